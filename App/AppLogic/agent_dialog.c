@@ -0,0 +1,199 @@
+// CKOS Agent Dialog Selection
+// Indexed candidate lookup, priority-weighted pick and the compressed text
+// decoder (see agent_dialog.h)
+
+#include "agent_dialog.h"
+#include <stddef.h>
+#include "agent_dialog_tables.h"
+
+// Section 4.2's generator; 0 would stick, so it reseeds
+static uint32_t xorshift32(uint32_t* state) {
+    uint32_t x = *state ? *state : 0x9E3779B9u;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state = x;
+    return x;
+}
+
+// =============================================================================
+// CANDIDATES
+// =============================================================================
+
+// Bitsets of the context's entries that each dimension's level admits, or
+// NULL if the context has no entries
+static const DialogContextIndex_t* lookup(const DialogIndex_t* index, DialogContext context,
+                                          const uint8_t mood[AGENT_MOOD_DIMENSION_COUNT],
+                                          const uint32_t* sets[AGENT_MOOD_DIMENSION_COUNT]) {
+    if (!index || !mood || (unsigned)context >= DIALOG_CONTEXT_COUNT) return NULL;
+
+    const DialogContextIndex_t* ctx = &index->contexts[context];
+    if (ctx->count == 0) return NULL;
+
+    for (int d = 0; d < AGENT_MOOD_DIMENSION_COUNT; d++) {
+        uint8_t level = (mood[d] < DIALOG_MOOD_LEVELS) ? mood[d] : DIALOG_MOOD_LEVELS - 1;
+        uint32_t bucket = index->bucket_base[d] + index->bucket_of[d][level];
+        sets[d] = index->bits + ctx->bits + bucket * ctx->words;
+    }
+    return ctx;
+}
+
+static uint32_t candidate_word(const uint32_t* sets[AGENT_MOOD_DIMENSION_COUNT], uint16_t word) {
+    return sets[0][word] & sets[1][word] & sets[2][word] & sets[3][word];
+}
+
+static const DialogEntry_t* context_entry(const DialogIndex_t* index, const DialogContextIndex_t* ctx,
+                                          uint32_t position) {
+    return &index->entries[index->ids[ctx->first + position]];
+}
+
+bool agent_dialog_matches(const DialogEntry_t* entry, DialogContext context,
+                          const uint8_t mood[AGENT_MOOD_DIMENSION_COUNT]) {
+    if (!entry || !mood || (unsigned)context >= DIALOG_CONTEXT_COUNT) return false;
+    if ((entry->context_flags & DIALOG_CONTEXT_FLAG(context)) == 0) return false;
+
+    for (int d = 0; d < AGENT_MOOD_DIMENSION_COUNT; d++) {
+        if (entry->min_mood[d] != DIALOG_MOOD_ANY && mood[d] < entry->min_mood[d]) return false;
+        if (entry->max_mood[d] != DIALOG_MOOD_ANY && mood[d] > entry->max_mood[d]) return false;
+    }
+    return true;
+}
+
+uint16_t agent_dialog_candidates(const DialogIndex_t* index, DialogContext context,
+                                 const uint8_t mood[AGENT_MOOD_DIMENSION_COUNT],
+                                 uint16_t* entries, uint16_t max) {
+    const uint32_t* sets[AGENT_MOOD_DIMENSION_COUNT];
+    const DialogContextIndex_t* ctx = lookup(index, context, mood, sets);
+    if (!ctx) return 0;
+
+    uint16_t count = 0;
+    for (uint16_t w = 0; w < ctx->words; w++) {
+        uint32_t word = candidate_word(sets, w);
+        while (word) {
+            uint32_t position = w * 32u + (uint32_t)__builtin_ctz(word);
+            word &= word - 1;
+            if (entries && count < max) {
+                entries[count] = index->ids[ctx->first + position];
+            }
+            count++;
+        }
+    }
+    return count;
+}
+
+// =============================================================================
+// SELECTION
+// =============================================================================
+
+const DialogEntry_t* agent_dialog_select(const DialogIndex_t* index, DialogContext context,
+                                         const uint8_t mood[AGENT_MOOD_DIMENSION_COUNT],
+                                         uint32_t* rng_state) {
+    const uint32_t* sets[AGENT_MOOD_DIMENSION_COUNT];
+    const DialogContextIndex_t* ctx = lookup(index, context, mood, sets);
+    if (!ctx || !rng_state) return NULL;
+
+    // Draw by priority over the whole context and keep the draw if it is a
+    // candidate: among candidates that is still proportional to priority
+    const uint32_t* prefix = index->prefix + ctx->first;
+    for (int draw = 0; draw < DIALOG_SELECT_DRAWS; draw++) {
+        uint32_t r = xorshift32(rng_state) % prefix[ctx->count - 1];
+        uint32_t lo = 0;
+        uint32_t hi = ctx->count - 1u;
+        while (lo < hi) {   // First running sum above r
+            uint32_t mid = (lo + hi) / 2;
+            if (prefix[mid] > r) hi = mid;
+            else lo = mid + 1;
+        }
+        if (sets[0][lo / 32] & sets[1][lo / 32] & sets[2][lo / 32] & sets[3][lo / 32] & (1u << (lo % 32))) {
+            return context_entry(index, ctx, lo);
+        }
+    }
+
+    // Few candidates by weight: add theirs up and draw against that
+    uint32_t total = 0;
+    for (uint16_t w = 0; w < ctx->words; w++) {
+        uint32_t word = candidate_word(sets, w);
+        while (word) {
+            total += context_entry(index, ctx, w * 32u + (uint32_t)__builtin_ctz(word))->priority;
+            word &= word - 1;
+        }
+    }
+    if (total == 0) return NULL;
+
+    uint32_t r = xorshift32(rng_state) % total;
+    for (uint16_t w = 0; w < ctx->words; w++) {
+        uint32_t word = candidate_word(sets, w);
+        while (word) {
+            const DialogEntry_t* entry = context_entry(index, ctx, w * 32u + (uint32_t)__builtin_ctz(word));
+            if (r < entry->priority) return entry;
+            r -= entry->priority;
+            word &= word - 1;
+        }
+    }
+    return NULL;
+}
+
+const DialogIndex_t* agent_dialog_index(uint8_t agent) {
+    return (agent < AGENT_DIALOG_TABLES_COUNT) ? agent_dialog_tables[agent] : NULL;
+}
+
+// =============================================================================
+// DIALOG TEXT
+// =============================================================================
+
+#define TEXT_END    0       // Symbol after each string
+
+// One canonical Huffman symbol from the bit at *position on: a code of each
+// length is a count past the first code of that length
+static int decode_symbol(uint32_t* position) {
+    uint32_t code = 0;
+    uint32_t first = 0;
+    uint32_t index = 0;
+    for (int length = 1; length <= DIALOG_TEXT_CODE_BITS; length++) {
+        uint32_t bit = *position;
+        code |= (agent_dialog_text[bit >> 3] >> (7 - (bit & 7))) & 1u;
+        (*position)++;
+
+        uint32_t count = agent_dialog_code_count[length];
+        if (code - first < count) {
+            return agent_dialog_code_symbol[index + code - first];
+        }
+        index += count;
+        first = (first + count) << 1;
+        code <<= 1;
+    }
+    return -1;      // Not a code: corrupt tables
+}
+
+static int text_next(DisplayTextSource* source) {
+    uint32_t position = source->position;
+    int symbol = decode_symbol(&position);
+    if (symbol <= TEXT_END) return -1;      // Stays at the end
+    source->position = position;
+    return symbol;
+}
+
+DialogText agent_dialog_option_text(DialogOption option) {
+    return ((unsigned)option < DIALOG_OPTION_COUNT) ? agent_dialog_options[option] : 0;
+}
+
+void agent_dialog_text_source(DialogText text, DisplayTextSource* source) {
+    if (!source) return;
+    source->next = text_next;
+    source->data = NULL;
+    source->position = text;
+}
+
+uint16_t agent_dialog_text_copy(DialogText text, char* buffer, uint16_t size) {
+    DisplayTextSource source;
+    agent_dialog_text_source(text, &source);
+
+    uint16_t length = 0;
+    int c;
+    while ((c = text_next(&source)) >= 0) {
+        if (buffer && length + 1u < size) buffer[length] = (char)c;
+        length++;
+    }
+    if (buffer && size > 0) buffer[(length < size) ? length : size - 1u] = '\0';
+    return length;
+}
@@ -0,0 +1,170 @@
+#ifndef AGENT_DIALOG_H
+#define AGENT_DIALOG_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "agent_mood.h"
+#include "../Display/display_api.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Agent dialog selection (Agent_System_Design.txt sections 4.1 and 4.2)
+// over index tables built ahead of time by Tools/Scripts/gen_dialog_tables.py
+// from Assets_Src/Dialogs/dialogs.txt.
+//
+// For every agent and context the generator lists the context's entries,
+// their priorities as running sums, and for each mood dimension a bitset of
+// those entries per mood bucket (the stretches of 0-100 over which no
+// entry's range starts or ends). An entry is a candidate if its bit is set
+// in the bucket of all four current levels: four table lookups and an AND,
+// however many entries the corpus holds.
+//
+// The weighted pick draws against the context's running sums and keeps the
+// draw if it is a candidate. A few failed draws fall back to summing the
+// candidates' priorities word by word. Either way an entry is picked with
+// probability proportional to its priority among the candidates, as the
+// linear filter of section 4.2 would pick it.
+//
+// Entry and option text is Huffman coded over the whole corpus, each string
+// stored once however many agents use it. A DialogText is where a string's
+// code starts; it is read a character at a time straight into the layout
+// and glyph drawing (ui_draw_wrapped_text()), never whole into RAM.
+
+// =============================================================================
+// CONFIGURATION
+// =============================================================================
+
+#define DIALOG_MOOD_ANY             255     // Range bound that always matches
+#define DIALOG_MOOD_LEVELS          101     // Whole points 0-100
+#define DIALOG_SELECT_DRAWS         8       // Draws before the exact fallback
+
+// Contexts an entry can answer; the generator reads this list
+#define DIALOG_CONTEXT_LIST(X) \
+    X(GREETING) \
+    X(BEG_LESS_TIME) \
+    X(ASK_MORE_TIME) \
+    X(BEG_EARLY_UNLOCK) \
+    X(BEG_BREAK) \
+    X(ASK_GAME) \
+    X(NEGOTIATION) \
+    X(PROACTIVE_OFFER) \
+    X(PATIENCE_WARNING) \
+    X(TRUST_MILESTONE) \
+    X(COOLDOWN) \
+    X(CONDITION_RESPONSE)
+
+typedef enum {
+#define DIALOG_CONTEXT_ENUM(name) DIALOG_CTX_##name,
+    DIALOG_CONTEXT_LIST(DIALOG_CONTEXT_ENUM)
+#undef DIALOG_CONTEXT_ENUM
+    DIALOG_CONTEXT_COUNT
+} DialogContext;
+
+#define DIALOG_CONTEXT_FLAG(context)    ((uint16_t)(1u << (context)))
+
+// Option text that changes with mood and history (section 5.8.2); the
+// generator reads this list and the corpus gives each its text
+#define DIALOG_OPTION_LIST(X) \
+    X(ASK_SWEETLY_LESS_TIME) \
+    X(CAREFUL_LESS_TIME) \
+    X(POLITE_LESS_TIME) \
+    X(BEG_ANY_REDUCTION) \
+    X(SUGGEST_PLAYING) \
+    X(CHALLENGE_GAME) \
+    X(ASK_GAME) \
+    X(BREAK_AGAIN) \
+    X(PERSONAL_TIME) \
+    X(HYGIENE_BREAK) \
+    X(ASK_WHEN_LATER) \
+    X(ACCEPT_CONDITIONS) \
+    X(NEGOTIATE_CONDITIONS) \
+    X(EXPLORE_MILESTONE)
+
+typedef enum {
+#define DIALOG_OPTION_ENUM(name) DIALOG_OPTION_##name,
+    DIALOG_OPTION_LIST(DIALOG_OPTION_ENUM)
+#undef DIALOG_OPTION_ENUM
+    DIALOG_OPTION_COUNT
+} DialogOption;
+
+#define DIALOG_TEXT_CODE_BITS       15      // Longest Huffman code
+
+// =============================================================================
+// TYPES
+// =============================================================================
+
+// Bit offset of a string in the compressed text
+typedef uint32_t DialogText;
+
+// Section 4.1's entry; mood bounds in AgentMoodDimension order, inclusive
+typedef struct {
+    uint16_t dialog_id;
+    uint8_t min_mood[AGENT_MOOD_DIMENSION_COUNT];
+    uint8_t max_mood[AGENT_MOOD_DIMENSION_COUNT];
+    uint16_t context_flags;         // DIALOG_CONTEXT_FLAG() bits
+    uint8_t priority;               // Weight, never 0
+    DialogText text;
+} DialogEntry_t;
+
+typedef struct {
+    uint16_t first;                 // Into the agent's ids and prefix sums
+    uint16_t count;
+    uint16_t words;                 // Per bitset
+    uint32_t bits;                  // Offset of the context's bitsets
+} DialogContextIndex_t;
+
+typedef struct {
+    const DialogEntry_t* entries;
+    uint16_t entry_count;
+    const uint16_t* ids;            // Entries of each context
+    const uint32_t* prefix;         // Running priority sums, per context
+    const DialogContextIndex_t* contexts;           // [DIALOG_CONTEXT_COUNT]
+    const uint8_t (*bucket_of)[DIALOG_MOOD_LEVELS];  // [dimension][level]
+    uint16_t bucket_base[AGENT_MOOD_DIMENSION_COUNT];
+    const uint32_t* bits;           // [context][dimension bucket][word]
+} DialogIndex_t;
+
+// =============================================================================
+// AGENT DIALOG API
+// =============================================================================
+
+// The generated tables for an agent (AgentPersonality), or NULL
+const DialogIndex_t* agent_dialog_index(uint8_t agent);
+
+// Whether an entry's mood ranges admit the levels (whole points), and its
+// contexts include context: section 4.2's filter for one entry
+bool agent_dialog_matches(const DialogEntry_t* entry, DialogContext context,
+                          const uint8_t mood[AGENT_MOOD_DIMENSION_COUNT]);
+
+// Candidates for the context at the mood levels, in index order. Writes up
+// to max entry numbers (into index->entries) and returns how many match.
+uint16_t agent_dialog_candidates(const DialogIndex_t* index, DialogContext context,
+                                 const uint8_t mood[AGENT_MOOD_DIMENSION_COUNT],
+                                 uint16_t* entries, uint16_t max);
+
+// Picks a candidate weighted by priority, or NULL if none matches.
+// rng_state is the caller's xorshift32 state, never 0.
+const DialogEntry_t* agent_dialog_select(const DialogIndex_t* index, DialogContext context,
+                                         const uint8_t mood[AGENT_MOOD_DIMENSION_COUNT],
+                                         uint32_t* rng_state);
+
+// =============================================================================
+// DIALOG TEXT
+// =============================================================================
+
+DialogText agent_dialog_option_text(DialogOption option);
+
+// Sets up source to decode text as it is read
+void agent_dialog_text_source(DialogText text, DisplayTextSource* source);
+
+// Decodes text into buffer, cut short to fit and always terminated, for
+// formatting (section 4.3). Returns the full length.
+uint16_t agent_dialog_text_copy(DialogText text, char* buffer, uint16_t size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // AGENT_DIALOG_H
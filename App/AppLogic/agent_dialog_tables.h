@@ -0,0 +1,710 @@
+// CKOS Agent Dialog Tables
+// Generated by Tools/Scripts/gen_dialog_tables.py - do not edit
+// Source: Assets_Src/Dialogs/dialogs.txt
+// Included by agent_dialog.c after agent_dialog.h
+
+#ifndef AGENT_DIALOG_TABLES_H
+#define AGENT_DIALOG_TABLES_H
+
+// rookie: 36 entries, 2168 bytes of index, text 2107 bytes as C strings, 1232 compressed (58.5%)
+static const DialogEntry_t rookie_entries[36] = {
+    { 1, {  70,   0, 255, 255 }, { 100,  40, 255, 255 }, 0x0001, 10, 0 },    // Hey there! Ready for another great locked session?
+    { 2, { 255, 255, 255, 255 }, { 255, 255, 255, 255 }, 0x0001, 4, 235 },    // Hi! Good to see you.
+    { 3, {  60, 255,   0, 255 }, { 100, 255,  30, 255 }, 0x0101, 12, 336 },    // I love you, but please, give me a moment?
+    { 4, { 255, 255, 255,  70 }, { 255, 255, 255, 100 }, 0x0001, 8, 532 },    // I believe in you! You've always kept your word with me.
+    { 5, { 255, 255, 255,  95 }, { 255, 255, 255, 100 }, 0x0201, 20, 792 },    // You've earned my complete trust. What do you need?
+    { 6, {  60,   0,  40, 255 }, { 100,  50, 100, 255 }, 0x0002, 8, 1024 },    // Okay, just this once! I'll take off 30 minutes. You're doing great!
+    { 7, { 255, 255, 255, 255 }, { 255, 255, 255, 255 }, 0x0002, 6, 1366 },    // I know it's tough, but you can do this! Stay strong!
+    { 8, {  50, 255,  50, 255 }, { 100, 255, 100, 255 }, 0x0002, 6, 1619 },    // Well, since you asked so nicely... I'll take off 20 minutes!
+    { 9, { 255, 255,  30, 255 }, { 255, 255, 100, 255 }, 0x0002, 5, 1917 },    // I appreciate you being polite, but I think you need this time.
+    { 10, { 255, 255,  40,  50 }, { 255, 255, 100, 100 }, 0x0002, 5, 2196 },    // Your reasoning is actually quite good. Okay, 10 minutes off.
+    { 11, { 255, 255, 255, 255 }, { 255, 255, 255, 255 }, 0x0002, 5, 2494 },    // I can see you really want this, but trust the process.
+    { 12, { 255, 255,   0, 255 }, { 255, 255,  30, 255 }, 0x0102, 10, 2737 },    // Hey, hey... breathe. I know it's hard, but please don't panic.
+    { 13, { 255, 255, 255, 255 }, { 255, 255, 255, 255 }, 0x0004, 10, 3033 },    // Wow! I'm so proud of you! Adding an hour. You're amazing!
+    { 14, { 255, 255, 255,  80 }, { 255, 255, 255, 100 }, 0x0004, 15, 3325 },    // Your commitment continues to impress me. How much time would you like?
+    { 15, { 255, 255, 255, 255 }, { 255, 255, 255, 255 }, 0x0008, 10, 3653 },    // I really wish I could, but that defeats the whole purpose!
+    { 16, {  60, 255, 255,  80 }, { 100, 255, 255, 100 }, 0x0008, 20, 3924 },    // You know what? I trust you. If you really need this, I'll help.
+    { 17, { 255, 255, 255,   0 }, { 255, 255, 255,  30 }, 0x0008, 18, 4224 },    // Why should I believe you? You haven't earned my trust yet.
+    { 18, { 255, 255, 255,  81 }, { 255, 255, 255, 100 }, 0x0008, 12, 4495 },    // This is highly irregular... but I trust you. Unlocking now.
+    { 19, { 255, 255, 255,  86 }, { 255, 255, 255, 100 }, 0x0008, 15, 4782 },    // You know what? I trust you completely. If you truly need out, I believe you. Unlocking now.
+    { 20, { 255, 255, 255, 255 }, { 255, 255, 255, 255 }, 0x0010, 10, 5213 },    // Of course! Take 10 minutes. I'll be waiting right here!
+    { 21, { 255, 255,   0, 255 }, { 255, 255,  40, 255 }, 0x0410, 8, 5492 },    // You just had a break. You'll have to wait.
+    { 22, { 255, 255, 255, 255 }, { 255, 255, 255, 255 }, 0x0020, 10, 5696 },    // Yay! I love playing games with you! Let's have fun!
+    { 23, { 255, 255, 255,  75 }, { 255, 255, 255, 100 }, 0x0020, 12, 5951 },    // You've earned a special challenge. Ready?
+    { 24, { 255, 255, 255,  61 }, { 255, 255, 255, 100 }, 0x0040, 10, 6148 },    // Let's talk this through. What's your reasoning, and what can we work out?
+    { 25, {  70, 255, 255, 255 }, { 100, 255, 255, 255 }, 0x0080, 10, 6494 },    // You're being so wonderful today! Would you like me to add an extra hour as a reward?
+    { 26, { 255, 255,   0, 255 }, { 255, 255,  30, 255 }, 0x0100, 10, 6881 },    // I'm feeling a bit overwhelmed right now. Could we keep things simple for a while?
+    { 27, { 255, 255, 255,  70 }, { 255, 255, 255,  89 }, 0x0200, 10, 7260 },    // We've built something really special here. I want to share something with you...
+    { 28, { 255, 255, 255,  90 }, { 255, 255, 255, 100 }, 0x0200, 10, 7622 },    // You've earned my complete trust. Welcome to the inner circle.
+    { 29, { 255, 255, 255, 255 }, { 255, 255, 255, 255 }, 0x0800, 10, 7899 },    // Let me see... if you can wait quietly for 30 minutes, I might reconsider.
+    { 30, { 255,  40, 255, 255 }, { 255, 100, 255, 255 }, 0x0800, 8, 8245 },    // Smart choice. I'm glad we understand each other.
+    { 31, {  40, 255, 255, 255 }, { 100, 255, 255, 255 }, 0x0800, 8, 8470 },    // Trying to change the terms already? That's... actually clever.
+    { 32, {  50, 255, 255,  60 }, { 100, 255, 255, 100 }, 0x0A00, 6, 8764 },    // We've come so far together. I have something special to show you...
+    { 33, { 255, 255,  50, 255 }, { 255, 255, 100, 255 }, 0x0400, 10, 9072 },    // You just asked that. Give it some time.
+    { 34, { 255, 255,  30, 255 }, { 255, 255,  60, 255 }, 0x0400, 10, 9258 },    // I said wait. Patience, please.
+    { 35, { 255, 255,   0, 255 }, { 255, 255,  30, 255 }, 0x0400, 12, 9401 },    // If you ask one more time, I'm done talking for a while.
+    { 36, { 255, 255,  60,  50 }, { 255, 255, 100, 100 }, 0x0401, 6, 9656 },    // That's better. What can I help you with?
+};
+
+static const uint16_t rookie_ids[42] = {
+    0, 1, 2, 3, 4, 35, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14,
+    15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 2, 11, 25, 4, 26, 27,
+    31, 20, 32, 33, 34, 35, 28, 29, 30, 31,
+};
+
+static const uint32_t rookie_prefix[42] = {
+    10, 14, 26, 34, 54, 60, 8, 14, 20, 25, 30, 35,
+    45, 10, 25, 10, 30, 48, 60, 75, 10, 18, 10, 22,
+    10, 10, 12, 22, 32, 20, 30, 40, 46, 8, 18, 28,
+    40, 46, 10, 18, 26, 32,
+};
+
+static const uint32_t rookie_bits[348] = {
+    0x0000003A, 0x0000003A, 0x0000003A, 0x0000003E, 0x0000003F, 0x0000003F,
+    0x0000003F, 0x0000003E, 0x0000003E, 0x0000001F, 0x0000001F, 0x0000001B,
+    0x0000001B, 0x0000001B, 0x0000001B, 0x0000003B, 0x0000003B, 0x00000007,
+    0x00000007, 0x00000027, 0x00000027, 0x00000027, 0x0000002F, 0x0000002F,
+    0x0000002F, 0x0000002F, 0x0000002F, 0x0000002F, 0x0000003F, 0x0000007A,
+    0x0000007A, 0x0000007E, 0x0000007F, 0x0000007F, 0x0000007F, 0x0000007F,
+    0x0000007F, 0x0000007E, 0x00000062, 0x0000006A, 0x0000002A, 0x0000003B,
+    0x0000003B, 0x0000003F, 0x0000003F, 0x0000003F, 0x0000006F, 0x0000006F,
+    0x0000007F, 0x0000007F, 0x0000007F, 0x0000007F, 0x0000007F, 0x0000007F,
+    0x0000007F, 0x0000007F, 0x0000007F, 0x0000007F, 0x00000003, 0x00000003,
+    0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003,
+    0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003,
+    0x00000003, 0x00000003, 0x00000003, 0x00000001, 0x00000001, 0x00000001,
+    0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000003, 0x00000003,
+    0x00000003, 0x00000003, 0x00000003, 0x0000001D, 0x0000001D, 0x0000001D,
+    0x0000001F, 0x0000001F, 0x0000001F, 0x0000001F, 0x0000001F, 0x0000001F,
+    0x0000001F, 0x0000001F, 0x0000001F, 0x0000001F, 0x0000001F, 0x0000001F,
+    0x0000001F, 0x0000001F, 0x00000005, 0x00000001, 0x00000001, 0x00000001,
+    0x00000001, 0x00000001, 0x00000001, 0x00000003, 0x0000000B, 0x0000001B,
+    0x0000001B, 0x0000001B, 0x00000003, 0x00000003, 0x00000003, 0x00000003,
+    0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003,
+    0x00000003, 0x00000003, 0x00000003, 0x00000001, 0x00000001, 0x00000001,
+    0x00000001, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003,
+    0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003,
+    0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003,
+    0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003,
+    0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003,
+    0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001,
+    0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003,
+    0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001,
+    0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001,
+    0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000001, 0x00000001, 0x00000001,
+    0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000001, 0x00000001, 0x00000001,
+    0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001,
+    0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001,
+    0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001,
+    0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000006, 0x00000006,
+    0x00000006, 0x00000007, 0x00000007, 0x00000007, 0x00000007, 0x00000007,
+    0x00000007, 0x00000007, 0x00000007, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000007, 0x00000007, 0x00000007,
+    0x00000007, 0x00000007, 0x00000007, 0x00000007, 0x00000007, 0x00000007,
+    0x00000007, 0x00000007, 0x00000007, 0x00000007, 0x00000007, 0x0000000F,
+    0x0000000F, 0x0000000F, 0x0000000F, 0x0000000F, 0x0000000F, 0x0000000F,
+    0x0000000F, 0x0000000F, 0x0000000F, 0x0000000F, 0x0000000F, 0x0000000F,
+    0x0000000F, 0x0000000F, 0x00000000, 0x00000000, 0x00000000, 0x00000008,
+    0x00000008, 0x0000000A, 0x0000000A, 0x0000000A, 0x0000000A, 0x0000000A,
+    0x0000000C, 0x0000000D, 0x0000001F, 0x0000001F, 0x0000001F, 0x0000001F,
+    0x0000001F, 0x0000001F, 0x0000001F, 0x0000001F, 0x0000001F, 0x00000009,
+    0x0000000D, 0x00000005, 0x00000005, 0x00000004, 0x00000006, 0x00000016,
+    0x00000012, 0x0000000F, 0x0000000F, 0x0000001F, 0x0000001F, 0x0000001F,
+    0x0000001F, 0x0000001F, 0x0000001F, 0x0000001F, 0x0000001F, 0x0000001F,
+    0x0000001F, 0x00000003, 0x00000007, 0x0000000F, 0x0000000F, 0x0000000F,
+    0x0000000D, 0x0000000F, 0x0000000F, 0x0000000F, 0x0000000F, 0x0000000F,
+    0x0000000F, 0x0000000F, 0x0000000F, 0x0000000F, 0x0000000F, 0x0000000F,
+    0x00000007, 0x00000007, 0x00000007, 0x0000000F, 0x0000000F, 0x0000000F,
+    0x0000000F, 0x0000000F, 0x0000000F, 0x0000000F, 0x0000000F, 0x0000000F,
+};
+
+static const uint8_t rookie_bucket_of[AGENT_MOOD_DIMENSION_COUNT][DIALOG_MOOD_LEVELS] = {
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+        3,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        6, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+        7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+        7,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6,
+        7, 8, 8, 8, 8, 8, 9, 9, 9, 9, 10, 10, 10, 10, 10, 11, 11, 11, 11, 11,
+        11,
+    },
+};
+
+static const DialogContextIndex_t rookie_contexts[DIALOG_CONTEXT_COUNT] = {
+    { 0, 6, 1, 0 },    // GREETING
+    { 6, 7, 1, 29 },    // BEG_LESS_TIME
+    { 13, 2, 1, 58 },    // ASK_MORE_TIME
+    { 15, 5, 1, 87 },    // BEG_EARLY_UNLOCK
+    { 20, 2, 1, 116 },    // BEG_BREAK
+    { 22, 2, 1, 145 },    // ASK_GAME
+    { 24, 1, 1, 174 },    // NEGOTIATION
+    { 25, 1, 1, 203 },    // PROACTIVE_OFFER
+    { 26, 3, 1, 232 },    // PATIENCE_WARNING
+    { 29, 4, 1, 261 },    // TRUST_MILESTONE
+    { 33, 5, 1, 290 },    // COOLDOWN
+    { 38, 4, 1, 319 },    // CONDITION_RESPONSE
+};
+
+static const DialogIndex_t rookie_dialogs = {
+    rookie_entries, 36, rookie_ids, rookie_prefix, rookie_contexts,
+    rookie_bucket_of, { 0, 5, 9, 17 }, rookie_bits,
+};
+
+// veteran: 33 entries, 2486 bytes of index, text 1810 bytes as C strings, 1045 compressed (57.7%)
+static const DialogEntry_t veteran_entries[33] = {
+    { 1, {  30,  30,  30,  30 }, {  70,  70,  70,  70 }, 0x0001, 10, 9851 },    // Let's see how you handle today's challenge.
+    { 2, { 255, 255, 255, 255 }, { 255, 255, 255, 255 }, 0x0001, 4, 10050 },    // You're back. Good.
+    { 3, { 255, 255, 255,   0 }, { 255, 255, 255,  30 }, 0x0003, 10, 10151 },    // You'll need to prove yourself before I consider that request.
+    { 4, { 255,  30, 255,  70 }, { 255,  70, 255, 100 }, 0x0001, 8, 10433 },    // I trust you, but we still need to follow some rules.
+    { 5, { 255, 255, 255,  95 }, { 255, 255, 255, 100 }, 0x0201, 20, 792 },    // You've earned my complete trust. What do you need?
+    { 6, {  50,   0,  40,  40 }, { 100,  60, 100, 100 }, 0x0002, 6, 10669 },    // Fine. 15 minutes off. Don't make me regret this.
+    { 7, { 255, 255, 255, 255 }, { 255, 255, 255, 255 }, 0x0002, 6, 10906 },    // Nice try, but we both know you need this time.
+    { 8, { 255, 255,  50, 255 }, { 255, 255, 100, 255 }, 0x0002, 5, 11118 },    // Your politeness is noted. 15 minutes removed.
+    { 9, {  60, 255,  30,  50 }, { 100, 255, 100, 100 }, 0x0002, 4, 11330 },    // Fine. Your passion is convincing. 5 minutes off.
+    { 10, { 255,  40, 255, 255 }, { 255, 100, 255, 255 }, 0x0002, 5, 11564 },    // Nice try, but begging won't change the fundamentals here.
+    { 11, { 255, 255,   0, 255 }, { 255, 255,  30, 255 }, 0x0102, 10, 11832 },    // This desperation isn't helping your case. Compose yourself.
+    { 12, { 255, 255, 255, 255 }, { 255, 255, 255, 255 }, 0x0004, 10, 12110 },    // Impressive dedication. One hour added. Keep it up.
+    { 13, { 255, 255, 255,  80 }, { 255, 255, 255, 100 }, 0x0004, 15, 3325 },    // Your commitment continues to impress me. How much time would you like?
+    { 14, { 255, 255, 255, 255 }, { 255, 255, 255, 255 }, 0x0008, 10, 12347 },    // Not happening. You knew what you signed up for.
+    { 15, { 255, 255, 255,  81 }, { 255, 255, 255, 100 }, 0x0008, 12, 4495 },    // This is highly irregular... but I trust you. Unlocking now.
+    { 16, { 255, 255, 255,  86 }, { 255, 255, 255, 100 }, 0x0008, 15, 4782 },    // You know what? I trust you completely. If you truly need out, I believe you. Unlocking now.
+    { 17, { 255, 255, 255, 255 }, { 255, 255, 255, 255 }, 0x0010, 10, 12570 },    // 5 minutes. Don't be late or there will be consequences.
+    { 18, { 255, 255,   0, 255 }, { 255, 255,  40, 255 }, 0x0410, 8, 5492 },    // You just had a break. You'll have to wait.
+    { 19, { 255, 255, 255, 255 }, { 255, 255, 255, 255 }, 0x0020, 10, 12825 },    // Alright, but I won't go easy on you.
+    { 20, { 255, 255, 255,  75 }, { 255, 255, 255, 100 }, 0x0020, 12, 5951 },    // You've earned a special challenge. Ready?
+    { 21, { 255, 255, 255,  61 }, { 255, 255, 255, 100 }, 0x0040, 10, 12999 },    // Alright, you've earned a seat at the negotiation table. Make your case.
+    { 22, {  70, 255, 255, 255 }, { 100, 255, 255, 255 }, 0x0080, 10, 13318 },    // Your dedication impresses me. I'm offering you a special bonus challenge.
+    { 23, { 255, 255,   0, 255 }, { 255, 255,  30, 255 }, 0x0100, 10, 13657 },    // My patience is running thin. I suggest giving me some space.
+    { 24, { 255, 255, 255,  70 }, { 255, 255, 255,  89 }, 0x0200, 10, 7260 },    // We've built something really special here. I want to share something with you...
+    { 25, { 255, 255, 255,  90 }, { 255, 255, 255, 100 }, 0x0200, 10, 7622 },    // You've earned my complete trust. Welcome to the inner circle.
+    { 26, { 255, 255, 255, 255 }, { 255, 255, 255, 255 }, 0x0800, 10, 7899 },    // Let me see... if you can wait quietly for 30 minutes, I might reconsider.
+    { 27, { 255,  40, 255, 255 }, { 255, 100, 255, 255 }, 0x0800, 8, 8245 },    // Smart choice. I'm glad we understand each other.
+    { 28, {  40, 255, 255, 255 }, { 100, 255, 255, 255 }, 0x0800, 8, 8470 },    // Trying to change the terms already? That's... actually clever.
+    { 29, {  50, 255, 255,  60 }, { 100, 255, 255, 100 }, 0x0A00, 6, 8764 },    // We've come so far together. I have something special to show you...
+    { 30, { 255, 255,  50, 255 }, { 255, 255, 100, 255 }, 0x0400, 10, 9072 },    // You just asked that. Give it some time.
+    { 31, { 255, 255,  30, 255 }, { 255, 255,  60, 255 }, 0x0400, 10, 9258 },    // I said wait. Patience, please.
+    { 32, { 255, 255,   0, 255 }, { 255, 255,  30, 255 }, 0x0400, 12, 9401 },    // If you ask one more time, I'm done talking for a while.
+    { 33, { 255, 255,  60,  50 }, { 255, 255, 100, 100 }, 0x0401, 6, 9656 },    // That's better. What can I help you with?
+};
+
+static const uint16_t veteran_ids[39] = {
+    0, 1, 2, 3, 4, 32, 2, 5, 6, 7, 8, 9, 10, 11, 12, 13,
+    14, 15, 16, 17, 18, 19, 20, 21, 10, 22, 4, 23, 24, 28, 17, 29,
+    30, 31, 32, 25, 26, 27, 28,
+};
+
+static const uint32_t veteran_prefix[39] = {
+    10, 14, 24, 32, 52, 58, 10, 16, 22, 27, 31, 36,
+    46, 10, 25, 10, 22, 37, 10, 18, 10, 22, 10, 10,
+    10, 20, 20, 30, 40, 46, 8, 18, 28, 40, 46, 10,
+    18, 26, 32,
+};
+
+static const uint32_t veteran_bits[432] = {
+    0x0000003E, 0x0000003F, 0x0000003F, 0x0000003F, 0x0000003F, 0x0000003F,
+    0x0000003E, 0x00000036, 0x0000003F, 0x0000003F, 0x0000003F, 0x00000036,
+    0x0000001E, 0x0000001F, 0x0000001F, 0x0000001F, 0x0000001F, 0x0000001F,
+    0x0000003F, 0x0000003F, 0x0000003E, 0x00000006, 0x00000007, 0x00000003,
+    0x00000003, 0x00000023, 0x00000023, 0x00000023, 0x0000002B, 0x0000002A,
+    0x0000002A, 0x0000002A, 0x0000002A, 0x0000002A, 0x0000002A, 0x0000003A,
+    0x0000006D, 0x0000006D, 0x0000006D, 0x0000006F, 0x0000007F, 0x0000007F,
+    0x0000007F, 0x0000005F, 0x0000005F, 0x0000007F, 0x0000007D, 0x0000007D,
+    0x00000065, 0x00000075, 0x00000035, 0x00000037, 0x00000037, 0x0000003F,
+    0x0000003F, 0x0000003F, 0x0000003F, 0x0000006D, 0x0000006D, 0x0000006C,
+    0x0000006E, 0x0000007E, 0x0000007E, 0x0000007E, 0x0000007E, 0x0000007E,
+    0x0000007E, 0x0000007E, 0x0000007E, 0x0000007E, 0x0000007E, 0x0000007E,
+    0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003,
+    0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003,
+    0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003,
+    0x00000003, 0x00000003, 0x00000003, 0x00000001, 0x00000001, 0x00000001,
+    0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001,
+    0x00000001, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003,
+    0x00000007, 0x00000007, 0x00000007, 0x00000007, 0x00000007, 0x00000007,
+    0x00000007, 0x00000007, 0x00000007, 0x00000007, 0x00000007, 0x00000007,
+    0x00000007, 0x00000007, 0x00000007, 0x00000007, 0x00000007, 0x00000007,
+    0x00000007, 0x00000007, 0x00000007, 0x00000001, 0x00000001, 0x00000001,
+    0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001,
+    0x00000001, 0x00000001, 0x00000003, 0x00000007, 0x00000007, 0x00000007,
+    0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003,
+    0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003,
+    0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000001, 0x00000001,
+    0x00000001, 0x00000001, 0x00000001, 0x00000003, 0x00000003, 0x00000003,
+    0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003,
+    0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003,
+    0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003,
+    0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003,
+    0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003,
+    0x00000003, 0x00000003, 0x00000003, 0x00000001, 0x00000001, 0x00000001,
+    0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001,
+    0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003,
+    0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001,
+    0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001,
+    0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001,
+    0x00000001, 0x00000001, 0x00000001, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000001, 0x00000001, 0x00000001,
+    0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000001,
+    0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001,
+    0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001,
+    0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001,
+    0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001,
+    0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001,
+    0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003,
+    0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003,
+    0x00000003, 0x00000003, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000003, 0x00000003, 0x00000003,
+    0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003,
+    0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003,
+    0x00000007, 0x00000007, 0x00000007, 0x0000000F, 0x0000000F, 0x0000000F,
+    0x0000000F, 0x0000000F, 0x0000000F, 0x0000000F, 0x0000000F, 0x0000000F,
+    0x0000000F, 0x0000000F, 0x0000000F, 0x0000000F, 0x0000000F, 0x0000000F,
+    0x0000000F, 0x0000000F, 0x0000000F, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000008, 0x00000008, 0x0000000A, 0x0000000A,
+    0x0000000A, 0x0000000A, 0x0000000A, 0x0000000A, 0x0000000C, 0x0000000D,
+    0x0000001F, 0x0000001F, 0x0000001F, 0x0000001F, 0x0000001F, 0x0000001F,
+    0x0000001F, 0x0000001F, 0x0000001F, 0x0000001F, 0x0000001F, 0x0000001F,
+    0x00000009, 0x0000000D, 0x00000005, 0x00000005, 0x00000004, 0x00000006,
+    0x00000016, 0x00000012, 0x00000012, 0x0000000F, 0x0000000F, 0x0000000F,
+    0x0000000F, 0x0000001F, 0x0000001F, 0x0000001F, 0x0000001F, 0x0000001F,
+    0x0000001F, 0x0000001F, 0x0000001F, 0x0000001F, 0x0000001F, 0x0000001F,
+    0x00000003, 0x00000003, 0x00000007, 0x0000000F, 0x0000000F, 0x0000000F,
+    0x0000000F, 0x0000000D, 0x0000000D, 0x0000000F, 0x0000000F, 0x0000000F,
+    0x0000000F, 0x0000000F, 0x0000000F, 0x0000000F, 0x0000000F, 0x0000000F,
+    0x0000000F, 0x0000000F, 0x0000000F, 0x00000007, 0x00000007, 0x00000007,
+    0x00000007, 0x00000007, 0x0000000F, 0x0000000F, 0x0000000F, 0x0000000F,
+    0x0000000F, 0x0000000F, 0x0000000F, 0x0000000F, 0x0000000F, 0x0000000F,
+};
+
+static const uint8_t veteran_bucket_of[AGENT_MOOD_DIMENSION_COUNT][DIALOG_MOOD_LEVELS] = {
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+        6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+        6,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        6, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+        8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+        8,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 8, 8, 8, 8, 9, 9, 9, 9, 9,
+        10, 11, 11, 11, 11, 11, 12, 12, 12, 12, 13, 13, 13, 13, 13, 14, 14, 14, 14, 14,
+        14,
+    },
+};
+
+static const DialogContextIndex_t veteran_contexts[DIALOG_CONTEXT_COUNT] = {
+    { 0, 6, 1, 0 },    // GREETING
+    { 6, 7, 1, 36 },    // BEG_LESS_TIME
+    { 13, 2, 1, 72 },    // ASK_MORE_TIME
+    { 15, 3, 1, 108 },    // BEG_EARLY_UNLOCK
+    { 18, 2, 1, 144 },    // BEG_BREAK
+    { 20, 2, 1, 180 },    // ASK_GAME
+    { 22, 1, 1, 216 },    // NEGOTIATION
+    { 23, 1, 1, 252 },    // PROACTIVE_OFFER
+    { 24, 2, 1, 288 },    // PATIENCE_WARNING
+    { 26, 4, 1, 324 },    // TRUST_MILESTONE
+    { 30, 5, 1, 360 },    // COOLDOWN
+    { 35, 4, 1, 396 },    // CONDITION_RESPONSE
+};
+
+static const DialogIndex_t veteran_dialogs = {
+    veteran_entries, 33, veteran_ids, veteran_prefix, veteran_contexts,
+    veteran_bucket_of, { 0, 7, 12, 21 }, veteran_bits,
+};
+
+// warden: 31 entries, 2150 bytes of index, text 1597 bytes as C strings, 927 compressed (58.0%)
+static const DialogEntry_t warden_entries[31] = {
+    { 1, {   0,  70, 255, 255 }, {  30, 100, 255, 255 }, 0x0001, 10, 13934 },    // Denied. Time remaining is fixed.
+    { 2, { 255, 255, 255, 255 }, { 255, 255, 255, 255 }, 0x0001, 4, 14091 },    // State your business.
+    { 3, { 255, 255,   0, 255 }, { 255, 255,  20, 255 }, 0x000B, 15, 14189 },    // No. Stop asking. Now.
+    { 4, { 255, 255, 255,   0 }, { 255, 255, 255,  15 }, 0x0009, 12, 14304 },    // I don't believe a word you're saying. Request denied.
+    { 5, { 255, 255, 255,  95 }, { 255, 255, 255, 100 }, 0x0201, 20, 792 },    // You've earned my complete trust. What do you need?
+    { 6, { 255, 255, 255, 255 }, { 255, 255, 255, 255 }, 0x0002, 8, 14551 },    // Absolutely not. The time was set for a reason.
+    { 7, { 255, 255,  30, 255 }, { 255, 255, 100, 255 }, 0x0002, 5, 14760 },    // Polite request acknowledged and denied.
+    { 8, { 255,  50, 255, 255 }, { 255, 100, 255, 255 }, 0x0002, 5, 14942 },    // Emotional appeals are irrelevant. Request denied.
+    { 9, { 255, 255,   0, 255 }, { 255, 255,  30, 255 }, 0x0102, 10, 15171 },    // This behavior is unacceptable. Further outbursts will be ignored.
+    { 10, { 255, 255, 255, 255 }, { 255, 255, 255, 255 }, 0x0004, 10, 15481 },    // Acceptable. Duration extended by one hour.
+    { 11, { 255, 255, 255,  80 }, { 255, 255, 255, 100 }, 0x0004, 15, 3325 },    // Your commitment continues to impress me. How much time would you like?
+    { 12, { 255, 255, 255, 255 }, { 255, 255, 255, 255 }, 0x0008, 10, 15683 },    // Request denied. No exceptions.
+    { 13, { 255, 255, 255,  81 }, { 255, 255, 255, 100 }, 0x0008, 12, 4495 },    // This is highly irregular... but I trust you. Unlocking now.
+    { 14, { 255, 255, 255,  86 }, { 255, 255, 255, 100 }, 0x0008, 15, 4782 },    // You know what? I trust you completely. If you truly need out, I believe you. Unlocking now.
+    { 15, { 255, 255, 255, 255 }, { 255, 255, 255, 255 }, 0x0010, 10, 15833 },    // 3 minutes. Starting now.
+    { 16, { 255, 255,   0, 255 }, { 255, 255,  40, 255 }, 0x0410, 8, 5492 },    // You just had a break. You'll have to wait.
+    { 17, { 255, 255, 255, 255 }, { 255, 255, 255, 255 }, 0x0020, 10, 15954 },    // Games are a distraction. Focus on your task.
+    { 18, { 255, 255, 255,  75 }, { 255, 255, 255, 100 }, 0x0020, 12, 5951 },    // You've earned a special challenge. Ready?
+    { 19, { 255, 255, 255,  61 }, { 255, 255, 255, 100 }, 0x0040, 10, 16161 },    // Your track record allows for discussion. Present your argument.
+    { 20, {  60, 255, 255, 255 }, { 100, 255, 255, 255 }, 0x0080, 10, 16459 },    // Acceptable performance warrants acknowledgment. Benefit authorized.
+    { 21, { 255, 255,   0, 255 }, { 255, 255,  30, 255 }, 0x0100, 10, 16784 },    // Patience levels critical. Interaction minimization recommended.
+    { 22, { 255, 255, 255,  70 }, { 255, 255, 255,  89 }, 0x0200, 10, 7260 },    // We've built something really special here. I want to share something with you...
+    { 23, { 255, 255, 255,  90 }, { 255, 255, 255, 100 }, 0x0200, 10, 7622 },    // You've earned my complete trust. Welcome to the inner circle.
+    { 24, { 255, 255, 255, 255 }, { 255, 255, 255, 255 }, 0x0800, 10, 7899 },    // Let me see... if you can wait quietly for 30 minutes, I might reconsider.
+    { 25, { 255,  40, 255, 255 }, { 255, 100, 255, 255 }, 0x0800, 8, 8245 },    // Smart choice. I'm glad we understand each other.
+    { 26, {  40, 255, 255, 255 }, { 100, 255, 255, 255 }, 0x0800, 8, 8470 },    // Trying to change the terms already? That's... actually clever.
+    { 27, {  50, 255, 255,  60 }, { 100, 255, 255, 100 }, 0x0A00, 6, 8764 },    // We've come so far together. I have something special to show you...
+    { 28, { 255, 255,  50, 255 }, { 255, 255, 100, 255 }, 0x0400, 10, 9072 },    // You just asked that. Give it some time.
+    { 29, { 255, 255,  30, 255 }, { 255, 255,  60, 255 }, 0x0400, 10, 9258 },    // I said wait. Patience, please.
+    { 30, { 255, 255,   0, 255 }, { 255, 255,  30, 255 }, 0x0400, 12, 9401 },    // If you ask one more time, I'm done talking for a while.
+    { 31, { 255, 255,  60,  50 }, { 255, 255, 100, 100 }, 0x0401, 6, 9656 },    // That's better. What can I help you with?
+};
+
+static const uint16_t warden_ids[39] = {
+    0, 1, 2, 3, 4, 30, 2, 5, 6, 7, 8, 9, 10, 2, 3, 11,
+    12, 13, 14, 15, 16, 17, 18, 19, 8, 20, 4, 21, 22, 26, 15, 27,
+    28, 29, 30, 23, 24, 25, 26,
+};
+
+static const uint32_t warden_prefix[39] = {
+    10, 14, 29, 41, 61, 67, 15, 23, 28, 33, 43, 10,
+    25, 15, 27, 37, 49, 64, 10, 18, 10, 22, 10, 10,
+    10, 20, 20, 30, 40, 46, 8, 18, 28, 40, 46, 10,
+    18, 26, 32,
+};
+
+static const uint32_t warden_bits[348] = {
+    0x0000003F, 0x0000003E, 0x0000003E, 0x0000003E, 0x0000003E, 0x0000003E,
+    0x0000003E, 0x0000003E, 0x0000003F, 0x0000001F, 0x0000001B, 0x0000001B,
+    0x0000001B, 0x0000001B, 0x0000001B, 0x0000003B, 0x0000003B, 0x0000000F,
+    0x00000007, 0x00000027, 0x00000027, 0x00000027, 0x00000027, 0x00000027,
+    0x00000027, 0x00000027, 0x00000027, 0x00000027, 0x00000037, 0x0000001F,
+    0x0000001F, 0x0000001F, 0x0000001F, 0x0000001F, 0x00000017, 0x00000017,
+    0x0000001F, 0x0000001F, 0x0000001B, 0x0000001A, 0x0000001E, 0x0000000E,
+    0x0000000E, 0x0000000E, 0x0000000E, 0x0000000E, 0x0000001F, 0x0000001F,
+    0x0000001F, 0x0000001F, 0x0000001F, 0x0000001F, 0x0000001F, 0x0000001F,
+    0x0000001F, 0x0000001F, 0x0000001F, 0x0000001F, 0x00000003, 0x00000003,
+    0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003,
+    0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003,
+    0x00000003, 0x00000003, 0x00000003, 0x00000001, 0x00000001, 0x00000001,
+    0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000003, 0x00000003,
+    0x00000003, 0x00000003, 0x00000003, 0x0000001F, 0x0000001F, 0x0000001F,
+    0x0000001F, 0x0000001F, 0x0000001F, 0x0000001F, 0x0000001F, 0x0000001F,
+    0x0000001F, 0x0000001E, 0x0000001E, 0x0000001E, 0x0000001E, 0x0000001E,
+    0x0000001E, 0x0000001E, 0x00000007, 0x00000005, 0x00000005, 0x00000005,
+    0x00000005, 0x00000005, 0x00000005, 0x00000005, 0x0000000D, 0x0000001D,
+    0x0000001D, 0x0000001D, 0x00000003, 0x00000003, 0x00000003, 0x00000003,
+    0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003,
+    0x00000003, 0x00000003, 0x00000003, 0x00000001, 0x00000001, 0x00000001,
+    0x00000001, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003,
+    0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003,
+    0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003,
+    0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003,
+    0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003,
+    0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001,
+    0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003,
+    0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001,
+    0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001,
+    0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000001, 0x00000001, 0x00000001,
+    0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000001, 0x00000001, 0x00000001,
+    0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001,
+    0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001,
+    0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001,
+    0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000003, 0x00000003,
+    0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003,
+    0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000003, 0x00000003, 0x00000003,
+    0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003,
+    0x00000003, 0x00000003, 0x00000003, 0x00000007, 0x00000007, 0x00000007,
+    0x0000000F, 0x0000000F, 0x0000000F, 0x0000000F, 0x0000000F, 0x0000000F,
+    0x0000000F, 0x0000000F, 0x0000000F, 0x0000000F, 0x0000000F, 0x0000000F,
+    0x0000000F, 0x0000000F, 0x00000000, 0x00000000, 0x00000000, 0x00000008,
+    0x00000008, 0x0000000A, 0x0000000A, 0x0000000A, 0x0000000A, 0x0000000A,
+    0x0000000C, 0x0000000D, 0x0000001F, 0x0000001F, 0x0000001F, 0x0000001F,
+    0x0000001F, 0x0000001F, 0x0000001F, 0x0000001F, 0x0000001F, 0x00000009,
+    0x00000009, 0x0000000D, 0x00000005, 0x00000004, 0x00000006, 0x00000016,
+    0x00000012, 0x0000000F, 0x0000000F, 0x0000001F, 0x0000001F, 0x0000001F,
+    0x0000001F, 0x0000001F, 0x0000001F, 0x0000001F, 0x0000001F, 0x0000001F,
+    0x0000001F, 0x00000003, 0x00000003, 0x00000007, 0x0000000F, 0x0000000F,
+    0x0000000D, 0x0000000F, 0x0000000F, 0x0000000F, 0x0000000F, 0x0000000F,
+    0x0000000F, 0x0000000F, 0x0000000F, 0x0000000F, 0x0000000F, 0x0000000F,
+    0x00000007, 0x00000007, 0x00000007, 0x0000000F, 0x0000000F, 0x0000000F,
+    0x0000000F, 0x0000000F, 0x0000000F, 0x0000000F, 0x0000000F, 0x0000000F,
+};
+
+static const uint8_t warden_bucket_of[AGENT_MOOD_DIMENSION_COUNT][DIALOG_MOOD_LEVELS] = {
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+        3,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+        3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        6, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+        7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+        7,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6,
+        7, 8, 8, 8, 8, 8, 9, 9, 9, 9, 10, 10, 10, 10, 10, 11, 11, 11, 11, 11,
+        11,
+    },
+};
+
+static const DialogContextIndex_t warden_contexts[DIALOG_CONTEXT_COUNT] = {
+    { 0, 6, 1, 0 },    // GREETING
+    { 6, 5, 1, 29 },    // BEG_LESS_TIME
+    { 11, 2, 1, 58 },    // ASK_MORE_TIME
+    { 13, 5, 1, 87 },    // BEG_EARLY_UNLOCK
+    { 18, 2, 1, 116 },    // BEG_BREAK
+    { 20, 2, 1, 145 },    // ASK_GAME
+    { 22, 1, 1, 174 },    // NEGOTIATION
+    { 23, 1, 1, 203 },    // PROACTIVE_OFFER
+    { 24, 2, 1, 232 },    // PATIENCE_WARNING
+    { 26, 4, 1, 261 },    // TRUST_MILESTONE
+    { 30, 5, 1, 290 },    // COOLDOWN
+    { 35, 4, 1, 319 },    // CONDITION_RESPONSE
+};
+
+static const DialogIndex_t warden_dialogs = {
+    warden_entries, 31, warden_ids, warden_prefix, warden_contexts,
+    warden_bucket_of, { 0, 5, 9, 17 }, warden_bits,
+};
+
+// Text: 82 distinct strings, 4021 bytes as C strings, 2342 compressed + 91 of code (60.5%),
+// canonical Huffman over 59 symbols
+static const uint16_t agent_dialog_code_count[DIALOG_TEXT_CODE_BITS + 1] = {
+    0, 0, 0, 2, 5, 8, 6, 6, 5, 5, 15, 5, 2, 0, 0, 0,
+};
+
+static const uint8_t agent_dialog_code_symbol[59] = {
+    32, 101, 97, 105, 110, 111, 116, 46, 100, 104, 108, 114, 115, 117, 121, 0,
+    99, 103, 109, 112, 119, 39, 73, 98, 102, 107, 118, 33, 44, 63, 65, 89,
+    78, 83, 84, 87, 113, 48, 49, 53, 67, 68, 70, 71, 72, 76, 79, 80,
+    82, 106, 120, 122, 51, 66, 69, 77, 85, 50, 75,
+};
+
+static const uint8_t agent_dialog_text[2342] = {
+    0xFD, 0x4E, 0x44, 0x50, 0xD8, 0xFA, 0x0F, 0xE4, 0xA4, 0xF2, 0x3B, 0xBD, 0x82, 0x33, 0xC5, 0x0D,
+    0x86, 0xD6, 0x29, 0x02, 0xAF, 0xAF, 0x83, 0x31, 0x73, 0x7B, 0xAB, 0xB7, 0xB6, 0x9F, 0xAA, 0xFA,
+    0x0F, 0xD1, 0xDE, 0x62, 0x1C, 0x5C, 0x91, 0x97, 0xC4, 0xB4, 0xEA, 0x2A, 0xFE, 0x48, 0xCB, 0xE3,
+    0xD4, 0x76, 0xC4, 0x0E, 0x2A, 0x52, 0xE7, 0xD4, 0x6C, 0xBE, 0x48, 0xDC, 0x84, 0x1B, 0xBE, 0xE5,
+    0xA3, 0xDB, 0x4E, 0xA3, 0xB1, 0xAA, 0x9F, 0x24, 0x2B, 0x0C, 0xBE, 0x3D, 0x07, 0xC3, 0xE3, 0xA7,
+    0x92, 0x12, 0xBC, 0xA6, 0x6E, 0x3C, 0x1E, 0x20, 0x65, 0xF1, 0x61, 0xCB, 0xDA, 0x63, 0x95, 0x8A,
+    0x0D, 0xCC, 0xB4, 0xF8, 0x7C, 0x74, 0xF2, 0x41, 0x4B, 0x31, 0x98, 0xDF, 0x23, 0x57, 0xDF, 0x8A,
+    0x98, 0x22, 0x2D, 0x8B, 0xC4, 0x87, 0xD6, 0x89, 0x02, 0x6E, 0x32, 0xF8, 0x0C, 0x4C, 0xFD, 0xB4,
+    0xFD, 0xFC, 0x26, 0x7D, 0x47, 0xF5, 0x8B, 0xC0, 0x8A, 0x2D, 0xC3, 0xB6, 0xA7, 0xD0, 0x75, 0xE9,
+    0x5A, 0x88, 0x4F, 0x04, 0x3F, 0x7E, 0xE3, 0xFD, 0x7D, 0xC3, 0x75, 0x6C, 0x41, 0xBC, 0x87, 0xC3,
+    0xE3, 0xA5, 0x88, 0x9B, 0xAB, 0x6C, 0x36, 0xB1, 0x48, 0xF4, 0xD3, 0xA8, 0xF0, 0xCF, 0xC8, 0x58,
+    0xE9, 0x71, 0x0F, 0x8D, 0xA9, 0xEA, 0x3B, 0x62, 0x06, 0x5F, 0x03, 0x54, 0x61, 0x37, 0x11, 0x45,
+    0xBF, 0xA0, 0xF9, 0xC2, 0x64, 0x5E, 0x2C, 0xED, 0xB7, 0xA6, 0x9F, 0x53, 0x5A, 0xFA, 0x8B, 0xAB,
+    0x6A, 0x46, 0x5F, 0x01, 0x2F, 0xE0, 0xCC, 0x5D, 0xC3, 0x2E, 0xA6, 0xB9, 0x94, 0xA4, 0x3A, 0xF4,
+    0xAD, 0x44, 0x27, 0x82, 0x1F, 0xBF, 0x71, 0xFF, 0xDF, 0x70, 0xDD, 0x5B, 0x10, 0x6F, 0xE9, 0xA7,
+    0x50, 0x9C, 0x71, 0x63, 0xAA, 0xA4, 0x11, 0x97, 0xC0, 0xEC, 0x55, 0xB6, 0x1C, 0x3D, 0x56, 0x0F,
+    0xA8, 0xED, 0x88, 0x1D, 0x44, 0x51, 0x5B, 0xC0, 0xCB, 0xE0, 0x31, 0x33, 0x11, 0x45, 0xB8, 0x85,
+    0xDC, 0xCB, 0x4F, 0x87, 0xC5, 0x85, 0x8A, 0x5D, 0xD9, 0x5B, 0x60, 0xB7, 0x09, 0xAC, 0x61, 0x2B,
+    0x5C, 0x8F, 0xB6, 0x16, 0x08, 0xD9, 0xDE, 0x72, 0x1F, 0xBF, 0x84, 0xCF, 0xA8, 0xFB, 0xFE, 0xE1,
+    0xBA, 0xB6, 0x20, 0xDC, 0x3F, 0x7E, 0xF2, 0xD3, 0xA8, 0xD5, 0x18, 0x5C, 0x91, 0x97, 0xC0, 0xB1,
+    0x4A, 0xD7, 0x23, 0x94, 0x68, 0x11, 0x45, 0xBF, 0xA8, 0xED, 0x88, 0x11, 0x6C, 0x5E, 0x04, 0x50,
+    0x8E, 0x2C, 0xFA, 0x9B, 0xDE, 0x5A, 0x7E, 0xA7, 0x3E, 0xA2, 0x87, 0x32, 0x94, 0x87, 0x6B, 0x14,
+    0x8A, 0x19, 0x0E, 0xA3, 0xC3, 0x3F, 0x21, 0x63, 0xA5, 0xC5, 0x12, 0xD3, 0xF5, 0x1D, 0xB1, 0x03,
+    0x8A, 0x94, 0xB9, 0x13, 0x76, 0xE9, 0x03, 0x84, 0x65, 0xD6, 0x5A, 0x7D, 0x5F, 0x9F, 0x41, 0xD7,
+    0xA6, 0xE2, 0xEE, 0x38, 0xB3, 0xE2, 0x61, 0xFB, 0x8C, 0xBE, 0x3D, 0x07, 0xBC, 0xE6, 0xAD, 0xB0,
+    0x46, 0x14, 0x7C, 0x5A, 0x43, 0xE1, 0xF1, 0xD2, 0xC4, 0x26, 0xE9, 0xFE, 0x2B, 0x6D, 0xE9, 0xA7,
+    0xC3, 0xE2, 0xC3, 0x57, 0xDF, 0x75, 0x8D, 0xCB, 0x40, 0xD5, 0xDA, 0x15, 0xB0, 0x6E, 0x21, 0xC2,
+    0xEF, 0xC5, 0x8D, 0xEE, 0x37, 0x32, 0x1F, 0xAB, 0xF2, 0x37, 0xC6, 0xB4, 0x10, 0xBB, 0x91, 0xCB,
+    0xE2, 0xB3, 0x19, 0x7C, 0x0A, 0xAF, 0x83, 0xED, 0xA7, 0x51, 0x62, 0x95, 0xAE, 0x47, 0x2B, 0x7A,
+    0x0E, 0xA3, 0x57, 0xC5, 0x67, 0xEA, 0x3B, 0x62, 0x04, 0x51, 0x20, 0x4C, 0xF7, 0x29, 0x17, 0x11,
+    0x42, 0x39, 0xA3, 0xD4, 0x8E, 0x31, 0x6E, 0x1E, 0xE7, 0xD3, 0x4F, 0x87, 0xC0, 0xF0, 0xCF, 0xC8,
+    0xE6, 0x89, 0x1E, 0xC3, 0xA8, 0x8B, 0x62, 0xF0, 0x32, 0xF8, 0x90, 0xEB, 0xDC, 0x65, 0xF0, 0x2C,
+    0x52, 0xB5, 0xC8, 0x62, 0x66, 0x22, 0x8B, 0x7F, 0x51, 0xD7, 0xA5, 0x6A, 0x28, 0x6B, 0xC4, 0xB4,
+    0xFA, 0xD3, 0x22, 0xF4, 0x7C, 0x56, 0x63, 0xA8, 0xEC, 0x6A, 0xA7, 0xC9, 0x19, 0x7C, 0x7B, 0x0F,
+    0x87, 0xC0, 0xA2, 0x79, 0x2D, 0xD2, 0x01, 0x4B, 0x31, 0x98, 0xDF, 0x22, 0x2D, 0x8B, 0xC0, 0xC9,
+    0x89, 0x69, 0xF4, 0xA2, 0xDC, 0x2D, 0xC5, 0x17, 0x6A, 0x57, 0x21, 0x6D, 0x63, 0xB6, 0x2A, 0x96,
+    0x94, 0xA4, 0x3B, 0x62, 0x07, 0x51, 0x16, 0xC5, 0xE0, 0x65, 0xF1, 0x21, 0xFF, 0x9A, 0xAF, 0xAF,
+    0x85, 0x6D, 0x83, 0x3F, 0x32, 0xD3, 0xE1, 0xF0, 0x3C, 0x33, 0xF2, 0x39, 0xA2, 0x47, 0xB0, 0xEA,
+    0x22, 0xD8, 0xBC, 0x0C, 0xBE, 0x06, 0xAF, 0xBF, 0x15, 0x30, 0x6B, 0x99, 0x0E, 0xBD, 0xC6, 0x5F,
+    0x02, 0x2D, 0x8A, 0xE4, 0x31, 0x33, 0x0F, 0x88, 0xF5, 0x1D, 0x47, 0x63, 0x55, 0x3E, 0x48, 0xCB,
+    0xE2, 0x43, 0xFF, 0x35, 0x5F, 0x5F, 0x0A, 0xDB, 0x06, 0x7E, 0x65, 0xA7, 0xEF, 0xDC, 0x6A, 0xF8,
+    0xB5, 0xCF, 0xA0, 0xFA, 0x27, 0x82, 0x3E, 0xFF, 0xB8, 0x6E, 0xAD, 0x88, 0x37, 0x90, 0xEB, 0xD2,
+    0xB5, 0x1D, 0x88, 0xE5, 0x16, 0x15, 0xB6, 0x16, 0x5D, 0xA9, 0x02, 0x86, 0xC7, 0xD3, 0x4F, 0x87,
+    0xC0, 0xFE, 0xB1, 0x78, 0x14, 0x49, 0x84, 0x1D, 0xAC, 0x53, 0xC4, 0x87, 0xC3, 0xE3, 0xA5, 0x6A,
+    0x28, 0x9E, 0x48, 0x87, 0x1C, 0xA2, 0xC4, 0xB4, 0xF8, 0x4C, 0xFA, 0x0E, 0xA2, 0xAF, 0xE4, 0x8E,
+    0x2A, 0x99, 0x56, 0xD8, 0x6C, 0x9B, 0x9B, 0x8E, 0x56, 0x28, 0x32, 0xF8, 0xF4, 0x1F, 0xB1, 0x8E,
+    0x97, 0x14, 0x4F, 0x24, 0x77, 0xC3, 0x7A, 0x69, 0xF0, 0xF8, 0xE9, 0xE4, 0x82, 0x96, 0x63, 0x30,
+    0x82, 0xFC, 0x1D, 0x55, 0x2A, 0x35, 0xA2, 0x56, 0xA5, 0xB6, 0x32, 0x1F, 0xC9, 0x49, 0xE7, 0xDB,
+    0x4F, 0xD8, 0xC7, 0x4B, 0x88, 0x4A, 0xF8, 0x11, 0x45, 0xB8, 0x8A, 0x59, 0xF1, 0xB5, 0x24, 0x3E,
+    0xB4, 0x48, 0xE9, 0x71, 0x97, 0xC5, 0x85, 0x8A, 0x5D, 0xD9, 0x5B, 0x6F, 0x50, 0x8D, 0x31, 0xCD,
+    0x12, 0x06, 0xA8, 0xC3, 0x92, 0x39, 0x7B, 0x78, 0x0F, 0x88, 0xF6, 0xD3, 0xE1, 0xF1, 0xD2, 0xC4,
+    0x76, 0x2A, 0xDB, 0x0B, 0xB8, 0xE5, 0xDA, 0x66, 0xDD, 0xF1, 0x51, 0x0F, 0x34, 0xCF, 0xA0, 0xFA,
+    0xBE, 0x2B, 0x31, 0x97, 0xC0, 0xAA, 0xF8, 0x23, 0x72, 0x21, 0xC2, 0x4E, 0x61, 0x18, 0x1F, 0xEE,
+    0x2C, 0x82, 0x8F, 0x8B, 0x04, 0xB8, 0x41, 0x63, 0xCA, 0x5A, 0x7E, 0xDA, 0x75, 0xE9, 0xB8, 0xEE,
+    0x4D, 0x55, 0xB6, 0x08, 0x3B, 0x2C, 0x07, 0xF2, 0x6D, 0xCD, 0x0D, 0x77, 0x33, 0x16, 0x5D, 0xA9,
+    0x01, 0x9F, 0x99, 0x0F, 0xC5, 0xF1, 0x59, 0x8E, 0x48, 0xF0, 0x4F, 0x02, 0x28, 0xAD, 0xB5, 0xC5,
+    0xD7, 0x7E, 0x2A, 0x47, 0x77, 0xB0, 0x41, 0xCD, 0x16, 0xA7, 0xDB, 0x4F, 0xA9, 0xE9, 0xE4, 0x8E,
+    0xD8, 0x5A, 0xC0, 0xBB, 0xEE, 0x62, 0x8A, 0xDB, 0x0B, 0x14, 0xAD, 0x72, 0x2F, 0xC1, 0xD5, 0x52,
+    0xA2, 0x86, 0xC6, 0x43, 0xA8, 0xE5, 0x1A, 0x04, 0x38, 0xBD, 0x12, 0xC4, 0x5D, 0xF7, 0x31, 0x45,
+    0x6D, 0x87, 0x2B, 0x14, 0x19, 0x7C, 0x4A, 0x52, 0xD3, 0xE1, 0xF1, 0xD3, 0xC9, 0x05, 0x2C, 0xC6,
+    0x63, 0x7C, 0x8D, 0x5F, 0x7E, 0x2A, 0x60, 0x88, 0xB6, 0x2F, 0x12, 0x1F, 0x53, 0x5D, 0x5F, 0x72,
+    0x21, 0xC4, 0x50, 0x85, 0x66, 0x36, 0x1A, 0xAD, 0xB5, 0xA9, 0x96, 0x9F, 0xB1, 0x81, 0xB9, 0x17,
+    0x26, 0x52, 0x90, 0x5E, 0xE3, 0x2F, 0x81, 0xAA, 0x30, 0xE5, 0x16, 0x07, 0xDB, 0x0A, 0x62, 0xB9,
+    0x1D, 0xDE, 0xC3, 0xFD, 0x7D, 0xC3, 0x75, 0x6C, 0x41, 0xBF, 0xA8, 0xEA, 0x37, 0x5D, 0xA9, 0x02,
+    0xC7, 0x57, 0x6B, 0xAC, 0xCD, 0xA5, 0xA7, 0xCF, 0x74, 0xB4, 0x0D, 0x68, 0xEB, 0xA9, 0x90, 0xEB,
+    0xD3, 0x71, 0xB5, 0x52, 0x63, 0x92, 0x30, 0xD3, 0x36, 0xBC, 0x23, 0x4C, 0x14, 0xD6, 0x81, 0xE2,
+    0x86, 0xD2, 0xD3, 0xE9, 0x6C, 0xAB, 0x6C, 0x21, 0xC6, 0xB4, 0x46, 0xD8, 0x88, 0xA1, 0x10, 0x6D,
+    0xBD, 0xC2, 0x56, 0xC5, 0x27, 0x9F, 0x61, 0xF4, 0xA2, 0x47, 0x4B, 0xCA, 0x52, 0x09, 0xAC, 0x61,
+    0x2B, 0x5C, 0x8D, 0x6A, 0x7C, 0x9B, 0x4B, 0x4F, 0xA9, 0xE9, 0xE4, 0x8D, 0x5F, 0x72, 0x2E, 0xE3,
+    0xBA, 0x58, 0x43, 0xEC, 0x62, 0x86, 0xD2, 0x1D, 0x45, 0x13, 0xC9, 0x17, 0x7D, 0xCC, 0x51, 0x5B,
+    0x61, 0x7E, 0x0E, 0xAA, 0x95, 0x10, 0xE2, 0xF4, 0x7E, 0x46, 0x5F, 0x12, 0x94, 0xB4, 0xF8, 0x7C,
+    0x0F, 0xEB, 0x17, 0x80, 0x97, 0xF0, 0x66, 0x22, 0x89, 0x12, 0x1F, 0xA2, 0xF9, 0x21, 0x60, 0x5D,
+    0xF7, 0x22, 0x17, 0x73, 0x2D, 0x3A, 0x8B, 0xA2, 0xCC, 0x72, 0x8B, 0x12, 0x1F, 0xC2, 0x42, 0x96,
+    0xD4, 0xFA, 0x8E, 0x2A, 0x52, 0xE6, 0x5A, 0x75, 0xEE, 0x32, 0xF8, 0x09, 0x7F, 0x01, 0xD8, 0x8D,
+    0xDE, 0xC4, 0x42, 0xEE, 0x7D, 0x47, 0x5E, 0x9B, 0x89, 0xBB, 0x11, 0x09, 0x5F, 0x0A, 0xDB, 0x0E,
+    0xEF, 0x60, 0x83, 0x9A, 0x2D, 0x4C, 0xB4, 0xFA, 0x51, 0x23, 0xA5, 0xC7, 0x63, 0x10, 0x6D, 0x21,
+    0xF5, 0xA2, 0x40, 0xD5, 0x18, 0x75, 0x14, 0x35, 0xE0, 0x65, 0xF0, 0x39, 0x58, 0xA7, 0xB6, 0x9F,
+    0xB1, 0x8E, 0x97, 0x17, 0x24, 0x51, 0xF9, 0x19, 0x7C, 0x0A, 0x23, 0x4E, 0xA4, 0x43, 0xCD, 0x33,
+    0xD2, 0xE3, 0x5A, 0x25, 0x6A, 0x5B, 0x63, 0x2D, 0x3E, 0x1F, 0x1D, 0x2C, 0x47, 0x64, 0xD7, 0xC4,
+    0x87, 0xE8, 0xEF, 0x39, 0x69, 0xF0, 0xF8, 0xE9, 0x5A, 0x86, 0x26, 0x62, 0x1C, 0x71, 0x67, 0xF2,
+    0x46, 0x5F, 0x16, 0xB9, 0xAF, 0x71, 0xD8, 0xF7, 0x7B, 0x11, 0xD4, 0x6A, 0xED, 0x75, 0x99, 0xB0,
+    0x8A, 0x24, 0x0B, 0x1F, 0xB6, 0x0D, 0xE2, 0x5A, 0x75, 0x11, 0x6C, 0x5E, 0x06, 0x5F, 0x1E, 0xA3,
+    0xB6, 0x20, 0x72, 0x45, 0xE1, 0x6B, 0x50, 0xC4, 0xCC, 0x43, 0x8E, 0xEF, 0x5A, 0xBF, 0x22, 0xEF,
+    0xB9, 0x16, 0xC5, 0x4D, 0xE5, 0xA7, 0xE6, 0xAC, 0x64, 0x3E, 0xFF, 0xC0, 0x6E, 0xAD, 0x88, 0x37,
+    0x0F, 0xDF, 0xBC, 0x87, 0xE4, 0xED, 0xD2, 0x06, 0xE9, 0xE0, 0x8D, 0xC8, 0xB1, 0xDA, 0xC6, 0x04,
+    0x51, 0x6F, 0x2D, 0x3E, 0x4B, 0xA9, 0x11, 0x6C, 0xFA, 0x8E, 0xD8, 0x81, 0xC9, 0x1D, 0x9E, 0x28,
+    0x3C, 0x33, 0xF2, 0x32, 0xF8, 0x0C, 0x4C, 0xC4, 0x51, 0x6E, 0x21, 0x77, 0x32, 0xD3, 0xE1, 0xF1,
+    0x61, 0xC3, 0xD5, 0x60, 0xB1, 0xBD, 0xC2, 0xDC, 0x33, 0xC1, 0x9C, 0x87, 0xDF, 0xF8, 0x0D, 0xD5,
+    0xB1, 0x06, 0xE2, 0xC7, 0x77, 0xF2, 0x67, 0x2D, 0x3F, 0x35, 0x63, 0x21, 0xF0, 0xF8, 0xB0, 0xE1,
+    0x2F, 0x75, 0x76, 0x0B, 0x71, 0xAB, 0xB7, 0x95, 0x6D, 0x55, 0xB6, 0x90, 0xFC, 0x06, 0xEA, 0xD8,
+    0x83, 0x70, 0xFD, 0xFB, 0xCB, 0x4F, 0x92, 0xEA, 0x44, 0x5B, 0x3E, 0xA3, 0xB6, 0x20, 0x76, 0x3B,
+    0x6C, 0xAD, 0xB0, 0xE5, 0xDB, 0xA4, 0x0D, 0x68, 0x8D, 0xB1, 0x11, 0x42, 0x3B, 0xE1, 0xA6, 0x9B,
+    0x96, 0x84, 0xAD, 0xC5, 0x0D, 0x8C, 0xB4, 0xFA, 0x51, 0x6E, 0x26, 0x6F, 0xC1, 0xB2, 0x42, 0xBB,
+    0x05, 0xBB, 0x74, 0x81, 0x43, 0x5E, 0x15, 0xB6, 0x19, 0x7C, 0x58, 0x6A, 0x97, 0x32, 0x1F, 0x8B,
+    0xEF, 0xC3, 0xDC, 0x8C, 0xBE, 0x2D, 0x73, 0x5E, 0xF2, 0xD3, 0xAE, 0xFC, 0x58, 0xDE, 0xEB, 0xE4,
+    0x89, 0x99, 0xAE, 0xA9, 0x0A, 0xED, 0x21, 0xFB, 0xB1, 0x14, 0x7C, 0x58, 0x24, 0xE6, 0x67, 0x21,
+    0xFF, 0xE4, 0xF0, 0x16, 0x06, 0x38, 0x96, 0x9F, 0x27, 0x81, 0x44, 0xE3, 0x82, 0xCA, 0xDB, 0x48,
+    0x7C, 0x3E, 0x07, 0x86, 0x3C, 0x8E, 0x68, 0x90, 0x32, 0xF8, 0x17, 0x5D, 0x98, 0xCC, 0x63, 0x81,
+    0xDD, 0xED, 0x2D, 0x3F, 0x01, 0xBA, 0xB6, 0x20, 0xDE, 0x43, 0xF2, 0x76, 0xE9, 0x03, 0xB1, 0x15,
+    0x48, 0x21, 0xEC, 0x22, 0x86, 0xC4, 0x72, 0xB5, 0xA8, 0xEC, 0x46, 0xAE, 0xD7, 0x3F, 0x6C, 0x16,
+    0xD4, 0xDE, 0x5A, 0x7B, 0xD6, 0xCB, 0xB5, 0x23, 0xD4, 0x76, 0xC4, 0x0E, 0xA3, 0x97, 0x6E, 0x90,
+    0x36, 0x70, 0x52, 0xF9, 0x0E, 0xC3, 0x2F, 0x89, 0x69, 0xEF, 0x5B, 0x2E, 0xD4, 0x8F, 0x51, 0x97,
+    0xC7, 0x4F, 0x24, 0x14, 0xB3, 0x19, 0x84, 0x17, 0x29, 0x01, 0x20, 0x45, 0x08, 0x63, 0xB3, 0xC2,
+    0xA4, 0x2B, 0xB0, 0x84, 0xED, 0x53, 0x21, 0xFF, 0x53, 0xC1, 0x19, 0x7C, 0x58, 0x6A, 0x97, 0x32,
+    0xD3, 0xE1, 0xF1, 0x61, 0x33, 0x35, 0xD5, 0x21, 0x5D, 0x82, 0xEF, 0xC5, 0x8D, 0xEE, 0x6E, 0x37,
+    0x32, 0x1D, 0x7A, 0x6E, 0x1F, 0xBF, 0x73, 0x65, 0x6D, 0x86, 0x5F, 0x01, 0x05, 0xF8, 0x3A, 0xAA,
+    0x54, 0x76, 0x76, 0xC5, 0xC6, 0xB4, 0x4A, 0xD4, 0xB6, 0xC6, 0x5A, 0x7F, 0xDC, 0x8E, 0x12, 0x14,
+    0xB6, 0xA4, 0x2D, 0xC5, 0xB0, 0xCC, 0xAD, 0xB0, 0x8A, 0x2B, 0x48, 0x75, 0x17, 0xC6, 0xDB, 0x1B,
+    0xC0, 0xD9, 0x7C, 0xAB, 0x6C, 0x37, 0x22, 0xEF, 0xB9, 0x17, 0xE1, 0x35, 0x32, 0xD3, 0xF2, 0x2C,
+    0xA6, 0x72, 0x1F, 0x45, 0xDC, 0x8B, 0x1D, 0xD1, 0x59, 0x5B, 0x60, 0xB7, 0x1D, 0xD7, 0xFB, 0x33,
+    0x96, 0x9F, 0x38, 0x48, 0x23, 0x2F, 0x8B, 0x0E, 0xD8, 0xBA, 0xB1, 0xBD, 0xE5, 0xA7, 0xC9, 0xE4,
+    0x3E, 0x70, 0xFC, 0x04, 0xBF, 0x85, 0x6D, 0xA4, 0x3E, 0x4F, 0xCC, 0xB4, 0xEA, 0x26, 0xED, 0xD2,
+    0x07, 0x63, 0x55, 0x3E, 0x48, 0x41, 0xCB, 0xDA, 0x63, 0x2F, 0x8E, 0x96, 0x22, 0xE9, 0x95, 0x6D,
+    0xA4, 0x3F, 0x93, 0xF6, 0xC1, 0xBC, 0x09, 0x96, 0x53, 0x39, 0x69, 0xEF, 0xDA, 0xEF, 0x5C, 0x41,
+    0xAE, 0x43, 0x3C, 0x48, 0x7D, 0x28, 0x44, 0x2E, 0xE4, 0x72, 0x97, 0x17, 0x30, 0x3B, 0xBD, 0x82,
+    0x0B, 0x14, 0xBB, 0xB4, 0xB4, 0xFE, 0x1E, 0xAB, 0x04, 0x58, 0xFD, 0xB0, 0x6F, 0x01, 0x35, 0xF0,
+    0xCF, 0xCD, 0x4C, 0xF6, 0x33, 0x08, 0xD3, 0x13, 0x2C, 0xA6, 0x72, 0xD3, 0xFE, 0x6E, 0xF0, 0xAE,
+    0xC9, 0x50, 0x9C, 0x70, 0x52, 0xB7, 0x09, 0x62, 0x16, 0xD6, 0x35, 0x3E, 0x51, 0xA2, 0x43, 0xF9,
+    0x3F, 0x6C, 0x1B, 0xC0, 0x99, 0x65, 0x33, 0x96, 0x9F, 0x4A, 0x2D, 0xC7, 0x63, 0x44, 0xF2, 0xAF,
+    0x60, 0xB7, 0x18, 0x64, 0xD7, 0x53, 0xC4, 0x27, 0x6A, 0x99, 0x0F, 0xCF, 0x16, 0x8A, 0x1B, 0x07,
+    0xC4, 0x76, 0xC5, 0xAF, 0x17, 0x1C, 0xAD, 0x6A, 0x3B, 0x10, 0xBB, 0x33, 0xD8, 0xCE, 0x5A, 0x7B,
+    0xEB, 0xA9, 0xE2, 0x13, 0xB5, 0x4C, 0x87, 0xE5, 0x8B, 0x24, 0x2B, 0xB0, 0x3F, 0xDC, 0x16, 0x99,
+    0x98, 0xED, 0x90, 0xEC, 0x45, 0x1F, 0x16, 0x96, 0x9F, 0xC9, 0xFB, 0x60, 0xDE, 0x04, 0xCB, 0x29,
+    0x9C, 0x87, 0xC9, 0xC1, 0xFE, 0xF5, 0x3C, 0x42, 0xBB, 0x5E, 0x5A, 0x7F, 0xA1, 0xBA, 0xB6, 0x20,
+    0xDE, 0x43, 0xE7, 0x09, 0x68, 0x56, 0xD8, 0x33, 0xF3, 0x2D, 0x3F, 0x44, 0xDC, 0xDC, 0x25, 0x88,
+    0x41, 0x35, 0xBC, 0x59, 0x35, 0x85, 0x76, 0x90, 0xFC, 0xDF, 0x5C, 0x5C, 0x3B, 0x0C, 0xBE, 0x2C,
+    0x21, 0x2F, 0xE2, 0x5A, 0x7C, 0x3E, 0x2C, 0x22, 0xC9, 0xAF, 0x81, 0x63, 0xAB, 0xDA, 0x61, 0x2B,
+    0x57, 0xE6, 0xE3, 0xBB, 0xD8, 0x4D, 0x6F, 0xAE, 0x2F, 0x75, 0x76, 0x90, 0xFE, 0x2C, 0x6E, 0x5A,
+    0x06, 0x5F, 0x16, 0x09, 0x6D, 0xB1, 0xB9, 0x68, 0x96, 0x9E, 0xFA, 0xEA, 0x78, 0x84, 0xED, 0x52,
+    0x38, 0x36, 0xEE, 0xF6, 0xDD, 0x1B, 0x52, 0x39, 0x4B, 0x59, 0x1A, 0x2E, 0x13, 0x5F, 0x0C, 0xFC,
+    0xD4, 0xCF, 0x6D, 0xCB, 0x44, 0x87, 0xFB, 0x2C, 0x7B, 0xAC, 0x04, 0xC4, 0x51, 0xEC, 0xBF, 0xE1,
+    0x9C, 0xB4, 0xFE, 0x12, 0x14, 0xB6, 0xA4, 0x54, 0xF9, 0x35, 0xB8, 0xD6, 0xCB, 0x0B, 0xAA, 0x56,
+    0x43, 0xAB, 0x41, 0xB2, 0x6B, 0x0A, 0xEC, 0x37, 0x56, 0x5D, 0xD7, 0xFC, 0x48, 0x57, 0x61, 0x63,
+    0xAB, 0xEF, 0xB9, 0x69, 0x99, 0xCB, 0x4F, 0x7B, 0xF8, 0x17, 0xE4, 0x98, 0xAE, 0x47, 0x77, 0xB0,
+    0xA9, 0xBD, 0xC4, 0x2E, 0xE7, 0x4F, 0xC5, 0x2C, 0x7B, 0xE2, 0xB5, 0xC8, 0xB1, 0xFB, 0x60, 0xDE,
+    0x04, 0x2E, 0xE4, 0x58, 0xCF, 0x1A, 0xC2, 0xBB, 0x69, 0xEF, 0x7F, 0x03, 0x87, 0xAA, 0xC1, 0xAE,
+    0x47, 0x77, 0xB0, 0xA9, 0xBD, 0xC4, 0x2E, 0xE7, 0x4F, 0xF6, 0x76, 0x13, 0x37, 0xE0, 0xD9, 0x20,
+    0xD7, 0x23, 0xBB, 0xD8, 0x23, 0x64, 0x58, 0xCF, 0x1A, 0xC2, 0xBB, 0x69, 0xF3, 0xC6, 0xDB, 0x1B,
+    0xC0, 0xE2, 0xA9, 0x95, 0x6D, 0x84, 0x3E, 0xC6, 0x28, 0x6D, 0xA7, 0xE3, 0x44, 0xAD, 0x4B, 0x6C,
+    0x44, 0x38, 0x46, 0x78, 0xA1, 0xB0, 0xD9, 0x37, 0x3A, 0x7B, 0xDF, 0xC0, 0x87, 0x1C, 0x55, 0x32,
+    0x10, 0x6C, 0x9B, 0x9D, 0x3E, 0x96, 0xC8, 0x4B, 0xF8, 0x56, 0xD8, 0x77, 0x7B, 0x0E, 0xD6, 0x29,
+    0xE0, 0x26, 0xC8, 0xAD, 0xA7, 0xF2, 0x7E, 0xD8, 0x37, 0x81, 0xC1, 0xB5, 0xDD, 0x92, 0xA2, 0x17,
+    0x73, 0xA7, 0xBD, 0xFC, 0x0E, 0xEF, 0x61, 0x4C, 0xEC, 0xA5, 0x88, 0xED, 0x62, 0x9E, 0x34, 0xF7,
+    0xBF, 0x81, 0xCD, 0x0B, 0x0A, 0xA4, 0x1B, 0x0D, 0xD7, 0x6A, 0x40, 0xEC, 0x74, 0xF7, 0xD7, 0x53,
+    0xC4, 0x0D, 0x5D, 0xA6, 0xB0, 0xAE, 0xD7, 0xD3, 0xE4, 0x76, 0x78, 0x54, 0x82, 0x35, 0x76, 0x9A,
+    0xC2, 0xBB, 0x5F, 0x4F, 0xF9, 0xFD, 0xF1, 0x57, 0xB1, 0x16, 0x35, 0x48, 0x57, 0x6B, 0xD1, 0x78,
+    0x1B, 0xAD, 0x4D, 0xE1, 0xD8, 0xE8,
+};
+
+static const DialogText agent_dialog_options[DIALOG_OPTION_COUNT] = {
+    17076,    // Ask sweetly for less time
+    17196,    // Carefully request time reduction
+    17351,    // Ask politely for less time
+    17476,    // Beg desperately for any reduction
+    17631,    // Suggest playing together
+    17749,    // Challenge to another game
+    17865,    // Ask to play a game
+    17954,    // Try asking for break again
+    18085,    // Request personal time
+    18189,    // Ask for hygiene break
+    18296,    // Ask when later might be
+    18408,    // Accept conditions
+    18494,    // Negotiate conditions
+    18588,    // Explore relationship milestone
+};
+
+#define AGENT_DIALOG_TABLES_COUNT 3
+
+static const DialogIndex_t* const agent_dialog_tables[3] = {
+    &rookie_dialogs,
+    &veteran_dialogs,
+    &warden_dialogs,
+};
+
+#endif // AGENT_DIALOG_TABLES_H
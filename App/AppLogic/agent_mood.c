@@ -0,0 +1,167 @@
+// CKOS Agent Mood Engine
+// Fixed-point mood levels with closed-form drift (see agent_mood.h)
+
+#include "agent_mood.h"
+#include <string.h>
+
+#define PERCENT_Q16(p)      ((uint32_t)(p) * AGENT_MOOD_Q16_ONE / 100u)
+#define POINTS_Q8(p)        ((uint32_t)(p) * AGENT_MOOD_ONE)
+
+// =============================================================================
+// TIER TABLES
+// =============================================================================
+
+// Indexed by AgentPersonality: Rookie (beginner), Veteran (advanced),
+// Warden (permanent). Baselines in points, volatility as Q16.
+typedef struct {
+    uint8_t baseline[AGENT_MOOD_DIMENSION_COUNT];
+    uint32_t volatility[AGENT_MOOD_DIMENSION_COUNT];
+} AgentMoodTier_t;
+
+static const AgentMoodTier_t tiers[CONFIG_AGENT_COUNT] = {
+    { { 90, 30, 70, 50 }, { PERCENT_Q16(100), PERCENT_Q16(80),  PERCENT_Q16(100), PERCENT_Q16(100) } },
+    { { 60, 60, 50, 40 }, { PERCENT_Q16(80),  PERCENT_Q16(100), PERCENT_Q16(80),  PERCENT_Q16(70) } },
+    { { 30, 90, 40, 30 }, { PERCENT_Q16(60),  PERCENT_Q16(100), PERCENT_Q16(60),  PERCENT_Q16(50) } },
+};
+
+// Section 3.4: strictness drifts at the base rate, affection at half of it,
+// patience at one and a half times; trust never drifts. Q16 of the base rate.
+static const uint32_t drift_rate[AGENT_MOOD_DIMENSION_COUNT] = {
+    [AGENT_MOOD_AFFECTION]    = PERCENT_Q16(50),
+    [AGENT_MOOD_STRICTNESS]   = PERCENT_Q16(100),
+    [AGENT_MOOD_SATISFACTION] = PERCENT_Q16(150),
+    [AGENT_MOOD_TRUST]        = 0,
+};
+
+// Section 3.3, in points: affection, strictness, patience, trust
+static const int8_t event_deltas[AGENT_MOOD_EVENT_COUNT][AGENT_MOOD_DIMENSION_COUNT] = {
+    [AGENT_MOOD_EVENT_BEG_LESS_TIME]      = {  -3,  +3, -10,  -1 },
+    [AGENT_MOOD_EVENT_ASK_MORE_TIME]      = { +10,  -5,  +5,  +5 },
+    [AGENT_MOOD_EVENT_BEG_EARLY_UNLOCK]   = {  -5,  +5, -15,  -2 },
+    [AGENT_MOOD_EVENT_BEG_CLEANING_BREAK] = {  -2,  +2,  -8,   0 },
+    [AGENT_MOOD_EVENT_ASK_GAME]           = {  +5,  -2,  -3,  +1 },
+    [AGENT_MOOD_EVENT_REQUEST_GRANTED]    = {  +3,  -2,  +5,  +2 },
+    [AGENT_MOOD_EVENT_REQUEST_DENIED]     = {  -1,  +1,  -2,   0 },
+    [AGENT_MOOD_EVENT_REQUEST_SPAM]       = {  -5,  +5, -20,  -3 },
+    [AGENT_MOOD_EVENT_GAME_WON]           = { +10,  -3,  +5,  +3 },
+    [AGENT_MOOD_EVENT_GAME_LOST]          = {  -3,  +2,  -5,   0 },
+    [AGENT_MOOD_EVENT_GAME_REFUSED]       = {  -8,  +3,  -5,  -2 },
+    [AGENT_MOOD_EVENT_BREAK_VIOLATION]    = { -10, +10, -20, -15 },
+    [AGENT_MOOD_EVENT_BREAK_ON_TIME]      = {  +5,  -2, +10,  +8 },
+    [AGENT_MOOD_EVENT_BREAK_EARLY]        = {  +8,  -3,  +8,  +5 },
+    [AGENT_MOOD_EVENT_COMPLIMENT]         = {  +8,   0,  +3,  +1 },
+    [AGENT_MOOD_EVENT_THANKS]             = {  +5,  -1,  +2,  +2 },
+    [AGENT_MOOD_EVENT_PROMISE_KEPT]       = {  +5,  -3,  +5, +10 },
+    [AGENT_MOOD_EVENT_PROMISE_BROKEN]     = {  -8,  +5, -10, -20 },
+};
+
+static const AgentMoodTier_t* tier_of(const AgentMood_t* mood) {
+    return &tiers[mood->agent < CONFIG_AGENT_COUNT ? mood->agent : 0];
+}
+
+// =============================================================================
+// DRIFT
+// =============================================================================
+
+uint16_t agent_mood_baseline(const AgentMood_t* mood, AgentMoodDimension dimension) {
+    if (!mood || (unsigned)dimension >= AGENT_MOOD_DIMENSION_COUNT) return 0;
+
+    uint32_t points = tier_of(mood)->baseline[dimension];
+    uint32_t shift = 0;
+    if (mood->lock_hours > CONFIG_AGENT_MOOD_LOCK_HOURS_MIN) {
+        // Section 3.5: a point less strict per 10 hours, less patient per 20
+        if (dimension == AGENT_MOOD_STRICTNESS) shift = mood->lock_hours / 10u;
+        if (dimension == AGENT_MOOD_SATISFACTION) shift = mood->lock_hours / 20u;
+    }
+    points = (shift < points) ? points - shift : 0;
+    return (uint16_t)POINTS_Q8(points);
+}
+
+uint16_t agent_mood_level(const AgentMood_t* mood, AgentMoodDimension dimension, uint64_t now_utc) {
+    if (!mood || (unsigned)dimension >= AGENT_MOOD_DIMENSION_COUNT) return 0;
+
+    uint16_t level = mood->level[dimension];
+    uint16_t baseline = agent_mood_baseline(mood, dimension);
+    if (now_utc <= mood->anchor_utc || level == baseline || drift_rate[dimension] == 0) {
+        return level;
+    }
+
+    // Linear in the seconds since the anchor, so it needs no history: Q8.8
+    // points per period times the Q16 rate, over the period
+    uint64_t elapsed = now_utc - mood->anchor_utc;
+    uint64_t distance = (level > baseline) ? level - baseline : baseline - level;
+    uint64_t per_period = ((uint64_t)CONFIG_AGENT_MOOD_DRIFT_Q8 * drift_rate[dimension]) >> 16;
+    if (elapsed >= (distance * CONFIG_AGENT_MOOD_DRIFT_PERIOD_S + per_period - 1) / per_period) {
+        return baseline;    // Reached; also keeps the product below from overflowing
+    }
+
+    uint64_t drift = elapsed * per_period / CONFIG_AGENT_MOOD_DRIFT_PERIOD_S;
+    return (uint16_t)((level > baseline) ? level - drift : level + drift);
+}
+
+void agent_mood_levels(const AgentMood_t* mood, uint64_t now_utc,
+                       uint16_t level[AGENT_MOOD_DIMENSION_COUNT]) {
+    if (!level) return;
+    for (int d = 0; d < AGENT_MOOD_DIMENSION_COUNT; d++) {
+        level[d] = agent_mood_level(mood, (AgentMoodDimension)d, now_utc);
+    }
+}
+
+// Settles the drift so far into the levels and moves the anchor to now
+static void settle(AgentMood_t* mood, uint64_t now_utc) {
+    if (now_utc <= mood->anchor_utc) return;
+    agent_mood_levels(mood, now_utc, mood->level);
+    mood->anchor_utc = now_utc;
+}
+
+// =============================================================================
+// AGENT MOOD API
+// =============================================================================
+
+void agent_mood_init(AgentMood_t* mood, uint8_t agent, uint64_t now_utc) {
+    if (!mood) return;
+    memset(mood, 0, sizeof(*mood));
+    mood->agent = agent;
+    mood->anchor_utc = now_utc;
+    for (int d = 0; d < AGENT_MOOD_DIMENSION_COUNT; d++) {
+        mood->level[d] = agent_mood_baseline(mood, (AgentMoodDimension)d);
+    }
+}
+
+void agent_mood_restore(AgentMood_t* mood, uint8_t agent, const uint16_t level[AGENT_MOOD_DIMENSION_COUNT],
+                        uint64_t anchor_utc) {
+    if (!mood || !level) return;
+    agent_mood_init(mood, agent, anchor_utc);
+    for (int d = 0; d < AGENT_MOOD_DIMENSION_COUNT; d++) {
+        mood->level[d] = (level[d] > AGENT_MOOD_LEVEL_MAX) ? AGENT_MOOD_LEVEL_MAX : level[d];
+    }
+}
+
+void agent_mood_apply(AgentMood_t* mood, const int8_t delta[AGENT_MOOD_DIMENSION_COUNT],
+                      uint64_t now_utc) {
+    if (!mood || !delta) return;
+    settle(mood, now_utc);
+
+    const AgentMoodTier_t* tier = tier_of(mood);
+    for (int d = 0; d < AGENT_MOOD_DIMENSION_COUNT; d++) {
+        int64_t scaled = (int64_t)delta[d] * AGENT_MOOD_ONE * tier->volatility[d];
+        if (d == AGENT_MOOD_TRUST && delta[d] < 0) {
+            scaled *= 2;    // Trust is lost faster than it is gained
+        }
+        int64_t level = mood->level[d] + scaled / (int64_t)AGENT_MOOD_Q16_ONE;
+        if (level < 0) level = 0;
+        if (level > AGENT_MOOD_LEVEL_MAX) level = AGENT_MOOD_LEVEL_MAX;
+        mood->level[d] = (uint16_t)level;
+    }
+}
+
+void agent_mood_apply_event(AgentMood_t* mood, AgentMoodEvent event, uint64_t now_utc) {
+    if ((unsigned)event >= AGENT_MOOD_EVENT_COUNT) return;
+    agent_mood_apply(mood, event_deltas[event], now_utc);
+}
+
+void agent_mood_set_lock_hours(AgentMood_t* mood, uint32_t lock_hours, uint64_t now_utc) {
+    if (!mood || mood->lock_hours == lock_hours) return;
+    settle(mood, now_utc);
+    mood->lock_hours = lock_hours;
+}
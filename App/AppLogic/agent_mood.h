@@ -0,0 +1,112 @@
+#ifndef AGENT_MOOD_H
+#define AGENT_MOOD_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "../Config/app_config.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Agent mood engine (Agent_System_Design.txt sections 3.1-3.5), in integer
+// arithmetic only so the application task never touches the FPU.
+//
+// Levels are Q8.8 on the design's 0-100 scale; volatilities and the
+// asymmetric trust factor are Q16 multipliers. Nothing ticks: a mood holds
+// its levels as of an anchor time, and a read works out the drift toward
+// the agent's baseline in closed form from the seconds since then. Drift is
+// linear and stops at the baseline, so one read after a night asleep gives
+// exactly what reading every five minutes would have. Only events and
+// baseline changes move the anchor.
+//
+// The baseline is the agent's tier baseline, shifted by the hours locked
+// with that agent (section 3.5): less strict, and less patient, with time.
+
+// =============================================================================
+// CONFIGURATION
+// =============================================================================
+
+#define AGENT_MOOD_ONE              256u                    // 1 point in Q8.8
+#define AGENT_MOOD_LEVEL_MAX        (CONFIG_AGENT_MOOD_MAX * AGENT_MOOD_ONE)
+#define AGENT_MOOD_Q16_ONE          65536u                  // 1.0 as a Q16 multiplier
+
+// Whole points of a Q8.8 level, rounded down
+#define AGENT_MOOD_POINTS(level)    ((uint32_t)(level) / AGENT_MOOD_ONE)
+
+// =============================================================================
+// TYPES
+// =============================================================================
+
+typedef enum {
+    AGENT_MOOD_AFFECTION = 0,
+    AGENT_MOOD_STRICTNESS,
+    AGENT_MOOD_SATISFACTION,        // The design's patience
+    AGENT_MOOD_TRUST,
+    AGENT_MOOD_DIMENSION_COUNT
+} AgentMoodDimension;
+
+// Events of section 3.3
+typedef enum {
+    AGENT_MOOD_EVENT_BEG_LESS_TIME = 0,
+    AGENT_MOOD_EVENT_ASK_MORE_TIME,
+    AGENT_MOOD_EVENT_BEG_EARLY_UNLOCK,
+    AGENT_MOOD_EVENT_BEG_CLEANING_BREAK,
+    AGENT_MOOD_EVENT_ASK_GAME,
+    AGENT_MOOD_EVENT_REQUEST_GRANTED,
+    AGENT_MOOD_EVENT_REQUEST_DENIED,
+    AGENT_MOOD_EVENT_REQUEST_SPAM,
+    AGENT_MOOD_EVENT_GAME_WON,
+    AGENT_MOOD_EVENT_GAME_LOST,
+    AGENT_MOOD_EVENT_GAME_REFUSED,
+    AGENT_MOOD_EVENT_BREAK_VIOLATION,
+    AGENT_MOOD_EVENT_BREAK_ON_TIME,
+    AGENT_MOOD_EVENT_BREAK_EARLY,
+    AGENT_MOOD_EVENT_COMPLIMENT,
+    AGENT_MOOD_EVENT_THANKS,
+    AGENT_MOOD_EVENT_PROMISE_KEPT,
+    AGENT_MOOD_EVENT_PROMISE_BROKEN,
+    AGENT_MOOD_EVENT_COUNT
+} AgentMoodEvent;
+
+typedef struct {
+    uint16_t level[AGENT_MOOD_DIMENSION_COUNT];     // Q8.8, as of anchor_utc
+    uint64_t anchor_utc;
+    uint8_t agent;                                  // AgentPersonality: tier baselines
+    uint32_t lock_hours;                            // Locked with this agent
+} AgentMood_t;
+
+// =============================================================================
+// AGENT MOOD API
+// =============================================================================
+
+// Starts at the agent's baseline
+void agent_mood_init(AgentMood_t* mood, uint8_t agent, uint64_t now_utc);
+
+// Restores saved levels and their anchor; levels above the maximum are clamped
+void agent_mood_restore(AgentMood_t* mood, uint8_t agent, const uint16_t level[AGENT_MOOD_DIMENSION_COUNT],
+                        uint64_t anchor_utc);
+
+// Level of one dimension at now_utc, drift included. Reads change nothing.
+uint16_t agent_mood_level(const AgentMood_t* mood, AgentMoodDimension dimension, uint64_t now_utc);
+void agent_mood_levels(const AgentMood_t* mood, uint64_t now_utc,
+                       uint16_t level[AGENT_MOOD_DIMENSION_COUNT]);
+
+// Baseline the levels drift toward
+uint16_t agent_mood_baseline(const AgentMood_t* mood, AgentMoodDimension dimension);
+
+// Section 3.2: whole-point deltas scaled by the agent's volatility, trust
+// losses doubled, then clamped to 0-100
+void agent_mood_apply(AgentMood_t* mood, const int8_t delta[AGENT_MOOD_DIMENSION_COUNT],
+                      uint64_t now_utc);
+void agent_mood_apply_event(AgentMood_t* mood, AgentMoodEvent event, uint64_t now_utc);
+
+// Hours locked with the agent; the baseline moves, so drift so far is
+// settled at now_utc first
+void agent_mood_set_lock_hours(AgentMood_t* mood, uint32_t lock_hours, uint64_t now_utc);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // AGENT_MOOD_H
@@ -3,18 +3,37 @@
 
 #include "app_logic.h"
 #include "../Display/display_api.h"
+#include "../Hardware/hardware_api.h"
+#include "../Utils/sim_instance.h"
+#include "../Utils/utils.h"
 #include <stdio.h>
 #include <string.h>
-#ifndef TEST_MODE
-#include <time.h>
-#endif
 
-// Global application state
-AppLogicState g_app_state = {0};
+// Application state, one copy per simulated device
+SIM_INSTANCE_STATE(AppLogicState, g_app_state);
+#define g_app_state SIM_INSTANCE(g_app_state)
+
+#ifdef SIMULATOR
+size_t app_logic_instance_size(void) {
+    return sizeof(AppLogicState);
+}
+
+void app_logic_instance_bind(void* state) {
+    SIM_INSTANCE_BIND(g_app_state, state);
+}
+#endif
 
 // Forward declarations for helper functions
 static void update_menu_scroll_window(void);
 static void update_settings_scroll_window(void);
+static void print_lock_history(void);
+static bool restore_snapshot(void);
+static AppState resume_state(AppState saved_state);
+static bool lock_session_active(void);
+static void update_lock_time(void);
+static void update_mood_baseline(void);
+static void service_lock_timing(bool alarm_fired);
+static void enter_initial_state(void);
 
 // Main menu options from documentation
 static const char* main_menu_options[] = {
@@ -28,6 +47,8 @@ static const char* main_menu_options[] = {
     "About Device"
 };
 #define MAIN_MENU_COUNT (sizeof(main_menu_options) / sizeof(main_menu_options[0]))
+#define MAIN_MENU_LOCK_HISTORY  5
+#define MAIN_MENU_SETTINGS      6
 
 // Settings menu options
 static const char* settings_options[] = {
@@ -48,6 +69,7 @@ static const char* settings_options[] = {
     "About Device"
 };
 #define SETTINGS_COUNT (sizeof(settings_options) / sizeof(settings_options[0]))
+#define SETTINGS_ABOUT_DEVICE   (SETTINGS_COUNT - 1)
 
 void app_logic_init(void) {
     printf("Initializing application logic...\n");
@@ -62,6 +84,7 @@ void app_logic_init(void) {
     // Initialize timezone settings (default to UTC)
     g_app_state.timezone_offset_hours = 0;
     g_app_state.dst_active = false;
+    civil_clock_init(&g_app_state.local_clock, 0, (CivilDstRule_t)CONFIG_TIME_DST_RULE, false);
     
     // Get current UTC time as starting point
 #ifdef TEST_MODE
@@ -73,14 +96,11 @@ void app_logic_init(void) {
     // Initialize agent mood values as per documentation
     // Rookie agent defaults (high affection, low strictness)
     g_app_state.selected_agent = AGENT_ROOKIE;
-    g_app_state.agent_mood_affection = 0.9f;
-    g_app_state.agent_mood_strictness = 0.3f;
-    g_app_state.agent_mood_satisfaction = 0.7f;
-    g_app_state.agent_mood_trust = 0.5f;
+    agent_mood_init(&g_app_state.agent_mood, AGENT_ROOKIE, g_app_state.utc_time_seconds);
     
     // Initialize lock system
-    g_app_state.device_locked = false;
-    g_app_state.active_lock_type = LOCK_TYPE_AGENT;
+    g_app_state.lock_session.operational_state = LOCK_STATE_UNLOCKED;
+    g_app_state.lock_session.active_lock_type = LOCK_TYPE_AGENT;
     
     // Initialize UI state
     g_app_state.menu_selection = 0;
@@ -96,9 +116,25 @@ void app_logic_init(void) {
     g_app_state.current_state = STATE_WELCOME;
     g_app_state.previous_state = STATE_WELCOME;
     
-    // Initialize Display_Task per architecture documentation
-    display_task_init();
-    app_logic_activate_screen(SCREEN_ID_WELCOME, NULL);
+    // Settings and any lock in progress from the last run, in one read
+    if (restore_snapshot()) {
+        g_app_state.current_state = resume_state(g_app_state.current_state);
+        g_app_state.previous_state = g_app_state.current_state;
+    }
+    
+    // Counters are checkpointed more often than the snapshot is saved
+    lock_time_restore(&g_app_state.lock_time, bsp_get_tick_ms64());
+    update_mood_baseline();
+    LockSession_t* session = &g_app_state.lock_session;
+    if (lock_session_active() &&
+        g_app_state.lock_time.counters.session_seconds > session->current_session_accumulated_time_seconds) {
+        session->current_session_accumulated_time_seconds = g_app_state.lock_time.counters.session_seconds;
+    }
+    
+    enter_initial_state();
+    
+    // Catch up on anything due while powered off and set the first alarm
+    service_lock_timing(false);
     
     printf("Application logic initialized\n");
     printf("Initial state: %s\n", app_logic_get_state_name(g_app_state.current_state));
@@ -107,24 +143,421 @@ void app_logic_init(void) {
 void app_logic_update(void) {
     // Update simulation time
 #ifndef TEST_MODE
-    static uint64_t last_update = 0;
-    uint64_t current_time = bsp_get_utc_time_seconds();
-    
-    if (current_time != last_update) {
-        g_app_state.utc_time_seconds = current_time;
-        last_update = current_time;
+    g_app_state.utc_time_seconds = bsp_get_utc_time_seconds();
+#endif
+}
+
+// =============================================================================
+// STATE MACHINE
+// =============================================================================
+
+// Each state is a row of the table below: entry and exit actions, and for
+// every event at most one transition. A transition may run an action and
+// either stay put or change state; a guarded one picks between two targets.
+// Adding a state to APP_STATE_LIST without a row here fails to compile.
+
+#define APP_STATE_STAY  STATE_COUNT         // Target that keeps the state
+
+typedef struct {
+    bool handled;
+    bool (*guard)(void);                    // NULL: always the first target
+    void (*action)(void);                   // Runs before the state changes
+    AppState target;                        // Guard true, or no guard
+    AppState otherwise;                     // Guard false
+    const char* guard_name;
+    const char* action_name;
+} AppTransition_t;
+
+typedef struct {
+    void (*entry)(void);
+    void (*exit)(void);
+    AppTransition_t on[APP_EVENT_COUNT];
+} AppStateRow_t;
+
+#define GOTO(state)                 { true, NULL, NULL, state, state, NULL, NULL }
+#define DO(action)                  { true, NULL, action, APP_STATE_STAY, APP_STATE_STAY, NULL, #action }
+#define DO_GOTO(action, state)      { true, NULL, action, state, state, NULL, #action }
+#define CHOOSE(guard, action, yes, no) { true, guard, action, yes, no, #guard, #action }
+#define ON_ANY_BUTTON(t) \
+    [APP_EVENT_UP] = t, [APP_EVENT_DOWN] = t, [APP_EVENT_LEFT] = t, \
+    [APP_EVENT_RIGHT] = t, [APP_EVENT_A] = t, [APP_EVENT_B] = t
+
+// Guards
+static bool is_first_boot(void) {
+    return g_app_state.first_boot;
+}
+
+static bool needs_time_setup(void) {
+    return g_app_state.first_boot && !g_app_state.time_configured;
+}
+
+static bool settings_chosen(void) {
+    return g_app_state.menu_selection == MAIN_MENU_SETTINGS;
+}
+
+// Screens
+static void show_welcome_screen(void) {
+    app_logic_activate_screen(SCREEN_ID_WELCOME, NULL);
+}
+
+static void show_timezone_screen(void) {
+    TimezoneScreenData data = {
+        .timezone_offset = g_app_state.timezone_offset_hours,
+        .dst_active = g_app_state.dst_active
+    };
+    app_logic_activate_screen(SCREEN_ID_TIMEZONE_SETUP, &data);
+}
+
+static void show_time_screen(void) {
+    TimeScreenData data = {0};
+    app_logic_get_local_time_string(data.time_string, sizeof(data.time_string));
+    app_logic_activate_screen(SCREEN_ID_TIME_SETUP, &data);
+}
+
+static void show_menu_screen(void) {
+    MenuScreenData data = {
+        .menu_selection = g_app_state.menu_selection,
+        .max_items = g_app_state.max_menu_items,
+        .visible_start = g_app_state.menu_visible_start,
+        .max_visible = g_app_state.max_visible_menu_items,
+        .options = main_menu_options
+    };
+    app_logic_activate_screen(SCREEN_ID_MAIN_MENU, &data);
+}
+
+// Timezone setup
+static void timezone_west(void) {
+    if (g_app_state.timezone_offset_hours > -12) {
+        g_app_state.timezone_offset_hours--;
     }
+    show_timezone_screen();
+}
+
+static void timezone_east(void) {
+    if (g_app_state.timezone_offset_hours < 12) {
+        g_app_state.timezone_offset_hours++;
+    }
+    show_timezone_screen();
+}
+
+static void toggle_dst(void) {
+    g_app_state.dst_active = !g_app_state.dst_active;
+    show_timezone_screen();
+}
+
+static void confirm_timezone(void) {
+    g_app_state.timezone_configured = true;
+}
+
+// Time setup
+static void confirm_time(void) {
+    g_app_state.time_configured = true;
+}
+
+static void leave_time_setup(void) {
+    // Confirmed or skipped, setup is over
+    g_app_state.first_boot = false;
+}
+
+// Main menu
+static void enter_menu(void) {
+    // Reset menu selection and ensure scroll window is correct
+    g_app_state.menu_selection = 0;
+    g_app_state.menu_visible_start = 0;
+    update_menu_scroll_window();
+    show_menu_screen();
+}
+
+static void menu_up(void) {
+    if (g_app_state.menu_selection > 0) {
+        g_app_state.menu_selection--;
+    }
+    update_menu_scroll_window();
+    show_menu_screen();
+}
+
+static void menu_down(void) {
+    if (g_app_state.menu_selection + 1 < g_app_state.max_menu_items) {
+        g_app_state.menu_selection++;
+    }
+    update_menu_scroll_window();
+    show_menu_screen();
+}
+
+static void menu_select(void) {
+    if (g_app_state.menu_selection == MAIN_MENU_LOCK_HISTORY) {
+        print_lock_history();
+    } else if (!settings_chosen()) {
+        printf("Feature not yet implemented: %s\n",
+               main_menu_options[g_app_state.menu_selection]);
+    }
+}
+
+// Settings
+static void enter_settings(void) {
+    g_app_state.settings_selection = 0;
+    g_app_state.settings_visible_start = 0;
+    update_settings_scroll_window();
+    app_logic_update_settings_menu();
+}
+
+static void settings_up(void) {
+    if (g_app_state.settings_selection > 0) {
+        g_app_state.settings_selection--;
+    }
+    update_settings_scroll_window();
+    app_logic_update_settings_menu();
+}
+
+static void settings_down(void) {
+    if (g_app_state.settings_selection + 1 < g_app_state.max_settings_items) {
+        g_app_state.settings_selection++;
+    }
+    update_settings_scroll_window();
+    app_logic_update_settings_menu();
+}
+
+static void settings_select(void) {
+    if (g_app_state.settings_selection == SETTINGS_ABOUT_DEVICE) {
+        printf("About Device selected\n");
+    }
+}
+
+// The rows
+static const AppStateRow_t row_FIRST_TIME_SETUP = { .entry = NULL };
+
+static const AppStateRow_t row_WELCOME = {
+    .entry = show_welcome_screen,
+    .on = {
+        // Any button: timezone setup on first boot, else the menu
+        ON_ANY_BUTTON(CHOOSE(is_first_boot, NULL, STATE_TIMEZONE_SETUP, STATE_MENU)),
+    },
+};
+
+static const AppStateRow_t row_TIMEZONE_SETUP = {
+    .entry = show_timezone_screen,
+    .on = {
+        [APP_EVENT_LEFT]  = DO(timezone_west),
+        [APP_EVENT_RIGHT] = DO(timezone_east),
+        [APP_EVENT_UP]    = DO(toggle_dst),
+        [APP_EVENT_DOWN]  = DO(toggle_dst),
+        [APP_EVENT_A]     = CHOOSE(needs_time_setup, confirm_timezone, STATE_TIME_SETUP, STATE_MENU),
+        // Skip: keep the default UTC
+        [APP_EVENT_B]     = CHOOSE(needs_time_setup, NULL, STATE_TIME_SETUP, STATE_MENU),
+    },
+};
+
+static const AppStateRow_t row_TIME_SETUP = {
+    .entry = show_time_screen,
+    .exit = leave_time_setup,
+    .on = {
+        [APP_EVENT_A] = DO_GOTO(confirm_time, STATE_MENU),
+        // Skip: keep the system time
+        [APP_EVENT_B] = GOTO(STATE_MENU),
+    },
+};
+
+static const AppStateRow_t row_MENU = {
+    .entry = enter_menu,
+    .on = {
+        [APP_EVENT_UP]   = DO(menu_up),
+        [APP_EVENT_DOWN] = DO(menu_down),
+        [APP_EVENT_A]    = CHOOSE(settings_chosen, menu_select, STATE_SETTINGS, APP_STATE_STAY),
+        [APP_EVENT_B]    = GOTO(STATE_WELCOME),
+    },
+};
+
+static const AppStateRow_t row_LOCK_SETUP = { .entry = NULL };
+
+static const AppStateRow_t row_LOCK_ACTIVE = {
+    .entry = app_logic_show_lock_status_screen,
+    .on = {
+        [APP_EVENT_UNLOCKED] = GOTO(STATE_MENU),
+    },
+};
+
+static const AppStateRow_t row_AGENT_INTERACTION = { .entry = NULL };
+static const AppStateRow_t row_UNLOCK_SEQUENCE = { .entry = NULL };
+
+static const AppStateRow_t row_SETTINGS = {
+    .entry = enter_settings,
+    .on = {
+        [APP_EVENT_UP]   = DO(settings_up),
+        [APP_EVENT_DOWN] = DO(settings_down),
+        [APP_EVENT_A]    = DO(settings_select),
+        [APP_EVENT_B]    = GOTO(STATE_MENU),
+    },
+};
+
+static const AppStateRow_t row_ERROR = { .entry = NULL };
+static const AppStateRow_t row_IDLE = { .entry = NULL };
+
+static const AppStateRow_t* const state_table[STATE_COUNT] = {
+#define APP_STATE_ROW(name) [STATE_##name] = &row_##name,
+    APP_STATE_LIST(APP_STATE_ROW)
+#undef APP_STATE_ROW
+};
+
+static const char* const state_names[STATE_COUNT] = {
+#define APP_STATE_NAME(name) [STATE_##name] = #name,
+    APP_STATE_LIST(APP_STATE_NAME)
+#undef APP_STATE_NAME
+};
+
+static const char* const event_names[APP_EVENT_COUNT] = {
+    [APP_EVENT_UP] = "UP",
+    [APP_EVENT_DOWN] = "DOWN",
+    [APP_EVENT_LEFT] = "LEFT",
+    [APP_EVENT_RIGHT] = "RIGHT",
+    [APP_EVENT_A] = "A",
+    [APP_EVENT_B] = "B",
+    [APP_EVENT_UNLOCKED] = "UNLOCKED",
+};
+
+bool app_logic_dispatch_event(AppEvent event) {
+    AppState state = g_app_state.current_state;
+    if ((unsigned)state >= STATE_COUNT || (unsigned)event >= APP_EVENT_COUNT) {
+        return false;
+    }
+
+    const AppTransition_t* t = &state_table[state]->on[event];
+    if (!t->handled) {
+        return false;
+    }
+
+    bool taken = !t->guard || t->guard();
+#ifdef SIMULATOR
+    g_app_state.transition_hits[state][event][taken ? 0 : 1]++;
 #endif
-    
-    // Update Display_Task per architecture documentation
-    display_task_update();
+
+    if (t->action) {
+        t->action();
+    }
+
+    AppState target = taken ? t->target : t->otherwise;
+    if (target == APP_STATE_STAY) {
+        return false;
+    }
+    app_logic_change_state(target);
+    return true;
+}
+
+// Screen for the state restored at power-up
+static void enter_initial_state(void) {
+    const AppStateRow_t* row = state_table[g_app_state.current_state];
+    if (row->entry) {
+        row->entry();
+    } else {
+        show_welcome_screen();
+    }
+}
+
+#ifdef SIMULATOR
+// Graphviz: one edge per transition, events with the same transition merged
+static void write_edge(FILE* out, AppState from, const AppTransition_t* t, bool taken,
+                       const char* events) {
+    AppState to = taken ? t->target : t->otherwise;
+    bool stay = (to == APP_STATE_STAY);
+
+    fprintf(out, "  %s -> %s [label=\"%s", state_names[from],
+            state_names[stay ? from : to], events);
+    if (t->guard) {
+        fprintf(out, " [%s%s]", taken ? "" : "!", t->guard_name);
+    }
+    if (t->action) {
+        fprintf(out, " / %s", t->action_name);
+    }
+    fprintf(out, "\"%s];\n", stay ? ", style=dashed" : "");
+}
+
+void app_logic_write_state_diagram(FILE* out) {
+    if (!out) return;
+
+    fprintf(out, "digraph app_logic {\n  rankdir=LR;\n  node [shape=box];\n");
+    for (int s = 0; s < STATE_COUNT; s++) {
+        fprintf(out, "  %s;\n", state_names[s]);
+    }
+
+    for (int s = 0; s < STATE_COUNT; s++) {
+        const AppStateRow_t* row = state_table[s];
+        bool written[APP_EVENT_COUNT] = { false };
+
+        for (int e = 0; e < APP_EVENT_COUNT; e++) {
+            const AppTransition_t* t = &row->on[e];
+            if (!t->handled || written[e]) continue;
+
+            char events[64] = "";
+            for (int other = e; other < APP_EVENT_COUNT; other++) {
+                if (memcmp(&row->on[other], t, sizeof(*t)) != 0) continue;
+                written[other] = true;
+                size_t used = strlen(events);
+                snprintf(events + used, sizeof(events) - used, "%s%s",
+                         used ? "," : "", event_names[other]);
+            }
+
+            write_edge(out, (AppState)s, t, true, events);
+            if (t->guard) {
+                write_edge(out, (AppState)s, t, false, events);
+            }
+        }
+    }
+    fprintf(out, "}\n");
+}
+
+void app_logic_get_state_coverage(uint32_t* taken, uint32_t* total) {
+    uint32_t hit = 0;
+    uint32_t branches = 0;
+
+    for (int s = 0; s < STATE_COUNT; s++) {
+        for (int e = 0; e < APP_EVENT_COUNT; e++) {
+            const AppTransition_t* t = &state_table[s]->on[e];
+            if (!t->handled) continue;
+            for (int b = 0; b < (t->guard ? 2 : 1); b++) {
+                branches++;
+                if (g_app_state.transition_hits[s][e][b]) hit++;
+            }
+        }
+    }
+
+    if (taken) *taken = hit;
+    if (total) *total = branches;
+}
+
+void app_logic_print_state_coverage(void) {
+    printf("State machine coverage:\n");
+    for (int s = 0; s < STATE_COUNT; s++) {
+        for (int e = 0; e < APP_EVENT_COUNT; e++) {
+            const AppTransition_t* t = &state_table[s]->on[e];
+            if (!t->handled) continue;
+            for (int b = 0; b < (t->guard ? 2 : 1); b++) {
+                printf("  %-16s %-8s %s%-18s %lu\n", state_names[s], event_names[e],
+                       b ? "!" : " ", t->guard ? t->guard_name : "",
+                       (unsigned long)g_app_state.transition_hits[s][e][b]);
+            }
+        }
+    }
+
+    uint32_t taken = 0;
+    uint32_t total = 0;
+    app_logic_get_state_coverage(&taken, &total);
+    printf("  %lu of %lu transitions taken\n", (unsigned long)taken, (unsigned long)total);
 }
+#endif
 
 void app_logic_process_button_event(const bsp_button_event_t* event) {
     if (!event || !event->pressed) {
         return; // Only process button press events, not releases
     }
     
+    // Any press is a wake source for the power governor and the display
+    hardware_power_note_activity();
+    display_task_note_activity();
+    
+    // A woken display shows the countdown again: bring it up to date
+    if (lock_session_active()) {
+        service_lock_timing(false);
+    }
+    
     // Button debouncing - ignore rapid button presses
     #define BUTTON_DEBOUNCE_MS 150
     if (g_app_state.last_button == event->button && 
@@ -139,198 +572,81 @@ void app_logic_process_button_event(const bsp_button_event_t* event) {
     g_app_state.last_button_time = event->timestamp;
     g_app_state.last_button = event->button;
     
-    // Handle state-specific input
-    switch (g_app_state.current_state) {
-        case STATE_WELCOME:
-            // Any button press proceeds to timezone setup on first boot
-            if (g_app_state.first_boot) {
-                app_logic_change_state(STATE_TIMEZONE_SETUP);
-            } else {
-                app_logic_change_state(STATE_MENU);
-            }
-            break;
-            
-        case STATE_TIMEZONE_SETUP: {
-            TimezoneScreenData data = {
-                .timezone_offset = g_app_state.timezone_offset_hours,
-                .dst_active = g_app_state.dst_active
-            };
-            
-            switch (event->button) {
-                case BSP_BUTTON_LEFT:
-                    g_app_state.timezone_offset_hours--;
-                    if (g_app_state.timezone_offset_hours < -12) {
-                        g_app_state.timezone_offset_hours = -12;
-                    }
-                    data.timezone_offset = g_app_state.timezone_offset_hours;
-                    app_logic_activate_screen(SCREEN_ID_TIMEZONE_SETUP, &data);
-                    break;
-                    
-                case BSP_BUTTON_RIGHT:
-                    g_app_state.timezone_offset_hours++;
-                    if (g_app_state.timezone_offset_hours > 12) {
-                        g_app_state.timezone_offset_hours = 12;
-                    }
-                    data.timezone_offset = g_app_state.timezone_offset_hours;
-                    app_logic_activate_screen(SCREEN_ID_TIMEZONE_SETUP, &data);
-                    break;
-                    
-                case BSP_BUTTON_UP:
-                case BSP_BUTTON_DOWN:
-                    g_app_state.dst_active = !g_app_state.dst_active;
-                    data.dst_active = g_app_state.dst_active;
-                    app_logic_activate_screen(SCREEN_ID_TIMEZONE_SETUP, &data);
-                    break;
-                    
-                case BSP_BUTTON_A:
-                    g_app_state.timezone_configured = true;
-                    if (g_app_state.first_boot && !g_app_state.time_configured) {
-                        app_logic_change_state(STATE_TIME_SETUP);
-                    } else {
-                        MenuScreenData data = {
-                            .menu_selection = g_app_state.menu_selection,
-                            .max_items = g_app_state.max_menu_items,
-                            .visible_start = g_app_state.menu_visible_start,
-                            .max_visible = g_app_state.max_visible_menu_items,
-                            .options = main_menu_options
-                        };
-                        app_logic_activate_screen(SCREEN_ID_MAIN_MENU, &data);
-                        app_logic_change_state(STATE_MENU);
-                    }
-                    break;
-                    
-                case BSP_BUTTON_B:
-                    // Skip timezone setup - use default UTC
-                    if (g_app_state.first_boot && !g_app_state.time_configured) {
-                        app_logic_change_state(STATE_TIME_SETUP);
-                    } else {
-                        MenuScreenData data = {
-                            .menu_selection = g_app_state.menu_selection,
-                            .max_items = g_app_state.max_menu_items,
-                            .visible_start = g_app_state.menu_visible_start,
-                            .max_visible = g_app_state.max_visible_menu_items,
-                            .options = main_menu_options
-                        };
-                        app_logic_activate_screen(SCREEN_ID_MAIN_MENU, &data);
-                        app_logic_change_state(STATE_MENU);
-                    }
-                    break;
-                    
-                default:
-                    break;
-            }
-            break;
-        }
+    if (event->button < BSP_BUTTON_COUNT) {
+        app_logic_dispatch_event((AppEvent)event->button);
+    }
+}
+
+// Outcome of the memory wire sequence started when the unlock time was
+// reached. The door opening while pending also means the latch let go.
+static void handle_unlock_result(uint32_t events) {
+    LockSession_t* session = &g_app_state.lock_session;
+    if (!(events & HST_EVT_SRC_HLM) || session->operational_state != LOCK_STATE_PENDING_UNLOCK) {
+        return;
+    }
+    
+    if (events & (HST_EVT_UNLOCK_SUCCESS | HST_EVT_DOOR_OPENED)) {
+        printf("Lock: Unlocked\n");
+        session->operational_state = LOCK_STATE_UNLOCKED;
         
-        case STATE_TIME_SETUP: {
-            switch (event->button) {
-                case BSP_BUTTON_A:
-                    g_app_state.time_configured = true;
-                    g_app_state.first_boot = false;
-                    app_logic_change_state(STATE_MENU);
-                    break;
-                    
-                case BSP_BUTTON_B:
-                    // Skip time setup - use system time
-                    g_app_state.first_boot = false;
-                    app_logic_change_state(STATE_MENU);
-                    break;
-                    
-                default:
-                    break;
-            }
-            break;
+        // The session's total is final: fold it into a base now rather than
+        // leave it to a checkpoint that no longer has a lock to wake for
+        lock_time_end_session(&g_app_state.lock_time);
+        lock_time_checkpoint(&g_app_state.lock_time, bsp_get_tick_ms64());
+        if (!app_logic_dispatch_event(APP_EVENT_UNLOCKED)) {
+            app_logic_save_snapshot();              // A state change saves it
         }
-        
-        case STATE_MENU: {
-            switch (event->button) {
-                case BSP_BUTTON_DOWN:
-                    g_app_state.menu_selection++;
-                    if (g_app_state.menu_selection >= g_app_state.max_menu_items) {
-                        g_app_state.menu_selection = g_app_state.max_menu_items - 1;
-                    }
-                    update_menu_scroll_window();
-                    break;
-                    
-                case BSP_BUTTON_UP:
-                    if (g_app_state.menu_selection > 0) {
-                        g_app_state.menu_selection--;
-                    }
-                    update_menu_scroll_window();
-                    break;
-                    
-                case BSP_BUTTON_A:
-                    // Handle menu selection
-                    if (g_app_state.menu_selection == 6) { // Settings
-                        app_logic_change_state(STATE_SETTINGS);
-                    } else {
-                        printf("Feature not yet implemented: %s\n", 
-                               main_menu_options[g_app_state.menu_selection]);
-                    }
-                    break;
-                    
-                case BSP_BUTTON_B:
-                    app_logic_change_state(STATE_WELCOME);
-                    break;
-                    
-                default:
-                    break;
-            }
-            
-            MenuScreenData data = {
-                .menu_selection = g_app_state.menu_selection,
-                .max_items = g_app_state.max_menu_items,
-                .visible_start = g_app_state.menu_visible_start,
-                .max_visible = g_app_state.max_visible_menu_items,
-                .options = main_menu_options
-            };
-            app_logic_activate_screen(SCREEN_ID_MAIN_MENU, &data);
-            break;
+    } else if (events & HST_EVT_UNLOCK_FAILURE) {
+        printf("Lock: ERROR - memory wire did not release the latch\n");
+        session->operational_state = LOCK_STATE_ERROR;
+        app_logic_save_snapshot();
+    } else if (events & HST_EVT_UNLOCK_BLOCKED) {
+        printf("Lock: Latch released but the door did not open\n");
+    }
+}
+
+void app_logic_process_hardware_events(uint32_t events) {
+    handle_unlock_result(events);
+    
+    // Lock timing runs on the RTC alarm; other events can move the schedule
+    // too (the checkpoint interval follows the battery)
+    service_lock_timing((events & HST_EVT_RTC_ALARM) != 0);
+    
+    if (events & HST_EVT_SRC_HLM) {
+        if (events & HST_EVT_DOOR_OPENED) {
+            printf("Door opened%s\n", lock_session_active() ? " while locked!" : "");
         }
-        
-        case STATE_SETTINGS: {
-            switch (event->button) {
-                case BSP_BUTTON_DOWN:
-                    g_app_state.settings_selection++;
-                    if (g_app_state.settings_selection >= g_app_state.max_settings_items) {
-                        g_app_state.settings_selection = g_app_state.max_settings_items - 1;
-                    }
-                    update_settings_scroll_window();
-                    break;
-                    
-                case BSP_BUTTON_UP:
-                    if (g_app_state.settings_selection > 0) {
-                        g_app_state.settings_selection--;
-                    }
-                    update_settings_scroll_window();
-                    break;
-                    
-                case BSP_BUTTON_A:
-                    if (g_app_state.settings_selection == 14) { // About Device
-                        printf("About Device selected\n");
-                    }
-                    break;
-                    
-                case BSP_BUTTON_B:
-                    app_logic_change_state(STATE_MENU);
-                    break;
-                    
-                default:
-                    break;
-            }
-            
-            app_logic_update_settings_menu();
-            break;
+        if (events & HST_EVT_DOOR_CLOSED) {
+            printf("Door closed\n");
+        }
+        if (events & HST_EVT_LATCH_CHANGED) {
+            printf("Latch state changed\n");
+        }
+    }
+    
+    if (events & HST_EVT_SRC_SENSOR) {
+        if (events & HST_EVT_BATTERY_CRITICAL) {
+            printf("Battery critical\n");
+        } else if (events & HST_EVT_BATTERY_LOW) {
+            printf("Battery low\n");
+        }
+        if (events & HST_EVT_CHARGER_CHANGED) {
+            printf("Charger status changed\n");
+        }
+        if (events & HST_EVT_OVER_TEMPERATURE) {
+            printf("Over temperature\n");
+        }
+    }
+    
+    if (events & HST_EVT_SRC_POWER) {
+        if (events & HST_EVT_POWER_MODE_CHANGED) {
+            printf("Power mode changed\n");
         }
-        
-        default:
-            // Data should be handled in app_logic_activate_screen
-            break;
     }
 }
 
 void app_logic_change_state(AppState new_state) {
-    if (new_state == g_app_state.current_state) {
+    if (new_state == g_app_state.current_state || (unsigned)new_state >= STATE_COUNT) {
         return; // No change needed
     }
     
@@ -338,60 +654,20 @@ void app_logic_change_state(AppState new_state) {
            app_logic_get_state_name(g_app_state.current_state),
            app_logic_get_state_name(new_state));
     
+    const AppStateRow_t* from = state_table[g_app_state.current_state];
+    if (from->exit) {
+        from->exit();
+    }
+    
     g_app_state.previous_state = g_app_state.current_state;
     g_app_state.current_state = new_state;
     
-    // Handle state entry actions
-    switch (new_state) {
-        case STATE_WELCOME:
-            app_logic_activate_screen(SCREEN_ID_WELCOME, NULL);
-            break;
-            
-        case STATE_TIMEZONE_SETUP: {
-            TimezoneScreenData data = {
-                .timezone_offset = g_app_state.timezone_offset_hours,
-                .dst_active = g_app_state.dst_active
-            };
-            app_logic_activate_screen(SCREEN_ID_TIMEZONE_SETUP, &data);
-            break;
-        }
-        
-        case STATE_TIME_SETUP: {
-            TimeScreenData data = {0};
-            app_logic_get_local_time_string(data.time_string, sizeof(data.time_string));
-            app_logic_activate_screen(SCREEN_ID_TIME_SETUP, &data);
-            break;
-        }
-        
-        case STATE_MENU: {
-            // Reset menu selection and ensure scroll window is correct
-            g_app_state.menu_selection = 0;
-            g_app_state.menu_visible_start = 0;
-            update_menu_scroll_window();
-            
-            MenuScreenData data = {
-                .menu_selection = g_app_state.menu_selection,
-                .max_items = g_app_state.max_menu_items,
-                .visible_start = g_app_state.menu_visible_start,
-                .max_visible = g_app_state.max_visible_menu_items,
-                .options = main_menu_options
-            };
-            app_logic_activate_screen(SCREEN_ID_MAIN_MENU, &data);
-            break;
-        }
-        
-        case STATE_SETTINGS: {
-            // Reset settings selection
-            g_app_state.settings_selection = 0;
-            g_app_state.settings_visible_start = 0;
-            update_settings_scroll_window();
-            app_logic_update_settings_menu();
-            break;
-        }
-        
-        default:
-            break;
+    const AppStateRow_t* to = state_table[new_state];
+    if (to->entry) {
+        to->entry();
     }
+    
+    app_logic_save_snapshot();
 }
 
 void app_logic_activate_screen(ScreenID screen_id, void* data) {
@@ -421,44 +697,379 @@ void app_logic_get_local_time_string(char* buffer, size_t buffer_size) {
     // Fixed time string for testing
     snprintf(buffer, buffer_size, "12:34:56");
 #else
-    // Convert UTC to local time using BSP
-    uint64_t local_time_seconds = g_app_state.utc_time_seconds + 
-                                  (g_app_state.timezone_offset_hours * 3600);
+    // Wall clock with DST under CONFIG_TIME_DST_RULE. The zone is checked
+    // on every call, as the setup screens change it; once a second the
+    // cached clock only has to count.
+    civil_clock_set_zone(&g_app_state.local_clock, g_app_state.timezone_offset_hours * 3600,
+                         (CivilDstRule_t)CONFIG_TIME_DST_RULE, g_app_state.dst_active);
+    const CivilTime_t* local = civil_clock_update(&g_app_state.local_clock,
+                                                  g_app_state.utc_time_seconds);
+    civil_time_format_hms(local, buffer, buffer_size);
+#endif
+}
+
+uint64_t app_logic_get_current_utc_time(void) {
+    return g_app_state.utc_time_seconds;
+}
+
+AppState app_logic_get_state(void) {
+    return g_app_state.current_state;
+}
+
+const LockSession_t* app_logic_get_lock_session(void) {
+    return &g_app_state.lock_session;
+}
+
+const LockTimeCounters_t* app_logic_get_lock_time_counters(void) {
+    return &g_app_state.lock_time.counters;
+}
+
+uint16_t app_logic_get_agent_mood(AgentMoodDimension dimension) {
+    return agent_mood_level(&g_app_state.agent_mood, dimension, g_app_state.utc_time_seconds);
+}
+
+uint64_t app_logic_get_next_lock_wake(LockWakeReason* reason) {
+    if (reason) *reason = g_app_state.lock_alarm_reason;
+    return g_app_state.lock_alarm_utc;
+}
+
+// =============================================================================
+// STATE SNAPSHOT
+// =============================================================================
+
+// Room for any version; the header is common to all of them
+typedef union {
+    AppSnapshotHeader_t header;
+    AppSnapshotV1_t v1;
+    AppSnapshot_t current;
+} AppSnapshotRecord_t;
+
+#define SNAPSHOT_BODY_LENGTH(type)  (sizeof(type) - sizeof(AppSnapshotHeader_t))
+
+// Version 1 kept moods as floats from 0 to 1; they become Q8.8 points,
+// taken to hold as of this boot. The only float left on the mood path.
+static void migrate_snapshot_v1(AppSnapshotRecord_t* record) {
+    AppSnapshotV1_t old = record->v1;
+    AppSnapshot_t* snapshot = &record->current;
+    memset(snapshot, 0, sizeof(*snapshot));
     
-    time_t local_time = (time_t)local_time_seconds;
-    struct tm* tm_info = gmtime(&local_time);
+    snapshot->flags = old.flags;
+    snapshot->timezone_offset_hours = old.timezone_offset_hours;
+    snapshot->state = old.state;
+    snapshot->selected_agent = old.selected_agent;
+    for (int d = 0; d < AGENT_MOOD_DIMENSION_COUNT; d++) {
+        float level = old.moods[d] * (float)AGENT_MOOD_LEVEL_MAX + 0.5f;
+        snapshot->moods[d] = !(level > 0.0f) ? 0 :
+                             (level >= (float)AGENT_MOOD_LEVEL_MAX) ? AGENT_MOOD_LEVEL_MAX :
+                             (uint16_t)level;
+    }
+    snapshot->utc_mood_anchor = (uint32_t)g_app_state.utc_time_seconds;
+    snapshot->lock_type = old.lock_type;
+    snapshot->lock_state = old.lock_state;
+    snapshot->break_allowed_duration_seconds = old.break_allowed_duration_seconds;
+    snapshot->utc_lock_start_time = old.utc_lock_start_time;
+    snapshot->utc_unlock_target_time = old.utc_unlock_target_time;
+    snapshot->accumulated_seconds = old.accumulated_seconds;
+    snapshot->utc_break_start_time = old.utc_break_start_time;
+}
+
+// Indexed by version: body length, and the step up to the next version
+static const struct {
+    uint8_t length;
+    void (*migrate)(AppSnapshotRecord_t* record);
+} snapshot_versions[APP_SNAPSHOT_VERSION + 1] = {
+    [1] = { SNAPSHOT_BODY_LENGTH(AppSnapshotV1_t), migrate_snapshot_v1 },
+    [2] = { SNAPSHOT_BODY_LENGTH(AppSnapshot_t), NULL },
+};
+
+static uint32_t snapshot_crc(const AppSnapshotRecord_t* record, uint32_t length) {
+    return utils_crc32((const uint8_t*)record + sizeof(AppSnapshotHeader_t), length);
+}
+
+int app_logic_save_snapshot(void) {
+    AppSnapshotRecord_t record;
+    AppSnapshot_t* snapshot = &record.current;
+    const LockSession_t* session = &g_app_state.lock_session;
+    memset(&record, 0, sizeof(record));
+    
+    snapshot->flags = (g_app_state.first_boot ? APP_SNAPSHOT_FLAG_FIRST_BOOT : 0) |
+                      (g_app_state.timezone_configured ? APP_SNAPSHOT_FLAG_TIMEZONE_CONFIGURED : 0) |
+                      (g_app_state.time_configured ? APP_SNAPSHOT_FLAG_TIME_CONFIGURED : 0) |
+                      (g_app_state.dst_active ? APP_SNAPSHOT_FLAG_DST_ACTIVE : 0);
+    snapshot->timezone_offset_hours = (int8_t)g_app_state.timezone_offset_hours;
+    snapshot->state = (uint8_t)g_app_state.current_state;
+    snapshot->selected_agent = (uint8_t)g_app_state.selected_agent;
+    memcpy(snapshot->moods, g_app_state.agent_mood.level, sizeof(snapshot->moods));
+    snapshot->utc_mood_anchor = (uint32_t)g_app_state.agent_mood.anchor_utc;
+    snapshot->lock_type = (uint8_t)session->active_lock_type;
+    snapshot->lock_state = (uint8_t)session->operational_state;
+    snapshot->break_allowed_duration_seconds = session->break_allowed_duration_seconds;
+    snapshot->utc_lock_start_time = session->utc_lock_start_time;
+    snapshot->utc_unlock_target_time = session->utc_unlock_target_time;
+    snapshot->accumulated_seconds = session->current_session_accumulated_time_seconds;
+    snapshot->utc_break_start_time = session->utc_break_start_time;
+    
+    record.header.magic = APP_SNAPSHOT_MAGIC;
+    record.header.version = APP_SNAPSHOT_VERSION;
+    record.header.length = snapshot_versions[APP_SNAPSHOT_VERSION].length;
+    record.header.crc = snapshot_crc(&record, record.header.length);
+    
+    if (hardware_config_write(HARDWARE_CONFIG_KEY_APP_SNAPSHOT, &record,
+                              sizeof(AppSnapshot_t)) != 0) {
+        return -1;
+    }
+    if (session->operational_state != g_app_state.saved_lock_state) {
+        if (hardware_config_flush() != 0) return -1;
+        g_app_state.saved_lock_state = session->operational_state;
+    }
+    return 0;
+}
+
+static bool moods_in_range(const uint16_t moods[AGENT_MOOD_DIMENSION_COUNT]) {
+    for (int d = 0; d < AGENT_MOOD_DIMENSION_COUNT; d++) {
+        if (moods[d] > AGENT_MOOD_LEVEL_MAX) return false;
+    }
+    return true;
+}
+
+// Loads the snapshot into g_app_state. Returns false, leaving the defaults,
+// if there is no usable snapshot.
+static bool restore_snapshot(void) {
+    AppSnapshotRecord_t record;
+    int length = hardware_config_read(HARDWARE_CONFIG_KEY_APP_SNAPSHOT, &record, sizeof(record));
+    if (length < (int)sizeof(AppSnapshotHeader_t)) {
+        return false;   // Nothing saved yet
+    }
+    
+    uint8_t version = record.header.version;
+    if (record.header.magic != APP_SNAPSHOT_MAGIC || version == 0 ||
+        version > APP_SNAPSHOT_VERSION ||
+        record.header.length != snapshot_versions[version].length ||
+        length != (int)(sizeof(AppSnapshotHeader_t) + record.header.length) ||
+        snapshot_crc(&record, record.header.length) != record.header.crc) {
+        printf("App: WARNING - state snapshot unusable (version %u), starting fresh\n", version);
+        return false;
+    }
+    
+    for (; version < APP_SNAPSHOT_VERSION; version++) {
+        snapshot_versions[version].migrate(&record);
+    }
+    
+    const AppSnapshot_t* snapshot = &record.current;
+    if (snapshot->state >= STATE_COUNT || snapshot->selected_agent >= AGENT_COUNT ||
+        snapshot->lock_type >= LOCK_TYPE_COUNT || snapshot->lock_state >= LOCK_STATE_COUNT ||
+        snapshot->timezone_offset_hours < -12 || snapshot->timezone_offset_hours > 12 ||
+        !moods_in_range(snapshot->moods)) {
+        printf("App: WARNING - state snapshot out of range, starting fresh\n");
+        return false;
+    }
+    
+    g_app_state.first_boot = (snapshot->flags & APP_SNAPSHOT_FLAG_FIRST_BOOT) != 0;
+    g_app_state.timezone_configured = (snapshot->flags & APP_SNAPSHOT_FLAG_TIMEZONE_CONFIGURED) != 0;
+    g_app_state.time_configured = (snapshot->flags & APP_SNAPSHOT_FLAG_TIME_CONFIGURED) != 0;
+    g_app_state.dst_active = (snapshot->flags & APP_SNAPSHOT_FLAG_DST_ACTIVE) != 0;
+    g_app_state.timezone_offset_hours = snapshot->timezone_offset_hours;
+    g_app_state.current_state = (AppState)snapshot->state;
+    g_app_state.selected_agent = (AgentPersonality)snapshot->selected_agent;
+    agent_mood_restore(&g_app_state.agent_mood, snapshot->selected_agent, snapshot->moods,
+                       snapshot->utc_mood_anchor);
+    
+    LockSession_t* session = &g_app_state.lock_session;
+    session->active_lock_type = (LockType)snapshot->lock_type;
+    session->operational_state = (LockOperationalState)snapshot->lock_state;
+    session->utc_lock_start_time = snapshot->utc_lock_start_time;
+    session->utc_unlock_target_time = snapshot->utc_unlock_target_time;
+    session->current_session_accumulated_time_seconds = snapshot->accumulated_seconds;
+    session->utc_break_start_time = snapshot->utc_break_start_time;
+    session->break_allowed_duration_seconds = snapshot->break_allowed_duration_seconds;
+    g_app_state.saved_lock_state = session->operational_state;
+    
+    printf("App: state restored (snapshot version %u)\n", record.header.version);
+    return true;
+}
+
+// Where to come back up: a lock in progress always shows its status, setup
+// screens start over and everything else returns to the menu
+static AppState resume_state(AppState saved_state) {
+    if (lock_session_active()) {
+        return STATE_LOCK_ACTIVE;
+    }
+    if (g_app_state.first_boot) {
+        return STATE_WELCOME;
+    }
+    return (saved_state == STATE_SETTINGS) ? STATE_SETTINGS : STATE_MENU;
+}
+
+// =============================================================================
+// LOCK TIME
+// =============================================================================
+
+static LockCounterType lock_counter_for_session(void) {
+    switch (g_app_state.lock_session.active_lock_type) {
+        case LOCK_TYPE_AGENT:
+            return (LockCounterType)(LOCK_COUNTER_AGENT_BEGINNER + g_app_state.selected_agent);
+        case LOCK_TYPE_CUSTOM:
+            return LOCK_COUNTER_CUSTOM;
+        default:
+            return LOCK_COUNTER_KEYHOLDER_BASIC;
+    }
+}
+
+// Session time accrues while locked and break time during a break, in whole
+// UTC seconds; the counters are checkpointed on the battery-dependent interval
+static void update_lock_time(void) {
+    uint32_t now = (uint32_t)g_app_state.utc_time_seconds;
+    LockSession_t* session = &g_app_state.lock_session;
+    
+    if (!lock_session_active() || g_app_state.lock_time_accrued_utc == 0 ||
+        now < g_app_state.lock_time_accrued_utc) {
+        g_app_state.lock_time_accrued_utc = now;
+        return;
+    }
+    uint32_t elapsed = now - g_app_state.lock_time_accrued_utc;
+    if (elapsed == 0) return;
+    g_app_state.lock_time_accrued_utc = now;
+    
+    if (session->operational_state == LOCK_STATE_LOCKED) {
+        lock_time_accrue(&g_app_state.lock_time, lock_counter_for_session(), elapsed, 0);
+        session->current_session_accumulated_time_seconds += elapsed;
+        update_mood_baseline();
+    } else if (session->operational_state == LOCK_STATE_BREAK_ACTIVE) {
+        lock_time_accrue(&g_app_state.lock_time, lock_counter_for_session(), 0, elapsed);
+    }
+    
+    hardware_sensor_data_t sensors = {0};
+    hardware_get_sensor_data(&sensors);
+    lock_time_service(&g_app_state.lock_time, bsp_get_tick_ms64(),
+                      sensors.battery_percentage, sensors.charging_active);
+}
+
+// Hours locked with the selected agent move its mood baseline
+static void update_mood_baseline(void) {
+    LockCounterType counter = (LockCounterType)(LOCK_COUNTER_AGENT_BEGINNER + g_app_state.selected_agent);
+    uint64_t locked = g_app_state.lock_time.counters.total_locked_seconds[counter];
+    agent_mood_set_lock_hours(&g_app_state.agent_mood, (uint32_t)(locked / 3600u),
+                              g_app_state.utc_time_seconds);
+}
+
+// Absolute instants of the running session; time that only accrues (session
+// and break time) is counted when serviced, so checkpoints need a wake too
+static void build_lock_schedule(LockSchedule_t* schedule, bool countdown_visible) {
+    const LockSession_t* session = &g_app_state.lock_session;
+    uint64_t now = g_app_state.utc_time_seconds;
+    memset(schedule, 0, sizeof(*schedule));
     
-    if (tm_info) {
-        strftime(buffer, buffer_size, "%H:%M:%S", tm_info);
+    if (session->operational_state == LOCK_STATE_LOCKED) {
+        schedule->unlock_utc = session->utc_unlock_target_time;
+    } else if (session->operational_state == LOCK_STATE_BREAK_ACTIVE) {
+        schedule->break_end_utc = (uint64_t)session->utc_break_start_time +
+                                  session->break_allowed_duration_seconds;
     } else {
-        snprintf(buffer, buffer_size, "00:00:00");
+        return;
     }
+    schedule->countdown_visible = countdown_visible;
+    schedule->countup_start_utc = session->utc_lock_start_time;
+    
+    hardware_sensor_data_t sensors = {0};
+    hardware_get_sensor_data(&sensors);
+    uint32_t interval = lock_time_checkpoint_interval_ms(sensors.battery_percentage,
+                                                         sensors.charging_active);
+    uint64_t since = bsp_get_tick_ms64() - g_app_state.lock_time.last_checkpoint_ms;
+    uint32_t due_ms = (since < interval) ? interval - (uint32_t)since : 0;
+    schedule->checkpoint_utc = now + (due_ms + 999u) / 1000u;
+}
+
+// Lock timing runs only when woken - by the RTC alarm, a button or another
+// hardware event: it acts on whatever instant has been reached, refreshes a
+// visible countdown and sets the alarm for the next instant. alarm_fired
+// forces the alarm to be set again (it may have fired early).
+static void service_lock_timing(bool alarm_fired) {
+#ifndef TEST_MODE
+    g_app_state.utc_time_seconds = bsp_get_utc_time_seconds();
 #endif
+    uint64_t now = g_app_state.utc_time_seconds;
+    LockSession_t* session = &g_app_state.lock_session;
+    update_lock_time();
+    
+    if (session->operational_state == LOCK_STATE_LOCKED &&
+        lock_schedule_reached(session->utc_unlock_target_time, now)) {
+        printf("Lock: Unlock time reached\n");
+        session->operational_state = LOCK_STATE_PENDING_UNLOCK;
+        hardware_log_append(HARDWARE_LOG_EVENT_LOCK_ENDED,
+                            session->current_session_accumulated_time_seconds / 60);
+        hardware_lock_release();
+        app_logic_save_snapshot();
+    } else if (session->operational_state == LOCK_STATE_BREAK_ACTIVE &&
+               lock_schedule_reached((uint64_t)session->utc_break_start_time +
+                                     session->break_allowed_duration_seconds, now)) {
+        printf("Lock: Break time used up\n");
+        session->operational_state = LOCK_STATE_AWAITING_DOOR_CLOSE;
+        app_logic_save_snapshot();
+    }
+    
+    // Remaining time is derived here, never counted down; a blanked display
+    // needs no update and no minute wakes
+    bool countdown_visible = g_app_state.current_state == STATE_LOCK_ACTIVE &&
+                             !display_is_blanked();
+    if (countdown_visible) {
+        DisplayCommand cmd = {0};
+        cmd.id = DISPLAY_CMD_UPDATE_LOCK_STATUS;
+        cmd.data.lock_status.time_remaining =
+            (uint32_t)lock_schedule_remaining(session->utc_unlock_target_time, now);
+        display_task_send_command(&cmd);
+    }
+    
+    LockSchedule_t schedule;
+    build_lock_schedule(&schedule, countdown_visible);
+    LockWakeReason reason;
+    uint64_t next = lock_schedule_next(&schedule, now, &reason);
+    if (next == g_app_state.lock_alarm_utc && !alarm_fired) {
+        return;
+    }
+    
+    g_app_state.lock_alarm_utc = next;
+    g_app_state.lock_alarm_reason = reason;
+    if (next == 0) {
+        hardware_rtc_cancel_alarm();
+    } else if (hardware_rtc_set_alarm(next, bsp_task_get_current()) != 0) {
+        printf("Lock: WARNING - RTC alarm not set (%s)\n", lock_schedule_reason_name(reason));
+    }
 }
 
-uint64_t app_logic_get_current_utc_time(void) {
-    return g_app_state.utc_time_seconds;
+static bool lock_session_active(void) {
+    switch (g_app_state.lock_session.operational_state) {
+        case LOCK_STATE_AWAITING_DOOR_CLOSE:
+        case LOCK_STATE_LOCKED:
+        case LOCK_STATE_PENDING_UNLOCK:
+        case LOCK_STATE_BREAK_ACTIVE:
+            return true;
+        default:
+            return false;
+    }
 }
 
 const char* app_logic_get_state_name(AppState state) {
-    switch (state) {
-        case STATE_FIRST_TIME_SETUP: return "FIRST_TIME_SETUP";
-        case STATE_WELCOME: return "WELCOME";
-        case STATE_TIMEZONE_SETUP: return "TIMEZONE_SETUP";
-        case STATE_TIME_SETUP: return "TIME_SETUP";
-        case STATE_MENU: return "MENU";
-        case STATE_LOCK_SETUP: return "LOCK_SETUP";
-        case STATE_LOCK_ACTIVE: return "LOCK_ACTIVE";
-        case STATE_AGENT_INTERACTION: return "AGENT_INTERACTION";
-        case STATE_UNLOCK_SEQUENCE: return "UNLOCK_SEQUENCE";
-        case STATE_SETTINGS: return "SETTINGS";
-        case STATE_ERROR: return "ERROR";
-        case STATE_IDLE: return "IDLE";
-        default: return "UNKNOWN";
-    }
+    return ((unsigned)state < STATE_COUNT) ? state_names[state] : "UNKNOWN";
+}
+
+const char* app_logic_get_event_name(AppEvent event) {
+    return ((unsigned)event < APP_EVENT_COUNT && event_names[event]) ? event_names[event] : "UNKNOWN";
 }
 
 // Helper functions
+// No history screen yet: list the newest entries on the console
+static void print_lock_history(void) {
+    uint32_t count = hardware_log_count();
+    printf("Lock History: %lu entries\n", (unsigned long)count);
+    for (uint32_t i = 0; i < count && i < 8; i++) {
+        EventLogEntry_t entry;
+        if (hardware_log_read(i, &entry) != 0) continue;
+        printf("  #%lu %s (%lu) at %lu\n", (unsigned long)entry.sequence,
+               hardware_log_event_name(entry.event), (unsigned long)entry.arg,
+               (unsigned long)entry.timestamp);
+    }
+}
+
 static void update_menu_scroll_window(void) {
     // Ensure the current selection is visible in the scroll window
     if (g_app_state.menu_selection < g_app_state.menu_visible_start) {
@@ -509,7 +1120,22 @@ void app_logic_handle_lock_setup_input(const bsp_button_event_t* event) {
 }
 
 void app_logic_show_lock_status_screen(void) {
-    printf("Lock status screen not yet implemented\n");
+    static const char* lock_type_names[] = {"Agent Lock", "Custom Lock", "Keyholder Lock"};
+    static const char* agent_names[] = {"Rookie", "Veteran", "Warden"};
+    const LockSession_t* session = &g_app_state.lock_session;
+    
+    LockStatusScreenData data = {
+        .lock_type = session->active_lock_type,
+        .lock_type_name = lock_type_names[session->active_lock_type],
+        .session_time_seconds = session->current_session_accumulated_time_seconds,
+        .is_break_active = session->operational_state == LOCK_STATE_BREAK_ACTIVE,
+        .agent_name = (session->active_lock_type == LOCK_TYPE_AGENT) ?
+                      agent_names[g_app_state.selected_agent] : NULL,
+        .battery_percentage = hardware_get_battery_percentage(),
+        .time_remaining_seconds = (uint32_t)lock_schedule_remaining(session->utc_unlock_target_time,
+                                                                    g_app_state.utc_time_seconds)
+    };
+    app_logic_activate_screen(SCREEN_ID_LOCK_STATUS, &data);
 }
 
 void app_logic_handle_lock_active_input(const bsp_button_event_t* event) {
@@ -4,30 +4,55 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include <stddef.h>
+#include <stdio.h>
 #include "../BSP/bsp_api.h"
 #include "../Display/display_api.h"
+#include "lock_time.h"
+#include "lock_schedule.h"
+#include "agent_mood.h"
+#include "../Utils/civil_time.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-// Application states from documentation
+// Application states from documentation. The list also builds the state
+// names and the transition table (app_logic.c), which needs a row for every
+// state here. Values are stored in the snapshot: append only.
+#define APP_STATE_LIST(X) \
+    X(FIRST_TIME_SETUP) \
+    X(WELCOME) \
+    X(TIMEZONE_SETUP) \
+    X(TIME_SETUP) \
+    X(MENU) \
+    X(LOCK_SETUP) \
+    X(LOCK_ACTIVE) \
+    X(AGENT_INTERACTION) \
+    X(UNLOCK_SEQUENCE) \
+    X(SETTINGS) \
+    X(ERROR) \
+    X(IDLE)
+
 typedef enum {
-    STATE_FIRST_TIME_SETUP = 0,
-    STATE_WELCOME,
-    STATE_TIMEZONE_SETUP,
-    STATE_TIME_SETUP,
-    STATE_MENU,
-    STATE_LOCK_SETUP,
-    STATE_LOCK_ACTIVE,
-    STATE_AGENT_INTERACTION,
-    STATE_UNLOCK_SEQUENCE,
-    STATE_SETTINGS,
-    STATE_ERROR,
-    STATE_IDLE,
+#define APP_STATE_ENUM(name) STATE_##name,
+    APP_STATE_LIST(APP_STATE_ENUM)
+#undef APP_STATE_ENUM
     STATE_COUNT
 } AppState;
 
+// Inputs to the state machine: the buttons, numbered as bsp_button_id_t,
+// then events the application raises itself
+typedef enum {
+    APP_EVENT_UP = BSP_BUTTON_UP,
+    APP_EVENT_DOWN = BSP_BUTTON_DOWN,
+    APP_EVENT_LEFT = BSP_BUTTON_LEFT,
+    APP_EVENT_RIGHT = BSP_BUTTON_RIGHT,
+    APP_EVENT_A = BSP_BUTTON_A,
+    APP_EVENT_B = BSP_BUTTON_B,
+    APP_EVENT_UNLOCKED,             // The lock opened at the end of a session
+    APP_EVENT_COUNT
+} AppEvent;
+
 // Lock types from documentation
 typedef enum {
     LOCK_TYPE_AGENT = 0,
@@ -44,6 +69,30 @@ typedef enum {
     AGENT_COUNT
 } AgentPersonality;
 
+// Lock session states from Lock_System_Design.txt
+typedef enum {
+    LOCK_STATE_UNLOCKED = 0,
+    LOCK_STATE_CONFIGURING,         // User is setting up a new lock
+    LOCK_STATE_AWAITING_DOOR_CLOSE, // Configured, waiting for the door
+    LOCK_STATE_LOCKED,
+    LOCK_STATE_PENDING_UNLOCK,      // Unlock condition met, awaiting mechanism
+    LOCK_STATE_BREAK_ACTIVE,        // Temporarily unlocked for a break/clean
+    LOCK_STATE_ERROR,
+    LOCK_STATE_COUNT
+} LockOperationalState;
+
+// Active or configured lock session (Lock_System_Design.txt 2.1.7; the
+// per-mode configuration is not kept yet)
+typedef struct {
+    LockType active_lock_type;
+    LockOperationalState operational_state;
+    uint32_t utc_lock_start_time;
+    uint32_t utc_unlock_target_time;            // 0 = no scheduled end
+    uint32_t current_session_accumulated_time_seconds;  // Excluding breaks
+    uint32_t utc_break_start_time;
+    uint16_t break_allowed_duration_seconds;
+} LockSession_t;
+
 // Application state structure
 typedef struct {
     AppState current_state;
@@ -58,19 +107,20 @@ typedef struct {
     int32_t timezone_offset_hours;  // Offset from UTC
     bool dst_active;                // Daylight saving time flag
     uint64_t utc_time_seconds;      // UTC time since epoch
+    CivilClock_t local_clock;       // Cached UTC to wall clock conversion
     
     // Lock system state
-    LockType active_lock_type;
     AgentPersonality selected_agent;
-    uint32_t lock_duration_seconds;
-    uint64_t lock_start_time;
-    bool device_locked;
+    LockSession_t lock_session;
+    LockOperationalState saved_lock_state;  // In the last snapshot written
+    LockTime_t lock_time;                   // Accumulated lock time counters
+    uint32_t lock_time_accrued_utc;         // Counted up to here
+    uint64_t lock_alarm_utc;                // RTC alarm set for, 0 = none
+    LockWakeReason lock_alarm_reason;
     
-    // Agent system state (simplified for now)
-    float agent_mood_affection;     // 0.0 - 1.0
-    float agent_mood_strictness;    // 0.0 - 1.0
-    float agent_mood_satisfaction;  // 0.0 - 1.0  
-    float agent_mood_trust;         // 0.0 - 1.0
+    // Agent system state: levels as of the mood's anchor, drift applied
+    // when read (app_logic_get_agent_mood)
+    AgentMood_t agent_mood;
     
     // UI state
     int menu_selection;
@@ -85,18 +135,116 @@ typedef struct {
     // Input handling
     uint32_t last_button_time;
     bsp_button_id_t last_button;
+    
+#ifdef SIMULATOR
+    // Times each transition was taken, guard held [0] or not [1]
+    uint32_t transition_hits[STATE_COUNT][APP_EVENT_COUNT][2];
+#endif
 } AppLogicState;
 
-extern AppLogicState g_app_state;
+// =============================================================================
+// STATE SNAPSHOT
+// =============================================================================
+
+// The persistent part of AppLogicState, lock session included, is kept as
+// one config record (HARDWARE_CONFIG_KEY_APP_SNAPSHOT) and restored with a
+// single hardware_config_read() in app_logic_init(), before the first screen
+// is activated. Layouts are fixed-width and never change once released: a
+// new layout gets a new version and a migration from the one before, and
+// restore steps an old record forward one version at a time. The CRC-32
+// (utils_crc32) covers the body after the header. A record that is missing,
+// corrupt, from newer firmware or out of range is ignored and the device
+// boots as on first power-up.
+#define APP_SNAPSHOT_MAGIC              0x5341u     // "AS"
+#define APP_SNAPSHOT_VERSION            2
+
+#define APP_SNAPSHOT_FLAG_FIRST_BOOT            0x01
+#define APP_SNAPSHOT_FLAG_TIMEZONE_CONFIGURED   0x02
+#define APP_SNAPSHOT_FLAG_TIME_CONFIGURED       0x04
+#define APP_SNAPSHOT_FLAG_DST_ACTIVE            0x08
+
+typedef struct {
+    uint16_t magic;
+    uint8_t version;
+    uint8_t length;                 // Body bytes after the header
+    uint32_t crc;
+} AppSnapshotHeader_t;
+
+// Version 1: the full lock session, moods as floats
+typedef struct {
+    AppSnapshotHeader_t header;
+    uint8_t flags;                  // APP_SNAPSHOT_FLAG_*
+    int8_t timezone_offset_hours;
+    uint8_t state;                  // AppState
+    uint8_t selected_agent;         // AgentPersonality
+    float moods[4];                 // Affection, strictness, satisfaction, trust
+    uint8_t lock_type;              // LockType
+    uint8_t lock_state;             // LockOperationalState
+    uint16_t break_allowed_duration_seconds;
+    uint32_t utc_lock_start_time;
+    uint32_t utc_unlock_target_time;
+    uint32_t accumulated_seconds;
+    uint32_t utc_break_start_time;
+} AppSnapshotV1_t;
+
+// Version 2: fixed-point moods and the time they were true at
+typedef struct {
+    AppSnapshotHeader_t header;
+    uint8_t flags;
+    int8_t timezone_offset_hours;
+    uint8_t state;
+    uint8_t selected_agent;
+    uint16_t moods[4];              // Q8.8 points, AgentMoodDimension order
+    uint8_t lock_type;
+    uint8_t lock_state;
+    uint16_t break_allowed_duration_seconds;
+    uint32_t utc_lock_start_time;
+    uint32_t utc_unlock_target_time;
+    uint32_t accumulated_seconds;
+    uint32_t utc_break_start_time;
+    uint32_t utc_mood_anchor;       // Moods drift from here on restore
+} AppSnapshot_t;
+
+// Write the current snapshot. Goes through the config cache, so an
+// unchanged snapshot costs nothing; a change of lock state is flushed to
+// flash at once so that no power cut can lose it. Returns 0 on success, -1
+// on failure.
+int app_logic_save_snapshot(void);
+
+#ifdef SIMULATOR
+// Per-device state for the multi-instance simulator (see Utils/sim_instance.h)
+size_t app_logic_instance_size(void);
+void app_logic_instance_bind(void* state);
+
+// The transition table as a Graphviz digraph, and how much of it this
+// device has exercised
+void app_logic_write_state_diagram(FILE* out);
+void app_logic_get_state_coverage(uint32_t* taken, uint32_t* total);
+void app_logic_print_state_coverage(void);
+#endif
 
 // Core application functions
 void app_logic_init(void);
 void app_logic_update(void);
 void app_logic_process_button_event(const bsp_button_event_t* event);
+void app_logic_process_hardware_events(uint32_t events);  // HST_EVT_* bits
 
-// State management
+// State management. Events go through the transition table; a state change
+// runs the old state's exit and the new state's entry action and saves the
+// snapshot. Dispatch returns whether the event changed the state.
+bool app_logic_dispatch_event(AppEvent event);
 void app_logic_change_state(AppState new_state);
 const char* app_logic_get_state_name(AppState state);
+const char* app_logic_get_event_name(AppEvent event);
+AppState app_logic_get_state(void);
+const LockSession_t* app_logic_get_lock_session(void);
+const LockTimeCounters_t* app_logic_get_lock_time_counters(void);
+
+// Agent mood level (Q8.8 points) at the current UTC time
+uint16_t app_logic_get_agent_mood(AgentMoodDimension dimension);
+
+// UTC time the lock timing alarm is set for and why, 0 when none is set
+uint64_t app_logic_get_next_lock_wake(LockWakeReason* reason);
 
 // Display functions (now using Display_Task)
 void app_logic_send_display_command(DisplayCommandID cmd_id, void* data);
@@ -0,0 +1,71 @@
+// CKOS Lock Schedule
+// Next RTC wake instant for a lock session; see lock_schedule.h
+
+#include "lock_schedule.h"
+
+#define SECONDS_PER_MINUTE  60u
+
+// The next instant at which the minutes shown change. Both directions show
+// whole minutes rounded down: a countdown drops one once the remaining time
+// falls below a multiple of 60, a count-up gains one when the elapsed time
+// reaches one.
+static uint64_t next_display_minute(const LockSchedule_t* schedule, uint64_t now_utc) {
+    if (schedule->unlock_utc) {
+        uint64_t remaining = lock_schedule_remaining(schedule->unlock_utc, now_utc);
+        if (remaining == 0) return 0;
+        return now_utc + remaining % SECONDS_PER_MINUTE + 1;
+    }
+    if (schedule->countup_start_utc && schedule->countup_start_utc <= now_utc) {
+        uint64_t elapsed = now_utc - schedule->countup_start_utc;
+        return now_utc + SECONDS_PER_MINUTE - elapsed % SECONDS_PER_MINUTE;
+    }
+    return 0;
+}
+
+uint64_t lock_schedule_next(const LockSchedule_t* schedule, uint64_t now_utc,
+                            LockWakeReason* reason) {
+    LockWakeReason next_reason = LOCK_WAKE_NONE;
+    uint64_t next = 0;
+
+    if (schedule) {
+        uint64_t instants[LOCK_WAKE_COUNT] = {
+            [LOCK_WAKE_UNLOCK]          = schedule->unlock_utc,
+            [LOCK_WAKE_BREAK_END]       = schedule->break_end_utc,
+            [LOCK_WAKE_PENALTY_END]     = schedule->penalty_end_utc,
+            [LOCK_WAKE_CHECKPOINT]      = schedule->checkpoint_utc,
+            [LOCK_WAKE_DISPLAY_MINUTE]  = schedule->countdown_visible ?
+                                          next_display_minute(schedule, now_utc) : 0,
+        };
+        for (int i = LOCK_WAKE_NONE + 1; i < LOCK_WAKE_COUNT; i++) {
+            if (instants[i] == 0) continue;
+            uint64_t at = (instants[i] < now_utc) ? now_utc : instants[i];
+            if (next == 0 || at < next) {
+                next = at;
+                next_reason = (LockWakeReason)i;
+            }
+        }
+    }
+
+    if (reason) *reason = next_reason;
+    return next;
+}
+
+uint64_t lock_schedule_remaining(uint64_t target_utc, uint64_t now_utc) {
+    return (target_utc > now_utc) ? target_utc - now_utc : 0;
+}
+
+bool lock_schedule_reached(uint64_t target_utc, uint64_t now_utc) {
+    return target_utc != 0 && target_utc <= now_utc;
+}
+
+const char* lock_schedule_reason_name(LockWakeReason reason) {
+    switch (reason) {
+        case LOCK_WAKE_NONE:            return "None";
+        case LOCK_WAKE_UNLOCK:          return "Unlock";
+        case LOCK_WAKE_BREAK_END:       return "Break end";
+        case LOCK_WAKE_PENALTY_END:     return "Penalty end";
+        case LOCK_WAKE_CHECKPOINT:      return "Checkpoint";
+        case LOCK_WAKE_DISPLAY_MINUTE:  return "Display minute";
+        default:                        return "Unknown";
+    }
+}
@@ -0,0 +1,66 @@
+#ifndef LOCK_SCHEDULE_H
+#define LOCK_SCHEDULE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Lock timing (Lock_System_Design.txt section 3.3.4). Nothing counts a lock
+// down: every instant is an absolute 64-bit UTC time, remaining time is
+// derived from it when asked for, and the device sleeps on an RTC alarm set
+// for the earliest instant at which something happens. A multi-week lock
+// wakes the application only for those instants.
+
+// =============================================================================
+// WAKE INSTANTS
+// =============================================================================
+
+typedef enum {
+    LOCK_WAKE_NONE = 0,
+    LOCK_WAKE_UNLOCK,               // Unlock target reached
+    LOCK_WAKE_BREAK_END,            // Break allowance used up
+    LOCK_WAKE_PENALTY_END,
+    LOCK_WAKE_CHECKPOINT,           // Lock time counters due for a checkpoint
+    LOCK_WAKE_DISPLAY_MINUTE,       // The visible countdown changes minute
+    LOCK_WAKE_COUNT
+} LockWakeReason;
+
+// Every field is a UTC time in seconds, 0 where it does not apply
+typedef struct {
+    uint64_t unlock_utc;
+    uint64_t break_end_utc;
+    uint64_t penalty_end_utc;
+    uint64_t checkpoint_utc;
+
+    // While the countdown is on screen: counts down to unlock_utc, or up
+    // from countup_start_utc for a lock with no scheduled end
+    bool countdown_visible;
+    uint64_t countup_start_utc;
+} LockSchedule_t;
+
+// =============================================================================
+// LOCK SCHEDULE API
+// =============================================================================
+
+// Earliest instant after now_utc (now_utc itself for one already passed) and
+// why, or 0 and LOCK_WAKE_NONE if nothing is scheduled. Instants that fall
+// together report the first reason in LockWakeReason order.
+uint64_t lock_schedule_next(const LockSchedule_t* schedule, uint64_t now_utc,
+                            LockWakeReason* reason);
+
+// Seconds from now_utc until target_utc, 0 once it has passed
+uint64_t lock_schedule_remaining(uint64_t target_utc, uint64_t now_utc);
+
+// Whether target_utc (non-zero) has been reached
+bool lock_schedule_reached(uint64_t target_utc, uint64_t now_utc);
+
+const char* lock_schedule_reason_name(LockWakeReason reason);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // LOCK_SCHEDULE_H
@@ -0,0 +1,186 @@
+// CKOS Lock Time Counters
+// Delta checkpoints of LockTimeCounters_t in the config store (see lock_time.h)
+
+#include "lock_time.h"
+#include "../Hardware/hardware_api.h"
+#include <stdio.h>
+#include <string.h>
+
+#define DELTA_MAX_SECONDS   0xFFFFu
+
+// =============================================================================
+// RECORDS
+// =============================================================================
+
+static int write_base(LockTime_t* lock_time) {
+    LockTimeBase_t record;
+    memset(&record, 0, sizeof(record));
+    record.counters = lock_time->counters;
+    record.generation = (uint16_t)(lock_time->generation + 1);
+    if (record.generation == 0) record.generation = 1;   // 0: no base yet
+
+    if (hardware_config_write(HARDWARE_CONFIG_KEY_LOCK_TIME_COUNTERS, &record, sizeof(record)) != 0) {
+        lock_time->stats.write_errors++;
+        return -1;
+    }
+
+    // The old delta names the old generation, so it no longer applies
+    lock_time->base = lock_time->counters;
+    lock_time->generation = record.generation;
+    lock_time->deltas_since_base = 0;
+    lock_time->stats.bases_written++;
+    return 0;
+}
+
+// Describes the time accrued since the base as one delta record. Returns
+// false if it takes more than one: several counters moved, the session
+// was reset, or a field would overflow.
+static bool build_delta(const LockTime_t* lock_time, LockTimeDelta_t* delta) {
+    const LockTimeCounters_t* now = &lock_time->counters;
+    const LockTimeCounters_t* base = &lock_time->base;
+    memset(delta, 0, sizeof(*delta));
+
+    bool counter_found = false;
+    uint64_t locked = 0;
+    for (uint32_t i = 0; i < LOCK_COUNTER_COUNT; i++) {
+        if (now->total_locked_seconds[i] == base->total_locked_seconds[i]) continue;
+        if (counter_found || now->total_locked_seconds[i] < base->total_locked_seconds[i]) {
+            return false;
+        }
+        counter_found = true;
+        delta->counter = (uint8_t)i;
+        locked = now->total_locked_seconds[i] - base->total_locked_seconds[i];
+    }
+
+    if (now->session_seconds < base->session_seconds ||
+        now->session_seconds - base->session_seconds != locked ||
+        now->break_seconds < base->break_seconds ||
+        locked > DELTA_MAX_SECONDS ||
+        now->break_seconds - base->break_seconds > DELTA_MAX_SECONDS) {
+        return false;
+    }
+
+    delta->generation = lock_time->generation;
+    delta->sequence = (uint8_t)(lock_time->deltas_since_base + 1);
+    delta->locked_seconds = (uint16_t)locked;
+    delta->break_seconds = (uint16_t)(now->break_seconds - base->break_seconds);
+    return true;
+}
+
+// =============================================================================
+// LOCK TIME API
+// =============================================================================
+
+int lock_time_restore(LockTime_t* lock_time, uint64_t now_ms) {
+    if (!lock_time) return -1;
+    memset(lock_time, 0, sizeof(*lock_time));
+    lock_time->last_checkpoint_ms = now_ms;
+
+    LockTimeBase_t base;
+    int length = hardware_config_read(HARDWARE_CONFIG_KEY_LOCK_TIME_COUNTERS, &base, sizeof(base));
+    if (length < 0) {
+        return 0;   // Nothing saved yet
+    }
+    if (length != (int)sizeof(base)) {
+        printf("LockTime: WARNING - counter record has the wrong size, starting from zero\n");
+        return -1;
+    }
+    lock_time->base = base.counters;
+    lock_time->counters = base.counters;
+    lock_time->generation = base.generation;
+
+    LockTimeDelta_t delta;
+    length = hardware_config_read(HARDWARE_CONFIG_KEY_LOCK_TIME_DELTA, &delta, sizeof(delta));
+    if (length == (int)sizeof(delta) && delta.generation == base.generation &&
+        delta.sequence >= 1 && delta.sequence <= CONFIG_LOCK_TIME_DELTAS_PER_BASE &&
+        delta.counter < LOCK_COUNTER_COUNT) {
+        lock_time->counters.total_locked_seconds[delta.counter] += delta.locked_seconds;
+        lock_time->counters.session_seconds += delta.locked_seconds;
+        lock_time->counters.break_seconds += delta.break_seconds;
+        lock_time->deltas_since_base = delta.sequence;
+        lock_time->stats.deltas_replayed = 1;
+    }
+    return 0;
+}
+
+void lock_time_accrue(LockTime_t* lock_time, LockCounterType counter,
+                      uint32_t locked_seconds, uint32_t break_seconds) {
+    if (!lock_time || counter >= LOCK_COUNTER_COUNT) return;
+    if (locked_seconds == 0 && break_seconds == 0) return;
+
+    lock_time->counters.total_locked_seconds[counter] += locked_seconds;
+    lock_time->counters.session_seconds += locked_seconds;
+    lock_time->counters.break_seconds += break_seconds;
+    lock_time->dirty = true;
+}
+
+void lock_time_end_session(LockTime_t* lock_time) {
+    if (!lock_time) return;
+    if (lock_time->counters.session_seconds == 0 && lock_time->counters.break_seconds == 0) return;
+
+    lock_time->counters.session_seconds = 0;
+    lock_time->counters.break_seconds = 0;
+    lock_time->dirty = true;
+}
+
+int lock_time_checkpoint(LockTime_t* lock_time, uint64_t now_ms) {
+    if (!lock_time) return -1;
+    lock_time->last_checkpoint_ms = now_ms;
+    if (!lock_time->dirty) return 0;
+
+    LockTimeDelta_t delta;
+    int result;
+    if (lock_time->generation != 0 &&
+        lock_time->deltas_since_base < CONFIG_LOCK_TIME_DELTAS_PER_BASE &&
+        build_delta(lock_time, &delta)) {
+        result = hardware_config_write(HARDWARE_CONFIG_KEY_LOCK_TIME_DELTA, &delta, sizeof(delta));
+        if (result == 0) {
+            lock_time->deltas_since_base = delta.sequence;
+            lock_time->stats.deltas_written++;
+        } else {
+            lock_time->stats.write_errors++;
+        }
+    } else {
+        result = write_base(lock_time);
+    }
+
+    // A checkpoint is only worth taking if it reaches flash
+    if (result == 0) result = hardware_config_flush();
+    if (result == 0) lock_time->dirty = false;
+    return result;
+}
+
+uint32_t lock_time_checkpoint_interval_ms(float battery_percentage, bool charging) {
+    if (charging) {
+        return CONFIG_LOCK_TIME_CHECKPOINT_CHARGING_MS;
+    }
+    if (battery_percentage < CONFIG_BATTERY_LOW_THRESHOLD) {
+        return CONFIG_LOCK_TIME_CHECKPOINT_LOW_MS;
+    }
+    return CONFIG_LOCK_TIME_CHECKPOINT_MS;
+}
+
+int lock_time_service(LockTime_t* lock_time, uint64_t now_ms,
+                      float battery_percentage, bool charging) {
+    if (!lock_time) return -1;
+
+    // Last chance before the battery gives out
+    bool critical = !charging && battery_percentage <= CONFIG_BATTERY_CRITICAL_THRESHOLD;
+    if (critical && !lock_time->critical_checkpoint_done) {
+        lock_time->critical_checkpoint_done = true;
+        return lock_time_checkpoint(lock_time, now_ms);
+    }
+    if (!critical) {
+        lock_time->critical_checkpoint_done = false;
+    }
+
+    uint32_t interval = lock_time_checkpoint_interval_ms(battery_percentage, charging);
+    if (now_ms - lock_time->last_checkpoint_ms < interval) {
+        return 0;
+    }
+    return lock_time_checkpoint(lock_time, now_ms);
+}
+
+void lock_time_get_stats(const LockTime_t* lock_time, LockTimeStats_t* stats) {
+    if (lock_time && stats) *stats = lock_time->stats;
+}
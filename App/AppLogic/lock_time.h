@@ -0,0 +1,120 @@
+#ifndef LOCK_TIME_H
+#define LOCK_TIME_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "../Config/app_config.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Lock time counters (Lock_System_Design.txt section 3.2) and their
+// checkpoints in the config store.
+//
+// A full base record (HARDWARE_CONFIG_KEY_LOCK_TIME_COUNTERS) is nine
+// doublewords of flash; a checkpoint instead writes a two-doubleword delta
+// record (HARDWARE_CONFIG_KEY_LOCK_TIME_DELTA) holding the time accrued
+// since the base. Each delta covers everything since the base, so it
+// supersedes the one before it and restore applies only the newest: the
+// base and one delta, two reads. After CONFIG_LOCK_TIME_DELTAS_PER_BASE
+// deltas, or when time accrued that a delta cannot express (a second
+// counter, a new session, a 16-bit overflow), the counters are folded into
+// a new base with the next generation number, which retires the old delta.
+//
+// Checkpoints are taken on a battery-dependent interval: often on the
+// charger, less often when the battery is low (each one costs a flash
+// program), and once more as the battery goes critical.
+
+// =============================================================================
+// COUNTERS
+// =============================================================================
+
+typedef enum {
+    LOCK_COUNTER_AGENT_BEGINNER = 0,    // Rookie
+    LOCK_COUNTER_AGENT_ADVANCED,        // Veteran
+    LOCK_COUNTER_AGENT_PERMANENT,       // Warden
+    LOCK_COUNTER_CUSTOM,
+    LOCK_COUNTER_KEYHOLDER_BASIC,
+    LOCK_COUNTER_KEYHOLDER_REMOTE,
+    LOCK_COUNTER_COUNT
+} LockCounterType;
+
+typedef struct {
+    uint64_t total_locked_seconds[LOCK_COUNTER_COUNT];
+    uint32_t session_seconds;       // Current session, excluding breaks
+    uint32_t break_seconds;         // Current session's breaks
+} LockTimeCounters_t;
+
+// =============================================================================
+// RECORDS
+// =============================================================================
+
+typedef struct {
+    LockTimeCounters_t counters;
+    uint16_t generation;            // Never 0
+    uint16_t reserved;
+} LockTimeBase_t;
+
+typedef struct {
+    uint16_t generation;            // Of the base it applies to
+    uint8_t sequence;               // 1..CONFIG_LOCK_TIME_DELTAS_PER_BASE
+    uint8_t counter;                // LockCounterType the locked time went to
+    uint16_t locked_seconds;        // Since the base, also added to the session
+    uint16_t break_seconds;         // Since the base
+} LockTimeDelta_t;
+
+typedef struct {
+    uint32_t deltas_written;
+    uint32_t bases_written;
+    uint32_t write_errors;
+    uint32_t deltas_replayed;       // At restore: 0 or 1
+} LockTimeStats_t;
+
+typedef struct {
+    LockTimeCounters_t counters;    // Live values
+    LockTimeCounters_t base;        // As stored in the base record
+    uint16_t generation;            // 0 until the first base is written
+    uint8_t deltas_since_base;
+    bool dirty;                     // Accrued since the last checkpoint
+    bool critical_checkpoint_done;
+    uint64_t last_checkpoint_ms;
+    LockTimeStats_t stats;
+} LockTime_t;
+
+// =============================================================================
+// LOCK TIME API
+// =============================================================================
+
+// Loads the counters from the base record and the newest delta; zero if
+// there is no base. Returns 0 on success, -1 if only defaults could be used.
+int lock_time_restore(LockTime_t* lock_time, uint64_t now_ms);
+
+// Adds time to the live counters: locked_seconds to counter and the
+// session, break_seconds to the session's breaks
+void lock_time_accrue(LockTime_t* lock_time, LockCounterType counter,
+                      uint32_t locked_seconds, uint32_t break_seconds);
+
+// Clears the session and break time; folded into a new base at the next
+// checkpoint
+void lock_time_end_session(LockTime_t* lock_time);
+
+// Writes a delta, or a new base when one is due, and flushes it to flash.
+// Returns 0 on success (or nothing to write), -1 on a storage error.
+int lock_time_checkpoint(LockTime_t* lock_time, uint64_t now_ms);
+
+// Checkpoint interval for the battery state
+uint32_t lock_time_checkpoint_interval_ms(float battery_percentage, bool charging);
+
+// Periodic call: checkpoints when the interval has passed, or at once when
+// the battery first reaches the critical threshold
+int lock_time_service(LockTime_t* lock_time, uint64_t now_ms,
+                      float battery_percentage, bool charging);
+
+void lock_time_get_stats(const LockTime_t* lock_time, LockTimeStats_t* stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // LOCK_TIME_H
@@ -26,7 +26,8 @@ void bsp_display_refresh(void);
 void bsp_display_set_pixel(int x, int y, bool on);
 bool bsp_display_get_pixel(int x, int y);
 
-// Text rendering (basic 6x8 font)
+// Text rendering (basic 6x8 font, 7 pixels per character)
+void bsp_display_draw_char(int x, int y, char c);
 void bsp_display_draw_text(int x, int y, const char* text);
 void bsp_display_draw_text_centered(int y, const char* text);
 
@@ -64,8 +65,12 @@ bool bsp_input_poll_event(bsp_button_event_t* event);
 // TIMING ABSTRACTION
 // =============================================================================
 
-// Time functions
+// Time functions. Both ticks count milliseconds from boot and never go
+// backwards. The 32-bit one wraps after 49.7 days, shorter than a long lock
+// session: keep it to differences over short spans, and use the 64-bit one
+// for anything held longer (bsp_get_tick_ms() is its low word).
 uint32_t bsp_get_tick_ms(void);
+uint64_t bsp_get_tick_ms64(void);
 uint64_t bsp_get_utc_time_seconds(void);
 void bsp_delay_ms(uint32_t ms);
 
@@ -90,20 +95,113 @@ void bsp_task_delete(bsp_task_handle_t task);
 void bsp_task_delay(uint32_t ms);
 void bsp_task_yield(void);
 
+// Periodic loops (vTaskDelayUntil): blocks until *last_wake_ms + period_ms
+// and advances *last_wake_ms by period_ms, so the period does not stretch by
+// however long the loop body took. A loop that fell behind returns at once
+// until it has caught up. Start *last_wake_ms at bsp_get_tick_ms64().
+void bsp_task_delay_until(uint64_t* last_wake_ms, uint32_t period_ms);
+
+bsp_task_handle_t bsp_task_get_current(void);
+
+// Timeout value that blocks until the event arrives
+#define BSP_WAIT_FOREVER  0xFFFFFFFFu
+
+// Task notifications: every task owns a 32-bit pending-bits word. Notifying
+// is a single OR plus a wake, with no message copy, so prefer it to queues
+// for frequent payload-free events. Waiting blocks until it is non-zero, then
+// returns and clears it (0 on timeout).
+bool bsp_task_notify(bsp_task_handle_t task, uint32_t bits);
+bool bsp_task_notify_from_isr(bsp_task_handle_t task, uint32_t bits);
+uint32_t bsp_task_notify_wait(uint32_t timeout_ms);
+
+// Waits until any bit in wait_mask is pending and returns (and clears) only
+// those bits; bits outside the mask stay pending for a later wait
+uint32_t bsp_task_notify_wait_bits(uint32_t wait_mask, uint32_t timeout_ms);
+
+// bsp_task_notify_wait_bits() for a periodic loop that events wake early:
+// waits at most until *last_wake_ms + period_ms, and advances *last_wake_ms
+// by period_ms only once that instant is reached, so early wakes leave the
+// loop's rate alone
+uint32_t bsp_task_notify_wait_until(uint32_t wait_mask, uint64_t* last_wake_ms, uint32_t period_ms);
+
+// task gets notify_bits each time a button event is queued (from the EXTI
+// interrupt on target), so the reader of bsp_input_poll_event() can block
+// until there is input instead of polling. A NULL task stops them.
+void bsp_input_set_notify(bsp_task_handle_t task, uint32_t notify_bits);
+
 // Queue management (for inter-task communication)
 bsp_queue_handle_t bsp_queue_create(uint8_t length, uint8_t item_size);
 void bsp_queue_delete(bsp_queue_handle_t queue);
 bool bsp_queue_send(bsp_queue_handle_t queue, const void* item, uint32_t timeout_ms);
 bool bsp_queue_receive(bsp_queue_handle_t queue, void* item, uint32_t timeout_ms);
 
+// Mutexes for state that more than one task changes, from a static table like
+// the queues, with priority inheritance on the target. Not recursive, and for
+// task context only. A NULL handle locks nothing.
+typedef void* bsp_mutex_handle_t;
+bsp_mutex_handle_t bsp_mutex_create(void);
+void bsp_mutex_lock(bsp_mutex_handle_t mutex);
+void bsp_mutex_unlock(bsp_mutex_handle_t mutex);
+
 // RTOS scheduler
 void bsp_scheduler_start(void);
 
+// =============================================================================
+// SOFTWARE TIMERS
+// =============================================================================
+
+// One-shot or periodic timers, so tasks block until their next deadline
+// instead of polling bsp_get_tick_ms(). Serviced by the FreeRTOS timer task
+// on STM32 and by the virtual clock on the simulator.
+//
+// On expiry a timer either runs its callback in timer-service context (keep
+// it short and never block) or notifies a task with its notify bits.
+
+typedef void* bsp_timer_handle_t;
+typedef void (*bsp_timer_callback_t)(bsp_timer_handle_t timer, void* context);
+
+bsp_timer_handle_t bsp_timer_create(const char* name,
+                                    uint32_t period_ms,
+                                    bool periodic,
+                                    bsp_timer_callback_t callback,
+                                    void* context);
+bsp_timer_handle_t bsp_timer_create_notify(const char* name,
+                                           uint32_t period_ms,
+                                           bool periodic,
+                                           bsp_task_handle_t task,
+                                           uint32_t notify_bits);
+void bsp_timer_delete(bsp_timer_handle_t timer);
+
+// Start (or restart) counting a full period from now
+bool bsp_timer_start(bsp_timer_handle_t timer);
+bool bsp_timer_stop(bsp_timer_handle_t timer);
+// Changes the period and restarts the timer
+bool bsp_timer_set_period(bsp_timer_handle_t timer, uint32_t period_ms);
+bool bsp_timer_is_active(bsp_timer_handle_t timer);
+
+// =============================================================================
+// RTC ALARM
+// =============================================================================
+
+// Notifies task with notify_bits once bsp_get_utc_time_seconds() reaches
+// utc_seconds, waking the MCU from STOP2. There is one alarm: setting it
+// again replaces it. An alarm in the past, or one the clock passes while it
+// is being set, fires at once. An alarm too far ahead for the hardware fires
+// early at its limit, so callers re-check the time when woken and set the
+// alarm again.
+int bsp_rtc_set_alarm(uint64_t utc_seconds, bsp_task_handle_t task, uint32_t notify_bits);
+void bsp_rtc_cancel_alarm(void);
+
 // =============================================================================
 // HARDWARE SERVICES ABSTRACTION
 // =============================================================================
 
-// Storage operations
+// Storage operations. Storage is internal flash: writes program whole
+// doublewords, each of which must be erased since it was last programmed,
+// and erase works on whole pages.
+#define BSP_STORAGE_PAGE_SIZE       2048    // STM32L452 flash page
+#define BSP_STORAGE_PROGRAM_UNIT    8       // Doubleword programming
+
 typedef struct {
     uint32_t address;
     uint8_t* data;
@@ -112,6 +210,18 @@ typedef struct {
 
 int bsp_storage_read(const bsp_storage_operation_t* op);
 int bsp_storage_write(const bsp_storage_operation_t* op);
+// Erase every page in [address, address + length); both must be page aligned
+int bsp_storage_erase(uint32_t address, uint32_t length);
+
+// CRC unit: continues crc over data, MSB first with no final XOR (start from
+// all ones; see utils_crc16()/utils_crc32()). On target long buffers are fed
+// to the unit by DMA while the caller blocks.
+typedef enum {
+    BSP_CRC_16_CCITT = 0,           // Polynomial 0x1021
+    BSP_CRC_32                      // Polynomial 0x04C11DB7
+} bsp_crc_type_t;
+
+uint32_t bsp_crc_update(bsp_crc_type_t type, uint32_t crc, const uint8_t* data, size_t length);
 
 // Sensor readings
 typedef struct {
@@ -125,16 +235,40 @@ typedef struct {
 
 int bsp_sensors_read(bsp_sensor_readings_t* readings);
 
-// Lock mechanism control
-typedef enum {
-    BSP_LOCK_STATE_LOCKED = 0,
-    BSP_LOCK_STATE_UNLOCKING,
-    BSP_LOCK_STATE_UNLOCKED,
-    BSP_LOCK_STATE_ERROR
-} bsp_lock_state_t;
+// Background sampling. Every CONFIG_SENSOR_BURST_PERIOD_MS, starting now,
+// the ADC takes a short burst of oversampled scans of the battery and
+// temperature channels by DMA; each burst is averaged and filtered
+// (Utils/sensor_pipeline.h) in the DMA interrupt without waking any task.
+// task gets notify_bits only when a filtered value crosses a battery or
+// temperature threshold, or snapshot_period_ms after the last notification
+// (notify_bits 0: never). While it runs bsp_sensors_read() returns the
+// filtered values. The ADC and DMA halt in STOP2, so each burst holds
+// insomnia while it runs; between bursts the device may enter STOP2.
+int bsp_sensors_start(bsp_task_handle_t task, uint32_t notify_bits, uint32_t snapshot_period_ms);
+void bsp_sensors_stop(void);
+
+typedef struct {
+    uint32_t blocks;                // Bursts filtered
+    uint32_t wakeups;               // Blocks that called for the task
+    uint32_t threshold_wakeups;     // ... because a threshold was crossed
+} bsp_sensor_stats_t;
+
+void bsp_sensors_get_stats(bsp_sensor_stats_t* stats);
+
+// Door and latch switches: task gets notify_bits on any change of either
+// (EXTI lines on target, which also wake STOP2), so they need no sampling
+// and are reported whether or not background sampling runs. Their levels
+// come from bsp_sensors_read(). notify_bits 0: never.
+void bsp_sensors_set_edge_notify(bsp_task_handle_t task, uint32_t notify_bits);
 
-int bsp_lock_unlock(void);
-bsp_lock_state_t bsp_lock_get_state(void);
+// Memory wire drive. The wire is switched by a PWM channel at
+// BSP_WIRE_PWM_HZ; duty is in per mille and 0 turns the output off. The
+// timer stops in STOP2, so the caller holds insomnia while the duty is
+// non-zero. Latch and door feedback come from bsp_sensors_read().
+#define BSP_WIRE_PWM_HZ         1000u
+#define BSP_WIRE_DUTY_MAX       1000u
+
+int bsp_wire_set_duty(uint16_t duty_permille);
 
 // Power management  
 typedef enum {
@@ -146,6 +280,27 @@ typedef enum {
 
 int bsp_power_set_mode(bsp_power_mode_t mode);
 
+// Sleep suppression ("insomnia"). Calls nest; while the level is non-zero the
+// tickless idle hook only enters SLEEP (WFI), at zero it may enter STOP2.
+void bsp_power_suppress_sleep(void);
+void bsp_power_allow_sleep(void);
+uint32_t bsp_power_get_insomnia_level(void);
+
+// Idle periods shorter than this stay in SLEEP even without insomnia
+#define BSP_POWER_STOP2_MIN_IDLE_MS  5
+
+// Tickless idle residency accounting (time spent per MCU mode since reset)
+typedef struct {
+    uint64_t run_ms;
+    uint64_t sleep_ms;
+    uint64_t stop2_ms;
+    uint32_t sleep_entries;
+    uint32_t stop2_entries;
+} bsp_power_residency_t;
+
+void bsp_power_get_residency(bsp_power_residency_t* residency);
+void bsp_power_reset_residency(void);
+
 // =============================================================================
 // PLATFORM DETECTION
 // =============================================================================
@@ -167,6 +322,107 @@ int bsp_power_set_mode(bsp_power_mode_t mode);
 void bsp_debug_print_display(void); // ASCII art display output
 void bsp_debug_set_sensor_value(const char* sensor, float value);
 void bsp_debug_trigger_button(bsp_button_id_t button);
+
+// Tickless idle model: idle for expected_idle_ms (or until input arrives),
+// choosing SLEEP or STOP2 the same way the target idle hook does
+void bsp_sim_idle(uint32_t expected_idle_ms);
+void bsp_debug_print_power_residency(void);
+
+// Energy model: a current draw per subsystem, integrated over the virtual
+// clock from the MCU mode residency above and the activity the other models
+// count (display frames, sensor sampling, wire on-time, flash busy time).
+// Subsystem currents add to the MCU's. Reset at the start of a scenario,
+// run it, then read or print the charge drawn since.
+typedef enum {
+    BSP_SIM_ENERGY_MCU_RUN = 0,
+    BSP_SIM_ENERGY_MCU_SLEEP,
+    BSP_SIM_ENERGY_MCU_STOP2,
+    BSP_SIM_ENERGY_DISPLAY_SPI,
+    BSP_SIM_ENERGY_ADC,
+    BSP_SIM_ENERGY_MEMORY_WIRE,
+    BSP_SIM_ENERGY_FLASH,
+    BSP_SIM_ENERGY_COUNT
+} bsp_sim_energy_subsystem_t;
+
+typedef struct {
+    float mcu_run_ua;               // 80 MHz, executing from flash
+    float mcu_sleep_ua;             // WFI, clocks running
+    float mcu_stop2_ua;             // STOP2 with the RTC on LSE
+    uint32_t task_run_us;           // CPU time per task activation (timer expiry)
+    float display_spi_ua;           // SPI and display controller during a transfer
+    uint32_t display_spi_khz;       // SPI clock
+    float adc_ua;                   // ADC, VREFINT and temperature sensor while sampling
+    float memory_wire_ua;           // Heating current at full duty
+    float flash_ua;                 // Program/erase, on top of the MCU
+} bsp_sim_energy_model_t;
+
+typedef struct {
+    uint32_t elapsed_ms;
+    double charge_mah[BSP_SIM_ENERGY_COUNT];
+    double total_mah;
+    double average_ua;
+} bsp_sim_energy_report_t;
+
+void bsp_sim_energy_get_default_model(bsp_sim_energy_model_t* model);
+void bsp_sim_energy_set_model(const bsp_sim_energy_model_t* model);  // NULL: default
+void bsp_sim_energy_reset(void);
+void bsp_sim_energy_get_report(bsp_sim_energy_report_t* report);
+const char* bsp_sim_energy_subsystem_name(bsp_sim_energy_subsystem_t subsystem);
+void bsp_debug_print_energy_report(const char* scenario);
+
+// Virtual clock behind bsp_get_tick_ms()/bsp_get_utc_time_seconds(). It
+// follows the host clock by default; in fast-forward mode it only moves when
+// the simulation idles or delays, so long scenarios run at host speed.
+void bsp_sim_clock_set_fast_forward(bool enabled);
+bool bsp_sim_clock_is_fast_forward(void);
+void bsp_sim_clock_advance(uint32_t ms);
+
+// Software timer service, driven from the main loop: run every expired
+// timer, then idle for at most bsp_sim_timer_next_expiry_ms()
+void bsp_sim_timer_process(void);
+uint32_t bsp_sim_timer_next_expiry_ms(void);  // BSP_WAIT_FOREVER if none armed
+
+// Multi-instance simulation: everything the BSP keeps per device (clock,
+// storage, framebuffer, sensors, timers, queues, power model) lives in one
+// caller-owned block. Binding a block makes every BSP call on the calling
+// thread act on that device; NULL rebinds the process default device.
+size_t bsp_sim_instance_size(void);
+void bsp_sim_instance_init(void* state);    // Blank device with default sensors
+void bsp_sim_instance_bind(void* state);
+const uint8_t* bsp_sim_get_framebuffer(void);
+void bsp_sim_instance_release(void* state); // Unmaps the device's flash file
+
+// Flash model behind bsp_storage_*(): enforces erase-before-write per
+// doubleword, counts erase cycles per page and charges typical L452 erase and
+// program latency (which advances the clock in fast-forward). Storage is a
+// blank RAM image until a backing file is opened; the file holds the flash
+// image followed by the per-page erase counters, so wear accumulates across
+// runs.
+typedef struct {
+    uint32_t reads;
+    uint32_t bytes_read;
+    uint32_t writes;
+    uint32_t doublewords_programmed;
+    uint32_t page_erases;
+    uint32_t program_errors;        // Writes rejected over unerased doublewords
+    uint64_t busy_us;               // Modelled erase + program time
+    uint32_t max_page_erase_count;  // Lifetime wear of the most-erased page
+} bsp_sim_storage_stats_t;
+
+int bsp_sim_storage_open(const char* path);     // Created blank if missing
+void bsp_sim_storage_close(void);
+void bsp_sim_storage_get_stats(bsp_sim_storage_stats_t* stats);
+void bsp_sim_storage_reset_stats(void);         // Lifetime erase counts are kept
+uint32_t bsp_sim_storage_get_page_erase_count(uint32_t page);
+void bsp_debug_print_storage_stats(void);
+
+// Memory wire and latch model: the wire heats in proportion to the duty and
+// cools toward the sensor temperature (first order). The latch lets go once
+// the wire passes its release temperature and the ejector then opens the
+// door. Debug values: "wire_heat" scales the heating (a weak wire or low
+// battery), "door_blocked" non-zero keeps the door shut; setting "door" to
+// closed re-engages the latch.
+float bsp_sim_wire_get_temperature(void);
 #endif
 
 #ifdef __cplusplus
@@ -44,33 +44,58 @@
 #define CONFIG_HARDWARE_REQUEST_QUEUE_SIZE  10      // Hardware request messages
 #define CONFIG_DISPLAY_COMMAND_QUEUE_SIZE   16      // Display command messages
 
+// Static kernel object storage (target never uses the FreeRTOS heap for these)
+#define CONFIG_RTOS_MAX_TASKS               4       // BSP-created tasks
+#define CONFIG_RTOS_STACK_ARENA_SIZE        (CONFIG_HARDWARE_TASK_STACK_SIZE + \
+                                             CONFIG_APP_LOGIC_TASK_STACK_SIZE + \
+                                             CONFIG_DISPLAY_TASK_STACK_SIZE + 512)
+#define CONFIG_RTOS_MAX_QUEUES              4       // BSP-created queues
+#define CONFIG_RTOS_QUEUE_ARENA_SIZE        2048    // Queue item storage, all queues
+#define CONFIG_RTOS_MAX_MUTEXES             2       // BSP-created mutexes
+
 // =============================================================================
 // TIMING CONFIGURATION
 // =============================================================================
 
 // Task update frequencies
 #define CONFIG_APP_LOGIC_UPDATE_FREQ_HZ     60      // 60 FPS for responsive UI
-#define CONFIG_DISPLAY_UPDATE_FREQ_HZ       30      // 30 FPS to save power
+#define CONFIG_DISPLAY_ANIMATION_FREQ_HZ    30      // Animations; other screens refresh by policy
+#define CONFIG_DISPLAY_STATUS_PERIOD_MS     1000    // Clock screens (verification)
 #define CONFIG_HARDWARE_UPDATE_FREQ_HZ      10      // 10 Hz for sensors
 
 // Timeout values
-#define CONFIG_DISPLAY_SLEEP_TIMEOUT_MS     30000   // 30 seconds
+#define CONFIG_DISPLAY_SLEEP_TIMEOUT_MS     30000   // 30 seconds without input blanks the display
 #define CONFIG_BUTTON_REPEAT_DELAY_MS       500     // Initial repeat delay
 #define CONFIG_BUTTON_REPEAT_RATE_MS        100     // Subsequent repeat rate
 
+// Local time (see Utils/civil_time.h): the daylight saving rule followed
+// while DST is on. 0 = one extra hour all year, 1 = EU, 2 = US.
+#define CONFIG_TIME_DST_RULE                1
+
 // =============================================================================
 // MEMORY CONFIGURATION
 // =============================================================================
 
 // Buffer sizes
 #define CONFIG_TEXT_BUFFER_SIZE             64      // General text buffers
-#define CONFIG_LOG_ENTRY_MAX_SIZE           256     // Log entry max size
 #define CONFIG_PIN_MAX_LENGTH               8       // Maximum PIN length
 
-// Storage layout
+// Fixed-block memory pools (see Utils/memory_pool.h), at most 32 blocks each
+#define CONFIG_POOL_DISPLAY_PAYLOAD_BLOCKS  8       // Queued ACTIVATE_SCREEN payloads
+#define CONFIG_POOL_STORAGE_OP_BLOCKS       8       // Write-back cached config records
+#define CONFIG_POOL_STORAGE_OP_SIZE         64      // Cache line header plus small record
+
+// Storage layout, in whole BSP_STORAGE_PAGE_SIZE flash pages
 #define CONFIG_STORAGE_CONFIG_START_ADDR    0x0000  // Configuration start
 #define CONFIG_STORAGE_CONFIG_SIZE          4096    // 4KB for config
 #define CONFIG_STORAGE_LOG_START_ADDR       0x1000  // Log storage start
+#define CONFIG_STORAGE_LOG_SIZE             4096    // 4KB for logs
+#define CONFIG_STORAGE_TOTAL_SIZE           (CONFIG_STORAGE_LOG_START_ADDR + CONFIG_STORAGE_LOG_SIZE)
+
+// Record store in the config region (see Utils/kv_store.h)
+#define CONFIG_KV_STORE_MAX_KEYS            16      // Distinct record keys
+#define CONFIG_KV_STORE_MAX_VALUE_SIZE      256     // Largest record value
+#define CONFIG_CONFIG_CACHE_FLUSH_MS        60000   // Longest a cached write stays unflushed
 
 // =============================================================================
 // AGENT SYSTEM CONFIGURATION
@@ -79,10 +104,12 @@
 // Agent personalities
 #define CONFIG_AGENT_COUNT                  3       // Rookie, Veteran, Warden
 
-// Mood system ranges
-#define CONFIG_AGENT_MOOD_MIN               0.0f    // Minimum mood value
-#define CONFIG_AGENT_MOOD_MAX               1.0f    // Maximum mood value
-#define CONFIG_AGENT_MOOD_DECAY_RATE        0.001f  // Per update decay
+// Mood system (see AppLogic/agent_mood.h): levels in points, Q8.8 in memory
+#define CONFIG_AGENT_MOOD_MIN               0       // Minimum mood level
+#define CONFIG_AGENT_MOOD_MAX               100     // Maximum mood level
+#define CONFIG_AGENT_MOOD_DRIFT_PERIOD_S    300     // Drift toward the baseline...
+#define CONFIG_AGENT_MOOD_DRIFT_Q8          640     // ...2.5 points per period (Q8.8)
+#define CONFIG_AGENT_MOOD_LOCK_HOURS_MIN    10      // Lock hours before the baseline shifts
 
 // =============================================================================
 // LOCK SYSTEM CONFIGURATION
@@ -92,9 +119,26 @@
 #define CONFIG_LOCK_MIN_DURATION_SECONDS    60      // 1 minute minimum
 #define CONFIG_LOCK_MAX_DURATION_SECONDS    (100UL * 365 * 24 * 3600) // 100 years max
 
-// Memory wire parameters
-#define CONFIG_MEMORY_WIRE_TARGET_TEMP      70      // Target temperature in °C
-#define CONFIG_MEMORY_WIRE_HEAT_DURATION    5000    // Heat duration in ms
+// Lock time counter checkpoints (see AppLogic/lock_time.h)
+#define CONFIG_LOCK_TIME_CHECKPOINT_MS          300000  // Battery above low threshold
+#define CONFIG_LOCK_TIME_CHECKPOINT_CHARGING_MS 60000   // On the charger
+#define CONFIG_LOCK_TIME_CHECKPOINT_LOW_MS      1200000 // Battery below low threshold
+#define CONFIG_LOCK_TIME_DELTAS_PER_BASE        8       // Deltas before a new base record
+
+// Memory wire actuation (see Utils/wire_actuator.h)
+#define CONFIG_MEMORY_WIRE_TARGET_TEMP      70      // Setpoint in °C, first attempt
+#define CONFIG_MEMORY_WIRE_RETRY_STEP_TEMP  10      // Setpoint added per retry
+#define CONFIG_MEMORY_WIRE_MAX_TEMP         100     // Setpoint ceiling in °C
+#define CONFIG_MEMORY_WIRE_HEAT_DURATION    5000    // Heating window per attempt in ms
+#define CONFIG_MEMORY_WIRE_MAX_ATTEMPTS     4
+#define CONFIG_MEMORY_WIRE_CONTROL_MS       20      // Duty update period
+#define CONFIG_MEMORY_WIRE_HEAT_RATE        150     // Wire model: °C/s at full duty
+#define CONFIG_MEMORY_WIRE_TAU_MS           2000    // Wire model: cooling time constant
+#define CONFIG_MEMORY_WIRE_GAIN             50      // Duty (per mille) per °C below setpoint
+#define CONFIG_MEMORY_WIRE_LATCH_SETTLE_MS  200     // Latch still watched after heating
+#define CONFIG_MEMORY_WIRE_EJECTOR_MS       500     // Door must open this soon after the latch
+#define CONFIG_MEMORY_WIRE_RETRY_DELAY_MS   3000    // Cooling between attempts
+#define CONFIG_MEMORY_WIRE_COOLDOWN_MS      10000   // Before another unlock sequence
 
 // =============================================================================
 // CONNECTIVITY CONFIGURATION  
@@ -116,10 +160,20 @@
 // Battery thresholds
 #define CONFIG_BATTERY_LOW_THRESHOLD        20      // 20% low battery warning
 #define CONFIG_BATTERY_CRITICAL_THRESHOLD   5       // 5% critical battery
+#define CONFIG_BATTERY_HYSTERESIS_PERCENT   2       // Rise above a threshold before it re-arms
+
+// Temperature thresholds (MCU die sensor)
+#define CONFIG_TEMPERATURE_OVER_THRESHOLD_C 60      // Over-temperature warning
+#define CONFIG_TEMPERATURE_HYSTERESIS_C     5       // Cool below by this before it re-arms
+
+// Sensor sampling (see Utils/sensor_pipeline.h)
+#define CONFIG_SENSOR_BURST_PERIOD_MS       1000    // One ADC burst (one block) per period
+#define CONFIG_SENSOR_FILTER_SHIFT          3       // Each block moves the filter 1/8 of the way
 
 // Power save timeouts
 #define CONFIG_IDLE_TO_SLEEP_TIMEOUT_MS     60000   // 1 minute to sleep
 #define CONFIG_SLEEP_TO_DEEP_SLEEP_MS       300000  // 5 minutes to deep sleep
+#define CONFIG_POWER_MAX_INSOMNIA_REASONS   8       // Distinct sleep suppression reasons tracked
 
 // =============================================================================
 // DEBUG CONFIGURATION
@@ -2,32 +2,242 @@
 // Unified display system that runs on both STM32 and simulator through BSP abstraction
 
 #include "display_api.h"
+#include "../Config/app_config.h"
+#include "../Utils/sim_instance.h"
 #include <string.h>
 #include <stdio.h>
 #include <stdarg.h>
 
+// ACTIVATE_SCREEN payloads are copied into a pool block when the command is
+// queued: callers pass the address of a stack local, which is gone by the time
+// the display task processes the command
+typedef union {
+    MenuScreenData menu;
+    TimezoneScreenData timezone;
+    TimeScreenData time;
+    SettingsScreenData settings;
+    AgentSelectionScreenData agent_selection;
+    AgentInteractionScreenData agent_interaction;
+    LockStatusScreenData lock_status;
+    CustomLockConfigScreenData custom_lock;
+    KeyholderConfigScreenData keyholder;
+    PinEntryScreenData pin_entry;
+    SpinWheelScreenData spin_wheel;
+    VerificationScreenData verification;
+} ScreenPayload_t;
+
 // Display Task state (per architecture documentation)
-static struct {
+typedef struct {
     ScreenID current_screen;
     ThemeID current_theme;
     DisplayCommand command_queue[16];  // Simplified queue for unified implementation
     int queue_head, queue_tail, queue_count;
     bool initialized;
-} display_task_state = {0};
-
-// Current screen data
-static MenuScreenData current_menu_data = {0};
-static TimezoneScreenData current_timezone_data = {0};
-static TimeScreenData current_time_data = {0};
-static SettingsScreenData current_settings_data = {0};
-static AgentSelectionScreenData current_agent_selection_data = {0};
-static AgentInteractionScreenData current_agent_interaction_data = {0};
-static LockStatusScreenData current_lock_status_data = {0};
-static CustomLockConfigScreenData current_custom_lock_data = {0};
-static KeyholderConfigScreenData current_keyholder_data = {0};
-static PinEntryScreenData current_pin_entry_data = {0};
-static SpinWheelScreenData current_spin_wheel_data = {0};
-static VerificationScreenData current_verification_data = {0};
+    
+    // Current screen data
+    MenuScreenData current_menu_data;
+    TimezoneScreenData current_timezone_data;
+    TimeScreenData current_time_data;
+    SettingsScreenData current_settings_data;
+    AgentSelectionScreenData current_agent_selection_data;
+    AgentInteractionScreenData current_agent_interaction_data;
+    LockStatusScreenData current_lock_status_data;
+    CustomLockConfigScreenData current_custom_lock_data;
+    KeyholderConfigScreenData current_keyholder_data;
+    PinEntryScreenData current_pin_entry_data;
+    SpinWheelScreenData current_spin_wheel_data;
+    VerificationScreenData current_verification_data;
+    
+    // Queued screen payloads
+    MemoryPool_t payload_pool;
+    uint8_t payload_arena[MEMORY_POOL_BLOCK_SIZE(sizeof(ScreenPayload_t)) *
+                          CONFIG_POOL_DISPLAY_PAYLOAD_BLOCKS]
+        __attribute__((aligned(MEMORY_POOL_ALIGNMENT)));
+    
+    // Refresh governor
+    bool dirty;                             // Current screen changed since its last frame
+    bool blanked;                           // Cleared for inactivity until the next input
+    uint32_t last_frame_ms;
+    volatile uint32_t last_activity_ms;     // Also written from the input path
+    bsp_task_handle_t notify_task;
+    uint32_t notify_bits;
+    DisplayRefreshStats refresh_stats;
+    
+    // Spin-the-wheel animation started by GAME_SPIN_THE_WHEEL_START_ANIM
+    int spin_target_segment;
+    bool spin_timed;
+    uint32_t spin_end_ms;
+} DisplayTaskState;
+
+// One copy per simulated device
+SIM_INSTANCE_STATE(DisplayTaskState, display_task_state);
+#define display_task_state SIM_INSTANCE(display_task_state)
+
+#ifdef SIMULATOR
+size_t display_instance_size(void) {
+    return sizeof(DisplayTaskState);
+}
+
+void display_instance_bind(void* state) {
+    SIM_INSTANCE_BIND(display_task_state, state);
+}
+#endif
+
+// Size of the data struct a screen expects, 0 if it takes none
+static size_t screen_data_size(ScreenID screen_id) {
+    switch (screen_id) {
+        case SCREEN_ID_MAIN_MENU:               return sizeof(MenuScreenData);
+        case SCREEN_ID_TIMEZONE_SETUP:          return sizeof(TimezoneScreenData);
+        case SCREEN_ID_TIME_SETUP:              return sizeof(TimeScreenData);
+        case SCREEN_ID_SETTINGS:                return sizeof(SettingsScreenData);
+        case SCREEN_ID_AGENT_SELECTION:         return sizeof(AgentSelectionScreenData);
+        case SCREEN_ID_AGENT_INTERACTION:       return sizeof(AgentInteractionScreenData);
+        case SCREEN_ID_LOCK_STATUS:             return sizeof(LockStatusScreenData);
+        case SCREEN_ID_LOCK_CONFIG_CUSTOM:      return sizeof(CustomLockConfigScreenData);
+        case SCREEN_ID_LOCK_CONFIG_KEYHOLDER:   return sizeof(KeyholderConfigScreenData);
+        case SCREEN_ID_PIN_ENTRY:               return sizeof(PinEntryScreenData);
+        case SCREEN_ID_GAME_SPIN_WHEEL:         return sizeof(SpinWheelScreenData);
+        case SCREEN_ID_VERIFICATION:            return sizeof(VerificationScreenData);
+        default:                                return 0;
+    }
+}
+
+// =============================================================================
+// REFRESH POLICY
+// =============================================================================
+
+#define DISPLAY_ANIMATION_PERIOD_MS (1000 / CONFIG_DISPLAY_ANIMATION_FREQ_HZ)
+
+static const DisplayRefreshPolicy refresh_policies[SCREEN_ID_COUNT] = {
+    [SCREEN_ID_WELCOME]                 = { DISPLAY_REFRESH_STATIC, 0 },
+    [SCREEN_ID_TIMEZONE_SETUP]          = { DISPLAY_REFRESH_ON_CHANGE, 0 },
+    [SCREEN_ID_TIME_SETUP]              = { DISPLAY_REFRESH_ON_CHANGE, 0 },
+    [SCREEN_ID_MAIN_MENU]               = { DISPLAY_REFRESH_ON_CHANGE, 0 },
+    [SCREEN_ID_LOCK_SETUP]              = { DISPLAY_REFRESH_ON_CHANGE, 0 },
+    [SCREEN_ID_AGENT_SELECTION]         = { DISPLAY_REFRESH_ON_CHANGE, 0 },
+    [SCREEN_ID_AGENT_INTERACTION]       = { DISPLAY_REFRESH_ON_CHANGE, 0 },
+    [SCREEN_ID_LOCK_STATUS]             = { DISPLAY_REFRESH_ON_CHANGE, 0 },
+    [SCREEN_ID_LOCK_CONFIG_CUSTOM]      = { DISPLAY_REFRESH_ON_CHANGE, 0 },
+    [SCREEN_ID_LOCK_CONFIG_KEYHOLDER]   = { DISPLAY_REFRESH_ON_CHANGE, 0 },
+    [SCREEN_ID_PIN_ENTRY]               = { DISPLAY_REFRESH_ON_CHANGE, 0 },
+    [SCREEN_ID_GAME_SPIN_WHEEL]         = { DISPLAY_REFRESH_ANIMATION, DISPLAY_ANIMATION_PERIOD_MS },
+    [SCREEN_ID_VERIFICATION]            = { DISPLAY_REFRESH_PERIODIC, CONFIG_DISPLAY_STATUS_PERIOD_MS },
+    [SCREEN_ID_SETTINGS]                = { DISPLAY_REFRESH_ON_CHANGE, 0 },
+    [SCREEN_ID_ERROR]                   = { DISPLAY_REFRESH_STATIC, 0 },
+};
+
+DisplayRefreshPolicy display_get_refresh_policy(ScreenID screen_id) {
+    if ((unsigned)screen_id >= SCREEN_ID_COUNT) {
+        DisplayRefreshPolicy fallback = { DISPLAY_REFRESH_ON_CHANGE, 0 };
+        return fallback;
+    }
+    return refresh_policies[screen_id];
+}
+
+static bool is_animating(void) {
+    return display_task_state.current_screen == SCREEN_ID_GAME_SPIN_WHEEL &&
+           display_task_state.current_spin_wheel_data.is_spinning;
+}
+
+// Whether cmd changes what the current screen shows. Static screens only
+// change by being activated.
+static bool command_changes_screen(const DisplayCommand* cmd) {
+    ScreenID screen = display_task_state.current_screen;
+    if (cmd->id == DISPLAY_CMD_ACTIVATE_SCREEN) return true;
+    if (display_get_refresh_policy(screen).mode == DISPLAY_REFRESH_STATIC) return false;
+    
+    switch (cmd->id) {
+        case DISPLAY_CMD_SET_THEME:
+            return true;
+        case DISPLAY_CMD_UPDATE_AGENT_MOOD:
+            return screen == SCREEN_ID_AGENT_INTERACTION;
+        case DISPLAY_CMD_UPDATE_LOCK_STATUS:
+            return screen == SCREEN_ID_LOCK_STATUS;
+        case DISPLAY_CMD_GAME_SPIN_THE_WHEEL_START_ANIM:
+        case DISPLAY_CMD_GAME_SPIN_THE_WHEEL_SHOW_RESULT:
+            return screen == SCREEN_ID_GAME_SPIN_WHEEL;
+        default:
+            return false;
+    }
+}
+
+// Milliseconds until the policy wants the next frame (0: due now)
+static uint32_t next_frame_ms(uint32_t now) {
+    if (display_task_state.dirty || display_task_state.queue_count > 0) return 0;
+    
+    DisplayRefreshPolicy policy = display_get_refresh_policy(display_task_state.current_screen);
+    bool timed = policy.mode == DISPLAY_REFRESH_PERIODIC ||
+                 (policy.mode == DISPLAY_REFRESH_ANIMATION && is_animating());
+    if (!timed) return BSP_WAIT_FOREVER;
+    
+    uint32_t since = now - display_task_state.last_frame_ms;
+    return (since >= policy.period_ms) ? 0 : policy.period_ms - since;
+}
+
+// When the frame drawn at now counts from. A timed frame keeps the policy's
+// phase, so waking late does not stretch the period; a changed screen, or a
+// frame more than a period behind, starts the phase again from now.
+static uint32_t frame_time(uint32_t now) {
+    uint32_t period = display_get_refresh_policy(display_task_state.current_screen).period_ms;
+    uint32_t since = now - display_task_state.last_frame_ms;
+    if (display_task_state.dirty || period == 0 || since < period || since >= 2 * period) {
+        return now;
+    }
+    return display_task_state.last_frame_ms + period;
+}
+
+static uint32_t idle_ms(uint32_t now) {
+    return now - __atomic_load_n(&display_task_state.last_activity_ms, __ATOMIC_ACQUIRE);
+}
+
+static void wake_display_task(void) {
+    if (display_task_state.notify_task) {
+        bsp_task_notify(display_task_state.notify_task, display_task_state.notify_bits);
+    }
+}
+
+uint32_t display_task_next_update_ms(void) {
+    if (!display_task_state.initialized) return BSP_WAIT_FOREVER;
+    
+    uint32_t now = bsp_get_tick_ms();
+    uint32_t idle = idle_ms(now);
+    if (display_task_state.blanked) {
+        // Dark until input; a queued command is applied on that frame
+        return (idle < CONFIG_DISPLAY_SLEEP_TIMEOUT_MS) ? 0 : BSP_WAIT_FOREVER;
+    }
+    
+    uint32_t next = next_frame_ms(now);
+    if (!is_animating()) {
+        uint32_t blank = (idle >= CONFIG_DISPLAY_SLEEP_TIMEOUT_MS) ? 0 :
+                         CONFIG_DISPLAY_SLEEP_TIMEOUT_MS - idle;
+        if (blank < next) next = blank;
+    }
+    return next;
+}
+
+void display_task_set_notify(bsp_task_handle_t task, uint32_t bits) {
+    display_task_state.notify_task = task;
+    display_task_state.notify_bits = bits;
+}
+
+void display_task_note_activity(void) {
+    __atomic_store_n(&display_task_state.last_activity_ms, bsp_get_tick_ms(), __ATOMIC_RELEASE);
+    if (display_task_state.blanked) {
+        wake_display_task();
+    }
+}
+
+bool display_is_blanked(void) {
+    return display_task_state.blanked;
+}
+
+void display_get_refresh_stats(DisplayRefreshStats* stats) {
+    if (stats) *stats = display_task_state.refresh_stats;
+}
+
+// =============================================================================
+// DISPLAY TASK
+// =============================================================================
 
 void display_task_init(void) {
     memset(&display_task_state, 0, sizeof(display_task_state));
@@ -35,91 +245,125 @@ void display_task_init(void) {
     display_task_state.current_theme = THEME_ID_DEFAULT;
     display_task_state.initialized = true;
     
+    // The first update draws the welcome screen
+    display_task_state.dirty = true;
+    display_task_state.last_activity_ms = bsp_get_tick_ms();
+    
+    memory_pool_init(&display_task_state.payload_pool, "display_payload",
+                     display_task_state.payload_arena, sizeof(display_task_state.payload_arena),
+                     sizeof(ScreenPayload_t));
+    
     // BSP display initialization handled by main.cpp
 }
 
-void display_task_update(void) {
-    if (!display_task_state.initialized) return;
-    
-    // Process command queue (simplified for unified implementation)
-    if (display_task_state.queue_count > 0) {
-        DisplayCommand* cmd = &display_task_state.command_queue[display_task_state.queue_head];
-        
-        switch (cmd->id) {
-            case DISPLAY_CMD_ACTIVATE_SCREEN:
-                display_task_state.current_screen = cmd->data.activate_screen.screen_id;
-                if (cmd->data.activate_screen.data_ptr) {
-                    // Copy screen data based on screen type
-                    switch (cmd->data.activate_screen.screen_id) {
-                        case SCREEN_ID_MAIN_MENU:
-                            current_menu_data = *(MenuScreenData*)cmd->data.activate_screen.data_ptr;
-                            break;
-                        case SCREEN_ID_TIMEZONE_SETUP:
-                            current_timezone_data = *(TimezoneScreenData*)cmd->data.activate_screen.data_ptr;
-                            break;
-                        case SCREEN_ID_TIME_SETUP:
-                            current_time_data = *(TimeScreenData*)cmd->data.activate_screen.data_ptr;
-                            break;
-                        case SCREEN_ID_SETTINGS:
-                            current_settings_data = *(SettingsScreenData*)cmd->data.activate_screen.data_ptr;
-                            break;
-                        case SCREEN_ID_AGENT_SELECTION:
-                            current_agent_selection_data = *(AgentSelectionScreenData*)cmd->data.activate_screen.data_ptr;
-                            break;
-                        case SCREEN_ID_AGENT_INTERACTION:
-                            current_agent_interaction_data = *(AgentInteractionScreenData*)cmd->data.activate_screen.data_ptr;
-                            break;
-                        case SCREEN_ID_LOCK_STATUS:
-                            current_lock_status_data = *(LockStatusScreenData*)cmd->data.activate_screen.data_ptr;
-                            break;
-                        case SCREEN_ID_LOCK_CONFIG_CUSTOM:
-                            current_custom_lock_data = *(CustomLockConfigScreenData*)cmd->data.activate_screen.data_ptr;
-                            break;
-                        case SCREEN_ID_LOCK_CONFIG_KEYHOLDER:
-                            current_keyholder_data = *(KeyholderConfigScreenData*)cmd->data.activate_screen.data_ptr;
-                            break;
-                        case SCREEN_ID_PIN_ENTRY:
-                            current_pin_entry_data = *(PinEntryScreenData*)cmd->data.activate_screen.data_ptr;
-                            break;
-                        case SCREEN_ID_GAME_SPIN_WHEEL:
-                            current_spin_wheel_data = *(SpinWheelScreenData*)cmd->data.activate_screen.data_ptr;
-                            break;
-                        case SCREEN_ID_VERIFICATION:
-                            current_verification_data = *(VerificationScreenData*)cmd->data.activate_screen.data_ptr;
-                            break;
-                        default:
-                            break;
-                    }
+static void apply_command(DisplayCommand* cmd, uint32_t now) {
+    switch (cmd->id) {
+        case DISPLAY_CMD_ACTIVATE_SCREEN:
+            display_task_state.current_screen = cmd->data.activate_screen.screen_id;
+            display_task_state.spin_timed = false;
+            if (cmd->data.activate_screen.data_ptr) {
+                // Copy screen data based on screen type
+                switch (cmd->data.activate_screen.screen_id) {
+                    case SCREEN_ID_MAIN_MENU:
+                        display_task_state.current_menu_data = *(MenuScreenData*)cmd->data.activate_screen.data_ptr;
+                        break;
+                    case SCREEN_ID_TIMEZONE_SETUP:
+                        display_task_state.current_timezone_data = *(TimezoneScreenData*)cmd->data.activate_screen.data_ptr;
+                        break;
+                    case SCREEN_ID_TIME_SETUP:
+                        display_task_state.current_time_data = *(TimeScreenData*)cmd->data.activate_screen.data_ptr;
+                        break;
+                    case SCREEN_ID_SETTINGS:
+                        display_task_state.current_settings_data = *(SettingsScreenData*)cmd->data.activate_screen.data_ptr;
+                        break;
+                    case SCREEN_ID_AGENT_SELECTION:
+                        display_task_state.current_agent_selection_data = *(AgentSelectionScreenData*)cmd->data.activate_screen.data_ptr;
+                        break;
+                    case SCREEN_ID_AGENT_INTERACTION:
+                        display_task_state.current_agent_interaction_data = *(AgentInteractionScreenData*)cmd->data.activate_screen.data_ptr;
+                        break;
+                    case SCREEN_ID_LOCK_STATUS:
+                        display_task_state.current_lock_status_data = *(LockStatusScreenData*)cmd->data.activate_screen.data_ptr;
+                        break;
+                    case SCREEN_ID_LOCK_CONFIG_CUSTOM:
+                        display_task_state.current_custom_lock_data = *(CustomLockConfigScreenData*)cmd->data.activate_screen.data_ptr;
+                        break;
+                    case SCREEN_ID_LOCK_CONFIG_KEYHOLDER:
+                        display_task_state.current_keyholder_data = *(KeyholderConfigScreenData*)cmd->data.activate_screen.data_ptr;
+                        break;
+                    case SCREEN_ID_PIN_ENTRY:
+                        display_task_state.current_pin_entry_data = *(PinEntryScreenData*)cmd->data.activate_screen.data_ptr;
+                        break;
+                    case SCREEN_ID_GAME_SPIN_WHEEL:
+                        display_task_state.current_spin_wheel_data = *(SpinWheelScreenData*)cmd->data.activate_screen.data_ptr;
+                        break;
+                    case SCREEN_ID_VERIFICATION:
+                        display_task_state.current_verification_data = *(VerificationScreenData*)cmd->data.activate_screen.data_ptr;
+                        break;
+                    default:
+                        break;
                 }
-                break;
-                
-            case DISPLAY_CMD_SET_THEME:
-                display_task_state.current_theme = cmd->data.set_theme.theme_id;
-                break;
-                
-            case DISPLAY_CMD_UPDATE_AGENT_MOOD:
-                // Update current agent interaction data with new mood
-                current_agent_interaction_data.mood_affection = cmd->data.agent_mood.affection;
-                current_agent_interaction_data.mood_strictness = cmd->data.agent_mood.strictness;
-                current_agent_interaction_data.mood_satisfaction = cmd->data.agent_mood.satisfaction;
-                current_agent_interaction_data.mood_trust = cmd->data.agent_mood.trust;
-                current_agent_interaction_data.mood_image_id = cmd->data.agent_mood.mood_image_id;
-                break;
-                
-            case DISPLAY_CMD_UPDATE_LOCK_STATUS:
-                // Update lock status display
-                current_lock_status_data.time_remaining_seconds = cmd->data.lock_status.time_remaining;
-                break;
-                
-            default:
-                break;
-        }
-        
-        // Remove command from queue
-        display_task_state.queue_head = (display_task_state.queue_head + 1) % 16;
-        display_task_state.queue_count--;
+                memory_pool_free(&display_task_state.payload_pool, cmd->data.activate_screen.data_ptr);
+            }
+            break;
+            
+        case DISPLAY_CMD_SET_THEME:
+            display_task_state.current_theme = cmd->data.set_theme.theme_id;
+            break;
+            
+        case DISPLAY_CMD_UPDATE_AGENT_MOOD:
+            // Update current agent interaction data with new mood
+            display_task_state.current_agent_interaction_data.mood_affection = cmd->data.agent_mood.affection;
+            display_task_state.current_agent_interaction_data.mood_strictness = cmd->data.agent_mood.strictness;
+            display_task_state.current_agent_interaction_data.mood_satisfaction = cmd->data.agent_mood.satisfaction;
+            display_task_state.current_agent_interaction_data.mood_trust = cmd->data.agent_mood.trust;
+            display_task_state.current_agent_interaction_data.mood_image_id = cmd->data.agent_mood.mood_image_id;
+            break;
+            
+        case DISPLAY_CMD_UPDATE_LOCK_STATUS:
+            // Update lock status display
+            display_task_state.current_lock_status_data.time_remaining_seconds = cmd->data.lock_status.time_remaining;
+            break;
+            
+        case DISPLAY_CMD_GAME_SPIN_THE_WHEEL_START_ANIM:
+            // Spins at the animation rate, then settles on the target
+            display_task_state.current_spin_wheel_data.is_spinning = true;
+            display_task_state.spin_target_segment = cmd->data.spin_wheel_anim.target_segment;
+            display_task_state.spin_timed = true;
+            display_task_state.spin_end_ms = now + cmd->data.spin_wheel_anim.duration_ms;
+            break;
+            
+        case DISPLAY_CMD_GAME_SPIN_THE_WHEEL_SHOW_RESULT:
+            if (display_task_state.spin_timed) {
+                display_task_state.current_spin_wheel_data.highlighted_segment =
+                    display_task_state.spin_target_segment;
+                display_task_state.spin_timed = false;
+            }
+            display_task_state.current_spin_wheel_data.is_spinning = false;
+            display_task_state.current_spin_wheel_data.result_text_line1 = cmd->data.spin_wheel_result.result_line1;
+            display_task_state.current_spin_wheel_data.result_text_line2 = cmd->data.spin_wheel_result.result_line2;
+            break;
+            
+        default:
+            break;
     }
-    
+}
+
+// One animation step per frame
+static void advance_animation(uint32_t now) {
+    SpinWheelScreenData* wheel = &display_task_state.current_spin_wheel_data;
+    if (!is_animating()) return;
+    
+    if (display_task_state.spin_timed && (int32_t)(now - display_task_state.spin_end_ms) >= 0) {
+        wheel->highlighted_segment = display_task_state.spin_target_segment;
+        wheel->is_spinning = false;
+        display_task_state.spin_timed = false;
+    } else if (wheel->num_segments > 0) {
+        wheel->highlighted_segment = (wheel->highlighted_segment + 1) % wheel->num_segments;
+    }
+}
+
+static void render_current_screen(void) {
     // Clear display and render current screen
     bsp_display_clear();
     
@@ -128,40 +372,40 @@ void display_task_update(void) {
             display_screen_welcome();
             break;
         case SCREEN_ID_TIMEZONE_SETUP:
-            display_screen_timezone_setup(&current_timezone_data);
+            display_screen_timezone_setup(&display_task_state.current_timezone_data);
             break;
         case SCREEN_ID_TIME_SETUP:
-            display_screen_time_setup(&current_time_data);
+            display_screen_time_setup(&display_task_state.current_time_data);
             break;
         case SCREEN_ID_MAIN_MENU:
-            display_screen_main_menu(&current_menu_data);
+            display_screen_main_menu(&display_task_state.current_menu_data);
             break;
         case SCREEN_ID_SETTINGS:
-            display_screen_settings(&current_settings_data);
+            display_screen_settings(&display_task_state.current_settings_data);
             break;
         case SCREEN_ID_AGENT_SELECTION:
-            display_screen_agent_selection(&current_agent_selection_data);
+            display_screen_agent_selection(&display_task_state.current_agent_selection_data);
             break;
         case SCREEN_ID_AGENT_INTERACTION:
-            display_screen_agent_interaction(&current_agent_interaction_data);
+            display_screen_agent_interaction(&display_task_state.current_agent_interaction_data);
             break;
         case SCREEN_ID_LOCK_STATUS:
-            display_screen_lock_status(&current_lock_status_data);
+            display_screen_lock_status(&display_task_state.current_lock_status_data);
             break;
         case SCREEN_ID_LOCK_CONFIG_CUSTOM:
-            display_screen_custom_lock_config(&current_custom_lock_data);
+            display_screen_custom_lock_config(&display_task_state.current_custom_lock_data);
             break;
         case SCREEN_ID_LOCK_CONFIG_KEYHOLDER:
-            display_screen_keyholder_config(&current_keyholder_data);
+            display_screen_keyholder_config(&display_task_state.current_keyholder_data);
             break;
         case SCREEN_ID_PIN_ENTRY:
-            display_screen_pin_entry(&current_pin_entry_data);
+            display_screen_pin_entry(&display_task_state.current_pin_entry_data);
             break;
         case SCREEN_ID_GAME_SPIN_WHEEL:
-            display_screen_spin_wheel(&current_spin_wheel_data);
+            display_screen_spin_wheel(&display_task_state.current_spin_wheel_data);
             break;
         case SCREEN_ID_VERIFICATION:
-            display_screen_verification(&current_verification_data);
+            display_screen_verification(&display_task_state.current_verification_data);
             break;
         default:
             ui_component_draw_title_bar("CKOS");
@@ -172,18 +416,90 @@ void display_task_update(void) {
     bsp_display_refresh();
 }
 
+void display_task_update(void) {
+    if (!display_task_state.initialized) return;
+    
+    uint32_t now = bsp_get_tick_ms();
+    display_task_state.refresh_stats.updates++;
+    
+    // Every queued change lands in the same frame
+    while (display_task_state.queue_count > 0) {
+        DisplayCommand* cmd = &display_task_state.command_queue[display_task_state.queue_head];
+        if (command_changes_screen(cmd)) {
+            display_task_state.dirty = true;
+        }
+        apply_command(cmd, now);
+        
+        // Remove command from queue
+        display_task_state.queue_head = (display_task_state.queue_head + 1) % 16;
+        display_task_state.queue_count--;
+    }
+    
+    // Blank after inactivity, never mid-animation; input redraws
+    uint32_t idle = idle_ms(now);
+    if (display_task_state.blanked) {
+        if (idle >= CONFIG_DISPLAY_SLEEP_TIMEOUT_MS) return;
+        display_task_state.blanked = false;
+        display_task_state.dirty = true;
+    } else if (idle >= CONFIG_DISPLAY_SLEEP_TIMEOUT_MS && !is_animating()) {
+        bsp_display_clear();
+        bsp_display_refresh();
+        display_task_state.blanked = true;
+        display_task_state.refresh_stats.blanks++;
+        return;
+    }
+    
+    if (next_frame_ms(now) != 0) return;
+    
+    advance_animation(now);
+    render_current_screen();
+    display_task_state.last_frame_ms = frame_time(now);
+    display_task_state.dirty = false;
+    display_task_state.refresh_stats.frames++;
+}
+
 bool display_task_send_command(DisplayCommand* cmd) {
     if (!cmd || display_task_state.queue_count >= 16) {
         return false;
     }
     
-    display_task_state.command_queue[display_task_state.queue_tail] = *cmd;
+    DisplayCommand* queued = &display_task_state.command_queue[display_task_state.queue_tail];
+    *queued = *cmd;
+    
+    if (cmd->id == DISPLAY_CMD_ACTIVATE_SCREEN && cmd->data.activate_screen.data_ptr) {
+        size_t size = screen_data_size(cmd->data.activate_screen.screen_id);
+        void* payload = size ? memory_pool_alloc(&display_task_state.payload_pool) : NULL;
+        if (size && !payload) {
+            printf("Display: payload pool exhausted, dropping screen %d\n",
+                   (int)cmd->data.activate_screen.screen_id);
+            return false;
+        }
+        if (payload) {
+            memcpy(payload, cmd->data.activate_screen.data_ptr, size);
+        }
+        queued->data.activate_screen.data_ptr = payload;
+    }
+    
     display_task_state.queue_tail = (display_task_state.queue_tail + 1) % 16;
     display_task_state.queue_count++;
     
+    // A new screen is shown even to an idle user (door opened, lock ended)
+    if (cmd->id == DISPLAY_CMD_ACTIVATE_SCREEN) {
+        __atomic_store_n(&display_task_state.last_activity_ms, bsp_get_tick_ms(), __ATOMIC_RELEASE);
+    }
+    wake_display_task();
+    
     return true;
 }
 
+void display_get_payload_pool_stats(MemoryPoolStats_t* stats) {
+    memory_pool_get_stats(&display_task_state.payload_pool, stats);
+}
+
+ScreenID display_get_current_screen(void) {
+    return display_task_state.current_screen;
+}
+
 // =============================================================================
 // SCREEN IMPLEMENTATIONS 
 // =============================================================================
@@ -421,8 +737,12 @@ void display_screen_agent_interaction(AgentInteractionScreenData* data) {
                                          data->mood_affection, data->mood_strictness,
                                          data->mood_satisfaction, data->mood_trust);
     
-    // Agent dialog box (main area)
-    ui_component_draw_agent_dialog_box(8, 18, 75, 20, data->agent_dialog);
+    // Agent dialog box (main area), decoded as it is drawn when it can be
+    if (data->agent_dialog_source.next) {
+        ui_component_draw_agent_dialog_stream(8, 18, 75, 20, &data->agent_dialog_source);
+    } else {
+        ui_component_draw_agent_dialog_box(8, 18, 75, 20, data->agent_dialog);
+    }
     
     // User interaction options (bottom area)
     if (data->interaction_options && data->num_options > 0) {
@@ -600,6 +920,13 @@ void ui_component_draw_agent_mood_display(int x, int y, int agent_id, int mood_i
 
 void ui_component_draw_agent_dialog_box(int x, int y, int width, int height, 
                                        const char* dialog_text) {
+    DisplayTextSource source;
+    display_text_source_init(&source, dialog_text);
+    ui_component_draw_agent_dialog_stream(x, y, width, height, dialog_text ? &source : NULL);
+}
+
+void ui_component_draw_agent_dialog_stream(int x, int y, int width, int height,
+                                          const DisplayTextSource* source) {
     // Draw dialog box with double border for emphasis
     bsp_display_draw_box(x, y, width, height);
     bsp_display_draw_box(x + 1, y + 1, width - 2, height - 2);
@@ -607,39 +934,10 @@ void ui_component_draw_agent_dialog_box(int x, int y, int width, int height,
     // Draw speech indicator
     bsp_display_draw_text(x + 2, y - 2, "Agent says:");
     
-    if (dialog_text) {
-        // Word wrap text within dialog box
-        char buffer[256];
-        strncpy(buffer, dialog_text, sizeof(buffer) - 1);
-        buffer[sizeof(buffer) - 1] = '\0';
-        
-        int text_y = y + 3;
-        int line_height = 7;
-        char* line = strtok(buffer, " ");
-        char current_line[32] = {0};
-        
-        while (line && text_y < y + height - 5) {
-            // Check if adding this word would exceed line width
-            if (strlen(current_line) + strlen(line) + 1 < 30) {
-                if (strlen(current_line) > 0) {
-                    strcat(current_line, " ");
-                }
-                strcat(current_line, line);
-            } else {
-                // Draw current line and start new one
-                if (strlen(current_line) > 0) {
-                    bsp_display_draw_text(x + 3, text_y, current_line);
-                    text_y += line_height;
-                }
-                strcpy(current_line, line);
-            }
-            line = strtok(NULL, " ");
-        }
-        
-        // Draw final line
-        if (strlen(current_line) > 0 && text_y < y + height - 5) {
-            bsp_display_draw_text(x + 3, text_y, current_line);
-        }
+    if (source && source->next) {
+        // Word wrap within the box from the start of the text, every redraw
+        DisplayTextSource reader = *source;
+        ui_draw_wrapped_text(x + 3, y + 3, width - 6, height - 6, &reader);
     }
 }
 
@@ -798,6 +1096,70 @@ void ui_component_draw_confirmation_dialog(const char* title, const char* messag
 // NEW STANDARDIZED UI FRAMEWORK
 // =============================================================================
 
+// Characters of a C string for ui_draw_wrapped_text()
+static int string_source_next(DisplayTextSource* source) {
+    const char* text = (const char*)source->data;
+    char c = text[source->position];
+    if (c == '\0') return -1;
+    source->position++;
+    return (unsigned char)c;
+}
+
+void display_text_source_init(DisplayTextSource* source, const char* text) {
+    if (!source) return;
+    source->next = string_source_next;
+    source->data = text ? text : "";
+    source->position = 0;
+}
+
+bool ui_draw_wrapped_text(int x, int y, int width, int height, DisplayTextSource* source) {
+    const int advance = 7;      // 6 pixel glyph + 1 space
+    const int line_height = 7;
+    int columns = width / advance;
+    if (!source || !source->next || columns < 1 || height < line_height) return false;
+
+    int column = 0;
+    int line_y = y;
+    int c = source->next(source);
+    while (c >= 0) {
+        if (c <= ' ') {         // Spaces and line breaks separate words
+            c = source->next(source);
+            continue;
+        }
+
+        // Measure the word, then go back and draw it
+        uint32_t word_start = source->position;
+        int length = 1;
+        int after;
+        while ((after = source->next(source)) > ' ') {
+            length++;
+        }
+        uint32_t word_end = source->position;
+
+        if (column > 0 && column + 1 + length > columns) {
+            column = 0;
+            line_y += line_height;
+        } else if (column > 0) {
+            column++;
+        }
+
+        source->position = word_start;
+        for (int i = 0; i < length; i++) {
+            if (column == columns) {    // Longer than a line: break it
+                column = 0;
+                line_y += line_height;
+            }
+            if (line_y + line_height > y + height) return false;
+            bsp_display_draw_char(x + column * advance, line_y, (char)c);
+            column++;
+            if (i + 1 < length) c = source->next(source);
+        }
+        source->position = word_end;
+        c = after;
+    }
+    return true;
+}
+
 void ui_draw_standard_title_bar(const char* title, float battery_percent) {
     // Top title bar with battery indicator (12 pixels high)
     bsp_display_draw_line(0, 11, BSP_DISPLAY_WIDTH - 1, 11);
@@ -4,6 +4,7 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include "../BSP/bsp_api.h"
+#include "../Utils/memory_pool.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -144,6 +145,15 @@ typedef struct {
     int max_settings;
 } SettingsScreenData;
 
+// Text pulled a character at a time, so it can be drawn as it is decoded
+// rather than from a buffer. position is all of the reading state: the
+// layout saves and restores it to read each word twice, once to measure it.
+typedef struct DisplayTextSource {
+    int (*next)(struct DisplayTextSource* source);  // Next character, or -1 at the end
+    const void* data;
+    uint32_t position;
+} DisplayTextSource;
+
 // Agent System Screen Data (from Agent_System_Design.txt)
 typedef struct {
     int selected_agent;  // 0=Rookie, 1=Veteran, 2=Warden
@@ -153,6 +163,7 @@ typedef struct {
 typedef struct {
     int selected_agent;          // Current agent personality
     const char* agent_dialog;    // Current agent message
+    DisplayTextSource agent_dialog_source; // Drawn as read, instead of agent_dialog, when next is set
     const char** interaction_options; // Available user options
     int num_options;
     int selected_option;
@@ -224,10 +235,56 @@ typedef struct {
     bool show_identicon;
 } VerificationScreenData;
 
+// =============================================================================
+// REFRESH POLICY
+// =============================================================================
+
+// How often a screen needs a new frame. The display task sleeps until the
+// current screen's policy, a command or input calls for one, and blanks the
+// panel after CONFIG_DISPLAY_SLEEP_TIMEOUT_MS without input.
+typedef enum {
+    DISPLAY_REFRESH_STATIC = 0,     // Drawn once when activated
+    DISPLAY_REFRESH_ON_CHANGE,      // Redrawn when a command changes its content
+    DISPLAY_REFRESH_PERIODIC,       // On change, and every period_ms
+    DISPLAY_REFRESH_ANIMATION       // On change, and every period_ms while animating
+} DisplayRefreshMode;
+
+typedef struct {
+    DisplayRefreshMode mode;
+    uint16_t period_ms;             // PERIODIC and ANIMATION only
+} DisplayRefreshPolicy;
+
+typedef struct {
+    uint32_t updates;               // display_task_update() calls
+    uint32_t frames;                // Frames rendered and sent to the panel
+    uint32_t blanks;                // Times blanked for inactivity
+} DisplayRefreshStats;
+
 // Display Task API (following architecture documentation)
 void display_task_init(void);
+// Applies every queued command, then draws a frame if the refresh policy,
+// a change or a wake-up calls for one
 void display_task_update(void);
 bool display_task_send_command(DisplayCommand* cmd);
+void display_get_payload_pool_stats(MemoryPoolStats_t* stats);
+ScreenID display_get_current_screen(void);
+
+// Milliseconds until display_task_update() next has work (a frame or the
+// blanking timeout), BSP_WAIT_FOREVER if none is scheduled
+uint32_t display_task_next_update_ms(void);
+// Notify task with bits when a command or input needs a frame sooner
+void display_task_set_notify(bsp_task_handle_t task, uint32_t bits);
+// User input: restarts the sleep timeout and wakes a blanked display
+void display_task_note_activity(void);
+bool display_is_blanked(void);
+DisplayRefreshPolicy display_get_refresh_policy(ScreenID screen_id);
+void display_get_refresh_stats(DisplayRefreshStats* stats);
+
+#ifdef SIMULATOR
+// Per-device state for the multi-instance simulator (see Utils/sim_instance.h)
+size_t display_instance_size(void);
+void display_instance_bind(void* state);
+#endif
 
 // Internal screen handlers (called by Display_Task)
 void display_screen_welcome(void);
@@ -260,6 +317,8 @@ void ui_component_draw_agent_mood_display(int x, int y, int agent_id, int mood_i
                                          float satisfaction, float trust);
 void ui_component_draw_agent_dialog_box(int x, int y, int width, int height, 
                                        const char* dialog_text);
+void ui_component_draw_agent_dialog_stream(int x, int y, int width, int height,
+                                          const DisplayTextSource* source);
 void ui_component_draw_agent_selection_card(int x, int y, int width, int height,
                                            const char* agent_name, const char* description, 
                                            bool selected);
@@ -299,6 +358,11 @@ void ui_draw_button_hints(const char* primary_action, const char* secondary_acti
 void ui_draw_centered_content(const char* line1, const char* line2, const char* line3);
 void ui_draw_menu_list(const char* items[], int count, int selected, int visible_start, int max_visible);
 
+// Word-wrapped text inside a box, glyph by glyph with no line buffer; words
+// longer than a line are broken. Returns false if the text did not fit.
+bool ui_draw_wrapped_text(int x, int y, int width, int height, DisplayTextSource* source);
+void display_text_source_init(DisplayTextSource* source, const char* text);
+
 // Specialized screen layouts
 void ui_draw_lock_status_display(int hours, int minutes, const char* agent_name, const char* mood);
 void ui_draw_agent_selection_list(const char* agents[], const char* descriptions[], int count, int selected);
@@ -2,57 +2,196 @@
 // High-level hardware operations built on BSP primitives
 
 #include "hardware_api.h"
+#include "../Config/app_config.h"
+#include "../Utils/sim_instance.h"
+#include "../Utils/sensor_pipeline.h"
 #include <string.h>
 #include <stdio.h>
 
+// =============================================================================
+// HARDWARE SERVICE STATE
+// =============================================================================
+
+typedef struct {
+    // Last sample seen by hardware_sensor_poll_events()
+    bsp_sensor_readings_t last_event_sample;
+    bool last_event_sample_valid;
+    uint8_t sensor_alarms;          // SENSOR_ALARM_* raised at that sample
+    
+    // Published sensor snapshot: two buffers, the current one chosen by the
+    // low bit of the publish count (see publish_sensor_data())
+    hardware_sensor_data_t sensor_buffers[2];
+    uint32_t sensor_sequence;
+    
+    // Lock history (log region of bsp_storage)
+    EventLog_t event_log;
+    uint64_t log_pending_ms;        // Tick of the first entry not yet in flash
+    
+    // Keyed configuration records (config region of bsp_storage)
+    KvStore_t config_store;
+    
+    // ApplicationLogic_Task saves through the cache and appends to the lock
+    // history while HardwareService_Task appends, flushes both and compacts
+    // the store; both hold storage_lock throughout
+    bsp_mutex_handle_t storage_lock;
+    
+    // Write-back cache in front of config_store, one pool block per record
+    MemoryPool_t storage_op_pool;
+    uint8_t storage_op_arena[MEMORY_POOL_BLOCK_SIZE(CONFIG_POOL_STORAGE_OP_SIZE) *
+                             CONFIG_POOL_STORAGE_OP_BLOCKS]
+        __attribute__((aligned(MEMORY_POOL_ALIGNMENT)));
+    struct ConfigCacheLine* cache_lines[CONFIG_POOL_STORAGE_OP_BLOCKS];
+    uint64_t oldest_dirty_ms;       // Tick of the first write since the last flush
+    hardware_config_cache_stats_t cache_stats;
+    
+    // Sleep suppression and idle timeouts
+    PowerGovernor_t power_governor;
+    hardware_power_mode_t power_mode;
+    bsp_task_handle_t governor_task;
+    uint32_t governor_notify_bits;
+    
+    // Memory wire unlock sequence; requests from other tasks wait in
+    // lock_request (set last, with release) for the HardwareService task
+    WireActuator_t wire;
+    bsp_task_handle_t lock_task;
+    uint32_t lock_notify_bits;
+    bool lock_request;
+    uint8_t lock_request_temp_c;
+    uint16_t lock_request_window_ms;
+} HardwareServiceState;
+
+// One copy per simulated device
+SIM_INSTANCE_STATE(HardwareServiceState, g_hw_state);
+#define g_hw_state SIM_INSTANCE(g_hw_state)
+
+#ifdef SIMULATOR
+size_t hardware_instance_size(void) {
+    return sizeof(HardwareServiceState);
+}
+
+void hardware_instance_bind(void* state) {
+    SIM_INSTANCE_BIND(g_hw_state, state);
+}
+#endif
+
 // =============================================================================
 // SENSOR SYSTEM IMPLEMENTATION
 // =============================================================================
 
+// Only the HardwareService task samples the sensors. Each sample is written
+// to the buffer readers are not using and then published by bumping the
+// sequence. A reader copies the current buffer and checks the sequence did
+// not move meanwhile; if it did, a newer sample was published and the copy
+// is retried. Readers never wait for the writer, and the writer, the
+// highest-priority task, never waits for readers.
+static void publish_sensor_data(const bsp_sensor_readings_t* readings) {
+    uint32_t sequence = g_hw_state.sensor_sequence;
+    hardware_sensor_data_t* next = &g_hw_state.sensor_buffers[(sequence + 1) & 1];
+    
+    next->battery_voltage = readings->battery_voltage;
+    next->battery_percentage = readings->battery_percentage;
+    next->battery_charging = false; // BSP doesn't provide this yet
+    next->temperature_celsius = readings->temperature_celsius;
+    next->door_closed = readings->door_closed;
+    next->latch_engaged = readings->latch_engaged;
+    next->charging_active = readings->charging_active;
+    next->timestamp_ms = bsp_get_tick_ms();
+    
+    __atomic_store_n(&g_hw_state.sensor_sequence, sequence + 1, __ATOMIC_RELEASE);
+}
+
 int hardware_get_sensor_data(hardware_sensor_data_t* data) {
     if (!data) return -1;
     
-    // Get sensor readings through BSP
-    bsp_sensor_readings_t bsp_readings;
-    int result = bsp_sensors_read(&bsp_readings);
-    
-    if (result == 0) {
-        // Map BSP readings to hardware API format
-        data->battery_voltage = bsp_readings.battery_voltage;
-        data->battery_percentage = bsp_readings.battery_percentage;
-        data->battery_charging = false; // BSP doesn't provide this yet
-        data->temperature_celsius = bsp_readings.temperature_celsius;
-        data->door_closed = bsp_readings.door_closed;
-        data->latch_engaged = bsp_readings.latch_engaged;
-        data->charging_active = bsp_readings.charging_active;
-        data->timestamp_ms = bsp_get_tick_ms();
-    }
+    uint32_t sequence;
+    do {
+        sequence = __atomic_load_n(&g_hw_state.sensor_sequence, __ATOMIC_ACQUIRE);
+        *data = g_hw_state.sensor_buffers[sequence & 1];
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    } while (__atomic_load_n(&g_hw_state.sensor_sequence, __ATOMIC_RELAXED) != sequence);
     
-    return result;
+    return (sequence != 0) ? 0 : -1;   // Nothing published before hardware_init()
 }
 
 float hardware_get_battery_percentage(void) {
-    bsp_sensor_readings_t readings;
-    if (bsp_sensors_read(&readings) == 0) {
-        return readings.battery_percentage;
-    }
-    return 0.0f;
+    hardware_sensor_data_t data;
+    hardware_get_sensor_data(&data);
+    return data.battery_percentage;
 }
 
 bool hardware_is_door_closed(void) {
-    bsp_sensor_readings_t readings;
-    if (bsp_sensors_read(&readings) == 0) {
-        return readings.door_closed;
-    }
-    return false;
+    hardware_sensor_data_t data;
+    hardware_get_sensor_data(&data);
+    return data.door_closed;
 }
 
 bool hardware_is_latch_engaged(void) {
-    bsp_sensor_readings_t readings;
-    if (bsp_sensors_read(&readings) == 0) {
-        return readings.latch_engaged;
+    hardware_sensor_data_t data;
+    hardware_get_sensor_data(&data);
+    return data.latch_engaged;
+}
+
+uint32_t hardware_sensor_poll_events(void) {
+    bsp_sensor_readings_t now;
+    if (bsp_sensors_read(&now) != 0) {
+        return 0;
+    }
+    publish_sensor_data(&now);
+    
+    uint8_t alarms = sensor_pipeline_alarms(g_hw_state.sensor_alarms, now.battery_percentage,
+                                            (int32_t)(now.temperature_celsius * 100.0f));
+    if (!g_hw_state.last_event_sample_valid) {
+        // First sample only establishes the baseline
+        g_hw_state.last_event_sample = now;
+        g_hw_state.last_event_sample_valid = true;
+        g_hw_state.sensor_alarms = alarms;
+        return 0;
+    }
+    uint8_t raised = alarms & (uint8_t)~g_hw_state.sensor_alarms;
+    g_hw_state.sensor_alarms = alarms;
+    
+    const bsp_sensor_readings_t* prev = &g_hw_state.last_event_sample;
+    uint32_t hlm = 0;
+    uint32_t sensor = 0;
+    
+    if (now.door_closed != prev->door_closed) {
+        hlm |= now.door_closed ? HST_EVT_DOOR_CLOSED : HST_EVT_DOOR_OPENED;
+        if (now.door_closed) {
+            hardware_log_append(HARDWARE_LOG_EVENT_DOOR_CLOSED, 0);
+        } else {
+            hardware_log_append(HARDWARE_LOG_EVENT_DOOR_OPENED, now.latch_engaged ? 1u : 0u);
+        }
+    }
+    if (now.latch_engaged != prev->latch_engaged) {
+        hlm |= HST_EVT_LATCH_CHANGED;
+    }
+    if (raised & SENSOR_ALARM_BATTERY_LOW) {
+        sensor |= HST_EVT_BATTERY_LOW;
+        hardware_log_append(HARDWARE_LOG_EVENT_BATTERY_LOW, now.battery_percentage);
+    }
+    if (raised & SENSOR_ALARM_BATTERY_CRITICAL) {
+        sensor |= HST_EVT_BATTERY_CRITICAL;
+        hardware_log_append(HARDWARE_LOG_EVENT_BATTERY_CRITICAL, now.battery_percentage);
+        // Brown-out may be close: get cached config and history into flash now
+        hardware_config_flush();
+        hardware_log_flush();
+    }
+    if (now.charging_active != prev->charging_active) {
+        sensor |= HST_EVT_CHARGER_CHANGED;
     }
-    return false;
+    if (raised & SENSOR_ALARM_OVER_TEMPERATURE) {
+        sensor |= HST_EVT_OVER_TEMPERATURE;
+        hardware_log_append(HARDWARE_LOG_EVENT_OVER_TEMPERATURE,
+                            (uint32_t)now.temperature_celsius);
+    }
+    
+    g_hw_state.last_event_sample = now;
+    if (hlm || sensor) {
+        hardware_power_note_activity();
+    }
+    
+    return (hlm ? (HST_EVT_SRC_HLM | hlm) : 0) |
+           (sensor ? (HST_EVT_SRC_SENSOR | sensor) : 0);
 }
 
 // =============================================================================
@@ -66,90 +205,398 @@ int hardware_lock_engage(void) {
 }
 
 int hardware_lock_release(void) {
-    return bsp_lock_unlock();
+    return hardware_memory_wire_heat(0, 0);
 }
 
 hardware_lock_state_t hardware_lock_get_state(void) {
-    bsp_lock_state_t bsp_state = bsp_lock_get_state();
-    
-    // Map BSP lock state to hardware API
-    switch (bsp_state) {
-        case BSP_LOCK_STATE_LOCKED:
-            return HARDWARE_LOCK_LOCKED;
-        case BSP_LOCK_STATE_UNLOCKING:
-            return HARDWARE_LOCK_UNLOCKING;
-        case BSP_LOCK_STATE_UNLOCKED:
-            return HARDWARE_LOCK_UNLOCKED;
-        case BSP_LOCK_STATE_ERROR:
-        default:
-            return HARDWARE_LOCK_ERROR;
+    WireActuatorState_t state = __atomic_load_n(&g_hw_state.wire.state, __ATOMIC_RELAXED);
+    if (__atomic_load_n(&g_hw_state.lock_request, __ATOMIC_ACQUIRE) ||
+        (state != WIRE_ACTUATOR_IDLE && state != WIRE_ACTUATOR_COOLDOWN)) {
+        return HARDWARE_LOCK_UNLOCKING;
     }
+    
+    hardware_sensor_data_t data;
+    hardware_get_sensor_data(&data);
+    return data.latch_engaged ? HARDWARE_LOCK_LOCKED : HARDWARE_LOCK_UNLOCKED;
 }
 
 int hardware_memory_wire_heat(uint8_t target_temp_celsius, uint16_t duration_ms) {
-    (void)target_temp_celsius;
-    (void)duration_ms;
-    printf("Hardware: Memory wire heating to %d°C for %dms\n", 
-           target_temp_celsius, duration_ms);
+    if (__atomic_load_n(&g_hw_state.wire.state, __ATOMIC_RELAXED) != WIRE_ACTUATOR_IDLE ||
+        __atomic_load_n(&g_hw_state.lock_request, __ATOMIC_ACQUIRE)) {
+        printf("Hardware: Memory wire busy, unlock refused\n");
+        return -1;
+    }
+    
+    g_hw_state.lock_request_temp_c = target_temp_celsius;
+    g_hw_state.lock_request_window_ms = duration_ms;
+    __atomic_store_n(&g_hw_state.lock_request, true, __ATOMIC_RELEASE);
+    if (g_hw_state.lock_task && g_hw_state.lock_notify_bits) {
+        bsp_task_notify(g_hw_state.lock_task, g_hw_state.lock_notify_bits);
+    }
     return 0;
 }
 
 bool hardware_memory_wire_is_heating(void) {
-    // Placeholder implementation
-    return false;
+    return __atomic_load_n(&g_hw_state.wire.state, __ATOMIC_RELAXED) == WIRE_ACTUATOR_HEATING;
+}
+
+void hardware_lock_start(bsp_task_handle_t task, uint32_t notify_bits) {
+    g_hw_state.lock_task = task;
+    g_hw_state.lock_notify_bits = notify_bits;
+}
+
+// Latch and door straight from the BSP, which the sequence polls faster than
+// the published snapshot is refreshed
+static void read_wire_inputs(WireActuatorInputs_t* inputs) {
+    bsp_sensor_readings_t readings;
+    if (bsp_sensors_read(&readings) == 0) {
+        inputs->ambient_cdeg = (int32_t)(readings.temperature_celsius * 100.0f);
+        inputs->latch_engaged = readings.latch_engaged;
+        inputs->door_closed = readings.door_closed;
+        return;
+    }
+    
+    hardware_sensor_data_t data;
+    hardware_get_sensor_data(&data);
+    inputs->ambient_cdeg = (int32_t)(data.temperature_celsius * 100.0f);
+    inputs->latch_engaged = data.latch_engaged;
+    inputs->door_closed = data.door_closed;
+}
+
+uint32_t hardware_lock_update(void) {
+    WireActuator_t* wire = &g_hw_state.wire;
+    uint64_t now = bsp_get_tick_ms64();
+    WireActuatorInputs_t inputs;
+    read_wire_inputs(&inputs);
+    
+    if (__atomic_load_n(&g_hw_state.lock_request, __ATOMIC_ACQUIRE)) {
+        __atomic_store_n(&g_hw_state.lock_request, false, __ATOMIC_RELAXED);
+        if (wire_actuator_request(wire, g_hw_state.lock_request_temp_c,
+                                  g_hw_state.lock_request_window_ms, &inputs, now) == 0) {
+            hardware_power_suppress_sleep("unlock");
+            printf("Hardware: Unlock sequence started (setpoint %ld C)\n",
+                   (long)(wire->setpoint_cdeg / 100));
+        }
+    }
+    if (wire->state == WIRE_ACTUATOR_IDLE) return 0;
+    
+    uint8_t attempt = wire->attempt;
+    WireActuatorResult_t result = wire_actuator_step(wire, &inputs, now);
+    bsp_wire_set_duty(wire_actuator_duty(wire));
+    if (wire->attempt != attempt) {
+        printf("Hardware: Unlock attempt %u (setpoint %ld C)\n",
+               (unsigned)wire->attempt, (long)(wire->setpoint_cdeg / 100));
+    }
+    if (result == WIRE_RESULT_NONE) return 0;
+    
+    hardware_power_allow_sleep("unlock");
+    hardware_power_note_activity();
+    printf("Hardware: Unlock sequence %s after %lu ms, %lu attempt(s)\n",
+           wire_actuator_result_name(result), (unsigned long)wire->stats.last_latency_ms,
+           (unsigned long)wire->stats.last_attempts);
+    
+    switch (result) {
+        case WIRE_RESULT_UNLOCKED:  return HST_EVT_SRC_HLM | HST_EVT_UNLOCK_SUCCESS;
+        case WIRE_RESULT_BLOCKED:   return HST_EVT_SRC_HLM | HST_EVT_UNLOCK_BLOCKED;
+        default:                    return HST_EVT_SRC_HLM | HST_EVT_UNLOCK_FAILURE;
+    }
+}
+
+uint32_t hardware_lock_next_ms(void) {
+    if (__atomic_load_n(&g_hw_state.lock_request, __ATOMIC_ACQUIRE)) return 0;
+    
+    uint32_t next = wire_actuator_next_ms(&g_hw_state.wire, bsp_get_tick_ms64());
+    return (next == WIRE_ACTUATOR_NO_DEADLINE) ? BSP_WAIT_FOREVER : next;
+}
+
+void hardware_lock_get_stats(WireActuatorStats_t* stats) {
+    if (stats) *stats = g_hw_state.wire.stats;
 }
 
 // =============================================================================
 // STORAGE SYSTEM IMPLEMENTATION
 // =============================================================================
 
-int hardware_config_read(uint32_t address, void* data, uint32_t length) {
-    bsp_storage_operation_t op = {
-        .address = address,
-        .data = (uint8_t*)data,
-        .length = length
-    };
-    
-    return bsp_storage_read(&op);
+// A cached record, stored in one storage_op_pool block
+typedef struct ConfigCacheLine {
+    uint16_t key;
+    uint16_t length;
+    bool dirty;
+    uint8_t value[];
+} ConfigCacheLine_t;
+
+#define CONFIG_CACHE_VALUE_MAX  (CONFIG_POOL_STORAGE_OP_SIZE - sizeof(ConfigCacheLine_t))
+
+static ConfigCacheLine_t** cache_find(uint16_t key) {
+    for (uint32_t i = 0; i < CONFIG_POOL_STORAGE_OP_BLOCKS; i++) {
+        if (g_hw_state.cache_lines[i] && g_hw_state.cache_lines[i]->key == key) {
+            return &g_hw_state.cache_lines[i];
+        }
+    }
+    return NULL;
 }
 
-int hardware_config_write(uint32_t address, const void* data, uint32_t length) {
-    bsp_storage_operation_t op = {
-        .address = address,
-        .data = (uint8_t*)data,
-        .length = length
-    };
+static void cache_drop(ConfigCacheLine_t** slot) {
+    if ((*slot)->dirty) {
+        // Superseded before it reached flash
+        g_hw_state.cache_stats.writes_absorbed++;
+        g_hw_state.cache_stats.dirty_records--;
+    }
+    memory_pool_free(&g_hw_state.storage_op_pool, *slot);
+    *slot = NULL;
+}
+
+static int config_flush(void);
+static int log_flush(void);
+
+// A free slot and block for a new line, evicting a clean line if need be
+// and flushing first if every line is dirty
+static ConfigCacheLine_t** cache_allocate(void) {
+    ConfigCacheLine_t** slot = NULL;
+    for (uint32_t i = 0; i < CONFIG_POOL_STORAGE_OP_BLOCKS && !slot; i++) {
+        if (!g_hw_state.cache_lines[i]) slot = &g_hw_state.cache_lines[i];
+    }
     
-    return bsp_storage_write(&op);
+    if (!slot) {
+        for (uint32_t pass = 0; pass < 2 && !slot; pass++) {
+            if (pass == 1 && config_flush() != 0) return NULL;
+            for (uint32_t i = 0; i < CONFIG_POOL_STORAGE_OP_BLOCKS && !slot; i++) {
+                if (!g_hw_state.cache_lines[i]->dirty) {
+                    slot = &g_hw_state.cache_lines[i];
+                    cache_drop(slot);
+                }
+            }
+        }
+        if (!slot) return NULL;
+    }
+    
+    *slot = memory_pool_alloc(&g_hw_state.storage_op_pool);
+    return *slot ? slot : NULL;
+}
+
+// The cache and store below take storage_lock in the public entry points
+// only; everything here runs with it held
+
+static int config_read(uint16_t key, void* data, uint32_t length) {
+    ConfigCacheLine_t** slot = cache_find(key);
+    if (slot) {
+        const ConfigCacheLine_t* line = *slot;
+        if (!data && length > 0) return -1;
+        memcpy(data, line->value, (line->length < length) ? line->length : length);
+        return line->length;
+    }
+    return kv_store_read(&g_hw_state.config_store, key, data, length);
 }
 
-int hardware_log_append(const char* log_entry) {
-    if (!log_entry) return -1;
+static int config_write(uint16_t key, const void* data, uint32_t length) {
+    g_hw_state.cache_stats.writes++;
     
-    printf("Hardware Log: %s\n", log_entry);
+    ConfigCacheLine_t** slot = cache_find(key);
+    if (length > CONFIG_CACHE_VALUE_MAX) {
+        // Too big to cache: write through, superseding any cached value
+        if (slot) cache_drop(slot);
+        g_hw_state.cache_stats.flash_programs++;
+        return kv_store_write(&g_hw_state.config_store, key, data, length);
+    }
+    
+    if (!slot) {
+        slot = cache_allocate();
+        if (!slot) {
+            g_hw_state.cache_stats.flash_programs++;
+            return kv_store_write(&g_hw_state.config_store, key, data, length);
+        }
+        (*slot)->key = key;
+        (*slot)->length = 0xFFFF;   // Never equal: the new value is dirty
+        (*slot)->dirty = false;
+    }
+    
+    ConfigCacheLine_t* line = *slot;
+    if (line->length == length && memcmp(line->value, data, length) == 0) {
+        g_hw_state.cache_stats.writes_absorbed++;   // Nothing new to program
+        return 0;
+    }
+    if (line->dirty) {
+        g_hw_state.cache_stats.writes_absorbed++;   // The pending value never will be
+    }
     
-    // TODO: Implement actual log storage
+    if (length > 0) memcpy(line->value, data, length);
+    line->length = (uint16_t)length;
+    if (!line->dirty) {
+        line->dirty = true;
+        if (g_hw_state.cache_stats.dirty_records++ == 0) {
+            g_hw_state.oldest_dirty_ms = bsp_get_tick_ms64();
+        }
+    }
     return 0;
 }
 
-int hardware_log_read(uint32_t index, char* buffer, uint32_t buffer_size) {
-    if (!buffer || buffer_size == 0) return -1;
+static int config_flush(void) {
+    if (g_hw_state.cache_stats.dirty_records == 0) return 0;
+    
+    hardware_power_suppress_sleep("storage flush");
+    int result = 0;
+    for (uint32_t i = 0; i < CONFIG_POOL_STORAGE_OP_BLOCKS; i++) {
+        ConfigCacheLine_t* line = g_hw_state.cache_lines[i];
+        if (!line || !line->dirty) continue;
+        
+        g_hw_state.cache_stats.flash_programs++;
+        if (kv_store_write(&g_hw_state.config_store, line->key, line->value, line->length) != 0) {
+            printf("Hardware: ERROR - flushing config record 0x%04x failed\n", line->key);
+            result = -1;
+            continue;   // Stays dirty for the next flush
+        }
+        line->dirty = false;
+        g_hw_state.cache_stats.dirty_records--;
+    }
+    
+    g_hw_state.cache_stats.flushes++;
+    g_hw_state.oldest_dirty_ms = bsp_get_tick_ms64();
+    hardware_power_allow_sleep("storage flush");
+    return result;
+}
+
+int hardware_config_read(uint16_t key, void* data, uint32_t length) {
+    bsp_mutex_lock(g_hw_state.storage_lock);
+    int result = config_read(key, data, length);
+    bsp_mutex_unlock(g_hw_state.storage_lock);
+    return result;
+}
+
+int hardware_config_write(uint16_t key, const void* data, uint32_t length) {
+    if (!data && length > 0) return -1;
+    
+    bsp_mutex_lock(g_hw_state.storage_lock);
+    int result = config_write(key, data, length);
+    bsp_mutex_unlock(g_hw_state.storage_lock);
+    return result;
+}
+
+int hardware_config_flush(void) {
+    bsp_mutex_lock(g_hw_state.storage_lock);
+    int result = config_flush();
+    bsp_mutex_unlock(g_hw_state.storage_lock);
+    return result;
+}
+
+void hardware_config_get_cache_stats(hardware_config_cache_stats_t* stats) {
+    if (!stats) return;
+    bsp_mutex_lock(g_hw_state.storage_lock);
+    *stats = g_hw_state.cache_stats;
+    bsp_mutex_unlock(g_hw_state.storage_lock);
+}
+
+void hardware_config_get_stats(KvStoreStats_t* stats) {
+    bsp_mutex_lock(g_hw_state.storage_lock);
+    kv_store_get_stats(&g_hw_state.config_store, stats);
+    bsp_mutex_unlock(g_hw_state.storage_lock);
+}
+
+void hardware_storage_idle(void) {
+    uint64_t now = bsp_get_tick_ms64();
+    bsp_mutex_lock(g_hw_state.storage_lock);
+    if (g_hw_state.cache_stats.dirty_records > 0 &&
+        now - g_hw_state.oldest_dirty_ms >= CONFIG_CONFIG_CACHE_FLUSH_MS) {
+        config_flush();
+    }
+    if (event_log_pending(&g_hw_state.event_log) > 0 &&
+        now - g_hw_state.log_pending_ms >= CONFIG_CONFIG_CACHE_FLUSH_MS) {
+        log_flush();
+    }
+    kv_store_compact(&g_hw_state.config_store);
+    bsp_mutex_unlock(g_hw_state.storage_lock);
+}
+
+static const char* const log_event_names[HARDWARE_LOG_EVENT_COUNT] = {
+    [HARDWARE_LOG_EVENT_NONE]               = "None",
+    [HARDWARE_LOG_EVENT_BOOT]               = "Boot",
+    [HARDWARE_LOG_EVENT_LOCK_STARTED]       = "Lock started",
+    [HARDWARE_LOG_EVENT_LOCK_ENDED]         = "Lock ended",
+    [HARDWARE_LOG_EVENT_EMERGENCY_RELEASE]  = "Emergency release",
+    [HARDWARE_LOG_EVENT_DOOR_OPENED]        = "Door opened",
+    [HARDWARE_LOG_EVENT_DOOR_CLOSED]        = "Door closed",
+    [HARDWARE_LOG_EVENT_BATTERY_LOW]        = "Battery low",
+    [HARDWARE_LOG_EVENT_BATTERY_CRITICAL]   = "Battery critical",
+    [HARDWARE_LOG_EVENT_OVER_TEMPERATURE]   = "Over temperature",
+};
+
+int hardware_log_append(hardware_log_event_t event, uint32_t arg) {
+    if (event <= HARDWARE_LOG_EVENT_NONE || event >= HARDWARE_LOG_EVENT_COUNT) return -1;
+    uint32_t utc = (uint32_t)bsp_get_utc_time_seconds();
+    
+    bsp_mutex_lock(g_hw_state.storage_lock);
+    if (event_log_pending(&g_hw_state.event_log) == 0) {
+        g_hw_state.log_pending_ms = bsp_get_tick_ms64();
+    }
+    int result = event_log_append(&g_hw_state.event_log, (uint8_t)event, utc, arg);
+    bsp_mutex_unlock(g_hw_state.storage_lock);
+    return result;
+}
+
+uint32_t hardware_log_count(void) {
+    bsp_mutex_lock(g_hw_state.storage_lock);
+    uint32_t count = event_log_count(&g_hw_state.event_log);
+    bsp_mutex_unlock(g_hw_state.storage_lock);
+    return count;
+}
+
+int hardware_log_read(uint32_t index, EventLogEntry_t* entry) {
+    bsp_mutex_lock(g_hw_state.storage_lock);
+    int result = event_log_read(&g_hw_state.event_log, index, entry);
+    bsp_mutex_unlock(g_hw_state.storage_lock);
+    return result;
+}
+
+// With storage_lock held
+static int log_flush(void) {
+    if (event_log_pending(&g_hw_state.event_log) == 0) return 0;
     
-    // Placeholder implementation
-    snprintf(buffer, buffer_size, "Log entry %lu", (unsigned long)index);
+    hardware_power_suppress_sleep("storage flush");
+    int result = event_log_flush(&g_hw_state.event_log);
+    hardware_power_allow_sleep("storage flush");
+    if (result != 0) {
+        printf("Hardware: ERROR - writing lock history failed\n");
+        return -1;
+    }
     return 0;
 }
 
+int hardware_log_flush(void) {
+    bsp_mutex_lock(g_hw_state.storage_lock);
+    int result = log_flush();
+    bsp_mutex_unlock(g_hw_state.storage_lock);
+    return result;
+}
+
+const char* hardware_log_event_name(uint8_t event) {
+    return (event < HARDWARE_LOG_EVENT_COUNT) ? log_event_names[event] : "Unknown";
+}
+
+void hardware_log_get_stats(EventLogStats_t* stats) {
+    bsp_mutex_lock(g_hw_state.storage_lock);
+    event_log_get_stats(&g_hw_state.event_log, stats);
+    bsp_mutex_unlock(g_hw_state.storage_lock);
+}
+
 // =============================================================================
 // CHARGING SYSTEM IMPLEMENTATION
 // =============================================================================
 
 bool hardware_is_charging(void) {
-    bsp_sensor_readings_t readings;
-    if (bsp_sensors_read(&readings) == 0) {
-        return readings.charging_active;
-    }
-    return false;
+    hardware_sensor_data_t data;
+    hardware_get_sensor_data(&data);
+    return data.charging_active;
+}
+
+// =============================================================================
+// RTC ALARM IMPLEMENTATION
+// =============================================================================
+
+int hardware_rtc_set_alarm(uint64_t utc_seconds, bsp_task_handle_t task) {
+    return bsp_rtc_set_alarm(utc_seconds, task, HST_EVT_SRC_RTC | HST_EVT_RTC_ALARM);
+}
+
+void hardware_rtc_cancel_alarm(void) {
+    bsp_rtc_cancel_alarm();
 }
 
 // =============================================================================
@@ -177,20 +624,114 @@ int hardware_power_set_mode(hardware_power_mode_t mode) {
             return -1;
     }
     
+    // Cached config and history reach flash before the system goes to sleep
+    if (mode != HARDWARE_POWER_ACTIVE) {
+        hardware_config_flush();
+        hardware_log_flush();
+    }
+    
+    g_hw_state.power_mode = mode;
     return bsp_power_set_mode(bsp_mode);
 }
 
 hardware_power_mode_t hardware_power_get_mode(void) {
-    // Placeholder - BSP doesn't provide power mode query yet
-    return HARDWARE_POWER_ACTIVE;
+    return g_hw_state.power_mode;
+}
+
+// Wakes the governor's task early; a no-op when it updates on its own timer
+static void governor_kick(void) {
+    if (g_hw_state.governor_task && g_hw_state.governor_notify_bits) {
+        bsp_task_notify(g_hw_state.governor_task, g_hw_state.governor_notify_bits);
+    }
 }
 
 void hardware_power_suppress_sleep(const char* reason) {
-    printf("Hardware: Sleep suppressed - %s\n", reason ? reason : "unknown");
+    power_governor_hold(&g_hw_state.power_governor, reason, bsp_get_tick_ms64());
+    bsp_power_suppress_sleep();
 }
 
 void hardware_power_allow_sleep(const char* reason) {
-    printf("Hardware: Sleep allowed - %s\n", reason ? reason : "unknown");
+    power_governor_release(&g_hw_state.power_governor, reason, bsp_get_tick_ms64());
+    bsp_power_allow_sleep();
+    
+    // The last hold may have been all that kept SLEEP from going deeper
+    if (power_governor_insomnia(&g_hw_state.power_governor) == 0 &&
+        g_hw_state.power_mode == HARDWARE_POWER_SLEEP) {
+        governor_kick();
+    }
+}
+
+uint32_t hardware_power_get_insomnia(void) {
+    return power_governor_insomnia(&g_hw_state.power_governor);
+}
+
+void hardware_power_governor_start(bsp_task_handle_t task, uint32_t notify_bits) {
+    g_hw_state.governor_task = task;
+    g_hw_state.governor_notify_bits = notify_bits;
+}
+
+void hardware_power_note_activity(void) {
+    power_governor_activity(&g_hw_state.power_governor, bsp_get_tick_ms64());
+    if (g_hw_state.power_mode != HARDWARE_POWER_ACTIVE) {
+        governor_kick();
+    }
+}
+
+uint32_t hardware_power_governor_update(void) {
+    static const hardware_power_mode_t modes[POWER_GOVERNOR_STATE_COUNT] = {
+        [POWER_GOVERNOR_ACTIVE]     = HARDWARE_POWER_ACTIVE,
+        [POWER_GOVERNOR_SLEEP]      = HARDWARE_POWER_SLEEP,
+        [POWER_GOVERNOR_DEEP_SLEEP] = HARDWARE_POWER_DEEP_SLEEP,
+    };
+    
+    PowerGovernorState_t state = power_governor_update(&g_hw_state.power_governor, bsp_get_tick_ms64());
+    if (modes[state] == g_hw_state.power_mode) return 0;
+    
+    printf("Hardware: Power mode %s\n", power_governor_state_name(state));
+    hardware_power_set_mode(modes[state]);
+    return HST_EVT_SRC_POWER | HST_EVT_POWER_MODE_CHANGED;
+}
+
+uint32_t hardware_power_governor_next_ms(void) {
+    uint32_t next = power_governor_next_deadline_ms(&g_hw_state.power_governor, bsp_get_tick_ms64());
+    return (next == POWER_GOVERNOR_NO_DEADLINE) ? BSP_WAIT_FOREVER : next;
+}
+
+uint32_t hardware_power_get_costliest(PowerReasonCost_t* costs, uint32_t max) {
+    return power_governor_costliest(&g_hw_state.power_governor, bsp_get_tick_ms64(), costs, max);
+}
+
+void hardware_power_print_report(void) {
+    const PowerGovernor_t* governor = &g_hw_state.power_governor;
+    uint64_t now = bsp_get_tick_ms64();
+    
+    uint64_t total = 0;
+    for (int state = 0; state < POWER_GOVERNOR_STATE_COUNT; state++) {
+        total += power_governor_residency_ms(governor, (PowerGovernorState_t)state, now);
+    }
+    if (total == 0) total = 1;
+    
+    printf("\n=== POWER GOVERNOR ===\n");
+    for (int state = 0; state < POWER_GOVERNOR_STATE_COUNT; state++) {
+        uint64_t residency = power_governor_residency_ms(governor, (PowerGovernorState_t)state, now);
+        printf("%-11s %9llu ms (%5.1f%%) in %lu entries\n",
+               power_governor_state_name((PowerGovernorState_t)state),
+               (unsigned long long)residency, 100.0 * residency / total,
+               (unsigned long)governor->entries[state]);
+    }
+    printf("Insomnia: %lu held (%lu without a reason slot)\n",
+           (unsigned long)power_governor_insomnia(governor),
+           (unsigned long)governor->unregistered);
+    
+    PowerReasonCost_t costs[POWER_GOVERNOR_MAX_REASONS];
+    uint32_t count = power_governor_costliest(governor, now, costs, POWER_GOVERNOR_MAX_REASONS);
+    printf("Costliest sleep suppression reasons:\n");
+    for (uint32_t i = 0; i < count; i++) {
+        printf("  %-20s %9llu ms in %lu holds%s\n", costs[i].name,
+               (unsigned long long)costs[i].held_ms, (unsigned long)costs[i].count,
+               costs[i].held ? " (held)" : "");
+    }
+    printf("=== END POWER GOVERNOR ===\n\n");
 }
 
 // =============================================================================
@@ -203,6 +744,37 @@ int hardware_init(void) {
     // Hardware initialization is handled by BSP layer
     // This function provides high-level initialization coordination
     
+    // Created once: a re-init keeps the lock the other tasks may hold
+    if (!g_hw_state.storage_lock) {
+        g_hw_state.storage_lock = bsp_mutex_create();
+    }
+    memory_pool_init(&g_hw_state.storage_op_pool, "storage_op", g_hw_state.storage_op_arena,
+                     sizeof(g_hw_state.storage_op_arena), CONFIG_POOL_STORAGE_OP_SIZE);
+    memset(g_hw_state.cache_lines, 0, sizeof(g_hw_state.cache_lines));
+    memset(&g_hw_state.cache_stats, 0, sizeof(g_hw_state.cache_stats));
+    power_governor_init(&g_hw_state.power_governor, bsp_get_tick_ms64());
+    g_hw_state.power_mode = HARDWARE_POWER_ACTIVE;
+    wire_actuator_init(&g_hw_state.wire);
+    g_hw_state.lock_request = false;
+    
+    if (kv_store_mount(&g_hw_state.config_store, CONFIG_STORAGE_CONFIG_START_ADDR,
+                       CONFIG_STORAGE_CONFIG_SIZE) != 0) {
+        printf("Hardware: ERROR - config store mount failed\n");
+        return -1;
+    }
+    if (event_log_mount(&g_hw_state.event_log, CONFIG_STORAGE_LOG_START_ADDR,
+                        CONFIG_STORAGE_LOG_SIZE) != 0) {
+        printf("Hardware: ERROR - lock history mount failed\n");
+        return -1;
+    }
+    hardware_log_append(HARDWARE_LOG_EVENT_BOOT, 0);
+    
+    // Readers get a valid snapshot from the start
+    bsp_sensor_readings_t readings;
+    if (bsp_sensors_read(&readings) == 0) {
+        publish_sensor_data(&readings);
+    }
+    
     printf("Hardware: Hardware subsystems initialized\n");
     return 0;
 }
@@ -211,6 +783,10 @@ void hardware_cleanup(void) {
     printf("Hardware: Cleaning up hardware subsystems...\n");
     
     // Cleanup coordination for hardware subsystems
+    hardware_rtc_cancel_alarm();
+    bsp_wire_set_duty(0);
+    hardware_config_flush();
+    hardware_log_flush();
     
     printf("Hardware: Hardware cleanup complete\n");
 }
\ No newline at end of file
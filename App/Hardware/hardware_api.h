@@ -4,6 +4,11 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include "../BSP/bsp_api.h"
+#include "../Utils/memory_pool.h"
+#include "../Utils/kv_store.h"
+#include "../Utils/event_log.h"
+#include "../Utils/power_governor.h"
+#include "../Utils/wire_actuator.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -27,14 +32,70 @@ typedef struct {
     uint32_t timestamp_ms;
 } hardware_sensor_data_t;
 
-// Get latest sensor readings
+// Latest sample published by the HardwareService task, which takes one
+// in hardware_init() and on every hardware_sensor_poll_events(). Safe from
+// any task without locking, and never touches the sensors: readers always
+// get one whole sample, timestamp_ms telling its age. Returns -1 (and
+// zeros) before hardware_init().
 int hardware_get_sensor_data(hardware_sensor_data_t* data);
 
-// Individual sensor queries
+// Individual fields of the same snapshot
 float hardware_get_battery_percentage(void);
 bool hardware_is_door_closed(void);
 bool hardware_is_latch_engaged(void);
 
+// =============================================================================
+// HARDWARESERVICE -> APPLICATIONLOGIC EVENTS
+// =============================================================================
+
+// Sent with bsp_task_notify() (Inter_Task_Communication_ICD.txt section 4).
+// Notifications OR into the receiver's pending word, so every source and
+// every event owns one bit and several events can be pending at once. Event
+// data is not packed into the word; the receiver reads current values back
+// through the getters above.
+
+// Event sources (bits 31-24)
+#define HST_EVT_SRC_OFFSET          24
+#define HST_EVT_SRC_HLM             (0x01u << HST_EVT_SRC_OFFSET)  // Hardware Lock Manager
+#define HST_EVT_SRC_SENSOR          (0x02u << HST_EVT_SRC_OFFSET)  // Sensor Management
+#define HST_EVT_SRC_STORAGE         (0x04u << HST_EVT_SRC_OFFSET)  // Storage Operations
+#define HST_EVT_SRC_POWER           (0x08u << HST_EVT_SRC_OFFSET)  // Power Management
+#define HST_EVT_SRC_RTC             (0x10u << HST_EVT_SRC_OFFSET)  // RTC events
+#define HST_EVT_SRC_SYSTEM          (0x80u << HST_EVT_SRC_OFFSET)  // General HW_TASK events
+#define HST_EVT_SRC_MASK            (0xFFu << HST_EVT_SRC_OFFSET)
+
+// HLM events (bits 7-0)
+#define HST_EVT_DOOR_OPENED         (1u << 0)
+#define HST_EVT_DOOR_CLOSED         (1u << 1)
+#define HST_EVT_LATCH_CHANGED       (1u << 2)
+#define HST_EVT_UNLOCK_SUCCESS      (1u << 3)
+#define HST_EVT_UNLOCK_FAILURE      (1u << 4)   // Latch did not move, or aborted
+#define HST_EVT_UNLOCK_BLOCKED      (1u << 5)   // Latch free, the door stayed shut
+
+// Sensor events (bits 15-8)
+#define HST_EVT_BATTERY_LOW         (1u << 8)   // Fell to CONFIG_BATTERY_LOW_THRESHOLD
+#define HST_EVT_BATTERY_CRITICAL    (1u << 9)   // Fell to CONFIG_BATTERY_CRITICAL_THRESHOLD
+#define HST_EVT_CHARGER_CHANGED     (1u << 10)
+#define HST_EVT_OVER_TEMPERATURE    (1u << 11)  // Rose to CONFIG_TEMPERATURE_OVER_THRESHOLD_C
+
+// Storage, power, RTC and system events (bits 23-16)
+#define HST_EVT_STORAGE_DONE        (1u << 16)
+#define HST_EVT_POWER_MODE_CHANGED  (1u << 17)
+#define HST_EVT_RTC_ALARM           (1u << 18)
+#define HST_EVT_HW_INIT_COMPLETE    (1u << 19)
+// Bit 23 is kept free: ApplicationLogic_Task takes its button input
+// notification there (main.cpp)
+
+#define HST_EVT_CODE_MASK           0x00FFFFFFu
+#define HST_EVT_ALL                 (HST_EVT_SRC_MASK | HST_EVT_CODE_MASK)
+
+// Sample the sensors, publish the sample for hardware_get_sensor_data() and
+// return the events (source bits included) for every edge since the
+// previous call; 0 when nothing changed. Threshold events are raised once,
+// and again only after the value has recovered past the hysteresis
+// (sensor_pipeline_alarms()). HardwareService task only.
+uint32_t hardware_sensor_poll_events(void);
+
 // =============================================================================
 // LOCK MECHANISM
 // =============================================================================
@@ -46,34 +107,109 @@ typedef enum {
     HARDWARE_LOCK_ERROR
 } hardware_lock_state_t;
 
-// Lock control operations
+// Lock control operations. Release starts the memory wire sequence with the
+// CONFIG_MEMORY_WIRE_* defaults and returns at once; the result arrives as
+// HST_EVT_UNLOCK_SUCCESS, _BLOCKED or _FAILURE. Returns -1 while a sequence
+// runs or the wire cools down.
 int hardware_lock_engage(void);
 int hardware_lock_release(void);
 hardware_lock_state_t hardware_lock_get_state(void);
 
-// Memory wire unlock system
+// Memory wire unlock system; 0 for either argument takes the default
 int hardware_memory_wire_heat(uint8_t target_temp_celsius, uint16_t duration_ms);
 bool hardware_memory_wire_is_heating(void);
 
+// The unlock sequence (Utils/wire_actuator.h), run by the HardwareService
+// task: requests from other tasks are queued and task gets notify_bits to
+// pick them up. hardware_lock_update() steps the sequence, drives the wire
+// PWM and returns the result events (source bit included), 0 while it runs;
+// the task blocks at most hardware_lock_next_ms() in between. Sleep is
+// suppressed ("unlock") from the request until the result.
+void hardware_lock_start(bsp_task_handle_t task, uint32_t notify_bits);
+uint32_t hardware_lock_update(void);
+uint32_t hardware_lock_next_ms(void);   // BSP_WAIT_FOREVER when idle
+void hardware_lock_get_stats(WireActuatorStats_t* stats);
+
 // =============================================================================
 // STORAGE SYSTEM  
 // =============================================================================
 
-// Configuration storage
-int hardware_config_read(uint32_t address, void* data, uint32_t length);
-int hardware_config_write(uint32_t address, const void* data, uint32_t length);
+// Configuration storage: keyed records in the wear-levelled record store
+// over the config region (Utils/kv_store.h). Values are opaque here; their
+// owners define the layout.
+#define HARDWARE_CONFIG_KEY_APP_SNAPSHOT        0x0001  // AppSnapshot_t, lock session included
+#define HARDWARE_CONFIG_KEY_LOCK_TIME_COUNTERS  0x0002  // LockTimeBase_t
+#define HARDWARE_CONFIG_KEY_LOCK_TIME_DELTA     0x0003  // LockTimeDelta_t
+
+// Small records are cached write-back: a write only updates RAM and marks
+// the record dirty, and dirty records reach flash in one batch on sleep
+// entry, on the battery crossing CONFIG_BATTERY_CRITICAL_THRESHOLD, or
+// CONFIG_CONFIG_CACHE_FLUSH_MS after the oldest unflushed write. Records too
+// big for a cache line are written through.
+//
+// Returns the stored length (copying at most length bytes), -1 if absent
+int hardware_config_read(uint16_t key, void* data, uint32_t length);
+int hardware_config_write(uint16_t key, const void* data, uint32_t length);
+int hardware_config_flush(void);    // Write every dirty record now
+void hardware_config_get_stats(KvStoreStats_t* stats);
+
+typedef struct {
+    uint32_t writes;                // hardware_config_write() calls
+    uint32_t writes_absorbed;       // Writes superseded or repeated before a flush
+    uint32_t flash_programs;        // Records written to the store
+    uint32_t flushes;               // Batches written
+    uint32_t dirty_records;         // Currently waiting for a flush
+} hardware_config_cache_stats_t;
+
+void hardware_config_get_cache_stats(hardware_config_cache_stats_t* stats);
 
-// Log storage 
-int hardware_log_append(const char* log_entry);
-int hardware_log_read(uint32_t index, char* buffer, uint32_t buffer_size);
+// Storage housekeeping for idle time: flush the cache and the lock history
+// once their deadline has passed and reclaim store pages ahead of need
+void hardware_storage_idle(void);
+
+// Lock history: binary event log over the log region (Utils/event_log.h).
+// Entries are timestamped with the UTC clock when appended. The block being
+// filled reaches flash on the same triggers as the config cache.
+typedef enum {
+    HARDWARE_LOG_EVENT_NONE = 0,
+    HARDWARE_LOG_EVENT_BOOT,
+    HARDWARE_LOG_EVENT_LOCK_STARTED,        // arg: lock duration in minutes
+    HARDWARE_LOG_EVENT_LOCK_ENDED,          // arg: minutes locked
+    HARDWARE_LOG_EVENT_EMERGENCY_RELEASE,
+    HARDWARE_LOG_EVENT_DOOR_OPENED,         // arg: 1 if the device was locked
+    HARDWARE_LOG_EVENT_DOOR_CLOSED,
+    HARDWARE_LOG_EVENT_BATTERY_LOW,         // arg: battery percentage
+    HARDWARE_LOG_EVENT_BATTERY_CRITICAL,    // arg: battery percentage
+    HARDWARE_LOG_EVENT_OVER_TEMPERATURE,    // arg: degrees Celsius
+    HARDWARE_LOG_EVENT_COUNT
+} hardware_log_event_t;
+
+int hardware_log_append(hardware_log_event_t event, uint32_t arg);
+uint32_t hardware_log_count(void);
+// index 0 is the newest entry. Returns 0 on success, -1 if unavailable
+int hardware_log_read(uint32_t index, EventLogEntry_t* entry);
+int hardware_log_flush(void);
+const char* hardware_log_event_name(uint8_t event);
+void hardware_log_get_stats(EventLogStats_t* stats);
 
 // =============================================================================
 // CHARGING SYSTEM
 // =============================================================================
 
-// Charging status
+// Charging status, from the published sensor snapshot
 bool hardware_is_charging(void);
 
+// =============================================================================
+// RTC ALARM
+// =============================================================================
+
+// One alarm at an absolute UTC time; task receives
+// HST_EVT_SRC_RTC | HST_EVT_RTC_ALARM when it fires. Setting it replaces the
+// previous one, and an alarm beyond the RTC's reach fires early, so the woken
+// task always reschedules.
+int hardware_rtc_set_alarm(uint64_t utc_seconds, bsp_task_handle_t task);
+void hardware_rtc_cancel_alarm(void);
+
 // =============================================================================
 // POWER MANAGEMENT
 // =============================================================================
@@ -85,13 +221,34 @@ typedef enum {
     HARDWARE_POWER_STANDBY
 } hardware_power_mode_t;
 
-// Power control
+// Power control. Any mode but ACTIVE flushes cached config and history first.
 int hardware_power_set_mode(hardware_power_mode_t mode);
 hardware_power_mode_t hardware_power_get_mode(void);
 
-// Sleep suppression (prevents deep sleep during critical operations)
+// Sleep suppression (prevents deep sleep during critical operations). Holds
+// nest and are counted per reason (Utils/power_governor.h); pass the same
+// reason string to both calls.
 void hardware_power_suppress_sleep(const char* reason);
 void hardware_power_allow_sleep(const char* reason);
+uint32_t hardware_power_get_insomnia(void);
+
+// Power governor, run by the HardwareService task: ACTIVE -> SLEEP after
+// CONFIG_IDLE_TO_SLEEP_TIMEOUT_MS without activity, SLEEP -> DEEP_SLEEP after
+// a further CONFIG_SLEEP_TO_DEEP_SLEEP_MS with no sleep suppressed. Input and
+// hardware events are wake sources and return it to ACTIVE. task gets
+// notify_bits when a wake-up or a released hold needs an update before the
+// current deadline (NULL: never, the caller updates periodically).
+void hardware_power_governor_start(bsp_task_handle_t task, uint32_t notify_bits);
+void hardware_power_note_activity(void);
+// Enters the mode due now; returns HST_EVT_SRC_POWER | HST_EVT_POWER_MODE_CHANGED
+// if it changed, else 0
+uint32_t hardware_power_governor_update(void);
+// Longest the task may block before the next update (BSP_WAIT_FOREVER if none)
+uint32_t hardware_power_governor_next_ms(void);
+
+// Sleep suppression reasons ranked by time held, costliest first
+uint32_t hardware_power_get_costliest(PowerReasonCost_t* costs, uint32_t max);
+void hardware_power_print_report(void);
 
 // =============================================================================
 // HARDWARE INITIALIZATION
@@ -101,6 +258,12 @@ void hardware_power_allow_sleep(const char* reason);
 int hardware_init(void);
 void hardware_cleanup(void);
 
+#ifdef SIMULATOR
+// Per-device state for the multi-instance simulator (see Utils/sim_instance.h)
+size_t hardware_instance_size(void);
+void hardware_instance_bind(void* state);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
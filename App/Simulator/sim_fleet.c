@@ -0,0 +1,335 @@
+// CKOS Multi-Instance Simulator Library
+// Runs many independent virtual devices in one host process; see sim_fleet.h
+
+#include "sim_fleet.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <unistd.h>
+#include "../AppLogic/app_logic.h"
+#include "../Display/display_api.h"
+#include "../Hardware/hardware_api.h"
+
+// Simulated task periods (same as the single-device simulator); the display
+// runs when its refresh governor asks for a frame
+#define SIM_HARDWARE_UPDATE_MS  100     // 10 Hz
+#define SIM_APP_LOGIC_UPDATE_MS 16      // ~60 Hz
+
+struct sim_device {
+    uint32_t id;
+    bool started;
+    
+    // Per-module state blocks, bound together by sim_device_bind()
+    void* bsp_state;
+    void* hardware_state;
+    void* display_state;
+    void* app_state;
+    
+    bsp_timer_handle_t display_timer;
+    bsp_timer_handle_t lock_timer;
+};
+
+// =============================================================================
+// SIMULATED TASKS
+// =============================================================================
+
+// Simulated tasks run on their timers, so the pipeline only filters the
+// readings here; on target it also decides when HardwareService wakes
+static void set_sensor_sampling(sim_device_t* device, bool enabled) {
+    if (!enabled) {
+        bsp_sensors_stop();
+    } else if (bsp_sensors_start(NULL, 0, SIM_HARDWARE_UPDATE_MS) != 0) {
+        printf("Sim: WARNING - device %lu sensor pipeline not started\n", (unsigned long)device->id);
+    }
+}
+
+static void hardware_timer_callback(bsp_timer_handle_t timer, void* context) {
+    (void)timer;
+    sim_device_t* device = (sim_device_t*)context;
+    
+    // Sensor edges reach app logic as notification bits, as on target
+    uint32_t events = hardware_sensor_poll_events();
+    hardware_storage_idle();
+    
+    // Idle timeouts; deep sleep stops the sensor pipeline as on target
+    uint32_t power_events = hardware_power_governor_update();
+    if (power_events) {
+        set_sensor_sampling(device, hardware_power_get_mode() != HARDWARE_POWER_DEEP_SLEEP);
+        events |= power_events;
+    }
+    if (events) {
+        bsp_task_notify(bsp_task_get_current(), events);
+    }
+}
+
+// One-shot, re-armed for the display's next frame or blanking deadline
+static void schedule_display(sim_device_t* device) {
+    uint32_t next_ms = display_task_next_update_ms();
+    if (next_ms == BSP_WAIT_FOREVER) {
+        bsp_timer_stop(device->display_timer);
+    } else {
+        bsp_timer_set_period(device->display_timer, next_ms ? next_ms : 1);
+    }
+}
+
+// One-shot, re-armed for the unlock sequence's next step; stopped while idle
+static void schedule_lock(sim_device_t* device) {
+    uint32_t next_ms = hardware_lock_next_ms();
+    if (next_ms == BSP_WAIT_FOREVER) {
+        bsp_timer_stop(device->lock_timer);
+    } else {
+        bsp_timer_set_period(device->lock_timer, next_ms ? next_ms : 1);
+    }
+}
+
+static void lock_timer_callback(bsp_timer_handle_t timer, void* context) {
+    (void)timer;
+    uint32_t events = hardware_lock_update();
+    if (events) {
+        bsp_task_notify(bsp_task_get_current(), events);
+    }
+    schedule_lock((sim_device_t*)context);
+}
+
+static void app_logic_timer_callback(bsp_timer_handle_t timer, void* context) {
+    (void)timer;
+    sim_device_t* device = (sim_device_t*)context;
+    
+    uint32_t hw_events = bsp_task_notify_wait_bits(HST_EVT_ALL, 0);
+    if (hw_events) {
+        app_logic_process_hardware_events(hw_events);
+    }
+    app_logic_update();
+    
+    // Stands in for the notification a command or input sends on target
+    schedule_display(device);
+    if (!bsp_timer_is_active(device->lock_timer)) {
+        schedule_lock(device);      // Picks up an unlock request just made
+    }
+}
+
+static void display_timer_callback(bsp_timer_handle_t timer, void* context) {
+    (void)timer;
+    display_task_update();
+    schedule_display((sim_device_t*)context);
+}
+
+static int start_task_timers(sim_device_t* device) {
+    bsp_timer_handle_t hardware_timer = bsp_timer_create(
+        "HardwareSim", SIM_HARDWARE_UPDATE_MS, true, hardware_timer_callback, device);
+    bsp_timer_handle_t app_logic_timer = bsp_timer_create(
+        "AppLogicSim", SIM_APP_LOGIC_UPDATE_MS, true, app_logic_timer_callback, device);
+    device->display_timer = bsp_timer_create(
+        "DisplaySim", 1, false, display_timer_callback, device);
+    device->lock_timer = bsp_timer_create(
+        "LockSim", 1, false, lock_timer_callback, device);
+    
+    if (!bsp_timer_start(hardware_timer) ||
+        !bsp_timer_start(app_logic_timer) ||
+        !bsp_timer_start(device->display_timer) || !device->lock_timer) {
+        return -1;
+    }
+    return 0;
+}
+
+// =============================================================================
+// DEVICE LIFECYCLE
+// =============================================================================
+
+sim_device_t* sim_device_create(uint32_t device_id) {
+    sim_device_t* device = calloc(1, sizeof(sim_device_t));
+    if (!device) return NULL;
+    
+    device->id = device_id;
+    device->bsp_state = calloc(1, bsp_sim_instance_size());
+    device->hardware_state = calloc(1, hardware_instance_size());
+    device->display_state = calloc(1, display_instance_size());
+    device->app_state = calloc(1, app_logic_instance_size());
+    
+    if (!device->bsp_state || !device->hardware_state ||
+        !device->display_state || !device->app_state) {
+        sim_device_destroy(device);
+        return NULL;
+    }
+    
+    bsp_sim_instance_init(device->bsp_state);
+    return device;
+}
+
+void sim_device_destroy(sim_device_t* device) {
+    if (!device) return;
+    
+    bsp_sim_instance_release(device->bsp_state);
+    free(device->bsp_state);
+    free(device->hardware_state);
+    free(device->display_state);
+    free(device->app_state);
+    free(device);
+}
+
+void sim_device_bind(sim_device_t* device) {
+    bsp_sim_instance_bind(device ? device->bsp_state : NULL);
+    hardware_instance_bind(device ? device->hardware_state : NULL);
+    display_instance_bind(device ? device->display_state : NULL);
+    app_logic_instance_bind(device ? device->app_state : NULL);
+}
+
+int sim_device_start(sim_device_t* device) {
+    if (!device) return -1;
+    
+    sim_device_bind(device);
+    if (device->started) return 0;
+    
+    hardware_init();
+    display_task_init();
+    app_logic_init();
+    
+    set_sensor_sampling(device, true);
+    
+    if (start_task_timers(device) != 0) {
+        printf("Sim: ERROR - device %lu task timer setup failed\n", (unsigned long)device->id);
+        return -1;
+    }
+    
+    device->started = true;
+    return 0;
+}
+
+void sim_device_run_for(sim_device_t* device, uint32_t virtual_ms) {
+    if (!device) return;
+    
+    sim_device_bind(device);
+    if (!bsp_sim_clock_is_fast_forward()) {
+        bsp_sim_clock_set_fast_forward(true);
+    }
+    
+    uint32_t end = bsp_get_tick_ms() + virtual_ms;
+    while (true) {
+        bsp_sim_timer_process();
+        
+        int32_t remaining = (int32_t)(end - bsp_get_tick_ms());
+        if (remaining <= 0) break;
+        
+        uint32_t idle_ms = bsp_sim_timer_next_expiry_ms();
+        if (idle_ms > (uint32_t)remaining) idle_ms = (uint32_t)remaining;
+        bsp_sim_idle(idle_ms);
+    }
+}
+
+void sim_device_press_button(sim_device_t* device, bsp_button_id_t button) {
+    if (!device || button >= BSP_BUTTON_COUNT) return;
+    
+    sim_device_bind(device);
+    bsp_button_event_t event = {
+        .button = button,
+        .pressed = true,
+        .timestamp = bsp_get_tick_ms()
+    };
+    app_logic_process_button_event(&event);
+}
+
+uint32_t sim_device_get_id(const sim_device_t* device) {
+    return device ? device->id : 0;
+}
+
+const uint8_t* sim_device_get_framebuffer(sim_device_t* device) {
+    if (!device) return NULL;
+    
+    sim_device_bind(device);
+    return bsp_sim_get_framebuffer();
+}
+
+// =============================================================================
+// FLEET RUNNER
+// =============================================================================
+
+typedef struct {
+    sim_device_t** devices;
+    uint32_t count;
+    const sim_fleet_config_t* config;
+    uint32_t next_device;           // Claimed with an atomic increment
+    uint32_t failures;
+} sim_fleet_job_t;
+
+static void fleet_run_device(sim_fleet_job_t* job, sim_device_t* device) {
+    const sim_fleet_config_t* config = job->config;
+    
+    // Fleet devices live purely on virtual time, from power-up on
+    sim_device_bind(device);
+    if (!bsp_sim_clock_is_fast_forward()) {
+        bsp_sim_clock_set_fast_forward(true);
+    }
+    
+    if (sim_device_start(device) != 0) {
+        __atomic_add_fetch(&job->failures, 1, __ATOMIC_RELAXED);
+        return;
+    }
+    if (config->hook) config->hook(device, 0, config->hook_context);
+    
+    uint32_t slice = config->slice_ms ? config->slice_ms : config->duration_ms;
+    uint32_t elapsed = 0;
+    while (elapsed < config->duration_ms) {
+        uint32_t step = config->duration_ms - elapsed;
+        if (step > slice) step = slice;
+        
+        sim_device_run_for(device, step);
+        elapsed += step;
+        if (config->hook) config->hook(device, elapsed, config->hook_context);
+    }
+}
+
+static void* fleet_worker(void* arg) {
+    sim_fleet_job_t* job = (sim_fleet_job_t*)arg;
+    
+    while (true) {
+        uint32_t index = __atomic_fetch_add(&job->next_device, 1, __ATOMIC_RELAXED);
+        if (index >= job->count) break;
+        fleet_run_device(job, job->devices[index]);
+    }
+    
+    sim_device_bind(NULL);
+    return NULL;
+}
+
+int sim_fleet_run(sim_device_t** devices, uint32_t count, const sim_fleet_config_t* config) {
+    if (!devices || !config) return -1;
+    
+    uint32_t num_threads = config->num_threads;
+    if (num_threads == 0) {
+        long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        num_threads = (cpus > 0) ? (uint32_t)cpus : 1;
+    }
+    if (num_threads > count) num_threads = count;
+    
+    sim_fleet_job_t job = {
+        .devices = devices,
+        .count = count,
+        .config = config,
+        .next_device = 0,
+        .failures = 0
+    };
+    
+    // The host tick source initialises lazily; do it before the workers race
+    (void)bsp_get_tick_ms();
+    
+    pthread_t* threads = calloc(num_threads ? num_threads : 1, sizeof(pthread_t));
+    uint32_t started = 0;
+    if (threads) {
+        while (started < num_threads &&
+               pthread_create(&threads[started], NULL, fleet_worker, &job) == 0) {
+            started++;
+        }
+    }
+    
+    // Without workers the calling thread does the whole job
+    if (started == 0) {
+        fleet_worker(&job);
+    }
+    
+    for (uint32_t i = 0; i < started; i++) {
+        pthread_join(threads[i], NULL);
+    }
+    free(threads);
+    
+    return (job.failures == 0) ? 0 : -1;
+}
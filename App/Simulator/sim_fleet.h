@@ -0,0 +1,70 @@
+#ifndef SIM_FLEET_H
+#define SIM_FLEET_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "../BSP/bsp_api.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Multi-instance simulator library (simulator builds only)
+//
+// A sim_device_t is one complete virtual CKOS device: BSP state (clock,
+// storage, framebuffer, sensors, timers), hardware service, display task and
+// application logic. Binding a device makes every CKOS call on the calling
+// thread act on it, so any number of devices can share one process and a
+// worker pool can run them in parallel.
+
+typedef struct sim_device sim_device_t;
+
+// =============================================================================
+// DEVICE LIFECYCLE
+// =============================================================================
+
+sim_device_t* sim_device_create(uint32_t device_id);
+void sim_device_destroy(sim_device_t* device);
+
+// Point the calling thread at device (NULL = process default state). A
+// device must not be bound on two threads at once.
+void sim_device_bind(sim_device_t* device);
+
+// Initialise hardware, display and app logic and start the task timers.
+// Binds device on the calling thread and leaves it bound.
+int sim_device_start(sim_device_t* device);
+
+// Run the device's timers for virtual_ms of fast-forward virtual time.
+// Binds device on the calling thread and leaves it bound.
+void sim_device_run_for(sim_device_t* device, uint32_t virtual_ms);
+
+void sim_device_press_button(sim_device_t* device, bsp_button_id_t button);
+
+uint32_t sim_device_get_id(const sim_device_t* device);
+const uint8_t* sim_device_get_framebuffer(sim_device_t* device);
+
+// =============================================================================
+// FLEET RUNNER
+// =============================================================================
+
+// Called on the worker thread with the device bound, before the first slice
+// (elapsed_ms == 0) and after every slice; inject inputs or check state here
+typedef void (*sim_fleet_hook_t)(sim_device_t* device, uint32_t elapsed_ms, void* context);
+
+typedef struct {
+    uint32_t num_threads;           // 0 = one per online CPU
+    uint32_t duration_ms;           // Virtual time to run every device for
+    uint32_t slice_ms;              // Virtual time between hook calls (0 = one slice)
+    sim_fleet_hook_t hook;          // Optional
+    void* hook_context;
+} sim_fleet_config_t;
+
+// Start and run every device for duration_ms on a pool of worker threads.
+// Returns 0 when every device started and ran, -1 otherwise.
+int sim_fleet_run(sim_device_t** devices, uint32_t count, const sim_fleet_config_t* config);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SIM_FLEET_H
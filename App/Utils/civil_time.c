@@ -0,0 +1,253 @@
+// CKOS Civil Time
+// Integer UTC to local time conversion, DST rules and formatting; see
+// civil_time.h
+
+#include "civil_time.h"
+#include <string.h>
+
+// =============================================================================
+// DST RULE TABLE
+// =============================================================================
+
+// The Nth given weekday of a month, at an hour of the wall clock in force
+// before the change (or of UTC)
+typedef struct {
+    uint8_t month;
+    uint8_t week;                   // 1-4, or 5 for the last
+    uint8_t weekday;                // 0 = Sunday
+    uint8_t hour;
+} CivilTransition_t;
+
+typedef struct {
+    CivilTransition_t start;
+    CivilTransition_t end;
+    bool utc;                       // Hours are UTC, not local
+} CivilDstRuleEntry_t;
+
+static const CivilDstRuleEntry_t dst_rules[CIVIL_DST_RULE_COUNT] = {
+    [CIVIL_DST_FIXED] = { { 0, 0, 0, 0 },  { 0, 0, 0, 0 },   false },
+    [CIVIL_DST_EU]    = { { 3, 5, 0, 1 },  { 10, 5, 0, 1 },  true },
+    [CIVIL_DST_US]    = { { 3, 2, 0, 2 },  { 11, 1, 0, 2 },  false },
+};
+
+// =============================================================================
+// DAYS AND DATES
+// =============================================================================
+
+// H. Hinnant's days_from_civil, from 1970-01-01
+uint32_t civil_time_days_from_date(uint32_t year, uint32_t month, uint32_t day) {
+    year -= (month <= 2U);
+    uint32_t era = year / 400U;
+    uint32_t year_of_era = year - era * 400U;
+    uint32_t day_of_year = (153U * (month > 2U ? month - 3U : month + 9U) + 2U) / 5U + day - 1U;
+    uint32_t day_of_era = year_of_era * 365U + year_of_era / 4U - year_of_era / 100U + day_of_year;
+    return era * 146097U + day_of_era - 719468U;
+}
+
+// And civil_from_days: years counted from March, so the leap day is last
+void civil_time_date_from_days(uint32_t days, CivilTime_t* out) {
+    if (!out) return;
+
+    uint32_t z = days + 719468U;
+    uint32_t era = z / 146097U;
+    uint32_t day_of_era = z - era * 146097U;
+    uint32_t year_of_era = (day_of_era - day_of_era / 1460U + day_of_era / 36524U -
+                            day_of_era / 146096U) / 365U;
+    uint32_t day_of_year = day_of_era - (365U * year_of_era + year_of_era / 4U - year_of_era / 100U);
+    uint32_t month_from_march = (5U * day_of_year + 2U) / 153U;
+    uint32_t month = month_from_march < 10U ? month_from_march + 3U : month_from_march - 9U;
+
+    out->year = (uint16_t)(year_of_era + era * 400U + (month <= 2U));
+    out->month = (uint8_t)month;
+    out->day = (uint8_t)(day_of_year - (153U * month_from_march + 2U) / 5U + 1U);
+    out->weekday = (uint8_t)((days + 4U) % 7U);    // 1970-01-01 was a Thursday
+}
+
+static int64_t local_seconds(uint64_t utc_seconds, int32_t offset_s) {
+    int64_t local = (int64_t)utc_seconds + offset_s;
+    return local < 0 ? 0 : local;
+}
+
+static void set_time_of_day(CivilTime_t* out, uint32_t second_of_day) {
+    out->hour = (uint8_t)(second_of_day / 3600U);
+    out->minute = (uint8_t)((second_of_day / 60U) % 60U);
+    out->second = (uint8_t)(second_of_day % 60U);
+}
+
+void civil_time_from_utc(uint64_t utc_seconds, int32_t offset_s, CivilTime_t* out) {
+    if (!out) return;
+
+    int64_t local = local_seconds(utc_seconds, offset_s);
+    civil_time_date_from_days((uint32_t)(local / CIVIL_SECONDS_PER_DAY), out);
+    set_time_of_day(out, (uint32_t)(local % CIVIL_SECONDS_PER_DAY));
+}
+
+// =============================================================================
+// DAYLIGHT SAVING
+// =============================================================================
+
+static uint32_t nth_weekday(uint32_t year, const CivilTransition_t* when) {
+    uint32_t first = civil_time_days_from_date(year, when->month, 1);
+    uint32_t first_weekday = (first + 4U) % 7U;
+    uint32_t day = first + (when->weekday + 7U - first_weekday) % 7U + 7U * (when->week - 1U);
+
+    if (when->week == 5) {
+        uint32_t next_month = (when->month == 12) ? civil_time_days_from_date(year + 1U, 1, 1) :
+                                                    civil_time_days_from_date(year, when->month + 1U, 1);
+        if (day >= next_month) day -= 7U;
+    }
+    return day;
+}
+
+int64_t civil_time_dst_transition(CivilDstRule_t rule, uint32_t year, bool start,
+                                  int32_t std_offset_s) {
+    if ((unsigned)rule >= CIVIL_DST_RULE_COUNT || rule == CIVIL_DST_FIXED) return INT64_MAX;
+
+    const CivilDstRuleEntry_t* entry = &dst_rules[rule];
+    const CivilTransition_t* when = start ? &entry->start : &entry->end;
+    int64_t at = (int64_t)nth_weekday(year, when) * CIVIL_SECONDS_PER_DAY + when->hour * 3600;
+    if (!entry->utc) {
+        // Ends at an hour of daylight time
+        at -= std_offset_s + (start ? 0 : CIVIL_DST_SAVE_SECONDS);
+    }
+    return at;
+}
+
+bool civil_time_dst_active(CivilDstRule_t rule, uint64_t utc_seconds, int32_t std_offset_s,
+                           int64_t* from, int64_t* until) {
+    int64_t previous = INT64_MIN;
+    int64_t next = INT64_MAX;
+    bool active = (rule == CIVIL_DST_FIXED);
+
+    if (!active && (unsigned)rule < CIVIL_DST_RULE_COUNT) {
+        // The transitions of the years either side cover both hemispheres
+        // and the weeks around New Year
+        CivilTime_t now;
+        civil_time_from_utc(utc_seconds, std_offset_s, &now);
+        int64_t t = (int64_t)utc_seconds;
+        for (uint32_t year = now.year - 1U; year <= now.year + 1U; year++) {
+            for (int start = 0; start <= 1; start++) {
+                int64_t at = civil_time_dst_transition(rule, year, start, std_offset_s);
+                if (at <= t && at > previous) {
+                    previous = at;
+                    active = start;
+                } else if (at > t && at < next) {
+                    next = at;
+                }
+            }
+        }
+    }
+
+    if (from) *from = previous;
+    if (until) *until = next;
+    return active;
+}
+
+// =============================================================================
+// CACHED CLOCK
+// =============================================================================
+
+void civil_clock_init(CivilClock_t* clock, int32_t std_offset_s, CivilDstRule_t rule,
+                      bool dst_observed) {
+    if (!clock) return;
+    memset(clock, 0, sizeof(*clock));
+    clock->std_offset_s = std_offset_s;
+    clock->rule = rule;
+    clock->dst_observed = dst_observed;
+}
+
+void civil_clock_set_zone(CivilClock_t* clock, int32_t std_offset_s, CivilDstRule_t rule,
+                          bool dst_observed) {
+    if (!clock) return;
+    if (clock->std_offset_s != std_offset_s || clock->rule != rule ||
+        clock->dst_observed != dst_observed) {
+        civil_clock_init(clock, std_offset_s, rule, dst_observed);
+    }
+}
+
+// Full conversion, and the span it holds for
+static void recompute(CivilClock_t* clock, uint64_t utc_seconds) {
+    int64_t from = INT64_MIN;
+    int64_t until = INT64_MAX;
+    bool dst = clock->dst_observed &&
+               civil_time_dst_active(clock->rule, utc_seconds, clock->std_offset_s, &from, &until);
+
+    clock->offset_s = clock->std_offset_s + (dst ? CIVIL_DST_SAVE_SECONDS : 0);
+    civil_time_from_utc(utc_seconds, clock->offset_s, &clock->local);
+
+    int64_t local = local_seconds(utc_seconds, clock->offset_s);
+    int64_t day_start = local - local % CIVIL_SECONDS_PER_DAY - clock->offset_s;
+    clock->span_start_utc = (from > day_start) ? from : day_start;
+    clock->span_end_utc = (until < day_start + CIVIL_SECONDS_PER_DAY) ?
+                          until : day_start + CIVIL_SECONDS_PER_DAY;
+    clock->valid = true;
+}
+
+const CivilTime_t* civil_clock_update(CivilClock_t* clock, uint64_t utc_seconds) {
+    if (!clock) return NULL;
+
+    int64_t t = (int64_t)utc_seconds;
+    if (!clock->valid || t < clock->span_start_utc || t >= clock->span_end_utc) {
+        recompute(clock, utc_seconds);
+    } else if (utc_seconds == clock->last_utc + 1) {
+        // The span ends by midnight, so the hour never carries into the date
+        CivilTime_t* local = &clock->local;
+        if (++local->second == 60) {
+            local->second = 0;
+            if (++local->minute == 60) {
+                local->minute = 0;
+                local->hour++;
+            }
+        }
+    } else if (utc_seconds != clock->last_utc) {
+        int64_t local = local_seconds(utc_seconds, clock->offset_s);
+        set_time_of_day(&clock->local, (uint32_t)(local % CIVIL_SECONDS_PER_DAY));
+    }
+
+    clock->last_utc = utc_seconds;
+    return &clock->local;
+}
+
+bool civil_clock_is_dst(const CivilClock_t* clock) {
+    return clock && clock->valid && clock->offset_s != clock->std_offset_s;
+}
+
+// =============================================================================
+// FORMATTING
+// =============================================================================
+
+static char* put_digits(char* out, uint32_t value, int digits) {
+    for (int i = digits - 1; i >= 0; i--) {
+        out[i] = (char)('0' + value % 10U);
+        value /= 10U;
+    }
+    return out + digits;
+}
+
+size_t civil_time_format_hms(const CivilTime_t* time, char* buffer, size_t size) {
+    if (!buffer || size == 0) return 0;
+    buffer[0] = '\0';
+    if (!time || size < CIVIL_TIME_HMS_SIZE) return 0;
+
+    char* p = put_digits(buffer, time->hour, 2);
+    *p++ = ':';
+    p = put_digits(p, time->minute, 2);
+    *p++ = ':';
+    p = put_digits(p, time->second, 2);
+    *p = '\0';
+    return (size_t)(p - buffer);
+}
+
+size_t civil_time_format_date(const CivilTime_t* time, char* buffer, size_t size) {
+    if (!buffer || size == 0) return 0;
+    buffer[0] = '\0';
+    if (!time || size < CIVIL_TIME_DATE_SIZE) return 0;
+
+    char* p = put_digits(buffer, time->year, 4);
+    *p++ = '-';
+    p = put_digits(p, time->month, 2);
+    *p++ = '-';
+    p = put_digits(p, time->day, 2);
+    *p = '\0';
+    return (size_t)(p - buffer);
+}
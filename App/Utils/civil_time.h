@@ -0,0 +1,119 @@
+#ifndef CIVIL_TIME_H
+#define CIVIL_TIME_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "../Config/app_config.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// UTC to local wall-clock time without gmtime()/strftime(): integer
+// day/date conversion (H. Hinnant's civil_from_days, no loops over years or
+// months), daylight saving from a small table of transition rules, and a
+// formatter that writes digits straight into the caller's buffer. Nothing
+// here keeps static state, so every task may use it.
+//
+// CivilClock_t caches the span around the last conversion in which the
+// offset and the date cannot change (to the next local midnight or DST
+// transition, whichever is first); a clock read once a second then only
+// increments its seconds. Dates from 1970 on.
+
+// =============================================================================
+// CONFIGURATION
+// =============================================================================
+
+#define CIVIL_SECONDS_PER_DAY       86400
+#define CIVIL_DST_SAVE_SECONDS      3600
+
+// Buffer sizes, terminator included
+#define CIVIL_TIME_HMS_SIZE         9       // "HH:MM:SS"
+#define CIVIL_TIME_DATE_SIZE        11      // "YYYY-MM-DD"
+
+// =============================================================================
+// TYPES
+// =============================================================================
+
+typedef struct {
+    uint16_t year;
+    uint8_t month;                  // 1-12
+    uint8_t day;                    // 1-31
+    uint8_t hour;
+    uint8_t minute;
+    uint8_t second;
+    uint8_t weekday;                // 0 = Sunday
+} CivilTime_t;
+
+// Daylight saving rules; CONFIG_TIME_DST_RULE picks one
+typedef enum {
+    CIVIL_DST_FIXED = 0,            // DST on means one more hour all year
+    CIVIL_DST_EU,                   // Last Sunday of March to last Sunday of October, 01:00 UTC
+    CIVIL_DST_US,                   // Second Sunday of March to first Sunday of November, 02:00 local
+    CIVIL_DST_RULE_COUNT
+} CivilDstRule_t;
+
+typedef struct {
+    int32_t std_offset_s;           // Standard time east of UTC
+    CivilDstRule_t rule;
+    bool dst_observed;
+    bool valid;                     // Cache below holds a span
+    uint64_t last_utc;
+    int64_t span_start_utc;         // Offset and date hold in [start, end)
+    int64_t span_end_utc;
+    int32_t offset_s;               // Offset in force over the span
+    CivilTime_t local;
+} CivilClock_t;
+
+// =============================================================================
+// CONVERSION API
+// =============================================================================
+
+// Days since 1970-01-01 and back
+uint32_t civil_time_days_from_date(uint32_t year, uint32_t month, uint32_t day);
+void civil_time_date_from_days(uint32_t days, CivilTime_t* out);
+
+// Broken-down time of utc_seconds shifted by offset_s
+void civil_time_from_utc(uint64_t utc_seconds, int32_t offset_s, CivilTime_t* out);
+
+// When DST starts (or ends) in year under rule, as UTC seconds
+int64_t civil_time_dst_transition(CivilDstRule_t rule, uint32_t year, bool start,
+                                  int32_t std_offset_s);
+
+// Whether DST is in force at utc_seconds. With from/until non-NULL, also the
+// transitions either side of it (INT64_MIN/INT64_MAX when there are none).
+bool civil_time_dst_active(CivilDstRule_t rule, uint64_t utc_seconds, int32_t std_offset_s,
+                           int64_t* from, int64_t* until);
+
+// =============================================================================
+// CACHED CLOCK API
+// =============================================================================
+
+void civil_clock_init(CivilClock_t* clock, int32_t std_offset_s, CivilDstRule_t rule,
+                      bool dst_observed);
+
+// Changes the zone; the cache is dropped only if something changed
+void civil_clock_set_zone(CivilClock_t* clock, int32_t std_offset_s, CivilDstRule_t rule,
+                          bool dst_observed);
+
+// Local time at utc_seconds
+const CivilTime_t* civil_clock_update(CivilClock_t* clock, uint64_t utc_seconds);
+
+// Whether the last update fell in daylight saving time
+bool civil_clock_is_dst(const CivilClock_t* clock);
+
+// =============================================================================
+// FORMATTING API
+// =============================================================================
+
+// Write "HH:MM:SS" or "YYYY-MM-DD" and a terminator. Return the characters
+// written, or 0 (buffer left empty) if it is too small.
+size_t civil_time_format_hms(const CivilTime_t* time, char* buffer, size_t size);
+size_t civil_time_format_date(const CivilTime_t* time, char* buffer, size_t size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // CIVIL_TIME_H
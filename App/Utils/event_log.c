@@ -0,0 +1,352 @@
+// CKOS Binary Event Log
+// Varint-packed entries in fixed flash blocks with a RAM index; see event_log.h
+
+#include "event_log.h"
+#include "utils.h"
+#include <stdio.h>
+#include <string.h>
+
+// =============================================================================
+// FLASH FORMAT
+// =============================================================================
+
+// Starts every block. Written in one program together with the payload, so a
+// block torn by a reset fails its CRC and is skipped at mount.
+typedef struct {
+    uint32_t block;                 // Block number, INVALID while erased
+    uint32_t first_entry;           // Sequence number of the first entry
+    uint32_t base_time;             // Timestamp of the first entry
+    uint8_t count;                  // Entries in the block
+    uint8_t length;                 // Payload bytes
+    uint16_t crc;                   // CRC16 over header (crc zero) and payload
+} EventLogBlockHeader_t;
+
+// Each entry: event code, zigzag varint timestamp delta to the previous entry
+// of the block, varint argument. Usually three bytes.
+#define EVENT_LOG_PAYLOAD_SIZE      (EVENT_LOG_BLOCK_SIZE - sizeof(EventLogBlockHeader_t))
+#define EVENT_LOG_RECORD_MAX        (1 + 5 + 5)
+
+// =============================================================================
+// HELPERS
+// =============================================================================
+
+static int flash_read(uint32_t address, void* data, uint32_t length) {
+    bsp_storage_operation_t op = { address, (uint8_t*)data, length };
+    return bsp_storage_read(&op);
+}
+
+static int flash_write(uint32_t address, const void* data, uint32_t length) {
+    bsp_storage_operation_t op = { address, (uint8_t*)data, length };
+    return bsp_storage_write(&op);
+}
+
+static uint32_t slot_address(const EventLog_t* log, uint32_t slot) {
+    return log->region_start + slot * EVENT_LOG_BLOCK_SIZE;
+}
+
+static uint32_t put_varint(uint8_t* out, uint32_t value) {
+    uint32_t n = 0;
+    while (value >= 0x80u) {
+        out[n++] = (uint8_t)(value | 0x80u);
+        value >>= 7;
+    }
+    out[n++] = (uint8_t)value;
+    return n;
+}
+
+static int get_varint(const uint8_t* data, uint32_t length, uint32_t* offset, uint32_t* value) {
+    uint32_t result = 0;
+    for (uint32_t shift = 0; shift < 35 && *offset < length; shift += 7) {
+        uint8_t byte = data[(*offset)++];
+        result |= (uint32_t)(byte & 0x7Fu) << shift;
+        if (!(byte & 0x80u)) {
+            *value = result;
+            return 0;
+        }
+    }
+    return -1;
+}
+
+// Small negative deltas (clock set back) stay small
+static uint32_t zigzag_encode(int32_t value) {
+    return (value < 0) ? ((~(uint32_t)value) << 1) | 1u : (uint32_t)value << 1;
+}
+
+static int32_t zigzag_decode(uint32_t value) {
+    return (value & 1u) ? (int32_t)~(value >> 1) : (int32_t)(value >> 1);
+}
+
+static uint16_t block_crc(uint8_t* block, uint32_t payload_length) {
+    EventLogBlockHeader_t header;
+    memcpy(&header, block, sizeof(header));
+    uint16_t stored = header.crc;
+    header.crc = 0;
+    memcpy(block, &header, sizeof(header));
+
+    uint16_t crc = utils_crc16(block, sizeof(header) + payload_length);
+
+    header.crc = stored;
+    memcpy(block, &header, sizeof(header));
+    return crc;
+}
+
+static void slot_forget(EventLog_t* log, uint32_t slot) {
+    if (log->slot_block[slot] == log->read_cache_block) {
+        log->read_cache_block = EVENT_LOG_ENTRY_INVALID;
+    }
+    log->slot_block[slot] = EVENT_LOG_ENTRY_INVALID;
+}
+
+// Slot holding entry sequence, or -1
+static int slot_find(const EventLog_t* log, uint32_t sequence) {
+    for (uint32_t slot = 0; slot < log->slot_count; slot++) {
+        if (log->slot_block[slot] == EVENT_LOG_ENTRY_INVALID) continue;
+        uint32_t offset = sequence - log->slot_first_entry[slot];
+        if (offset < log->slot_entry_count[slot]) return (int)slot;
+    }
+    return -1;
+}
+
+// =============================================================================
+// BLOCK WRITE
+// =============================================================================
+
+static int erase_page(EventLog_t* log, uint32_t page) {
+    uint32_t first_slot = page * EVENT_LOG_BLOCKS_PER_PAGE;
+    for (uint32_t i = 0; i < EVENT_LOG_BLOCKS_PER_PAGE; i++) {
+        slot_forget(log, first_slot + i);
+    }
+    log->stats.pages_erased++;
+    return bsp_storage_erase(slot_address(log, first_slot), BSP_STORAGE_PAGE_SIZE);
+}
+
+// Writes the pending block to the slot of the next block number, erasing the
+// page first when the block starts one. A slot that fails to program is
+// skipped, never retried, and the next one tried.
+static int write_pending(EventLog_t* log) {
+    if (log->pending_count == 0) return 0;
+
+    EventLogBlockHeader_t header;
+    memcpy(&header, log->pending, sizeof(header));
+
+    for (uint32_t attempt = 0; attempt <= EVENT_LOG_BLOCKS_PER_PAGE; attempt++) {
+        uint32_t block = log->next_block++;
+        uint32_t slot = block % log->slot_count;
+
+        if (slot % EVENT_LOG_BLOCKS_PER_PAGE == 0 &&
+            erase_page(log, slot / EVENT_LOG_BLOCKS_PER_PAGE) != 0) {
+            log->stats.write_errors++;
+            continue;
+        }
+        slot_forget(log, slot);
+
+        header.block = block;
+        header.crc = 0;
+        memcpy(log->pending, &header, sizeof(header));
+        header.crc = block_crc(log->pending, header.length);
+        memcpy(log->pending, &header, sizeof(header));
+
+        if (flash_write(slot_address(log, slot), log->pending,
+                        sizeof(header) + header.length) != 0) {
+            log->stats.write_errors++;
+            continue;
+        }
+
+        log->slot_block[slot] = block;
+        log->slot_first_entry[slot] = header.first_entry;
+        log->slot_entry_count[slot] = header.count;
+        log->stats.blocks_written++;
+        log->pending_count = 0;
+        log->pending_length = 0;
+        return 0;
+    }
+
+    printf("Event log: ERROR - no writable block, %u entries kept in RAM\n",
+           (unsigned)log->pending_count);
+    return -1;
+}
+
+// Entry index of a block already checked by the caller
+static int decode_entry(const uint8_t* block, uint32_t index, EventLogEntry_t* entry) {
+    EventLogBlockHeader_t header;
+    memcpy(&header, block, sizeof(header));
+    if (index >= header.count) return -1;
+
+    const uint8_t* payload = block + sizeof(header);
+    uint32_t offset = 0;
+    uint32_t timestamp = header.base_time;
+    for (uint32_t i = 0; i <= index; i++) {
+        uint32_t delta;
+        uint32_t arg;
+        if (offset >= header.length) return -1;
+        uint8_t event = payload[offset++];
+        if (get_varint(payload, header.length, &offset, &delta) != 0 ||
+            get_varint(payload, header.length, &offset, &arg) != 0) {
+            return -1;
+        }
+        timestamp += (uint32_t)zigzag_decode(delta);
+
+        if (i == index) {
+            entry->sequence = header.first_entry + index;
+            entry->timestamp = timestamp;
+            entry->event = event;
+            entry->arg = arg;
+        }
+    }
+    return 0;
+}
+
+// =============================================================================
+// LOG API
+// =============================================================================
+
+int event_log_mount(EventLog_t* log, uint32_t region_start, uint32_t region_size) {
+    if (!log || region_size == 0 ||
+        region_start % BSP_STORAGE_PAGE_SIZE != 0 ||
+        region_size % BSP_STORAGE_PAGE_SIZE != 0 ||
+        region_size / EVENT_LOG_BLOCK_SIZE > EVENT_LOG_MAX_SLOTS) {
+        return -1;
+    }
+
+    memset(log, 0, sizeof(*log));
+    log->region_start = region_start;
+    log->slot_count = region_size / EVENT_LOG_BLOCK_SIZE;
+    log->read_cache_block = EVENT_LOG_ENTRY_INVALID;
+
+    bool found = false;
+    uint32_t newest_slot = 0;
+    for (uint32_t slot = 0; slot < log->slot_count; slot++) {
+        log->slot_block[slot] = EVENT_LOG_ENTRY_INVALID;
+
+        uint8_t* block = log->read_cache;
+        if (flash_read(slot_address(log, slot), block, EVENT_LOG_BLOCK_SIZE) != 0) return -1;
+
+        EventLogBlockHeader_t header;
+        memcpy(&header, block, sizeof(header));
+        if (header.block == EVENT_LOG_ENTRY_INVALID) continue;
+
+        if (header.count == 0 || header.length > EVENT_LOG_PAYLOAD_SIZE ||
+            header.block % log->slot_count != slot ||
+            block_crc(block, header.length) != header.crc) {
+            log->stats.corrupt_blocks++;
+            continue;
+        }
+
+        log->slot_block[slot] = header.block;
+        log->slot_first_entry[slot] = header.first_entry;
+        log->slot_entry_count[slot] = header.count;
+        if (!found || header.block > log->slot_block[newest_slot]) {
+            newest_slot = slot;
+            found = true;
+        }
+    }
+
+    if (found) {
+        log->next_block = log->slot_block[newest_slot] + 1;
+        log->next_entry = log->slot_first_entry[newest_slot] + log->slot_entry_count[newest_slot];
+    }
+    log->mounted = true;
+    return 0;
+}
+
+int event_log_append(EventLog_t* log, uint8_t event, uint32_t timestamp, uint32_t arg) {
+    if (!log || !log->mounted) return -1;
+
+    if (log->pending_count > 0) {
+        uint8_t record[EVENT_LOG_RECORD_MAX];
+        uint32_t size = 1;
+        size += put_varint(&record[size], zigzag_encode((int32_t)(timestamp - log->pending_last_time)));
+        size += put_varint(&record[size], arg);
+        if (log->pending_length + size > EVENT_LOG_PAYLOAD_SIZE &&
+            write_pending(log) != 0) {
+            return -1;
+        }
+    }
+
+    if (log->pending_count == 0) {
+        EventLogBlockHeader_t header;
+        memset(&header, 0, sizeof(header));
+        header.first_entry = log->next_entry;
+        header.base_time = timestamp;
+        memcpy(log->pending, &header, sizeof(header));
+        log->pending_last_time = timestamp;
+    }
+
+    uint8_t* out = &log->pending[sizeof(EventLogBlockHeader_t) + log->pending_length];
+    uint32_t size = 0;
+    out[size++] = event;
+    size += put_varint(&out[size], zigzag_encode((int32_t)(timestamp - log->pending_last_time)));
+    size += put_varint(&out[size], arg);
+
+    log->pending_length = (uint8_t)(log->pending_length + size);
+    log->pending_count++;
+    log->pending_last_time = timestamp;
+
+    EventLogBlockHeader_t header;
+    memcpy(&header, log->pending, sizeof(header));
+    header.count = log->pending_count;
+    header.length = log->pending_length;
+    memcpy(log->pending, &header, sizeof(header));
+    log->next_entry++;
+    log->stats.entries_appended++;
+    return 0;
+}
+
+int event_log_flush(EventLog_t* log) {
+    if (!log || !log->mounted) return -1;
+    return write_pending(log);
+}
+
+uint32_t event_log_pending(const EventLog_t* log) {
+    return log ? log->pending_count : 0;
+}
+
+uint32_t event_log_count(const EventLog_t* log) {
+    if (!log || !log->mounted) return 0;
+
+    uint32_t oldest = log->next_entry - log->pending_count;
+    for (uint32_t slot = 0; slot < log->slot_count; slot++) {
+        if (log->slot_block[slot] != EVENT_LOG_ENTRY_INVALID &&
+            log->slot_first_entry[slot] < oldest) {
+            oldest = log->slot_first_entry[slot];
+        }
+    }
+    return log->next_entry - oldest;
+}
+
+int event_log_read(EventLog_t* log, uint32_t back, EventLogEntry_t* entry) {
+    if (!entry || back >= event_log_count(log)) return -1;
+
+    uint32_t sequence = log->next_entry - 1 - back;
+    uint32_t pending_first = log->next_entry - log->pending_count;
+    if (sequence >= pending_first) {
+        return decode_entry(log->pending, sequence - pending_first, entry);
+    }
+
+    int slot = slot_find(log, sequence);
+    if (slot < 0) return -1;     // Lost with a corrupt block
+
+    if (log->read_cache_block != log->slot_block[slot]) {
+        log->read_cache_block = EVENT_LOG_ENTRY_INVALID;
+        log->stats.block_reads++;
+        if (flash_read(slot_address(log, (uint32_t)slot), log->read_cache,
+                       EVENT_LOG_BLOCK_SIZE) != 0) {
+            return -1;
+        }
+
+        EventLogBlockHeader_t header;
+        memcpy(&header, log->read_cache, sizeof(header));
+        if (header.block != log->slot_block[slot] || header.length > EVENT_LOG_PAYLOAD_SIZE ||
+            block_crc(log->read_cache, header.length) != header.crc) {
+            log->stats.corrupt_blocks++;
+            return -1;
+        }
+        log->read_cache_block = header.block;
+    }
+
+    return decode_entry(log->read_cache, sequence - log->slot_first_entry[slot], entry);
+}
+
+void event_log_get_stats(const EventLog_t* log, EventLogStats_t* stats) {
+    if (log && stats) *stats = log->stats;
+}
@@ -0,0 +1,116 @@
+#ifndef EVENT_LOG_H
+#define EVENT_LOG_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "../BSP/bsp_api.h"
+#include "../Config/app_config.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Ring-buffered binary event log over a page-aligned bsp_storage_* flash
+// region. Entries are an event code, a timestamp and a numeric argument,
+// packed a few bytes each into fixed-size blocks: varints, with each
+// timestamp stored as the delta to the one before it in the block. Block N
+// always lives in slot N % slot_count, so when the head reaches a new page
+// that page is erased and only its entries are dropped; wrap-around never
+// rewrites the rest of the log. The block being filled is held in RAM until
+// it is full or flushed.
+//
+// The RAM index keeps the first entry number of every slot, so reading any
+// entry costs at most one block read, and reading the entry before it
+// (scrolling back) is usually served from the block already read.
+
+// =============================================================================
+// CONFIGURATION
+// =============================================================================
+
+#define EVENT_LOG_BLOCK_SIZE        64
+#define EVENT_LOG_BLOCKS_PER_PAGE   (BSP_STORAGE_PAGE_SIZE / EVENT_LOG_BLOCK_SIZE)
+#define EVENT_LOG_MAX_SLOTS         ((CONFIG_STORAGE_LOG_SIZE / BSP_STORAGE_PAGE_SIZE) * \
+                                     EVENT_LOG_BLOCKS_PER_PAGE)
+#define EVENT_LOG_ENTRY_INVALID     0xFFFFFFFFu     // Reads back from erased flash
+
+// =============================================================================
+// LOG AND STATISTICS
+// =============================================================================
+
+typedef struct {
+    uint32_t sequence;              // Entry number since the log was formatted
+    uint32_t timestamp;             // UTC seconds
+    uint8_t event;
+    uint32_t arg;
+} EventLogEntry_t;
+
+typedef struct {
+    uint32_t entries_appended;
+    uint32_t blocks_written;
+    uint32_t pages_erased;
+    uint32_t block_reads;           // Flash reads made by event_log_read()
+    uint32_t corrupt_blocks;        // Bad CRC seen at mount or read
+    uint32_t write_errors;
+} EventLogStats_t;
+
+typedef struct {
+    uint32_t region_start;
+    uint32_t slot_count;
+    bool mounted;
+
+    // Sparse index: one entry per flash block
+    uint32_t slot_block[EVENT_LOG_MAX_SLOTS];       // Block number, or INVALID
+    uint32_t slot_first_entry[EVENT_LOG_MAX_SLOTS];
+    uint8_t slot_entry_count[EVENT_LOG_MAX_SLOTS];
+
+    uint32_t next_block;            // Block number the pending block will get
+    uint32_t next_entry;            // Sequence number of the next entry
+
+    // Block being filled
+    uint8_t pending[EVENT_LOG_BLOCK_SIZE];
+    uint8_t pending_count;
+    uint8_t pending_length;
+    uint32_t pending_last_time;
+
+    // Last block read back, for scrolling
+    uint8_t read_cache[EVENT_LOG_BLOCK_SIZE];
+    uint32_t read_cache_block;
+
+    EventLogStats_t stats;
+} EventLog_t;
+
+// =============================================================================
+// LOG API
+// =============================================================================
+
+// Scans the block headers of the region (whole pages, at most
+// CONFIG_STORAGE_LOG_SIZE) and rebuilds the index. Returns 0 on success, -1
+// on bad arguments or a flash error.
+int event_log_mount(EventLog_t* log, uint32_t region_start, uint32_t region_size);
+
+// Adds an entry to the pending block, writing the block out first if the
+// entry does not fit. Returns 0 on success, -1 if a full block could not be
+// written; the new entry is then dropped and the pending ones kept.
+int event_log_append(EventLog_t* log, uint8_t event, uint32_t timestamp, uint32_t arg);
+
+// Writes the pending block now, even if partly filled
+int event_log_flush(EventLog_t* log);
+
+// Entries still only in RAM
+uint32_t event_log_pending(const EventLog_t* log);
+
+// Entries available to event_log_read(), oldest to newest
+uint32_t event_log_count(const EventLog_t* log);
+
+// Reads an entry counting back from the newest (0 = newest). Returns 0 on
+// success, -1 if out of range or its block is unreadable.
+int event_log_read(EventLog_t* log, uint32_t back, EventLogEntry_t* entry);
+
+void event_log_get_stats(const EventLog_t* log, EventLogStats_t* stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // EVENT_LOG_H
@@ -0,0 +1,355 @@
+// CKOS Log-Structured Record Store
+// Append-only records with a RAM index over bsp_storage_*; see kv_store.h
+
+#include "kv_store.h"
+#include "utils.h"
+#include "../BSP/bsp_api.h"
+#include <stdio.h>
+#include <string.h>
+
+// =============================================================================
+// FLASH FORMAT
+// =============================================================================
+
+// Every page starts with a header; its sequence number orders the ring. The
+// magic changed from "CKKV" when utils_crc16() got its full table: pages
+// written with the old CRC are erased at mount instead of every record
+// failing its check.
+#define KV_PAGE_MAGIC   0x32564B43u     // "CKV2"
+
+typedef struct {
+    uint32_t magic;
+    uint32_t sequence;
+} KvPageHeader_t;
+
+// One doubleword, followed by the value padded to a whole doubleword. The
+// header is programmed before the value, so a record torn by a reset fails
+// its CRC and is skipped; length_check guards the length used to step over it.
+typedef struct {
+    uint16_t key;
+    uint16_t length;
+    uint16_t length_check;          // ~length
+    uint16_t crc;                   // CRC16 over key, length and value
+} KvRecordHeader_t;
+
+#define KV_ALIGN(size) \
+    ((((size) + BSP_STORAGE_PROGRAM_UNIT - 1) / BSP_STORAGE_PROGRAM_UNIT) * BSP_STORAGE_PROGRAM_UNIT)
+#define KV_RECORD_SIZE(length)  (sizeof(KvRecordHeader_t) + KV_ALIGN(length))
+#define KV_PAGE_CAPACITY        (BSP_STORAGE_PAGE_SIZE - sizeof(KvPageHeader_t))
+
+// =============================================================================
+// HELPERS
+// =============================================================================
+
+static int flash_read(uint32_t address, void* data, uint32_t length) {
+    bsp_storage_operation_t op = { address, (uint8_t*)data, length };
+    return bsp_storage_read(&op);
+}
+
+static int flash_write(uint32_t address, const void* data, uint32_t length) {
+    bsp_storage_operation_t op = { address, (uint8_t*)data, length };
+    return bsp_storage_write(&op);
+}
+
+static uint32_t page_address(const KvStore_t* store, uint32_t page) {
+    return store->region_start + page * BSP_STORAGE_PAGE_SIZE;
+}
+
+// The value must already be in scratch + 4
+static uint16_t record_crc(KvStore_t* store, uint16_t key, uint16_t length) {
+    store->scratch[0] = (uint8_t)(key & 0xFF);
+    store->scratch[1] = (uint8_t)(key >> 8);
+    store->scratch[2] = (uint8_t)(length & 0xFF);
+    store->scratch[3] = (uint8_t)(length >> 8);
+    return utils_crc16(store->scratch, 4u + length);
+}
+
+static KvIndexEntry_t* index_find(KvStore_t* store, uint16_t key) {
+    for (uint32_t i = 0; i < store->index_count; i++) {
+        if (store->index[i].key == key) return &store->index[i];
+    }
+    return NULL;
+}
+
+static int index_set(KvStore_t* store, uint16_t key, uint16_t length, uint32_t address) {
+    KvIndexEntry_t* entry = index_find(store, key);
+    if (!entry) {
+        if (store->index_count >= KV_STORE_MAX_KEYS) return -1;
+        entry = &store->index[store->index_count++];
+        entry->key = key;
+    }
+    entry->length = length;
+    entry->address = address;
+    return 0;
+}
+
+static uint32_t live_bytes(const KvStore_t* store) {
+    uint32_t total = 0;
+    for (uint32_t i = 0; i < store->index_count; i++) {
+        total += KV_RECORD_SIZE(store->index[i].length);
+    }
+    return total;
+}
+
+// =============================================================================
+// APPEND AND RECLAIM
+// =============================================================================
+
+// Appends the value in scratch + 4 to the head page. Space is consumed even
+// when programming fails, so a bad spot is never reprogrammed.
+static int append_record(KvStore_t* store, uint16_t key, uint16_t length) {
+    uint32_t size = KV_RECORD_SIZE(length);
+    if (store->head_offset + size > BSP_STORAGE_PAGE_SIZE) return -1;
+
+    uint32_t address = page_address(store, store->head_page) + store->head_offset;
+    KvRecordHeader_t header = {
+        .key = key,
+        .length = length,
+        .length_check = (uint16_t)~length,
+        .crc = record_crc(store, key, length)
+    };
+    store->head_offset += size;
+
+    if (flash_write(address, &header, sizeof(header)) != 0) return -1;
+    if (length > 0 && flash_write(address + sizeof(header), &store->scratch[4], length) != 0) {
+        return -1;
+    }
+    return index_set(store, key, length, address);
+}
+
+static int reclaim_page(KvStore_t* store, uint32_t page) {
+    uint32_t start = page_address(store, page);
+
+    for (uint32_t i = 0; i < store->index_count; i++) {
+        KvIndexEntry_t* entry = &store->index[i];
+        if (entry->address < start || entry->address >= start + BSP_STORAGE_PAGE_SIZE) {
+            continue;
+        }
+        if (flash_read(entry->address + sizeof(KvRecordHeader_t),
+                       &store->scratch[4], entry->length) != 0 ||
+            append_record(store, entry->key, entry->length) != 0) {
+            printf("KvStore: ERROR - relocating key 0x%04x failed\n", entry->key);
+            return -1;
+        }
+        store->stats.records_relocated++;
+    }
+
+    if (bsp_storage_erase(start, BSP_STORAGE_PAGE_SIZE) != 0) return -1;
+    store->page_in_use[page] = false;
+    store->stats.pages_reclaimed++;
+    return 0;
+}
+
+// Moves the head to the next (erased) page in the ring, then reclaims the
+// oldest page if that left no erased page
+static int open_next_page(KvStore_t* store) {
+    uint32_t page = (store->head_page + 1) % store->page_count;
+    if (store->page_in_use[page]) return -1;
+
+    uint32_t address = page_address(store, page);
+    KvPageHeader_t header = { KV_PAGE_MAGIC, store->next_sequence };
+    if (flash_write(address, &header, sizeof(header)) != 0) {
+        // Not actually blank (e.g. an erase cut short): erase and retry once
+        if (bsp_storage_erase(address, BSP_STORAGE_PAGE_SIZE) != 0 ||
+            flash_write(address, &header, sizeof(header)) != 0) {
+            return -1;
+        }
+    }
+
+    store->page_in_use[page] = true;
+    store->page_sequence[page] = store->next_sequence++;
+    store->head_page = page;
+    store->head_offset = sizeof(header);
+
+    uint32_t oldest = (page + 1) % store->page_count;
+    if (store->page_in_use[oldest]) {
+        return reclaim_page(store, oldest);
+    }
+    return 0;
+}
+
+// =============================================================================
+// MOUNT
+// =============================================================================
+
+// Indexes every valid record of one page and returns the offset where its
+// log ends. A damaged record header closes the page.
+static uint32_t scan_page(KvStore_t* store, uint32_t page) {
+    uint32_t base = page_address(store, page);
+    uint32_t offset = sizeof(KvPageHeader_t);
+
+    while (offset + sizeof(KvRecordHeader_t) <= BSP_STORAGE_PAGE_SIZE) {
+        KvRecordHeader_t header;
+        if (flash_read(base + offset, &header, sizeof(header)) != 0) break;
+
+        if (header.key == KV_STORE_KEY_INVALID && header.length == 0xFFFFu &&
+            header.length_check == 0xFFFFu && header.crc == 0xFFFFu) {
+            break;  // Erased: end of this page's log
+        }
+
+        uint32_t size = KV_RECORD_SIZE(header.length);
+        if ((uint16_t)(header.length ^ header.length_check) != 0xFFFFu ||
+            header.length > KV_STORE_MAX_VALUE_SIZE ||
+            offset + size > BSP_STORAGE_PAGE_SIZE) {
+            store->stats.corrupt_records++;
+            return BSP_STORAGE_PAGE_SIZE;
+        }
+
+        if (flash_read(base + offset + sizeof(header), &store->scratch[4], header.length) == 0 &&
+            header.key != KV_STORE_KEY_INVALID &&
+            record_crc(store, header.key, header.length) == header.crc) {
+            if (index_set(store, header.key, header.length, base + offset) != 0) {
+                printf("KvStore: WARNING - index full, key 0x%04x ignored\n", header.key);
+            }
+        } else {
+            store->stats.corrupt_records++;
+        }
+        offset += size;
+    }
+    return offset;
+}
+
+int kv_store_mount(KvStore_t* store, uint32_t region_start, uint32_t region_size) {
+    if (!store) return -1;
+    if ((region_start % BSP_STORAGE_PAGE_SIZE) != 0 || (region_size % BSP_STORAGE_PAGE_SIZE) != 0) {
+        return -1;
+    }
+    uint32_t page_count = region_size / BSP_STORAGE_PAGE_SIZE;
+    if (page_count < 2 || page_count > KV_STORE_MAX_PAGES) return -1;
+
+    memset(store, 0, sizeof(*store));
+    store->region_start = region_start;
+    store->page_count = page_count;
+    store->next_sequence = 1;
+
+    // Page headers: valid, blank, or damaged (erased now)
+    for (uint32_t page = 0; page < page_count; page++) {
+        KvPageHeader_t header;
+        uint32_t address = page_address(store, page);
+        if (flash_read(address, &header, sizeof(header)) != 0) return -1;
+
+        if (header.magic == KV_PAGE_MAGIC) {
+            store->page_in_use[page] = true;
+            store->page_sequence[page] = header.sequence;
+            if (header.sequence >= store->next_sequence) {
+                store->next_sequence = header.sequence + 1;
+            }
+        } else if (header.magic != 0xFFFFFFFFu || header.sequence != 0xFFFFFFFFu) {
+            printf("KvStore: Page %lu header damaged, erasing\n", (unsigned long)page);
+            if (bsp_storage_erase(address, BSP_STORAGE_PAGE_SIZE) != 0) return -1;
+        }
+    }
+
+    // Replay pages oldest first, so later records supersede earlier ones
+    bool any_in_use = false;
+    uint32_t last_sequence = 0;
+    while (true) {
+        uint32_t page = page_count;
+        for (uint32_t p = 0; p < page_count; p++) {
+            if (store->page_in_use[p] && store->page_sequence[p] > last_sequence &&
+                (page == page_count || store->page_sequence[p] < store->page_sequence[page])) {
+                page = p;
+            }
+        }
+        if (page == page_count) break;
+
+        last_sequence = store->page_sequence[page];
+        store->head_page = page;
+        store->head_offset = scan_page(store, page);
+        any_in_use = true;
+    }
+
+    store->mounted = true;
+    if (!any_in_use) {
+        // Blank region: start the ring at page 0
+        store->head_page = page_count - 1;
+        return open_next_page(store);
+    }
+
+    // No erased page left means a reclaim was cut short: finish it
+    uint32_t oldest = (store->head_page + 1) % page_count;
+    if (store->page_in_use[oldest]) {
+        return reclaim_page(store, oldest);
+    }
+    return 0;
+}
+
+// =============================================================================
+// STORE API
+// =============================================================================
+
+int kv_store_read(KvStore_t* store, uint16_t key, void* buffer, uint32_t buffer_size) {
+    if (!store || !store->mounted || (!buffer && buffer_size > 0)) return -1;
+
+    KvIndexEntry_t* entry = index_find(store, key);
+    if (!entry) return -1;
+
+    uint32_t length = (entry->length < buffer_size) ? entry->length : buffer_size;
+    if (length > 0 && flash_read(entry->address + sizeof(KvRecordHeader_t), buffer, length) != 0) {
+        return -1;
+    }
+    return entry->length;
+}
+
+int kv_store_write(KvStore_t* store, uint16_t key, const void* data, uint32_t length) {
+    if (!store || !store->mounted || key == KV_STORE_KEY_INVALID) return -1;
+    if (length > KV_STORE_MAX_VALUE_SIZE || (!data && length > 0)) return -1;
+
+    KvIndexEntry_t* entry = index_find(store, key);
+    if (!entry && store->index_count >= KV_STORE_MAX_KEYS) return -1;
+
+    // Rewriting the stored value costs no flash at all
+    if (entry && entry->length == length &&
+        flash_read(entry->address + sizeof(KvRecordHeader_t), &store->scratch[4], length) == 0 &&
+        (length == 0 || memcmp(&store->scratch[4], data, length) == 0)) {
+        store->stats.writes_unchanged++;
+        return 0;
+    }
+
+    // The old value stays live until the new one is written, so a reclaim may
+    // have to fit both into one page. Keep enough room to rewrite this record.
+    uint32_t size = KV_RECORD_SIZE(length);
+    uint32_t live_after = live_bytes(store) - (entry ? KV_RECORD_SIZE(entry->length) : 0) + size;
+    if (live_after + size > KV_PAGE_CAPACITY) {
+        printf("KvStore: ERROR - no room for key 0x%04x\n", key);
+        return -1;
+    }
+
+    // Make room first: reclaiming uses the scratch buffer
+    if (store->head_offset + size > BSP_STORAGE_PAGE_SIZE && open_next_page(store) != 0) {
+        return -1;
+    }
+    if (length > 0) memcpy(&store->scratch[4], data, length);
+    if (append_record(store, key, (uint16_t)length) != 0) {
+        // Programming failed mid-page: abandon the page and retry once
+        store->head_offset = BSP_STORAGE_PAGE_SIZE;
+        if (open_next_page(store) != 0) return -1;
+        if (length > 0) memcpy(&store->scratch[4], data, length);
+        if (append_record(store, key, (uint16_t)length) != 0) return -1;
+    }
+
+    store->stats.records_written++;
+    return 0;
+}
+
+int kv_store_compact(KvStore_t* store) {
+    if (!store || !store->mounted) return -1;
+
+    uint32_t max_record = KV_RECORD_SIZE(KV_STORE_MAX_VALUE_SIZE);
+    if (store->head_offset + max_record <= BSP_STORAGE_PAGE_SIZE) return 0;
+
+    // Only worth an erase if it leaves room for a maximum-size record
+    if (sizeof(KvPageHeader_t) + live_bytes(store) + max_record > BSP_STORAGE_PAGE_SIZE) {
+        return 0;
+    }
+    return (open_next_page(store) == 0) ? 1 : -1;
+}
+
+void kv_store_get_stats(const KvStore_t* store, KvStoreStats_t* stats) {
+    if (!store || !stats) return;
+
+    *stats = store->stats;
+    stats->live_bytes = live_bytes(store);
+    stats->free_bytes = (store->head_offset < BSP_STORAGE_PAGE_SIZE)
+                            ? BSP_STORAGE_PAGE_SIZE - store->head_offset : 0;
+}
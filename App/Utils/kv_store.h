@@ -0,0 +1,100 @@
+#ifndef KV_STORE_H
+#define KV_STORE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "../Config/app_config.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Log-structured record store over a page-aligned bsp_storage_* flash region
+// (takes the place of the X-CUBE-EEP virtual addresses in
+// Lock_System_Design.txt section 2.2). Records are only ever appended; a
+// newer record for a key supersedes the older ones. Pages are used as a
+// ring, and reclaiming the oldest page copies its live records to the head
+// before erasing it, so every page is erased in turn. One page is always
+// kept erased for that. Mounting rebuilds the RAM index in one scan.
+
+// =============================================================================
+// CONFIGURATION
+// =============================================================================
+
+#define KV_STORE_MAX_PAGES          8
+#define KV_STORE_MAX_KEYS           CONFIG_KV_STORE_MAX_KEYS
+#define KV_STORE_MAX_VALUE_SIZE     CONFIG_KV_STORE_MAX_VALUE_SIZE
+#define KV_STORE_KEY_INVALID        0xFFFFu     // Reads back from erased flash
+
+// =============================================================================
+// STORE AND STATISTICS
+// =============================================================================
+
+typedef struct {
+    uint16_t key;
+    uint16_t length;
+    uint32_t address;               // Record header of the live value
+} KvIndexEntry_t;
+
+typedef struct {
+    uint32_t records_written;
+    uint32_t writes_unchanged;      // Writes skipped, value already stored
+    uint32_t records_relocated;     // Live records copied out of reclaimed pages
+    uint32_t pages_reclaimed;
+    uint32_t corrupt_records;       // Bad CRC or torn header seen at mount
+    uint32_t live_bytes;            // Flash used by live records
+    uint32_t free_bytes;            // Room left in the head page
+} KvStoreStats_t;
+
+typedef struct {
+    uint32_t region_start;
+    uint32_t page_count;
+    bool page_in_use[KV_STORE_MAX_PAGES];
+    uint32_t page_sequence[KV_STORE_MAX_PAGES];
+    uint32_t head_page;
+    uint32_t head_offset;           // Next free byte in the head page
+    uint32_t next_sequence;
+    bool mounted;
+
+    KvIndexEntry_t index[KV_STORE_MAX_KEYS];
+    uint32_t index_count;
+
+    KvStoreStats_t stats;
+
+    // Key, length and value of the record being checked or relocated
+    uint8_t scratch[4 + KV_STORE_MAX_VALUE_SIZE];
+} KvStore_t;
+
+// =============================================================================
+// STORE API
+// =============================================================================
+
+// Scans the region (at least two pages, page aligned) and rebuilds the index,
+// erasing pages with a damaged header and finishing an interrupted reclaim.
+// A blank region is formatted. Returns 0 on success, -1 on bad arguments or a
+// flash error.
+int kv_store_mount(KvStore_t* store, uint32_t region_start, uint32_t region_size);
+
+// Returns the stored length (copying at most buffer_size bytes), or -1 when
+// the key has no record
+int kv_store_read(KvStore_t* store, uint16_t key, void* buffer, uint32_t buffer_size);
+
+// Appends a record, reclaiming the oldest page first if the head is full.
+// Writing the value already stored does not touch flash. Returns 0 on
+// success, -1 on bad arguments, a full store or a flash error.
+int kv_store_write(KvStore_t* store, uint16_t key, const void* data, uint32_t length);
+
+// Idle-time maintenance: when the head page could not take another
+// maximum-size record, reclaim now so the next write does not wait for a
+// page erase. Returns 1 if a page was reclaimed, 0 if nothing was due, -1
+// on a flash error.
+int kv_store_compact(KvStore_t* store);
+
+void kv_store_get_stats(const KvStore_t* store, KvStoreStats_t* stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // KV_STORE_H
@@ -0,0 +1,125 @@
+// CKOS Fixed-Block Memory Pool
+// Bitmap allocator for static arenas; see memory_pool.h
+
+#include "memory_pool.h"
+#include <stdio.h>
+#include <string.h>
+
+// =============================================================================
+// INITIALIZATION
+// =============================================================================
+
+int memory_pool_init(MemoryPool_t* pool, const char* name,
+                     uint8_t* arena, size_t arena_size, size_t block_size) {
+    if (!pool || !arena || block_size == 0) return -1;
+    if (((uintptr_t)arena % MEMORY_POOL_ALIGNMENT) != 0) {
+        printf("MemoryPool: ERROR - arena for '%s' is not %d-byte aligned\n",
+               name ? name : "?", MEMORY_POOL_ALIGNMENT);
+        return -1;
+    }
+    
+    size_t aligned_block = MEMORY_POOL_BLOCK_SIZE(block_size);
+    size_t num_blocks = arena_size / aligned_block;
+    if (num_blocks == 0) return -1;
+    if (num_blocks > MEMORY_POOL_MAX_BLOCKS) {
+        num_blocks = MEMORY_POOL_MAX_BLOCKS;
+    }
+    
+    memset(pool, 0, sizeof(*pool));
+    pool->name = name;
+    pool->arena_start = arena;
+    pool->block_size_bytes = aligned_block;
+    pool->num_blocks = (uint8_t)num_blocks;
+    pool->total_size_bytes = num_blocks * aligned_block;
+    pool->free_blocks_bitmap = (num_blocks == 32) ? 0xFFFFFFFFu
+                                                  : ((1u << num_blocks) - 1u);
+    return 0;
+}
+
+// =============================================================================
+// ALLOCATION
+// =============================================================================
+
+void* memory_pool_alloc(MemoryPool_t* pool) {
+    if (!pool) return NULL;
+    
+    // Claim the lowest free block; retry if another context raced us to it
+    uint32_t bitmap = __atomic_load_n(&pool->free_blocks_bitmap, __ATOMIC_RELAXED);
+    uint32_t index;
+    do {
+        if (bitmap == 0) {
+            __atomic_add_fetch(&pool->alloc_failures, 1, __ATOMIC_RELAXED);
+            return NULL;
+        }
+        index = (uint32_t)__builtin_ctz(bitmap);
+    } while (!__atomic_compare_exchange_n(&pool->free_blocks_bitmap, &bitmap,
+                                          bitmap & ~(1u << index), true,
+                                          __ATOMIC_ACQUIRE, __ATOMIC_RELAXED));
+    
+    uint8_t in_use = __atomic_add_fetch(&pool->allocated_count, 1, __ATOMIC_RELAXED);
+    uint8_t high_water = __atomic_load_n(&pool->high_water_blocks, __ATOMIC_RELAXED);
+    while (in_use > high_water &&
+           !__atomic_compare_exchange_n(&pool->high_water_blocks, &high_water, in_use,
+                                        true, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+        // high_water reloaded by the failed exchange
+    }
+    
+    return pool->arena_start + index * pool->block_size_bytes;
+}
+
+bool memory_pool_owns(const MemoryPool_t* pool, const void* block_ptr) {
+    if (!pool || !block_ptr) return false;
+    
+    const uint8_t* ptr = (const uint8_t*)block_ptr;
+    if (ptr < pool->arena_start || ptr >= pool->arena_start + pool->total_size_bytes) {
+        return false;
+    }
+    return ((size_t)(ptr - pool->arena_start) % pool->block_size_bytes) == 0;
+}
+
+int memory_pool_free(MemoryPool_t* pool, void* block_ptr) {
+    if (!pool || !block_ptr) return -1;
+    
+    if (!memory_pool_owns(pool, block_ptr)) {
+        __atomic_add_fetch(&pool->invalid_frees, 1, __ATOMIC_RELAXED);
+        printf("MemoryPool: ERROR - '%s' free of foreign pointer %p\n",
+               pool->name ? pool->name : "?", block_ptr);
+        return -1;
+    }
+    
+    uint32_t index = (uint32_t)(((uint8_t*)block_ptr - pool->arena_start) / pool->block_size_bytes);
+    uint32_t bit = 1u << index;
+    
+    uint32_t previous = __atomic_fetch_or(&pool->free_blocks_bitmap, bit, __ATOMIC_RELEASE);
+    if (previous & bit) {
+        // Already free: setting the bit again changed nothing
+        __atomic_add_fetch(&pool->invalid_frees, 1, __ATOMIC_RELAXED);
+        printf("MemoryPool: ERROR - '%s' double free of block %lu\n",
+               pool->name ? pool->name : "?", (unsigned long)index);
+        return -1;
+    }
+    
+    __atomic_sub_fetch(&pool->allocated_count, 1, __ATOMIC_RELAXED);
+    return 0;
+}
+
+// =============================================================================
+// STATISTICS
+// =============================================================================
+
+void memory_pool_get_stats(const MemoryPool_t* pool, MemoryPoolStats_t* stats) {
+    if (!pool || !stats) return;
+    
+    stats->total_blocks = pool->num_blocks;
+    stats->allocated_blocks = pool->allocated_count;
+    stats->free_blocks = pool->num_blocks - stats->allocated_blocks;
+    stats->high_water_blocks = pool->high_water_blocks;
+    stats->block_size_bytes = pool->block_size_bytes;
+    stats->alloc_failures = pool->alloc_failures;
+    stats->invalid_frees = pool->invalid_frees;
+}
+
+void memory_pool_reset_high_water(MemoryPool_t* pool) {
+    if (!pool) return;
+    __atomic_store_n(&pool->high_water_blocks, pool->allocated_count, __ATOMIC_RELAXED);
+}
@@ -0,0 +1,84 @@
+#ifndef MEMORY_POOL_H
+#define MEMORY_POOL_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Fixed-block allocator over a static arena (Memory_Layout_and_Management.txt
+// section 3). One bitmap word per pool: alloc finds a free block with a
+// count-trailing-zeros, free sets its bit back, both O(1) and lock-free, so a
+// block may be allocated in one task and freed in another.
+
+// =============================================================================
+// CONFIGURATION
+// =============================================================================
+
+#define MEMORY_POOL_MAX_BLOCKS   32     // One 32-bit free bitmap per pool
+#define MEMORY_POOL_ALIGNMENT    8      // Alignment of the arena and every block
+
+// Block size rounded up so every block in the arena stays aligned
+#define MEMORY_POOL_BLOCK_SIZE(size) \
+    ((((size) + MEMORY_POOL_ALIGNMENT - 1) / MEMORY_POOL_ALIGNMENT) * MEMORY_POOL_ALIGNMENT)
+
+// Declares a suitably aligned static arena for num_blocks blocks of block_size
+#define MEMORY_POOL_ARENA(name, block_size, num_blocks) \
+    static uint8_t name[MEMORY_POOL_BLOCK_SIZE(block_size) * (num_blocks)] \
+        __attribute__((aligned(MEMORY_POOL_ALIGNMENT)))
+
+// =============================================================================
+// POOL AND STATISTICS
+// =============================================================================
+
+typedef struct {
+    const char* name;
+    uint8_t* arena_start;           // Start of the static memory region
+    size_t total_size_bytes;        // Bytes of the arena in use (num_blocks * block size)
+    size_t block_size_bytes;        // Size of each block, rounded to MEMORY_POOL_ALIGNMENT
+    uint8_t num_blocks;             // Total number of blocks in the pool
+    volatile uint32_t free_blocks_bitmap;   // Bit set = block free
+    volatile uint8_t allocated_count;       // Blocks currently allocated
+    volatile uint8_t high_water_blocks;     // Most blocks ever allocated at once
+    volatile uint32_t alloc_failures;       // Allocations refused because the pool was full
+    volatile uint32_t invalid_frees;        // Double frees and foreign pointers
+} MemoryPool_t;
+
+typedef struct {
+    uint8_t total_blocks;
+    uint8_t allocated_blocks;
+    uint8_t free_blocks;
+    uint8_t high_water_blocks;
+    size_t block_size_bytes;
+    uint32_t alloc_failures;
+    uint32_t invalid_frees;
+} MemoryPoolStats_t;
+
+// =============================================================================
+// POOL API
+// =============================================================================
+
+// Returns 0 on success, -1 on bad arguments (misaligned arena or room for no
+// block). Only the first MEMORY_POOL_MAX_BLOCKS blocks of a larger arena are used.
+int memory_pool_init(MemoryPool_t* pool, const char* name,
+                     uint8_t* arena, size_t arena_size, size_t block_size);
+
+// Returns NULL when the pool is exhausted
+void* memory_pool_alloc(MemoryPool_t* pool);
+
+// Returns 0 on success, -1 for a pointer outside the pool, not on a block
+// boundary, or already free (double free); the pool is left untouched
+int memory_pool_free(MemoryPool_t* pool, void* block_ptr);
+
+bool memory_pool_owns(const MemoryPool_t* pool, const void* block_ptr);
+void memory_pool_get_stats(const MemoryPool_t* pool, MemoryPoolStats_t* stats);
+void memory_pool_reset_high_water(MemoryPool_t* pool);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // MEMORY_POOL_H
@@ -0,0 +1,210 @@
+// CKOS Power Governor
+// Insomnia accounting and idle-timeout power states; see power_governor.h
+
+#include "power_governor.h"
+#include <string.h>
+
+// =============================================================================
+// INSOMNIA REGISTRY
+// =============================================================================
+
+// Reason slots are claimed with a compare-and-swap on the name and never
+// released, so a slot found once stays valid without a lock
+static PowerReason_t* find_reason(PowerGovernor_t* governor, const char* reason, bool claim) {
+    for (uint32_t i = 0; i < POWER_GOVERNOR_MAX_REASONS; i++) {
+        PowerReason_t* slot = &governor->reasons[i];
+        const char* name = __atomic_load_n(&slot->name, __ATOMIC_ACQUIRE);
+        if (!name) {
+            if (!claim) return NULL;
+            if (__atomic_compare_exchange_n(&slot->name, &name, reason, false,
+                                            __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+                return slot;
+            }
+            // Lost the race: name now holds the winner's reason
+        }
+        if (name == reason || strcmp(name, reason) == 0) {
+            return slot;
+        }
+    }
+    return NULL;
+}
+
+// Decrements *value unless it is already zero; returns the value it had
+static uint32_t decrement_if_held(volatile uint32_t* value) {
+    uint32_t held = __atomic_load_n(value, __ATOMIC_RELAXED);
+    while (held > 0 &&
+           !__atomic_compare_exchange_n(value, &held, held - 1, false,
+                                        __ATOMIC_ACQ_REL, __ATOMIC_RELAXED)) {
+    }
+    return held;
+}
+
+void power_governor_hold(PowerGovernor_t* governor, const char* reason, uint64_t now_ms) {
+    if (!governor) return;
+
+    __atomic_add_fetch(&governor->insomnia, 1, __ATOMIC_ACQ_REL);
+    PowerReason_t* slot = find_reason(governor, reason ? reason : "unknown", true);
+    if (!slot) {
+        __atomic_add_fetch(&governor->unregistered, 1, __ATOMIC_RELAXED);
+        return;
+    }
+    if (__atomic_fetch_add(&slot->holds, 1, __ATOMIC_ACQ_REL) == 0) {
+        slot->held_since_ms = now_ms;
+    }
+    __atomic_add_fetch(&slot->count, 1, __ATOMIC_RELAXED);
+}
+
+void power_governor_release(PowerGovernor_t* governor, const char* reason, uint64_t now_ms) {
+    if (!governor) return;
+
+    PowerReason_t* slot = find_reason(governor, reason ? reason : "unknown", false);
+    uint32_t held = slot ? decrement_if_held(&slot->holds) : 0;
+    if (held == 1) {
+        slot->held_ms += now_ms - slot->held_since_ms;
+    } else if (held == 0 && decrement_if_held(&governor->unregistered) == 0) {
+        return;     // Never held: leave the count alone
+    }
+    decrement_if_held(&governor->insomnia);
+}
+
+uint32_t power_governor_insomnia(const PowerGovernor_t* governor) {
+    return governor ? __atomic_load_n(&governor->insomnia, __ATOMIC_ACQUIRE) : 0;
+}
+
+// =============================================================================
+// IDLE TIMEOUTS
+// =============================================================================
+
+// Full tick of the published activity stamp: the latest tick at or before
+// now_ms with that low word. Activity stamped after now_ms was read counts as
+// now. power_governor_update() runs after every wake source, long before the
+// low word could alias.
+static uint64_t stamp_to_ms(const PowerGovernor_t* governor, uint64_t now_ms) {
+    uint32_t stamp = __atomic_load_n(&governor->activity_stamp, __ATOMIC_ACQUIRE);
+    int32_t ago = (int32_t)((uint32_t)now_ms - stamp);
+    uint64_t at = (ago > 0) ? now_ms - (uint32_t)ago : now_ms;
+    return (at > governor->last_activity_ms) ? at : governor->last_activity_ms;
+}
+
+static uint64_t idle_ms(const PowerGovernor_t* governor, uint64_t now_ms) {
+    uint64_t activity = __atomic_load_n(&governor->activity_pending, __ATOMIC_ACQUIRE) ?
+                        stamp_to_ms(governor, now_ms) : governor->last_activity_ms;
+    return (now_ms > activity) ? now_ms - activity : 0;
+}
+
+static PowerGovernorState_t due_state(const PowerGovernor_t* governor, uint64_t now_ms) {
+    uint64_t idle = idle_ms(governor, now_ms);
+    if (idle < CONFIG_IDLE_TO_SLEEP_TIMEOUT_MS) {
+        return POWER_GOVERNOR_ACTIVE;
+    }
+    if (power_governor_insomnia(governor) > 0 ||
+        idle - CONFIG_IDLE_TO_SLEEP_TIMEOUT_MS < CONFIG_SLEEP_TO_DEEP_SLEEP_MS) {
+        return POWER_GOVERNOR_SLEEP;
+    }
+    return POWER_GOVERNOR_DEEP_SLEEP;
+}
+
+void power_governor_init(PowerGovernor_t* governor, uint64_t now_ms) {
+    if (!governor) return;
+    memset(governor, 0, sizeof(*governor));
+    governor->state = POWER_GOVERNOR_ACTIVE;
+    governor->activity_stamp = (uint32_t)now_ms;
+    governor->last_activity_ms = now_ms;
+    governor->state_since_ms = now_ms;
+    governor->entries[POWER_GOVERNOR_ACTIVE] = 1;
+}
+
+void power_governor_activity(PowerGovernor_t* governor, uint64_t now_ms) {
+    if (!governor) return;
+    __atomic_store_n(&governor->activity_stamp, (uint32_t)now_ms, __ATOMIC_RELEASE);
+    __atomic_store_n(&governor->activity_pending, 1, __ATOMIC_RELEASE);
+}
+
+PowerGovernorState_t power_governor_update(PowerGovernor_t* governor, uint64_t now_ms) {
+    if (!governor) return POWER_GOVERNOR_ACTIVE;
+
+    if (__atomic_exchange_n(&governor->activity_pending, 0, __ATOMIC_ACQ_REL)) {
+        governor->last_activity_ms = stamp_to_ms(governor, now_ms);
+    }
+
+    PowerGovernorState_t due = due_state(governor, now_ms);
+    if (due != governor->state) {
+        governor->residency_ms[governor->state] += now_ms - governor->state_since_ms;
+        governor->state = due;
+        governor->state_since_ms = now_ms;
+        governor->entries[due]++;
+    }
+    return governor->state;
+}
+
+uint32_t power_governor_next_deadline_ms(const PowerGovernor_t* governor, uint64_t now_ms) {
+    if (!governor) return POWER_GOVERNOR_NO_DEADLINE;
+    if (due_state(governor, now_ms) != governor->state) return 0;
+
+    // Below the step's timeout, or the state would be due to change
+    uint32_t idle = (uint32_t)idle_ms(governor, now_ms);
+    switch (governor->state) {
+        case POWER_GOVERNOR_ACTIVE:
+            return CONFIG_IDLE_TO_SLEEP_TIMEOUT_MS - idle;
+        case POWER_GOVERNOR_SLEEP:
+            // A hold blocks the next step until it is released
+            if (power_governor_insomnia(governor) > 0) return POWER_GOVERNOR_NO_DEADLINE;
+            return CONFIG_IDLE_TO_SLEEP_TIMEOUT_MS + CONFIG_SLEEP_TO_DEEP_SLEEP_MS - idle;
+        default:
+            return POWER_GOVERNOR_NO_DEADLINE;
+    }
+}
+
+// =============================================================================
+// REPORTING
+// =============================================================================
+
+uint64_t power_governor_residency_ms(const PowerGovernor_t* governor, PowerGovernorState_t state,
+                                     uint64_t now_ms) {
+    if (!governor || state >= POWER_GOVERNOR_STATE_COUNT) return 0;
+
+    uint64_t residency = governor->residency_ms[state];
+    if (state == governor->state) {
+        residency += now_ms - governor->state_since_ms;
+    }
+    return residency;
+}
+
+uint32_t power_governor_costliest(const PowerGovernor_t* governor, uint64_t now_ms,
+                                  PowerReasonCost_t* costs, uint32_t max) {
+    if (!governor || !costs) return 0;
+
+    // Insertion into a list kept sorted, longest held first
+    uint32_t found = 0;
+    for (uint32_t i = 0; i < POWER_GOVERNOR_MAX_REASONS; i++) {
+        const PowerReason_t* slot = &governor->reasons[i];
+        const char* name = __atomic_load_n(&slot->name, __ATOMIC_ACQUIRE);
+        if (!name) break;   // Slots are claimed in order
+
+        PowerReasonCost_t cost;
+        cost.name = name;
+        cost.held = __atomic_load_n(&slot->holds, __ATOMIC_ACQUIRE) > 0;
+        cost.held_ms = slot->held_ms + (cost.held ? now_ms - slot->held_since_ms : 0);
+        cost.count = slot->count;
+
+        uint32_t position = found;
+        while (position > 0 && costs[position - 1].held_ms < cost.held_ms) {
+            if (position < max) costs[position] = costs[position - 1];
+            position--;
+        }
+        if (position < max) {
+            costs[position] = cost;
+            if (found < max) found++;
+        }
+    }
+    return found;
+}
+
+const char* power_governor_state_name(PowerGovernorState_t state) {
+    switch (state) {
+        case POWER_GOVERNOR_ACTIVE:     return "Active";
+        case POWER_GOVERNOR_SLEEP:      return "Sleep";
+        case POWER_GOVERNOR_DEEP_SLEEP: return "Deep sleep";
+        default:                        return "Unknown";
+    }
+}
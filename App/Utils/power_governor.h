@@ -0,0 +1,111 @@
+#ifndef POWER_GOVERNOR_H
+#define POWER_GOVERNOR_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "../Config/app_config.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Idle-timeout power governor with reference-counted sleep suppression
+// ("insomnia"). Any task may take or drop a hold on behalf of a named reason;
+// the insomnia count and each reason's hold count are updated atomically and
+// each reason accumulates how long it was held and how often, so the reasons
+// that keep the device awake can be ranked. The governor itself steps
+// ACTIVE -> SLEEP after CONFIG_IDLE_TO_SLEEP_TIMEOUT_MS without activity and
+// SLEEP -> DEEP_SLEEP after a further CONFIG_SLEEP_TO_DEEP_SLEEP_MS, the
+// second step only while no hold is outstanding; any wake source returns it
+// to ACTIVE. Only one task (HardwareService) calls power_governor_update().
+// Times are bsp_get_tick_ms64() ticks, so nothing wraps however long the
+// device stays up.
+
+// =============================================================================
+// CONFIGURATION
+// =============================================================================
+
+#define POWER_GOVERNOR_MAX_REASONS      CONFIG_POWER_MAX_INSOMNIA_REASONS
+#define POWER_GOVERNOR_NO_DEADLINE      0xFFFFFFFFu
+
+// =============================================================================
+// STATES AND REASONS
+// =============================================================================
+
+typedef enum {
+    POWER_GOVERNOR_ACTIVE = 0,
+    POWER_GOVERNOR_SLEEP,
+    POWER_GOVERNOR_DEEP_SLEEP,
+    POWER_GOVERNOR_STATE_COUNT
+} PowerGovernorState_t;
+
+typedef struct {
+    const char* volatile name;      // NULL: free slot, claimed on first hold
+    volatile uint32_t holds;        // Outstanding holds
+    uint32_t count;                 // Holds taken since init
+    uint64_t held_since_ms;         // Tick of the 0 -> 1 transition
+    uint64_t held_ms;               // Time held, completed holds only
+} PowerReason_t;
+
+typedef struct {
+    volatile uint32_t insomnia;     // Outstanding holds over every reason
+    volatile uint32_t unregistered; // Outstanding holds with no free reason slot
+    PowerReason_t reasons[POWER_GOVERNOR_MAX_REASONS];
+
+    PowerGovernorState_t state;
+    // Wake sources run on any task and 64-bit atomics are not lock-free on
+    // the target, so activity is published as the low word of its tick and
+    // folded into last_activity_ms by power_governor_update()
+    volatile uint32_t activity_stamp;
+    volatile uint32_t activity_pending;
+    uint64_t last_activity_ms;
+    uint64_t state_since_ms;
+    uint32_t entries[POWER_GOVERNOR_STATE_COUNT];
+    uint64_t residency_ms[POWER_GOVERNOR_STATE_COUNT];  // Completed stays only
+} PowerGovernor_t;
+
+// One line of the cost report
+typedef struct {
+    const char* name;
+    uint64_t held_ms;               // Including a hold still outstanding
+    uint32_t count;
+    bool held;                      // Held right now
+} PowerReasonCost_t;
+
+// =============================================================================
+// POWER GOVERNOR API
+// =============================================================================
+
+void power_governor_init(PowerGovernor_t* governor, uint64_t now_ms);
+
+// Holds nest per reason. A reason is a string, matched by content; the first
+// hold of a new reason claims a registry slot for good.
+void power_governor_hold(PowerGovernor_t* governor, const char* reason, uint64_t now_ms);
+void power_governor_release(PowerGovernor_t* governor, const char* reason, uint64_t now_ms);
+uint32_t power_governor_insomnia(const PowerGovernor_t* governor);
+
+// Wake source (input, hardware event): restarts the idle timer
+void power_governor_activity(PowerGovernor_t* governor, uint64_t now_ms);
+
+// The state due at now_ms, entered if it differs from the current one
+PowerGovernorState_t power_governor_update(PowerGovernor_t* governor, uint64_t now_ms);
+
+// Milliseconds until power_governor_update() would change state with no
+// further activity or holds, or POWER_GOVERNOR_NO_DEADLINE
+uint32_t power_governor_next_deadline_ms(const PowerGovernor_t* governor, uint64_t now_ms);
+
+// Time spent in state, including the current stay
+uint64_t power_governor_residency_ms(const PowerGovernor_t* governor, PowerGovernorState_t state,
+                                     uint64_t now_ms);
+
+// Fills up to max reasons, costliest (longest held) first; returns how many
+uint32_t power_governor_costliest(const PowerGovernor_t* governor, uint64_t now_ms,
+                                  PowerReasonCost_t* costs, uint32_t max);
+
+const char* power_governor_state_name(PowerGovernorState_t state);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // POWER_GOVERNOR_H
@@ -0,0 +1,141 @@
+// CKOS Sensor Pipeline
+// Fixed-point filtering and threshold wake-ups for DMA sample blocks; see
+// sensor_pipeline.h
+
+#include "sensor_pipeline.h"
+#include <string.h>
+
+// =============================================================================
+// BATTERY CURVE
+// =============================================================================
+
+// Cell voltage at 0%, 10%, ... 100% under light load. Every segment spans a
+// multiple of 10 mV, so each whole percent has an exact voltage.
+static const int16_t battery_curve_mv[11] = {
+    3300, 3600, 3700, 3750, 3790, 3830, 3870, 3920, 3980, 4060, 4200
+};
+
+uint8_t sensor_pipeline_battery_percentage(int32_t battery_mv) {
+    if (battery_mv <= battery_curve_mv[0]) return 0;
+    if (battery_mv >= battery_curve_mv[10]) return 100;
+
+    uint32_t segment = 0;
+    while (battery_mv >= battery_curve_mv[segment + 1]) {
+        segment++;
+    }
+    int32_t span = battery_curve_mv[segment + 1] - battery_curve_mv[segment];
+    int32_t tenths = ((battery_mv - battery_curve_mv[segment]) * 10 + span / 2) / span;
+    return (uint8_t)(segment * 10 + (uint32_t)tenths);
+}
+
+int32_t sensor_pipeline_battery_mv(uint8_t percentage) {
+    if (percentage >= 100) return battery_curve_mv[10];
+
+    uint32_t segment = percentage / 10u;
+    int32_t span = battery_curve_mv[segment + 1] - battery_curve_mv[segment];
+    return battery_curve_mv[segment] + (int32_t)(percentage % 10u) * span / 10;
+}
+
+// =============================================================================
+// FILTER AND ALARMS
+// =============================================================================
+
+// y += (x - y) / 2^CONFIG_SENSOR_FILTER_SHIFT, in SENSOR_PIPELINE_FRACTION_BITS
+// fixed point; no multiply, no float, safe in an interrupt
+static void filter_step(int32_t* state, int32_t input) {
+    int32_t target = input * (1 << SENSOR_PIPELINE_FRACTION_BITS);
+    *state += (target - *state) / (1 << CONFIG_SENSOR_FILTER_SHIFT);
+}
+
+static int32_t filter_value(int32_t state) {
+    int32_t half = 1 << (SENSOR_PIPELINE_FRACTION_BITS - 1);
+    return (state >= 0) ? (state + half) >> SENSOR_PIPELINE_FRACTION_BITS
+                        : -((half - state) >> SENSOR_PIPELINE_FRACTION_BITS);
+}
+
+// Raised at the threshold; cleared only once the value is back past it by
+// the hysteresis
+static bool alarm_below(bool raised, int32_t value, int32_t threshold, int32_t hysteresis) {
+    return value <= (raised ? threshold + hysteresis : threshold);
+}
+
+static bool alarm_above(bool raised, int32_t value, int32_t threshold, int32_t hysteresis) {
+    return value >= (raised ? threshold - hysteresis : threshold);
+}
+
+uint8_t sensor_pipeline_alarms(uint8_t raised, uint8_t battery_percentage,
+                               int32_t temperature_cdeg) {
+    uint8_t alarms = 0;
+    if (alarm_below(raised & SENSOR_ALARM_BATTERY_LOW, battery_percentage,
+                    CONFIG_BATTERY_LOW_THRESHOLD, CONFIG_BATTERY_HYSTERESIS_PERCENT)) {
+        alarms |= SENSOR_ALARM_BATTERY_LOW;
+    }
+    if (alarm_below(raised & SENSOR_ALARM_BATTERY_CRITICAL, battery_percentage,
+                    CONFIG_BATTERY_CRITICAL_THRESHOLD, CONFIG_BATTERY_HYSTERESIS_PERCENT)) {
+        alarms |= SENSOR_ALARM_BATTERY_CRITICAL;
+    }
+    if (alarm_above(raised & SENSOR_ALARM_OVER_TEMPERATURE, temperature_cdeg,
+                    CONFIG_TEMPERATURE_OVER_THRESHOLD_C * 100,
+                    CONFIG_TEMPERATURE_HYSTERESIS_C * 100)) {
+        alarms |= SENSOR_ALARM_OVER_TEMPERATURE;
+    }
+    return alarms;
+}
+
+// =============================================================================
+// SENSOR PIPELINE API
+// =============================================================================
+
+void sensor_pipeline_init(SensorPipeline_t* pipeline, uint32_t snapshot_period_ms) {
+    if (!pipeline) return;
+    memset(pipeline, 0, sizeof(*pipeline));
+    pipeline->snapshot_period_ms = snapshot_period_ms;
+}
+
+uint32_t sensor_pipeline_process(SensorPipeline_t* pipeline, const SensorBlock_t* block,
+                                 uint32_t now_ms) {
+    if (!pipeline || !block) return 0;
+
+    uint32_t result = 0;
+    if (!pipeline->primed) {
+        // Start from the first block rather than crawling up from zero
+        pipeline->battery_state = block->battery_mv * (1 << SENSOR_PIPELINE_FRACTION_BITS);
+        pipeline->temperature_state = block->temperature_cdeg * (1 << SENSOR_PIPELINE_FRACTION_BITS);
+        pipeline->primed = true;
+        result |= SENSOR_PIPELINE_SNAPSHOT_DUE;
+    } else {
+        filter_step(&pipeline->battery_state, block->battery_mv);
+        filter_step(&pipeline->temperature_state, block->temperature_cdeg);
+    }
+
+    SensorPipelineOutput_t* output = &pipeline->output;
+    int32_t battery_mv = filter_value(pipeline->battery_state);
+    int32_t temperature = filter_value(pipeline->temperature_state);
+    output->battery_mv = (uint16_t)((battery_mv < 0) ? 0 : (battery_mv > 0xFFFF) ? 0xFFFF : battery_mv);
+    output->battery_percentage = sensor_pipeline_battery_percentage(battery_mv);
+    output->temperature_cdeg = (int16_t)((temperature < INT16_MIN) ? INT16_MIN :
+                                         (temperature > INT16_MAX) ? INT16_MAX : temperature);
+    output->timestamp_ms = now_ms;
+
+    uint8_t alarms = sensor_pipeline_alarms(output->alarms, output->battery_percentage,
+                                            output->temperature_cdeg);
+    for (uint8_t raised = alarms & (uint8_t)~output->alarms; raised; raised &= raised - 1) {
+        pipeline->stats.alarms_raised++;
+    }
+    result |= (uint32_t)(alarms ^ output->alarms);
+    output->alarms = alarms;
+
+    if ((uint32_t)(now_ms - pipeline->last_wake_ms) >= pipeline->snapshot_period_ms) {
+        result |= SENSOR_PIPELINE_SNAPSHOT_DUE;
+    }
+
+    pipeline->stats.blocks++;
+    if (result) {
+        pipeline->stats.wakeups++;
+        if (result & ~SENSOR_PIPELINE_SNAPSHOT_DUE) {
+            pipeline->stats.threshold_wakeups++;
+        }
+        pipeline->last_wake_ms = now_ms;
+    }
+    return result;
+}
@@ -0,0 +1,98 @@
+#ifndef SENSOR_PIPELINE_H
+#define SENSOR_PIPELINE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "../Config/app_config.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Filtering and wake-up decisions for the background ADC sampling behind
+// bsp_sensors_start(). The BSP averages each block of DMA scans (one ADC
+// burst) into one SensorBlock_t in engineering units and hands it
+// to sensor_pipeline_process(), from the DMA interrupt on target. Every
+// channel goes through a first-order IIR filter in integer fixed point, the
+// filtered values are checked against the battery and temperature
+// thresholds (with hysteresis, so noise at a threshold cannot chatter), and
+// the result says whether the sensor task needs waking: only when a
+// threshold is crossed or a snapshot is due, never for an ordinary block.
+
+// =============================================================================
+// CONFIGURATION
+// =============================================================================
+
+#define SENSOR_PIPELINE_FRACTION_BITS   8       // Filter state is value << 8
+
+// =============================================================================
+// SAMPLES AND EVENTS
+// =============================================================================
+
+// One block, averaged over its scans
+typedef struct {
+    int32_t battery_mv;             // At the cell, after the divider
+    int32_t temperature_cdeg;       // Hundredths of a degree Celsius
+} SensorBlock_t;
+
+// Filtered values, as bsp_sensors_read() reports them
+typedef struct {
+    uint16_t battery_mv;
+    uint8_t battery_percentage;
+    int16_t temperature_cdeg;
+    uint8_t alarms;                 // SENSOR_ALARM_* currently raised
+    uint32_t timestamp_ms;          // Block the values were updated from
+} SensorPipelineOutput_t;
+
+// Alarms, raised and cleared with hysteresis
+#define SENSOR_ALARM_BATTERY_LOW        (1u << 0)   // At or below CONFIG_BATTERY_LOW_THRESHOLD
+#define SENSOR_ALARM_BATTERY_CRITICAL   (1u << 1)   // At or below CONFIG_BATTERY_CRITICAL_THRESHOLD
+#define SENSOR_ALARM_OVER_TEMPERATURE   (1u << 2)   // At or above CONFIG_TEMPERATURE_OVER_THRESHOLD_C
+
+// sensor_pipeline_process() results: the alarms that changed, plus
+#define SENSOR_PIPELINE_SNAPSHOT_DUE    (1u << 7)   // snapshot_period_ms since the last wake
+
+typedef struct {
+    uint32_t blocks;                // Blocks filtered
+    uint32_t wakeups;               // Blocks that woke the sensor task
+    uint32_t threshold_wakeups;     // ... because an alarm changed
+    uint32_t alarms_raised;
+} SensorPipelineStats_t;
+
+typedef struct {
+    int32_t battery_state;          // Filter states, SENSOR_PIPELINE_FRACTION_BITS
+    int32_t temperature_state;
+    bool primed;                    // The first block seeds the filters
+    uint32_t snapshot_period_ms;
+    uint32_t last_wake_ms;
+    SensorPipelineOutput_t output;
+    SensorPipelineStats_t stats;
+} SensorPipeline_t;
+
+// =============================================================================
+// SENSOR PIPELINE API
+// =============================================================================
+
+void sensor_pipeline_init(SensorPipeline_t* pipeline, uint32_t snapshot_period_ms);
+
+// Filters one block taken at now_ms. Returns 0 if nothing needs the sensor
+// task, else the SENSOR_ALARM_* bits that changed and/or
+// SENSOR_PIPELINE_SNAPSHOT_DUE. The first block always wakes.
+uint32_t sensor_pipeline_process(SensorPipeline_t* pipeline, const SensorBlock_t* block,
+                                 uint32_t now_ms);
+
+// The alarms raised for these values, given the ones already raised; the
+// same rule for the pipeline and for event detection in the hardware layer
+uint8_t sensor_pipeline_alarms(uint8_t raised, uint8_t battery_percentage,
+                               int32_t temperature_cdeg);
+
+// Battery state of charge from the cell voltage, and back; a piecewise
+// linear Li-ion discharge curve, exact in both directions at whole percents
+uint8_t sensor_pipeline_battery_percentage(int32_t battery_mv);
+int32_t sensor_pipeline_battery_mv(uint8_t percentage);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SENSOR_PIPELINE_H
@@ -0,0 +1,36 @@
+#ifndef SIM_INSTANCE_H
+#define SIM_INSTANCE_H
+
+// Per-device module state for the multi-instance simulator
+//
+// Each module keeps its mutable state in one struct declared with
+// SIM_INSTANCE_STATE. On target this is a plain static. In the simulator the
+// module reaches it through a thread-local pointer, which the module's
+// *_instance_bind() function points at one device's copy. Binding a device
+// on a worker thread therefore switches every module over to that device, so
+// one host process can run many independent devices on a thread pool.
+//
+// Usage in a module:
+//     SIM_INSTANCE_STATE(my_state_t, g_my_state);
+//     #define g_my_state SIM_INSTANCE(g_my_state)
+
+#ifdef SIMULATOR
+
+#define SIM_INSTANCE_STATE(type, name) \
+    static type name##_default; \
+    static __thread type* name##_instance = &name##_default
+
+#define SIM_INSTANCE(name) (*name##_instance)
+
+// Point the calling thread at state, or back at the process default (NULL)
+#define SIM_INSTANCE_BIND(name, state) \
+    (name##_instance = (state) ? (void*)(state) : (void*)&name##_default)
+
+#else
+
+#define SIM_INSTANCE_STATE(type, name) static type name##_default
+#define SIM_INSTANCE(name) name##_default
+
+#endif
+
+#endif // SIM_INSTANCE_H
@@ -2,12 +2,17 @@
 // Common utility functions for the CKOS application
 
 #include "utils.h"
+#include "../BSP/bsp_api.h"
 #include <string.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdint.h>
 #include <stdbool.h>
 
+#ifdef SIMULATOR
+#include "utils_crc_tables.h"
+#endif
+
 // =============================================================================
 // STRING UTILITIES
 // =============================================================================
@@ -104,27 +109,71 @@ uint32_t utils_time_string_to_seconds(const char* time_str) {
 // CRC UTILITIES
 // =============================================================================
 
-// Simple CRC16 calculation for data integrity
-static const uint16_t crc16_table[256] = {
-    0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50a5, 0x60c6, 0x70e7,
-    0x8108, 0x9129, 0xa14a, 0xb16b, 0xc18c, 0xd1ad, 0xe1ce, 0xf1ef,
-    // ... (full table would be here in production)
-    // Abbreviated for space
-};
+#ifdef SIMULATOR
 
-uint16_t utils_crc16(const uint8_t* data, size_t length) {
-    if (!data) return 0;
-    
-    uint16_t crc = 0xFFFF;
+// Slice-by-8: eight bytes per step through eight tables (see utils_crc_tables.h)
+
+uint16_t utils_crc16_update(uint16_t crc, const uint8_t* data, size_t length) {
+    if (!data) return crc;
     
-    for (size_t i = 0; i < length; i++) {
-        uint8_t tbl_idx = ((crc >> 8) ^ data[i]) & 0xFF;
-        crc = ((crc << 8) ^ crc16_table[tbl_idx]) & 0xFFFF;
+    while (length >= 8) {
+        crc = crc16_slice_table[7][data[0] ^ (crc >> 8)] ^
+              crc16_slice_table[6][data[1] ^ (crc & 0xFF)] ^
+              crc16_slice_table[5][data[2]] ^ crc16_slice_table[4][data[3]] ^
+              crc16_slice_table[3][data[4]] ^ crc16_slice_table[2][data[5]] ^
+              crc16_slice_table[1][data[6]] ^ crc16_slice_table[0][data[7]];
+        data += 8;
+        length -= 8;
+    }
+    while (length-- > 0) {
+        crc = (uint16_t)((crc << 8) ^ crc16_slice_table[0][((crc >> 8) ^ *data++) & 0xFF]);
     }
+    return crc;
+}
+
+uint32_t utils_crc32_update(uint32_t crc, const uint8_t* data, size_t length) {
+    if (!data) return crc;
     
+    while (length >= 8) {
+        crc ^= ((uint32_t)data[0] << 24) | ((uint32_t)data[1] << 16) |
+               ((uint32_t)data[2] << 8) | data[3];
+        crc = crc32_slice_table[7][crc >> 24] ^ crc32_slice_table[6][(crc >> 16) & 0xFF] ^
+              crc32_slice_table[5][(crc >> 8) & 0xFF] ^ crc32_slice_table[4][crc & 0xFF] ^
+              crc32_slice_table[3][data[4]] ^ crc32_slice_table[2][data[5]] ^
+              crc32_slice_table[1][data[6]] ^ crc32_slice_table[0][data[7]];
+        data += 8;
+        length -= 8;
+    }
+    while (length-- > 0) {
+        crc = (crc << 8) ^ crc32_slice_table[0][((crc >> 24) ^ *data++) & 0xFF];
+    }
     return crc;
 }
 
+#else
+
+// The CRC unit, configured per call for either polynomial
+
+uint16_t utils_crc16_update(uint16_t crc, const uint8_t* data, size_t length) {
+    if (!data) return crc;
+    return (uint16_t)bsp_crc_update(BSP_CRC_16_CCITT, crc, data, length);
+}
+
+uint32_t utils_crc32_update(uint32_t crc, const uint8_t* data, size_t length) {
+    if (!data) return crc;
+    return bsp_crc_update(BSP_CRC_32, crc, data, length);
+}
+
+#endif
+
+uint16_t utils_crc16(const uint8_t* data, size_t length) {
+    return utils_crc16_update(UTILS_CRC16_INIT, data, length);
+}
+
+uint32_t utils_crc32(const uint8_t* data, size_t length) {
+    return utils_crc32_update(UTILS_CRC32_INIT, data, length);
+}
+
 // =============================================================================
 // MEMORY UTILITIES
 // =============================================================================
@@ -36,7 +36,19 @@ uint32_t utils_time_string_to_seconds(const char* time_str);
 // CRC UTILITIES
 // =============================================================================
 
+// CRC-16/CCITT-FALSE (polynomial 0x1021) and CRC-32/MPEG-2 (polynomial
+// 0x04C11DB7): MSB first, all-ones initial value, no final XOR. These are
+// the two the STM32 CRC unit computes directly, so on target they run on the
+// unit (DMA-fed for long buffers); on the host they are slice-by-8 table
+// lookups with the same results. The _update forms continue a running CRC,
+// starting from the INIT value.
+#define UTILS_CRC16_INIT    0xFFFFu
+#define UTILS_CRC32_INIT    0xFFFFFFFFu
+
 uint16_t utils_crc16(const uint8_t* data, size_t length);
+uint16_t utils_crc16_update(uint16_t crc, const uint8_t* data, size_t length);
+uint32_t utils_crc32(const uint8_t* data, size_t length);
+uint32_t utils_crc32_update(uint32_t crc, const uint8_t* data, size_t length);
 
 // =============================================================================
 // MEMORY UTILITIES
@@ -0,0 +1,230 @@
+// CKOS Memory Wire Actuator
+// Non-blocking unlock sequence with a model-based duty controller; see
+// wire_actuator.h
+
+#include "wire_actuator.h"
+#include <string.h>
+
+#define WIRE_HEAT_RATE_CDEG_S   ((int64_t)CONFIG_MEMORY_WIRE_HEAT_RATE * 100)
+#define WIRE_TAU_MS             ((int64_t)CONFIG_MEMORY_WIRE_TAU_MS)
+
+static bool deadline_reached(uint64_t deadline_ms, uint64_t now_ms) {
+    return now_ms >= deadline_ms;
+}
+
+// =============================================================================
+// WIRE MODEL AND DUTY
+// =============================================================================
+
+// Brings the model up to now_ms at the duty applied since the last step,
+// charging the on-time. Backward Euler, so it stays stable however long the
+// task slept: T' = (T*tau + Ta*dt + heat*tau) / (tau + dt), where heat is
+// the rise the duty gives over dt with no loss.
+static void advance_model(WireActuator_t* actuator, int32_t ambient_cdeg, uint64_t now_ms) {
+    int64_t dt = (int64_t)(now_ms - actuator->last_step_ms);
+    actuator->last_step_ms = now_ms;
+    if (dt == 0) return;
+
+    uint64_t on_us = (uint64_t)actuator->duty * dt;     // Per mille x ms
+    actuator->stats.on_us += on_us;
+    actuator->stats.last_on_us += on_us;
+
+    int64_t heat = WIRE_HEAT_RATE_CDEG_S * actuator->duty * dt / 1000000;
+    actuator->estimate_cdeg = (int32_t)(((int64_t)actuator->estimate_cdeg * WIRE_TAU_MS +
+                                         (int64_t)ambient_cdeg * dt + heat * WIRE_TAU_MS) /
+                                        (WIRE_TAU_MS + dt));
+}
+
+// The duty that balances the loss to ambient at the setpoint, plus a
+// proportional term on the modelled error: full power until the wire is
+// near the setpoint
+static uint16_t control_duty(const WireActuator_t* actuator, int32_t ambient_cdeg) {
+    int64_t hold = (int64_t)(actuator->setpoint_cdeg - ambient_cdeg) * 1000000 /
+                   (WIRE_HEAT_RATE_CDEG_S * WIRE_TAU_MS);
+    int64_t error = actuator->setpoint_cdeg - actuator->estimate_cdeg;
+    int64_t duty = hold + error * CONFIG_MEMORY_WIRE_GAIN / 100;
+
+    if (duty < 0) return 0;
+    if (duty > WIRE_ACTUATOR_DUTY_MAX) return WIRE_ACTUATOR_DUTY_MAX;
+    return (uint16_t)duty;
+}
+
+// =============================================================================
+// SEQUENCE
+// =============================================================================
+
+static void enter(WireActuator_t* actuator, WireActuatorState_t state, uint64_t now_ms,
+                  uint32_t duration_ms) {
+    actuator->state = state;
+    actuator->deadline_ms = now_ms + duration_ms;
+    actuator->duty = 0;
+}
+
+static void start_attempt(WireActuator_t* actuator, uint8_t attempt,
+                          const WireActuatorInputs_t* inputs, uint64_t now_ms) {
+    int32_t setpoint = actuator->base_setpoint_cdeg +
+                       (attempt - 1) * CONFIG_MEMORY_WIRE_RETRY_STEP_TEMP * 100;
+    if (setpoint > CONFIG_MEMORY_WIRE_MAX_TEMP * 100) {
+        setpoint = CONFIG_MEMORY_WIRE_MAX_TEMP * 100;
+    }
+
+    actuator->attempt = attempt;
+    actuator->setpoint_cdeg = setpoint;
+    actuator->stats.attempts++;
+    enter(actuator, WIRE_ACTUATOR_HEATING, now_ms, actuator->heat_window_ms);
+    actuator->duty = control_duty(actuator, inputs->ambient_cdeg);
+}
+
+static WireActuatorResult_t finish(WireActuator_t* actuator, WireActuatorResult_t result,
+                                   uint64_t now_ms) {
+    enter(actuator, WIRE_ACTUATOR_COOLDOWN, now_ms, CONFIG_MEMORY_WIRE_COOLDOWN_MS);
+
+    WireActuatorStats_t* stats = &actuator->stats;
+    switch (result) {
+        case WIRE_RESULT_UNLOCKED:      stats->unlocks++; break;
+        case WIRE_RESULT_BLOCKED:       stats->blocked++; break;
+        case WIRE_RESULT_LATCH_FAILED:  stats->latch_failures++; break;
+        default:                        stats->aborts++; break;
+    }
+    stats->last_latency_ms = (uint32_t)(now_ms - actuator->requested_ms);
+    stats->last_attempts = actuator->attempt;
+    return result;
+}
+
+// =============================================================================
+// WIRE ACTUATOR API
+// =============================================================================
+
+void wire_actuator_init(WireActuator_t* actuator) {
+    if (!actuator) return;
+    memset(actuator, 0, sizeof(*actuator));
+    actuator->state = WIRE_ACTUATOR_IDLE;
+}
+
+int wire_actuator_request(WireActuator_t* actuator, int32_t setpoint_c, uint32_t heat_window_ms,
+                          const WireActuatorInputs_t* inputs, uint64_t now_ms) {
+    if (!actuator || !inputs || actuator->state != WIRE_ACTUATOR_IDLE) return -1;
+
+    // The model cooled toward ambient while nothing stepped it
+    advance_model(actuator, inputs->ambient_cdeg, now_ms);
+
+    actuator->requested_ms = now_ms;
+    actuator->base_setpoint_cdeg = (setpoint_c ? setpoint_c : CONFIG_MEMORY_WIRE_TARGET_TEMP) * 100;
+    actuator->heat_window_ms = heat_window_ms ? heat_window_ms : CONFIG_MEMORY_WIRE_HEAT_DURATION;
+    actuator->stats.sequences++;
+    actuator->stats.last_on_us = 0;
+    start_attempt(actuator, 1, inputs, now_ms);
+    return 0;
+}
+
+WireActuatorResult_t wire_actuator_step(WireActuator_t* actuator,
+                                        const WireActuatorInputs_t* inputs, uint64_t now_ms) {
+    if (!actuator || !inputs) return WIRE_RESULT_NONE;
+
+    advance_model(actuator, inputs->ambient_cdeg, now_ms);
+    bool due = deadline_reached(actuator->deadline_ms, now_ms);
+
+    switch (actuator->state) {
+        case WIRE_ACTUATOR_IDLE:
+            return WIRE_RESULT_NONE;
+        case WIRE_ACTUATOR_COOLDOWN:
+            if (due) actuator->state = WIRE_ACTUATOR_IDLE;
+            return WIRE_RESULT_NONE;
+        default:
+            break;
+    }
+
+    if (inputs->ambient_cdeg >= CONFIG_TEMPERATURE_OVER_THRESHOLD_C * 100) {
+        return finish(actuator, WIRE_RESULT_ABORTED, now_ms);
+    }
+
+    switch (actuator->state) {
+        case WIRE_ACTUATOR_HEATING:
+            if (!inputs->latch_engaged) {
+                enter(actuator, WIRE_ACTUATOR_MONITORING_EJECTOR, now_ms, CONFIG_MEMORY_WIRE_EJECTOR_MS);
+            } else if (due) {
+                enter(actuator, WIRE_ACTUATOR_MONITORING_LATCH, now_ms, CONFIG_MEMORY_WIRE_LATCH_SETTLE_MS);
+            } else {
+                actuator->duty = control_duty(actuator, inputs->ambient_cdeg);
+            }
+            break;
+
+        case WIRE_ACTUATOR_MONITORING_LATCH:
+            if (!inputs->latch_engaged) {
+                enter(actuator, WIRE_ACTUATOR_MONITORING_EJECTOR, now_ms, CONFIG_MEMORY_WIRE_EJECTOR_MS);
+            } else if (due) {
+                if (actuator->attempt >= CONFIG_MEMORY_WIRE_MAX_ATTEMPTS) {
+                    return finish(actuator, WIRE_RESULT_LATCH_FAILED, now_ms);
+                }
+                enter(actuator, WIRE_ACTUATOR_RETRY_WAIT, now_ms, CONFIG_MEMORY_WIRE_RETRY_DELAY_MS);
+            }
+            break;
+
+        case WIRE_ACTUATOR_RETRY_WAIT:
+            if (due) {
+                start_attempt(actuator, actuator->attempt + 1, inputs, now_ms);
+            }
+            break;
+
+        case WIRE_ACTUATOR_MONITORING_EJECTOR:
+            if (!inputs->door_closed) {
+                return finish(actuator, WIRE_RESULT_UNLOCKED, now_ms);
+            }
+            if (due) {
+                return finish(actuator, WIRE_RESULT_BLOCKED, now_ms);
+            }
+            break;
+
+        default:
+            break;
+    }
+    return WIRE_RESULT_NONE;
+}
+
+uint16_t wire_actuator_duty(const WireActuator_t* actuator) {
+    return actuator ? actuator->duty : 0;
+}
+
+bool wire_actuator_is_heating(const WireActuator_t* actuator) {
+    return actuator && actuator->state == WIRE_ACTUATOR_HEATING;
+}
+
+uint32_t wire_actuator_next_ms(const WireActuator_t* actuator, uint64_t now_ms) {
+    if (!actuator || actuator->state == WIRE_ACTUATOR_IDLE) return WIRE_ACTUATOR_NO_DEADLINE;
+
+    // States last at most a configured duration, so the remainder fits
+    uint32_t remaining = deadline_reached(actuator->deadline_ms, now_ms) ?
+                         0 : (uint32_t)(actuator->deadline_ms - now_ms);
+    switch (actuator->state) {
+        case WIRE_ACTUATOR_HEATING:
+        case WIRE_ACTUATOR_MONITORING_LATCH:
+        case WIRE_ACTUATOR_MONITORING_EJECTOR:
+            // Duty updates, and the latch and door are polled
+            return (remaining < CONFIG_MEMORY_WIRE_CONTROL_MS) ? remaining : CONFIG_MEMORY_WIRE_CONTROL_MS;
+        default:
+            return remaining;
+    }
+}
+
+const char* wire_actuator_state_name(WireActuatorState_t state) {
+    switch (state) {
+        case WIRE_ACTUATOR_IDLE:                return "Idle";
+        case WIRE_ACTUATOR_HEATING:             return "Heating";
+        case WIRE_ACTUATOR_MONITORING_LATCH:    return "Monitoring latch";
+        case WIRE_ACTUATOR_MONITORING_EJECTOR:  return "Monitoring ejector";
+        case WIRE_ACTUATOR_RETRY_WAIT:          return "Retry wait";
+        case WIRE_ACTUATOR_COOLDOWN:            return "Cooldown";
+        default:                                return "Unknown";
+    }
+}
+
+const char* wire_actuator_result_name(WireActuatorResult_t result) {
+    switch (result) {
+        case WIRE_RESULT_NONE:          return "None";
+        case WIRE_RESULT_UNLOCKED:      return "Unlocked";
+        case WIRE_RESULT_BLOCKED:       return "Door blocked";
+        case WIRE_RESULT_LATCH_FAILED:  return "Latch failed";
+        case WIRE_RESULT_ABORTED:       return "Aborted";
+        default:                        return "Unknown";
+    }
+}
@@ -0,0 +1,118 @@
+#ifndef WIRE_ACTUATOR_H
+#define WIRE_ACTUATOR_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "../Config/app_config.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Memory wire unlock sequence (Hardware_Service_Layer_Design.txt 2.2-2.3) as
+// a state machine that never waits: the HardwareService task steps it on
+// every wake and sleeps until wire_actuator_next_ms() in between, so the
+// other hardware work goes on during an unlock.
+//
+// An attempt heats the wire with PWM toward a setpoint. Nothing measures
+// the wire itself, so the controller runs a first-order model of it (heated
+// by the duty, cooling toward the temperature the ADC pipeline reports) and
+// sets the duty from the modelled temperature: full power below the
+// setpoint, then the duty that holds it there plus a proportional term.
+// Heating stops as soon as the latch moves. The door then has to open; if
+// the latch did not move, the wire cools and the next attempt runs with a
+// higher setpoint. After the sequence the wire cools down before another.
+
+// =============================================================================
+// CONFIGURATION
+// =============================================================================
+
+#define WIRE_ACTUATOR_DUTY_MAX          1000u       // Duty is in per mille
+#define WIRE_ACTUATOR_NO_DEADLINE       0xFFFFFFFFu
+
+// =============================================================================
+// STATES AND RESULTS
+// =============================================================================
+
+typedef enum {
+    WIRE_ACTUATOR_IDLE = 0,
+    WIRE_ACTUATOR_HEATING,              // PWM on, latch watched
+    WIRE_ACTUATOR_MONITORING_LATCH,     // Heating window over, the wire may still pull
+    WIRE_ACTUATOR_MONITORING_EJECTOR,   // Latch free, waiting for the door to open
+    WIRE_ACTUATOR_RETRY_WAIT,           // Cooling before the next attempt
+    WIRE_ACTUATOR_COOLDOWN,             // Sequence over, no new one yet
+    WIRE_ACTUATOR_STATE_COUNT
+} WireActuatorState_t;
+
+typedef enum {
+    WIRE_RESULT_NONE = 0,
+    WIRE_RESULT_UNLOCKED,
+    WIRE_RESULT_BLOCKED,                // Latch free, the door stayed shut
+    WIRE_RESULT_LATCH_FAILED,           // No attempt moved the latch
+    WIRE_RESULT_ABORTED                 // Over temperature
+} WireActuatorResult_t;
+
+// What the controller reads on each step
+typedef struct {
+    int32_t ambient_cdeg;               // Filtered temperature, hundredths of a degree
+    bool latch_engaged;
+    bool door_closed;
+} WireActuatorInputs_t;
+
+typedef struct {
+    uint32_t sequences;
+    uint32_t attempts;
+    uint32_t unlocks;
+    uint32_t blocked;
+    uint32_t latch_failures;
+    uint32_t aborts;
+    uint64_t on_us;                     // Wire on-time at full current (duty x time)
+    uint32_t last_latency_ms;           // Request to result, last sequence
+    uint32_t last_attempts;
+    uint64_t last_on_us;
+} WireActuatorStats_t;
+
+typedef struct {
+    WireActuatorState_t state;
+    uint64_t deadline_ms;               // Current state ends
+    uint64_t last_step_ms;
+    uint64_t requested_ms;
+    uint8_t attempt;                    // 1-based, within the sequence
+    int32_t setpoint_cdeg;              // This attempt
+    int32_t base_setpoint_cdeg;         // First attempt
+    uint32_t heat_window_ms;
+    int32_t estimate_cdeg;              // Modelled wire temperature
+    uint16_t duty;
+    WireActuatorStats_t stats;
+} WireActuator_t;
+
+// =============================================================================
+// WIRE ACTUATOR API
+// =============================================================================
+
+void wire_actuator_init(WireActuator_t* actuator);
+
+// Starts a sequence; setpoint_c and heat_window_ms of 0 take the
+// CONFIG_MEMORY_WIRE_* defaults. Returns -1 while one runs or cools down.
+int wire_actuator_request(WireActuator_t* actuator, int32_t setpoint_c, uint32_t heat_window_ms,
+                          const WireActuatorInputs_t* inputs, uint64_t now_ms);
+
+// Advances the sequence to now_ms and returns its result when it ends there,
+// WIRE_RESULT_NONE otherwise. Apply wire_actuator_duty() after each step.
+WireActuatorResult_t wire_actuator_step(WireActuator_t* actuator,
+                                        const WireActuatorInputs_t* inputs, uint64_t now_ms);
+
+uint16_t wire_actuator_duty(const WireActuator_t* actuator);
+bool wire_actuator_is_heating(const WireActuator_t* actuator);
+
+// Milliseconds until the next step is due, or WIRE_ACTUATOR_NO_DEADLINE
+uint32_t wire_actuator_next_ms(const WireActuator_t* actuator, uint64_t now_ms);
+
+const char* wire_actuator_state_name(WireActuatorState_t state);
+const char* wire_actuator_result_name(WireActuatorResult_t result);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // WIRE_ACTUATOR_H
@@ -31,36 +31,90 @@ static bsp_queue_handle_t display_command_queue;
 // - Power management
 // =============================================================================
 
+// Notification bits for HardwareService_Task
+#define HST_NOTIFY_SENSOR_TICK   (1u << 0)
+#define HST_NOTIFY_POWER         (1u << 1)
+#define HST_NOTIFY_LOCK          (1u << 2)
+#define HST_NOTIFY_SENSOR_EDGE   (1u << 3)
+
+// Readings are refreshed once every ten ADC bursts unless a threshold is
+// crossed first
+#define HST_SENSOR_PERIOD_MS     (10 * CONFIG_SENSOR_BURST_PERIOD_MS)
+
+static bsp_timer_handle_t hst_sensor_timer;
+
+// Battery and temperature are sampled and filtered in the background; the
+// task sleeps until a threshold is crossed or a snapshot is due. Without the
+// pipeline it samples on a timer instead. Each ADC burst holds off STOP2
+// only while it runs; deep sleep needs no readings, so sampling stops. Door
+// and latch changes arrive as edges (HST_NOTIFY_SENSOR_EDGE) in any mode.
+static void hst_set_sampling(bool enabled) {
+    if (!enabled) {
+        bsp_sensors_stop();
+        if (hst_sensor_timer) bsp_timer_stop(hst_sensor_timer);
+        return;
+    }
+    
+    if (bsp_sensors_start(bsp_task_get_current(), HST_NOTIFY_SENSOR_TICK,
+                          HST_SENSOR_PERIOD_MS) == 0) {
+        return;
+    }
+    if (!hst_sensor_timer) {
+        printf("Warning: Sensor pipeline unavailable, sampling on a timer\n");
+        hst_sensor_timer = bsp_timer_create_notify(
+            "HST_Sensor", HST_SENSOR_PERIOD_MS, true,
+            bsp_task_get_current(), HST_NOTIFY_SENSOR_TICK);
+    }
+    if (!hst_sensor_timer || !bsp_timer_start(hst_sensor_timer)) {
+        printf("ERROR: Failed to start sensor timer\n");
+    }
+}
+
 void hardware_service_task(void* parameters) {
     (void)parameters; // Unused
     
     printf("HardwareService_Task starting...\n");
     
     // Initialize hardware systems through BSP
-    if (bsp_sensors_read(NULL) != 0) {
-        printf("Warning: Sensor initialization failed\n");
+    if (hardware_init() != 0) {
+        printf("Warning: Hardware service initialization incomplete\n");
     }
     
-    bsp_sensor_readings_t readings;
-    uint32_t last_sensor_update = 0;
+    hst_set_sampling(true);
+    bsp_sensors_set_edge_notify(bsp_task_get_current(), HST_NOTIFY_SENSOR_EDGE);
+    hardware_power_governor_start(bsp_task_get_current(), HST_NOTIFY_POWER);
+    hardware_lock_start(bsp_task_get_current(), HST_NOTIFY_LOCK);
     
     while (true) {
-        uint32_t current_time = bsp_get_tick_ms();
+        // Blocks until an event, the power governor's next idle timeout or
+        // the next step of a running unlock sequence
+        uint32_t timeout = hardware_power_governor_next_ms();
+        uint32_t lock_timeout = hardware_lock_next_ms();
+        uint32_t events = bsp_task_notify_wait(lock_timeout < timeout ? lock_timeout : timeout);
         
-        // Update sensors every 1000ms
-        if (current_time - last_sensor_update >= 1000) {
-            if (bsp_sensors_read(&readings) == 0) {
-                // Hardware monitoring and status updates
-                // TODO: Send sensor data to ApplicationLogic_Task if needed
+        if (events & (HST_NOTIFY_SENSOR_TICK | HST_NOTIFY_SENSOR_EDGE)) {
+            // Door, latch, battery and charger edges go to ApplicationLogic_Task
+            // as notification bits (ICD section 4)
+            uint32_t app_events = hardware_sensor_poll_events();
+            if (app_events) {
+                bsp_task_notify(application_logic_task_handle, app_events);
             }
-            last_sensor_update = current_time;
+            
+            // Nothing else pending: reclaim flash now rather than mid-save
+            hardware_storage_idle();
         }
         
-        // Check for hardware requests from ApplicationLogic_Task
-        // TODO: Implement hardware request processing
+        uint32_t power_events = hardware_power_governor_update();
+        if (power_events) {
+            hst_set_sampling(hardware_power_get_mode() != HARDWARE_POWER_DEEP_SLEEP);
+            bsp_task_notify(application_logic_task_handle, power_events);
+        }
         
-        // Yield to other tasks
-        bsp_task_delay(10);
+        // Unlock requests from ApplicationLogic_Task, and the running sequence
+        uint32_t lock_events = hardware_lock_update();
+        if (lock_events) {
+            bsp_task_notify(application_logic_task_handle, lock_events);
+        }
     }
 }
 
@@ -74,6 +128,10 @@ void hardware_service_task(void* parameters) {
 // - Menu navigation
 // =============================================================================
 
+// Notification bit for button input, next to the HST_EVT_* bits this task
+// also receives (hardware_api.h leaves it free)
+#define APP_NOTIFY_INPUT         (1u << 23)
+
 void application_logic_task(void* parameters) {
     (void)parameters; // Unused
     
@@ -83,18 +141,28 @@ void application_logic_task(void* parameters) {
     app_logic_init();
     
     bsp_button_event_t button_event;
+    bsp_input_set_notify(bsp_task_get_current(), APP_NOTIFY_INPUT);
+    uint32_t events = 0;
     
     while (true) {
-        // Process user input
-        if (bsp_input_poll_event(&button_event)) {
-            app_logic_process_button_event(&button_event);
-        }
-        
         // Update application state
         app_logic_update();
         
-        // Task update frequency: 60Hz for responsive UI
-        bsp_task_delay(16); // ~60 FPS
+        uint32_t hw_events = events & ~APP_NOTIFY_INPUT;
+        if (hw_events) {
+            app_logic_process_hardware_events(hw_events);
+        }
+        
+        // Process user input; presses queued before the notification was
+        // set are picked up on the first pass
+        while (bsp_input_poll_event(&button_event)) {
+            app_logic_process_button_event(&button_event);
+        }
+        
+        // Nothing runs on a period: sleeps until a button press, a
+        // HardwareService_Task event or the RTC alarm for the next lock
+        // deadline (HST_EVT_RTC_ALARM)
+        events = bsp_task_notify_wait_bits(HST_EVT_ALL, BSP_WAIT_FOREVER);
     }
 }
 
@@ -108,26 +176,28 @@ void application_logic_task(void* parameters) {
 // - Display command processing
 // =============================================================================
 
+// Notification bits for Display_Task
+#define DISPLAY_NOTIFY_WAKE      (1u << 0)
+
 void display_task_function(void* parameters) {
     (void)parameters; // Unused
     
     printf("Display_Task starting...\n");
     
-    // Initialize display system through BSP
-    if (bsp_display_init() != 0) {
-        printf("ERROR: Display initialization failed!\n");
-        return;
-    }
-    
-    // Initialize display task logic
-    display_task_init();
+    // The display and its task state were set up by main() before the
+    // scheduler started
+    display_task_set_notify(bsp_task_get_current(), DISPLAY_NOTIFY_WAKE);
     
     while (true) {
         // Process display commands from ApplicationLogic_Task
         display_task_update();
         
-        // Task update frequency: 30Hz to save power
-        bsp_task_delay(33); // ~30 FPS
+        // Sleeps until the screen's refresh policy wants a frame or the
+        // display is due to blank; commands and input wake it sooner. The
+        // timeout is relative, as for HardwareService_Task: it is worked
+        // out afresh from the last frame on every pass, and timed frames
+        // keep their phase (display_task_update).
+        bsp_task_notify_wait_bits(DISPLAY_NOTIFY_WAKE, display_task_next_update_ms());
     }
 }
 
@@ -252,7 +322,11 @@ int main() {
         return -1; 
     }
     
-    // Step 3: Create RTOS tasks
+    // Step 3: Initialize display task state once, before ApplicationLogic_Task
+    // queues its first screen
+    display_task_init();
+    
+    // Step 4: Create RTOS tasks
     if (create_rtos_tasks() != 0) {
         printf("FATAL: Task creation failed\n");
         return -1;
@@ -260,7 +334,7 @@ int main() {
     
     printf("CKOS initialization complete - starting scheduler\n");
     
-    // Step 4: Start RTOS scheduler (never returns)
+    // Step 5: Start RTOS scheduler (never returns)
     bsp_scheduler_start();
     
     // Should never reach here
@@ -5,6 +5,7 @@
 // on the main thread while still running the same application logic
 
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <atomic>
 #include <thread>
@@ -14,52 +15,31 @@
 #include "Display/display_api.h"
 #include "Hardware/hardware_api.h"
 #include "Config/app_config.h"
+#include "Simulator/sim_fleet.h"
 
 // Global state for coordinating between main thread and simulation
 static std::atomic<bool> g_running{true};
-static std::atomic<bool> g_app_initialized{false};
 
-// Simulation state update frequencies
-static const int HARDWARE_UPDATE_MS = 100;  // 10 Hz
-static const int APP_LOGIC_UPDATE_MS = 16;   // ~60 Hz  
-static const int DISPLAY_UPDATE_MS = 33;     // ~30 Hz
-
-// Last update times
-static uint32_t last_hardware_update = 0;
-static uint32_t last_app_logic_update = 0;
-static uint32_t last_display_update = 0;
-
-// =============================================================================
-// SIMULATION THREAD FUNCTIONS
-// =============================================================================
-
-void hardware_simulation_update() {
-    static bsp_sensor_readings_t readings;
+// Once, from exit() or before the device is destroyed on a normal shutdown
+static void print_simulation_reports(void) {
+    static bool printed = false;
+    if (printed) return;
+    printed = true;
+    bsp_debug_print_power_residency();
+    bsp_debug_print_storage_stats();
+    bsp_debug_print_energy_report("interactive session");
+    app_logic_print_state_coverage();
     
-    // Simulate sensor readings
-    if (bsp_sensors_read(&readings) == 0) {
-        // Hardware monitoring simulation
-    }
-}
-
-void app_logic_simulation_update() {
-    static bool initialized = false;
-    
-    if (!initialized) {
-        app_logic_init();
-        initialized = true;
-        g_app_initialized = true;
-        printf("Application logic initialized\n");
+    // The transition table as a Graphviz graph, for the docs
+    const char* diagram_path = getenv("CKOS_STATE_DIAGRAM");
+    if (diagram_path) {
+        FILE* diagram = fopen(diagram_path, "w");
+        if (diagram) {
+            app_logic_write_state_diagram(diagram);
+            fclose(diagram);
+            printf("State diagram written to %s\n", diagram_path);
+        }
     }
-    
-    // Process button events (handled by main thread SDL loop)
-    // App logic state updates
-    app_logic_update();
-}
-
-void display_simulation_update() {
-    // Process display commands and update screen
-    display_task_update();
 }
 
 // =============================================================================
@@ -73,6 +53,21 @@ int main() {
     // Initialize BSP systems (SDL initialization happens here)
     printf("Initializing BSP systems...\n");
     
+    // The interactive simulator is device 0 of the multi-instance library,
+    // bound to the main thread for the whole run
+    sim_device_t* device = sim_device_create(0);
+    if (!device) {
+        printf("ERROR: Simulated device creation failed\n");
+        return -1;
+    }
+    sim_device_bind(device);
+    
+    // Flash contents and wear persist in a file between runs
+    const char* flash_path = getenv("CKOS_SIM_FLASH");
+    if (bsp_sim_storage_open(flash_path ? flash_path : "ckos_flash.bin") != 0) {
+        printf("WARNING: Using a blank flash image for this run\n");
+    }
+    
     if (bsp_display_init() != 0) {
         printf("ERROR: Display initialization failed\n");
         return -1;
@@ -85,53 +80,44 @@ int main() {
     
     printf("BSP systems initialized successfully\n");
     
-    // Initialize application components
-    hardware_init();
-    display_task_init();
-    
     printf("CKOS initialization complete\n");
     printf("Running single-threaded simulation...\n");
     printf("Controls: Arrow keys to navigate, A/B for select/back, ESC to exit\n");
     
+    // ESC/quit exit() from inside the BSP, so report residency, flash
+    // activity and the charge drawn at exit
+    bsp_power_reset_residency();
+    bsp_sim_energy_reset();
+    atexit(print_simulation_reports);
+    
+    // Hardware, display and app logic come up before the first button event
+    if (sim_device_start(device) != 0) {
+        printf("ERROR: Simulation timer setup failed\n");
+        return -1;
+    }
+    
     // Main simulation loop (single-threaded)
     while (g_running) {
-        uint32_t current_time = bsp_get_tick_ms();
-        
         // 1. Handle SDL events (must be on main thread)
         bsp_button_event_t button_event;
         while (bsp_input_poll_event(&button_event)) {
-            if (g_app_initialized) {
-                app_logic_process_button_event(&button_event);
-            }
-        }
-        
-        // 2. Update hardware simulation at 10 Hz
-        if (current_time - last_hardware_update >= HARDWARE_UPDATE_MS) {
-            hardware_simulation_update();
-            last_hardware_update = current_time;
+            app_logic_process_button_event(&button_event);
         }
         
-        // 3. Update application logic at ~60 Hz
-        if (current_time - last_app_logic_update >= APP_LOGIC_UPDATE_MS) {
-            app_logic_simulation_update();
-            last_app_logic_update = current_time;
-        }
-        
-        // 4. Update display at ~30 Hz
-        if (current_time - last_display_update >= DISPLAY_UPDATE_MS) {
-            display_simulation_update();
-            last_display_update = current_time;
-        }
+        // 2. Run the hardware, app logic and display updates that are due
+        bsp_sim_timer_process();
         
-        // Small delay to prevent excessive CPU usage
-        bsp_delay_ms(1);
+        // 3. Idle until the next timer deadline, like the target's tickless idle
+        bsp_sim_idle(bsp_sim_timer_next_expiry_ms());
     }
     
     printf("Simulator shutting down...\n");
+    print_simulation_reports();
     
     // Cleanup
     bsp_display_cleanup();
     bsp_input_cleanup();
+    sim_device_destroy(device);
     
     return 0;
 }
\ No newline at end of file
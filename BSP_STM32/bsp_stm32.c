@@ -0,0 +1,1262 @@
+// BSP STM32 Implementation
+// STM32L452 implementation of the BSP API on top of STM32Cube HAL and FreeRTOS
+// This is the target-side counterpart of BSP_Simulator/
+
+#include <string.h>
+#include "main.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include "timers.h"
+#include "queue.h"
+#include "semphr.h"
+#include "../App/BSP/bsp_api.h"
+#include "../App/Config/app_config.h"
+#include "../App/Utils/sensor_pipeline.h"
+#include "../App/Utils/civil_time.h"
+
+// Peripheral handles owned by Core/Src/main.c (CubeMX generated)
+extern RTC_HandleTypeDef hrtc;
+extern ADC_HandleTypeDef hadc1;
+extern TIM_HandleTypeDef htim2;
+void SystemClock_Config(void);
+
+// =============================================================================
+// POWER MANAGEMENT - INSOMNIA
+// =============================================================================
+
+static volatile uint32_t g_insomnia_level = 0;
+static bsp_power_mode_t g_power_mode = BSP_POWER_MODE_RUN;
+
+void bsp_power_suppress_sleep(void) {
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    g_insomnia_level++;
+    __set_PRIMASK(primask);
+}
+
+void bsp_power_allow_sleep(void) {
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    if (g_insomnia_level > 0) {
+        g_insomnia_level--;
+    }
+    __set_PRIMASK(primask);
+}
+
+uint32_t bsp_power_get_insomnia_level(void) {
+    return g_insomnia_level;
+}
+
+int bsp_power_set_mode(bsp_power_mode_t mode) {
+    // SLEEP/STOP2 are entered from the idle hook below; STANDBY loses RAM and
+    // is only entered on explicit command
+    g_power_mode = mode;
+    if (mode == BSP_POWER_MODE_STANDBY) {
+        HAL_PWR_EnterSTANDBYMode();
+    }
+    return 0;
+}
+
+// =============================================================================
+// POWER MANAGEMENT - TICKLESS IDLE (configUSE_TICKLESS_IDLE = 2)
+// =============================================================================
+
+// RTC wake-up timer clocked from LSE / 16 = 2048 Hz, 16-bit reload (~32 s)
+#define RTC_WUT_CLOCK_HZ        2048U
+#define RTC_WUT_MAX_COUNTS      0x10000U
+#define RTC_WUT_MAX_IDLE_MS     ((RTC_WUT_MAX_COUNTS * 1000U) / RTC_WUT_CLOCK_HZ)
+
+// Calendar second fractions per second (SynchPrediv + 1, see MX_RTC_Init)
+#define RTC_SUBSEC_PER_DAY      (86400UL * 256UL)
+
+static bsp_power_residency_t g_residency = {0};
+static uint64_t g_residency_start_ms = 0;
+static uint64_t g_sleep_subsec = 0;     // SLEEP residency in RTC 1/256 s units
+static bool g_rtc_wakeup_irq_enabled = false;
+
+// Read the RTC calendar as 1/256 s units since midnight. Reading the time
+// locks the shadow registers until the date is read, so both are read.
+static uint32_t rtc_read_subsec_of_day(void) {
+    RTC_TimeTypeDef time;
+    RTC_DateTypeDef date;
+
+    HAL_RTC_GetTime(&hrtc, &time, RTC_FORMAT_BIN);
+    HAL_RTC_GetDate(&hrtc, &date, RTC_FORMAT_BIN);
+
+    uint32_t seconds = (uint32_t)time.Hours * 3600U +
+                       (uint32_t)time.Minutes * 60U +
+                       (uint32_t)time.Seconds;
+    return seconds * 256U + (time.SecondFraction - time.SubSeconds);
+}
+
+// The shadow registers stop updating in STOP modes: clear RSF and wait for
+// the next copy from the calendar before trusting a read after wake-up
+static void rtc_resync_shadow(void) {
+    __HAL_RTC_WRITEPROTECTION_DISABLE(&hrtc);
+    HAL_RTC_WaitForSynchro(&hrtc);
+    __HAL_RTC_WRITEPROTECTION_ENABLE(&hrtc);
+}
+
+static uint32_t rtc_elapsed_subsec(uint32_t start, uint32_t end) {
+    return (end >= start) ? (end - start) : (end + RTC_SUBSEC_PER_DAY - start);
+}
+
+static uint32_t rtc_elapsed_ms(uint32_t start, uint32_t end) {
+    return (rtc_elapsed_subsec(start, end) * 1000U) / 256U;
+}
+
+// Light sleep: SysTick keeps running so no tick correction is needed. The
+// kernel tick count stands still while the scheduler is suspended for this
+// hook, so the RTC times the WFI. One WFI lasts at most a tick, well under
+// the RTC's 1/256 s step, so the raw steps are summed and only the total is
+// converted. Called with interrupts disabled; returns with them enabled.
+static void power_enter_sleep(void) {
+    uint32_t rtc_start = rtc_read_subsec_of_day();
+    __enable_irq();
+    __DSB();
+    __WFI();
+    __ISB();
+    g_sleep_subsec += rtc_elapsed_subsec(rtc_start, rtc_read_subsec_of_day());
+    g_residency.sleep_entries++;
+}
+
+void bsp_power_suppress_ticks_and_sleep(TickType_t expected_idle_ticks) {
+    uint32_t expected_ms = (uint32_t)expected_idle_ticks * (1000U / configTICK_RATE_HZ);
+
+    __disable_irq();
+
+    // A task may have become ready between the scheduler's idle decision and
+    // disabling interrupts
+    if (eTaskConfirmSleepModeStatus() == eAbortSleep) {
+        __enable_irq();
+        return;
+    }
+
+    if (g_insomnia_level > 0 || expected_ms < BSP_POWER_STOP2_MIN_IDLE_MS) {
+        power_enter_sleep();
+        return;
+    }
+
+    if (expected_ms > RTC_WUT_MAX_IDLE_MS) {
+        expected_ms = RTC_WUT_MAX_IDLE_MS;
+        expected_idle_ticks = (TickType_t)(expected_ms / (1000U / configTICK_RATE_HZ));
+    }
+
+    if (!g_rtc_wakeup_irq_enabled) {
+        HAL_NVIC_SetPriority(RTC_WKUP_IRQn, 5, 0);
+        HAL_NVIC_EnableIRQ(RTC_WKUP_IRQn);
+        g_rtc_wakeup_irq_enabled = true;
+    }
+
+    // Stop the RTOS tick and program hrtc to wake at the next kernel deadline
+    SysTick->CTRL &= ~SysTick_CTRL_ENABLE_Msk;
+    // Rounded up so the timer never fires before the ticks it will step
+    uint32_t counts = (expected_ms * RTC_WUT_CLOCK_HZ + 999U) / 1000U;
+    HAL_RTCEx_SetWakeUpTimer_IT(&hrtc, counts - 1U, RTC_WAKEUPCLOCK_RTCCLK_DIV16);
+
+    uint32_t rtc_start = rtc_read_subsec_of_day();
+
+    configPRE_SLEEP_PROCESSING(expected_idle_ticks);
+    HAL_PWREx_EnterSTOP2Mode(PWR_STOPENTRY_WFI);
+    configPOST_SLEEP_PROCESSING(expected_idle_ticks);
+
+    // STOP2 exits on MSI; restore the PLL before anything time-critical runs
+    SystemClock_Config();
+    bool timer_expired = __HAL_RTC_WAKEUPTIMER_GET_FLAG(&hrtc, RTC_FLAG_WUTF) != 0U;
+    HAL_RTCEx_DeactivateWakeUpTimer(&hrtc);
+    rtc_resync_shadow();
+
+    // Woken by the wake-up timer: exactly the programmed idle time passed, so
+    // step it whole rather than losing a fraction of a tick every sleep.
+    // Woken early by an EXTI line (button, door): the RTC says how long we
+    // slept. Never step past the expected idle time.
+    TickType_t slept_ticks = expected_idle_ticks;
+    uint32_t slept_ms = expected_ms;
+    if (!timer_expired) {
+        slept_ms = rtc_elapsed_ms(rtc_start, rtc_read_subsec_of_day());
+        if (slept_ms > expected_ms) {
+            slept_ms = expected_ms;
+        }
+        slept_ticks = (TickType_t)(slept_ms / (1000U / configTICK_RATE_HZ));
+    }
+    vTaskStepTick(slept_ticks);
+
+    g_residency.stop2_ms += slept_ms;
+    g_residency.stop2_entries++;
+
+    SysTick->VAL = 0UL;
+    SysTick->CTRL |= SysTick_CTRL_ENABLE_Msk;
+    __enable_irq();
+}
+
+void bsp_power_rtc_wakeup_irq_handler(void) {
+    HAL_RTCEx_WakeUpTimerIRQHandler(&hrtc);
+}
+
+void bsp_power_get_residency(bsp_power_residency_t* residency) {
+    if (!residency) return;
+
+    taskENTER_CRITICAL();
+    *residency = g_residency;
+    residency->sleep_ms = g_sleep_subsec * 1000U / 256U;
+    uint64_t total_ms = bsp_get_tick_ms64() - g_residency_start_ms;
+    taskEXIT_CRITICAL();
+
+    uint64_t idle_ms = residency->sleep_ms + residency->stop2_ms;
+    residency->run_ms = (total_ms > idle_ms) ? (total_ms - idle_ms) : 0;
+}
+
+void bsp_power_reset_residency(void) {
+    taskENTER_CRITICAL();
+    memset(&g_residency, 0, sizeof(g_residency));
+    g_sleep_subsec = 0;
+    g_residency_start_ms = bsp_get_tick_ms64();
+    taskEXIT_CRITICAL();
+}
+
+// =============================================================================
+// RTC CALENDAR AND ALARM
+// =============================================================================
+
+// The calendar holds UTC. Alarm A matches the time of day with the date
+// masked, so it reaches at most a day ahead; a later instant fires a day out
+// and the woken task sets the alarm again.
+#define RTC_SECONDS_PER_DAY     86400U
+
+static bsp_task_handle_t rtc_alarm_task = NULL;
+static uint32_t rtc_alarm_bits = 0;
+static bool rtc_alarm_irq_enabled = false;
+
+uint64_t bsp_get_utc_time_seconds(void) {
+    RTC_TimeTypeDef time;
+    RTC_DateTypeDef date;
+    HAL_RTC_GetTime(&hrtc, &time, RTC_FORMAT_BIN);
+    HAL_RTC_GetDate(&hrtc, &date, RTC_FORMAT_BIN);  // Unlocks the shadow registers
+
+    uint32_t days = civil_time_days_from_date(2000U + date.Year, date.Month, date.Date);
+    return (uint64_t)days * RTC_SECONDS_PER_DAY +
+           time.Hours * 3600U + time.Minutes * 60U + time.Seconds;
+}
+
+int bsp_rtc_set_alarm(uint64_t utc_seconds, bsp_task_handle_t task, uint32_t notify_bits) {
+    if (!task || notify_bits == 0) return -1;
+
+    bsp_rtc_cancel_alarm();
+    uint64_t now = bsp_get_utc_time_seconds();
+    if (utc_seconds <= now) {
+        bsp_task_notify(task, notify_bits);
+        return 0;
+    }
+
+    // The alarm matches a time of day, so the target is clamped to between
+    // one second and just under a day ahead of the time read here
+    uint64_t at = (utc_seconds - now < RTC_SECONDS_PER_DAY) ?
+                  utc_seconds : now + RTC_SECONDS_PER_DAY - 1U;
+    if (at < now + 1U) at = now + 1U;
+    uint32_t second_of_day = (uint32_t)(at % RTC_SECONDS_PER_DAY);
+
+    if (!rtc_alarm_irq_enabled) {
+        HAL_NVIC_SetPriority(RTC_Alarm_IRQn, 5, 0);
+        HAL_NVIC_EnableIRQ(RTC_Alarm_IRQn);
+        rtc_alarm_irq_enabled = true;
+    }
+
+    taskENTER_CRITICAL();
+    rtc_alarm_task = task;
+    rtc_alarm_bits = notify_bits;
+    taskEXIT_CRITICAL();
+
+    RTC_AlarmTypeDef alarm = {0};
+    alarm.AlarmTime.Hours = second_of_day / 3600U;
+    alarm.AlarmTime.Minutes = (second_of_day / 60U) % 60U;
+    alarm.AlarmTime.Seconds = second_of_day % 60U;
+    alarm.AlarmMask = RTC_ALARMMASK_DATEWEEKDAY;
+    alarm.AlarmSubSecondMask = RTC_ALARMSUBSECONDMASK_ALL;
+    alarm.AlarmDateWeekDaySel = RTC_ALARMDATEWEEKDAYSEL_DATE;
+    alarm.AlarmDateWeekDay = 1;
+    alarm.Alarm = RTC_ALARM_A;
+
+    // Also arms EXTI line 18, the STOP2 wake-up path
+    if (HAL_RTC_SetAlarm_IT(&hrtc, &alarm, RTC_FORMAT_BIN) != HAL_OK) return -1;
+
+    // The RTC keeps counting while the alarm is written. If it has already
+    // reached the target, the match was missed and the alarm would not fire
+    // for another day, so notify now. The caller re-checks the time when
+    // woken, so an alarm that also fires costs nothing.
+    if (bsp_get_utc_time_seconds() >= at) {
+        bsp_task_notify(task, notify_bits);
+    }
+    return 0;
+}
+
+void bsp_rtc_cancel_alarm(void) {
+    HAL_RTC_DeactivateAlarm(&hrtc, RTC_ALARM_A);
+
+    taskENTER_CRITICAL();
+    rtc_alarm_task = NULL;
+    rtc_alarm_bits = 0;
+    taskEXIT_CRITICAL();
+}
+
+void bsp_rtc_alarm_irq_handler(void) {
+    HAL_RTC_AlarmIRQHandler(&hrtc);
+}
+
+// HAL weak callback, from RTC_Alarm_IRQHandler. The alarm stays armed and
+// would repeat a day later; the woken task replaces or cancels it first.
+void HAL_RTC_AlarmAEventCallback(RTC_HandleTypeDef* rtc) {
+    (void)rtc;
+    if (rtc_alarm_task) {
+        bsp_task_notify_from_isr(rtc_alarm_task, rtc_alarm_bits);
+    }
+}
+
+// =============================================================================
+// MONOTONIC TICK
+// =============================================================================
+
+// The FreeRTOS tick is the millisecond clock (configTICK_RATE_HZ is 1000).
+// TickType_t is 32 bits; the kernel counts its overflows for timeouts, and
+// vTaskSetTimeOutState() reads both under one critical section, which gives
+// the upper word without a second counter to keep in step.
+uint32_t bsp_get_tick_ms(void) {
+    return (uint32_t)xTaskGetTickCount();
+}
+
+uint64_t bsp_get_tick_ms64(void) {
+    TimeOut_t now;
+    vTaskSetTimeOutState(&now);
+    return ((uint64_t)(uint32_t)now.xOverflowCount << 32) | (uint32_t)now.xTimeOnEntering;
+}
+
+void bsp_delay_ms(uint32_t ms) {
+    if (xTaskGetSchedulerState() == taskSCHEDULER_RUNNING) {
+        vTaskDelay(pdMS_TO_TICKS(ms));
+    } else {
+        HAL_Delay(ms);
+    }
+}
+
+// =============================================================================
+// TASK NOTIFICATIONS
+// =============================================================================
+
+static TickType_t timeout_to_ticks(uint32_t timeout_ms) {
+    if (timeout_ms == BSP_WAIT_FOREVER) return portMAX_DELAY;
+    return pdMS_TO_TICKS(timeout_ms);
+}
+
+bsp_task_handle_t bsp_task_get_current(void) {
+    return (bsp_task_handle_t)xTaskGetCurrentTaskHandle();
+}
+
+bool bsp_task_notify(bsp_task_handle_t task, uint32_t bits) {
+    if (!task) return false;
+    return xTaskNotify((TaskHandle_t)task, bits, eSetBits) == pdPASS;
+}
+
+bool bsp_task_notify_from_isr(bsp_task_handle_t task, uint32_t bits) {
+    if (!task) return false;
+
+    BaseType_t higher_priority_task_woken = pdFALSE;
+    BaseType_t result = xTaskNotifyFromISR((TaskHandle_t)task, bits, eSetBits,
+                                           &higher_priority_task_woken);
+    portYIELD_FROM_ISR(higher_priority_task_woken);
+    return result == pdPASS;
+}
+
+// Take the pending bits in mask, leaving the rest. FreeRTOS 10.3 has no
+// masked clear, so the remainder is written back inside a critical section.
+static uint32_t notify_take_bits(uint32_t mask) {
+    uint32_t value = 0;
+    uint32_t taken;
+
+    taskENTER_CRITICAL();
+    xTaskNotifyWait(0, 0, &value, 0);
+    taken = value & mask;
+    if (taken != 0) {
+        xTaskNotify(xTaskGetCurrentTaskHandle(), value & ~mask, eSetValueWithOverwrite);
+    }
+    taskEXIT_CRITICAL();
+
+    return taken;
+}
+
+uint32_t bsp_task_notify_wait_bits(uint32_t wait_mask, uint32_t timeout_ms) {
+    TickType_t start = xTaskGetTickCount();
+    TickType_t timeout = timeout_to_ticks(timeout_ms);
+    TickType_t remaining = timeout;
+
+    while (true) {
+        // Bits may already be pending from before this call, so look first
+        uint32_t bits = notify_take_bits(wait_mask);
+        if (bits != 0) return bits;
+
+        if (timeout != portMAX_DELAY) {
+            TickType_t elapsed = xTaskGetTickCount() - start;
+            if (elapsed >= timeout) return 0;
+            remaining = timeout - elapsed;
+        }
+
+        // Block until the next notification of any kind, then re-check
+        uint32_t unused;
+        xTaskNotifyWait(0, 0, &unused, remaining);
+    }
+}
+
+uint32_t bsp_task_notify_wait(uint32_t timeout_ms) {
+    return bsp_task_notify_wait_bits(0xFFFFFFFFUL, timeout_ms);
+}
+
+uint32_t bsp_task_notify_wait_until(uint32_t wait_mask, uint64_t* last_wake_ms, uint32_t period_ms) {
+    if (!last_wake_ms) return bsp_task_notify_wait_bits(wait_mask, period_ms);
+
+    uint64_t deadline = *last_wake_ms + period_ms;
+    uint64_t now = bsp_get_tick_ms64();
+    uint32_t bits = bsp_task_notify_wait_bits(wait_mask,
+                                              deadline > now ? (uint32_t)(deadline - now) : 0);
+    if (bsp_get_tick_ms64() >= deadline) {
+        *last_wake_ms = deadline;
+    }
+    return bits;
+}
+
+// =============================================================================
+// TASKS, QUEUES AND MUTEXES (static allocation)
+// =============================================================================
+
+// Task control blocks, stacks, queue storage and mutexes all come from
+// static tables sized in app_config.h, so the application never touches the
+// FreeRTOS heap.
+// Task slots and stack space are not reclaimed on delete; a deleted queue's
+// slot keeps its storage and is reused by a later queue that fits in it.
+
+typedef struct {
+    StaticTask_t tcb;
+    TaskHandle_t handle;
+} stm32_task_t;
+
+typedef struct {
+    StaticQueue_t control;
+    QueueHandle_t handle;
+    uint8_t* storage;
+    uint16_t capacity;
+    bool in_use;
+} stm32_queue_t;
+
+static stm32_task_t g_tasks[CONFIG_RTOS_MAX_TASKS];
+static uint8_t g_task_count = 0;
+static StackType_t g_stack_arena[CONFIG_RTOS_STACK_ARENA_SIZE / sizeof(StackType_t)];
+static size_t g_stack_arena_used = 0;      // In StackType_t words
+
+static stm32_queue_t g_queues[CONFIG_RTOS_MAX_QUEUES];
+static uint8_t g_queue_arena[CONFIG_RTOS_QUEUE_ARENA_SIZE] __attribute__((aligned(4)));
+static size_t g_queue_arena_used = 0;
+
+typedef struct {
+    StaticSemaphore_t control;
+    SemaphoreHandle_t handle;
+} stm32_mutex_t;
+
+static stm32_mutex_t g_mutexes[CONFIG_RTOS_MAX_MUTEXES];
+static uint8_t g_mutex_count = 0;
+
+bsp_task_handle_t bsp_task_create(bsp_task_function_t task_function,
+                                  const char* name,
+                                  uint16_t stack_size,
+                                  void* parameters,
+                                  uint8_t priority) {
+    // stack_size is in bytes, FreeRTOS counts stack words
+    size_t words = (stack_size + sizeof(StackType_t) - 1) / sizeof(StackType_t);
+    if (!task_function || words < configMINIMAL_STACK_SIZE) return NULL;
+
+    stm32_task_t* task = NULL;
+    StackType_t* stack = NULL;
+    taskENTER_CRITICAL();
+    size_t stack_words = sizeof(g_stack_arena) / sizeof(StackType_t);
+    if (g_task_count < CONFIG_RTOS_MAX_TASKS && g_stack_arena_used + words <= stack_words) {
+        task = &g_tasks[g_task_count++];
+        stack = &g_stack_arena[g_stack_arena_used];
+        g_stack_arena_used += words;
+    }
+    taskEXIT_CRITICAL();
+    if (!task) return NULL;
+
+    task->handle = xTaskCreateStatic(task_function, name, (uint32_t)words, parameters,
+                                     (UBaseType_t)priority, stack, &task->tcb);
+    return (bsp_task_handle_t)task->handle;
+}
+
+void bsp_task_delete(bsp_task_handle_t task) {
+    vTaskDelete((TaskHandle_t)task);
+}
+
+void bsp_task_delay(uint32_t ms) {
+    vTaskDelay(pdMS_TO_TICKS(ms));
+}
+
+// vTaskDelayUntil() keeps its own 32-bit wake time; it is the low word of
+// ours and handles the wrap itself, so only the caller's copy needs widening
+void bsp_task_delay_until(uint64_t* last_wake_ms, uint32_t period_ms) {
+    if (!last_wake_ms) return;
+
+    TickType_t previous = (TickType_t)*last_wake_ms;
+    vTaskDelayUntil(&previous, pdMS_TO_TICKS(period_ms));
+    *last_wake_ms += period_ms;
+}
+
+void bsp_task_yield(void) {
+    taskYIELD();
+}
+
+void bsp_scheduler_start(void) {
+    vTaskStartScheduler();
+}
+
+bsp_queue_handle_t bsp_queue_create(uint8_t length, uint8_t item_size) {
+    size_t bytes = (size_t)length * item_size;
+    if (bytes == 0) return NULL;
+
+    // Keep every queue's storage word aligned for item copies
+    size_t reserve = (bytes + 3u) & ~(size_t)3u;
+    stm32_queue_t* q = NULL;
+
+    taskENTER_CRITICAL();
+    for (int i = 0; i < CONFIG_RTOS_MAX_QUEUES && !q; i++) {
+        if (!g_queues[i].in_use && g_queues[i].storage && g_queues[i].capacity >= bytes) {
+            q = &g_queues[i];
+        }
+    }
+    for (int i = 0; i < CONFIG_RTOS_MAX_QUEUES && !q; i++) {
+        if (!g_queues[i].in_use && !g_queues[i].storage &&
+            g_queue_arena_used + reserve <= sizeof(g_queue_arena)) {
+            q = &g_queues[i];
+            q->storage = &g_queue_arena[g_queue_arena_used];
+            q->capacity = (uint16_t)reserve;
+            g_queue_arena_used += reserve;
+        }
+    }
+    if (q) q->in_use = true;
+    taskEXIT_CRITICAL();
+    if (!q) return NULL;
+
+    q->handle = xQueueCreateStatic(length, item_size, q->storage, &q->control);
+    return (bsp_queue_handle_t)q;
+}
+
+void bsp_queue_delete(bsp_queue_handle_t queue) {
+    stm32_queue_t* q = (stm32_queue_t*)queue;
+    if (!q || !q->in_use) return;
+
+    vQueueDelete(q->handle);
+    q->handle = NULL;
+    q->in_use = false;
+}
+
+bool bsp_queue_send(bsp_queue_handle_t queue, const void* item, uint32_t timeout_ms) {
+    stm32_queue_t* q = (stm32_queue_t*)queue;
+    if (!q || !q->in_use) return false;
+    return xQueueSend(q->handle, item, timeout_to_ticks(timeout_ms)) == pdPASS;
+}
+
+bool bsp_queue_receive(bsp_queue_handle_t queue, void* item, uint32_t timeout_ms) {
+    stm32_queue_t* q = (stm32_queue_t*)queue;
+    if (!q || !q->in_use) return false;
+    return xQueueReceive(q->handle, item, timeout_to_ticks(timeout_ms)) == pdPASS;
+}
+
+bsp_mutex_handle_t bsp_mutex_create(void) {
+    stm32_mutex_t* m = NULL;
+    taskENTER_CRITICAL();
+    if (g_mutex_count < CONFIG_RTOS_MAX_MUTEXES) {
+        m = &g_mutexes[g_mutex_count++];
+    }
+    taskEXIT_CRITICAL();
+    if (!m) return NULL;
+
+    m->handle = xSemaphoreCreateMutexStatic(&m->control);
+    return (bsp_mutex_handle_t)m;
+}
+
+// Before the scheduler starts there is only one thread of execution, as for
+// bsp_crc_update()
+void bsp_mutex_lock(bsp_mutex_handle_t mutex) {
+    stm32_mutex_t* m = (stm32_mutex_t*)mutex;
+    if (!m || xTaskGetSchedulerState() != taskSCHEDULER_RUNNING) return;
+    xSemaphoreTake(m->handle, portMAX_DELAY);
+}
+
+void bsp_mutex_unlock(bsp_mutex_handle_t mutex) {
+    stm32_mutex_t* m = (stm32_mutex_t*)mutex;
+    if (!m || xTaskGetSchedulerState() != taskSCHEDULER_RUNNING) return;
+    xSemaphoreGive(m->handle);
+}
+
+// =============================================================================
+// SOFTWARE TIMERS (FreeRTOS timer service)
+// =============================================================================
+
+// Timers are statically allocated so creating one never touches the heap
+#define BSP_MAX_TIMERS  8
+
+typedef struct {
+    TimerHandle_t handle;
+    StaticTimer_t storage;
+    bsp_timer_callback_t callback;
+    void* context;
+    TaskHandle_t notify_task;
+    uint32_t notify_bits;
+} stm32_timer_t;
+
+static stm32_timer_t g_timers[BSP_MAX_TIMERS];
+
+static void timer_dispatch(TimerHandle_t handle) {
+    stm32_timer_t* t = (stm32_timer_t*)pvTimerGetTimerID(handle);
+
+    if (t->callback) {
+        t->callback((bsp_timer_handle_t)t, t->context);
+    } else {
+        xTaskNotify(t->notify_task, t->notify_bits, eSetBits);
+    }
+}
+
+static stm32_timer_t* timer_alloc(const char* name, uint32_t period_ms, bool periodic) {
+    TickType_t period = pdMS_TO_TICKS(period_ms);
+    if (period == 0) return NULL;
+
+    stm32_timer_t* t = NULL;
+    taskENTER_CRITICAL();
+    for (int i = 0; i < BSP_MAX_TIMERS; i++) {
+        if (g_timers[i].handle == NULL) {
+            t = &g_timers[i];
+            // Reserve the slot before leaving the critical section
+            t->handle = (TimerHandle_t)&t->storage;
+            break;
+        }
+    }
+    taskEXIT_CRITICAL();
+    if (!t) return NULL;
+
+    t->callback = NULL;
+    t->context = NULL;
+    t->notify_task = NULL;
+    t->notify_bits = 0;
+    t->handle = xTimerCreateStatic(name, period, periodic ? pdTRUE : pdFALSE,
+                                   t, timer_dispatch, &t->storage);
+    return t->handle ? t : NULL;
+}
+
+bsp_timer_handle_t bsp_timer_create(const char* name,
+                                    uint32_t period_ms,
+                                    bool periodic,
+                                    bsp_timer_callback_t callback,
+                                    void* context) {
+    if (!callback) return NULL;
+
+    stm32_timer_t* t = timer_alloc(name, period_ms, periodic);
+    if (!t) return NULL;
+
+    t->callback = callback;
+    t->context = context;
+    return t;
+}
+
+bsp_timer_handle_t bsp_timer_create_notify(const char* name,
+                                           uint32_t period_ms,
+                                           bool periodic,
+                                           bsp_task_handle_t task,
+                                           uint32_t notify_bits) {
+    if (!task || notify_bits == 0) return NULL;
+
+    stm32_timer_t* t = timer_alloc(name, period_ms, periodic);
+    if (!t) return NULL;
+
+    t->notify_task = (TaskHandle_t)task;
+    t->notify_bits = notify_bits;
+    return t;
+}
+
+// Runs in the timer task, behind the delete command in its FIFO queue
+static void timer_release(void* slot, uint32_t unused) {
+    (void)unused;
+    ((stm32_timer_t*)slot)->handle = NULL;
+}
+
+void bsp_timer_delete(bsp_timer_handle_t timer) {
+    stm32_timer_t* t = (stm32_timer_t*)timer;
+    if (!t || !t->handle) return;
+
+    // The slot is only reusable once the timer task has processed the delete
+    xTimerDelete(t->handle, portMAX_DELAY);
+    xTimerPendFunctionCall(timer_release, t, 0, portMAX_DELAY);
+}
+
+bool bsp_timer_start(bsp_timer_handle_t timer) {
+    stm32_timer_t* t = (stm32_timer_t*)timer;
+    if (!t || !t->handle) return false;
+    return xTimerReset(t->handle, portMAX_DELAY) == pdPASS;
+}
+
+bool bsp_timer_stop(bsp_timer_handle_t timer) {
+    stm32_timer_t* t = (stm32_timer_t*)timer;
+    if (!t || !t->handle) return false;
+    return xTimerStop(t->handle, portMAX_DELAY) == pdPASS;
+}
+
+bool bsp_timer_set_period(bsp_timer_handle_t timer, uint32_t period_ms) {
+    stm32_timer_t* t = (stm32_timer_t*)timer;
+    TickType_t period = pdMS_TO_TICKS(period_ms);
+    if (!t || !t->handle || period == 0) return false;
+
+    // xTimerChangePeriod also starts a dormant timer
+    return xTimerChangePeriod(t->handle, period, portMAX_DELAY) == pdPASS;
+}
+
+bool bsp_timer_is_active(bsp_timer_handle_t timer) {
+    stm32_timer_t* t = (stm32_timer_t*)timer;
+    return t && t->handle && xTimerIsTimerActive(t->handle) != pdFALSE;
+}
+
+// =============================================================================
+// STORAGE (internal flash)
+// =============================================================================
+
+// The storage region is the flash area the linker script reserves at the end
+// of FLASH; bsp_storage addresses are offsets into it. Reads are plain memory
+// reads. Writes program whole doublewords (bytes outside the request are
+// left 0xFF), and the flash controller refuses any doubleword not erased.
+extern uint8_t _storage_start[];
+
+static bool storage_range_valid(uint32_t address, uint32_t length) {
+    return address <= CONFIG_STORAGE_TOTAL_SIZE &&
+           length <= CONFIG_STORAGE_TOTAL_SIZE - address;
+}
+
+int bsp_storage_read(const bsp_storage_operation_t* op) {
+    if (!op || (!op->data && op->length > 0)) return -1;
+    if (!storage_range_valid(op->address, op->length)) return -1;
+
+    memcpy(op->data, &_storage_start[op->address], op->length);
+    return 0;
+}
+
+int bsp_storage_write(const bsp_storage_operation_t* op) {
+    if (!op || (!op->data && op->length > 0)) return -1;
+    if (!storage_range_valid(op->address, op->length)) return -1;
+    if (op->length == 0) return 0;
+
+    HAL_StatusTypeDef status = HAL_OK;
+    uint32_t first = op->address & ~(uint32_t)(BSP_STORAGE_PROGRAM_UNIT - 1);
+    uint32_t end = op->address + op->length;
+
+    HAL_FLASH_Unlock();
+    for (uint32_t dw = first; dw < end && status == HAL_OK; dw += BSP_STORAGE_PROGRAM_UNIT) {
+        uint8_t bytes[BSP_STORAGE_PROGRAM_UNIT];
+        memset(bytes, 0xFF, sizeof(bytes));
+        for (uint32_t i = 0; i < BSP_STORAGE_PROGRAM_UNIT; i++) {
+            uint32_t address = dw + i;
+            if (address >= op->address && address < end) {
+                bytes[i] = op->data[address - op->address];
+            }
+        }
+
+        uint64_t value;
+        memcpy(&value, bytes, sizeof(value));
+        status = HAL_FLASH_Program(FLASH_TYPEPROGRAM_DOUBLEWORD,
+                                   (uint32_t)(uintptr_t)&_storage_start[dw], value);
+    }
+    HAL_FLASH_Lock();
+
+    return (status == HAL_OK) ? 0 : -1;
+}
+
+int bsp_storage_erase(uint32_t address, uint32_t length) {
+    if ((address % BSP_STORAGE_PAGE_SIZE) != 0 || (length % BSP_STORAGE_PAGE_SIZE) != 0) {
+        return -1;
+    }
+    if (!storage_range_valid(address, length)) return -1;
+    if (length == 0) return 0;
+
+    FLASH_EraseInitTypeDef erase = {
+        .TypeErase = FLASH_TYPEERASE_PAGES,
+        .Banks = FLASH_BANK_1,
+        .Page = ((uint32_t)(uintptr_t)&_storage_start[address] - FLASH_BASE) / FLASH_PAGE_SIZE,
+        .NbPages = length / FLASH_PAGE_SIZE
+    };
+    uint32_t page_error = 0;
+
+    HAL_FLASH_Unlock();
+    HAL_StatusTypeDef status = HAL_FLASHEx_Erase(&erase, &page_error);
+    HAL_FLASH_Lock();
+
+    return (status == HAL_OK) ? 0 : -1;
+}
+
+// =============================================================================
+// CRC UNIT
+// =============================================================================
+
+// MX_CRC_Init leaves the unit on the default CRC-32 polynomial; each call
+// reprograms polynomial, size and initial value. Words are byte-swapped on
+// the way in so the unit sees bytes in memory order, as the byte-wise
+// software CRC does. Long buffers are fed a byte at a time by a
+// memory-to-memory DMA channel while the caller blocks on its completion
+// interrupt, with insomnia held since STOP2 would halt the transfer. Tasks
+// share the unit under a mutex.
+#define BSP_CRC_DMA_MIN_LENGTH  256
+#define BSP_CRC_DMA_TIMEOUT_MS  10
+
+static DMA_HandleTypeDef hdma_crc;
+static StaticSemaphore_t crc_mutex_buffer;
+static StaticSemaphore_t crc_done_buffer;
+static SemaphoreHandle_t crc_mutex;
+static SemaphoreHandle_t crc_done;
+static bool crc_dma_ready;
+
+static void crc_dma_complete(DMA_HandleTypeDef* hdma) {
+    (void)hdma;
+    BaseType_t higher_priority_task_woken = pdFALSE;
+    xSemaphoreGiveFromISR(crc_done, &higher_priority_task_woken);
+    portYIELD_FROM_ISR(higher_priority_task_woken);
+}
+
+void bsp_crc_dma_irq_handler(void) {
+    HAL_DMA_IRQHandler(&hdma_crc);
+}
+
+static void crc_init_once(void) {
+    taskENTER_CRITICAL();
+    if (!crc_mutex) {
+        crc_done = xSemaphoreCreateBinaryStatic(&crc_done_buffer);
+        crc_mutex = xSemaphoreCreateMutexStatic(&crc_mutex_buffer);
+
+        hdma_crc.Instance = DMA1_Channel2;
+        hdma_crc.Init.Request = DMA_REQUEST_0;
+        hdma_crc.Init.Direction = DMA_MEMORY_TO_MEMORY;
+        hdma_crc.Init.PeriphInc = DMA_PINC_ENABLE;      // Source: the buffer
+        hdma_crc.Init.MemInc = DMA_MINC_DISABLE;        // Destination: CRC->DR
+        hdma_crc.Init.PeriphDataAlignment = DMA_PDATAALIGN_BYTE;
+        hdma_crc.Init.MemDataAlignment = DMA_MDATAALIGN_BYTE;
+        hdma_crc.Init.Mode = DMA_NORMAL;
+        hdma_crc.Init.Priority = DMA_PRIORITY_LOW;
+        if (HAL_DMA_Init(&hdma_crc) == HAL_OK) {
+            hdma_crc.XferCpltCallback = crc_dma_complete;
+            hdma_crc.XferErrorCallback = crc_dma_complete;
+            HAL_NVIC_SetPriority(DMA1_Channel2_IRQn, 5, 0);
+            HAL_NVIC_EnableIRQ(DMA1_Channel2_IRQn);
+            crc_dma_ready = true;
+        }
+    }
+    taskEXIT_CRITICAL();
+}
+
+static void crc_start(bsp_crc_type_t type, uint32_t crc) {
+    if (type == BSP_CRC_16_CCITT) {
+        CRC->POL = 0x1021u;
+        MODIFY_REG(CRC->CR, CRC_CR_POLYSIZE | CRC_CR_REV_IN | CRC_CR_REV_OUT, CRC_CR_POLYSIZE_0);
+    } else {
+        CRC->POL = 0x04C11DB7u;
+        MODIFY_REG(CRC->CR, CRC_CR_POLYSIZE | CRC_CR_REV_IN | CRC_CR_REV_OUT, 0);
+    }
+    CRC->INIT = crc;
+    CRC->CR |= CRC_CR_RESET;
+}
+
+static void crc_feed_cpu(const uint8_t* data, size_t length) {
+    while (length >= 4) {
+        uint32_t word;
+        memcpy(&word, data, sizeof(word));
+        CRC->DR = __REV(word);
+        data += 4;
+        length -= 4;
+    }
+    while (length-- > 0) {
+        *(__IO uint8_t*)&CRC->DR = *data++;
+    }
+}
+
+static bool crc_feed_dma(const uint8_t* data, size_t length) {
+    if (!crc_dma_ready || length > 0xFFFFu) return false;   // CNDTR is 16 bits
+
+    bool done = false;
+    xSemaphoreTake(crc_done, 0);
+    bsp_power_suppress_sleep();
+    if (HAL_DMA_Start_IT(&hdma_crc, (uint32_t)(uintptr_t)data,
+                         (uint32_t)(uintptr_t)&CRC->DR, (uint32_t)length) == HAL_OK) {
+        done = xSemaphoreTake(crc_done, pdMS_TO_TICKS(BSP_CRC_DMA_TIMEOUT_MS)) == pdTRUE &&
+               hdma_crc.ErrorCode == HAL_DMA_ERROR_NONE;
+        if (!done) {
+            HAL_DMA_Abort(&hdma_crc);
+        }
+    }
+    bsp_power_allow_sleep();
+    return done;
+}
+
+uint32_t bsp_crc_update(bsp_crc_type_t type, uint32_t crc, const uint8_t* data, size_t length) {
+    if (!data) return crc;
+
+    bool scheduler_running = xTaskGetSchedulerState() == taskSCHEDULER_RUNNING;
+    crc_init_once();
+    if (scheduler_running) {
+        xSemaphoreTake(crc_mutex, portMAX_DELAY);
+    }
+
+    crc_start(type, crc);
+    if (!scheduler_running || length < BSP_CRC_DMA_MIN_LENGTH || !crc_feed_dma(data, length)) {
+        // Also the fallback after a failed transfer, from the top
+        crc_start(type, crc);
+        crc_feed_cpu(data, length);
+    }
+    uint32_t result = CRC->DR;
+    if (type == BSP_CRC_16_CCITT) {
+        result &= 0xFFFFu;
+    }
+
+    if (scheduler_running) {
+        xSemaphoreGive(crc_mutex);
+    }
+    return result;
+}
+
+// =============================================================================
+// INPUT (push buttons on EXTI)
+// =============================================================================
+
+// MX_GPIO_Init puts the six buttons on rising-edge EXTI lines, which also
+// wake the core from STOP2. HAL_GPIO_EXTI_Callback queues one event per
+// press and notifies the task given to bsp_input_set_notify(), so the reader
+// sleeps until there is input. Edges within BSP_INPUT_DEBOUNCE_MS of the
+// last press of the same button are contact bounce and dropped; there is no
+// release edge, so only presses are reported.
+#define BSP_INPUT_QUEUE_LENGTH  8
+#define BSP_INPUT_DEBOUNCE_MS   30
+
+static const struct {
+    uint16_t pin;
+    bsp_button_id_t button;
+} input_pins[] = {
+    { PUSH_UP_Pin, BSP_BUTTON_UP },
+    { PUSH_DOWN_Pin, BSP_BUTTON_DOWN },
+    { PUSH_LEFT_Pin, BSP_BUTTON_LEFT },
+    { PUSH_RIGHT_Pin, BSP_BUTTON_RIGHT },
+    { PUSH_A_Pin, BSP_BUTTON_A },
+    { PUSH_B_Pin, BSP_BUTTON_B },
+};
+
+// Single producer (the EXTI interrupts) and single consumer (the reader)
+static bsp_button_event_t input_queue[BSP_INPUT_QUEUE_LENGTH];
+static volatile uint32_t input_head;
+static volatile uint32_t input_tail;
+static uint32_t input_last_press_ms[BSP_BUTTON_COUNT];
+static bsp_task_handle_t input_task;
+static uint32_t input_notify_bits;
+
+int bsp_input_init(void) {
+    taskENTER_CRITICAL();
+    input_head = 0;
+    input_tail = 0;
+    memset(input_last_press_ms, 0, sizeof(input_last_press_ms));
+    taskEXIT_CRITICAL();
+    return 0;
+}
+
+void bsp_input_cleanup(void) {
+    bsp_input_set_notify(NULL, 0);
+}
+
+void bsp_input_set_notify(bsp_task_handle_t task, uint32_t notify_bits) {
+    taskENTER_CRITICAL();
+    input_task = task;
+    input_notify_bits = notify_bits;
+    taskEXIT_CRITICAL();
+}
+
+bool bsp_input_poll_event(bsp_button_event_t* event) {
+    if (!event || input_tail == input_head) return false;
+
+    *event = input_queue[input_tail % BSP_INPUT_QUEUE_LENGTH];
+    input_tail = input_tail + 1;
+    return true;
+}
+
+// HAL weak callback, from the EXTI line interrupts
+void HAL_GPIO_EXTI_Callback(uint16_t pin) {
+    uint32_t now_ms = xTaskGetTickCountFromISR() * portTICK_PERIOD_MS;
+    for (uint32_t i = 0; i < sizeof(input_pins) / sizeof(input_pins[0]); i++) {
+        if (input_pins[i].pin != pin) continue;
+
+        bsp_button_id_t button = input_pins[i].button;
+        if (now_ms - input_last_press_ms[button] < BSP_INPUT_DEBOUNCE_MS) return;
+        input_last_press_ms[button] = now_ms;
+        if (input_head - input_tail >= BSP_INPUT_QUEUE_LENGTH) return;     // Full: drop
+
+        bsp_button_event_t* event = &input_queue[input_head % BSP_INPUT_QUEUE_LENGTH];
+        event->button = button;
+        event->pressed = true;
+        event->timestamp = now_ms;
+        input_head = input_head + 1;
+        if (input_task) {
+            bsp_task_notify_from_isr(input_task, input_notify_bits);
+        }
+        return;
+    }
+}
+
+// =============================================================================
+// SENSORS (ADC1 + DMA1 channel 1)
+// =============================================================================
+
+// MX_ADC1_Init sets up a continuous scan of BAT_REF (IN15) and VREFINT into a
+// circular DMA buffer but never starts it. bsp_sensors_start() reprograms
+// it: the die temperature sensor becomes a third rank, the clock drops to
+// SYSCLK/16 with the longest sampling time, and 64x hardware oversampling
+// (shifted to 16-bit results) means one scan takes about 25 ms with no CPU
+// work. The ADC and DMA halt in STOP2, so rather than scan continuously the
+// ADC takes one burst of BSP_ADC_BLOCK_SCANS scans every
+// CONFIG_SENSOR_BURST_PERIOD_MS, started from a timer. A burst holds
+// insomnia for its ~100 ms; the transfer-complete interrupt stops the ADC,
+// hands the block to the pipeline and lets the device back into STOP2, and
+// only the pipeline's decision wakes a task.
+#define BSP_ADC_CHANNELS        3               // Battery, VREFINT, temperature
+#define BSP_ADC_BLOCK_SCANS     4               // Scans per burst
+#define BSP_ADC_FULL_SCALE      (4095u * 16u)   // Oversampled 12-bit reading
+#define BSP_BATTERY_DIVIDER     2               // BAT_REF sees half the cell voltage
+
+static uint16_t adc_buffer[BSP_ADC_BLOCK_SCANS * BSP_ADC_CHANNELS];
+static SensorPipeline_t sensor_pipeline;
+static bsp_task_handle_t sensor_task;
+static uint32_t sensor_notify_bits;
+static bsp_timer_handle_t adc_burst_timer;
+static bool sensors_running;
+static volatile bool adc_burst_running;
+
+static int adc_configure(void) {
+    hadc1.Init.ClockPrescaler = ADC_CLOCK_ASYNC_DIV16;
+    hadc1.Init.NbrOfConversion = BSP_ADC_CHANNELS;
+    hadc1.Init.ContinuousConvMode = ENABLE;
+    hadc1.Init.ExternalTrigConv = ADC_SOFTWARE_START;
+    hadc1.Init.OversamplingMode = ENABLE;
+    hadc1.Init.Oversampling.Ratio = ADC_OVERSAMPLING_RATIO_64;
+    hadc1.Init.Oversampling.RightBitShift = ADC_RIGHTBITSHIFT_2;
+    hadc1.Init.Oversampling.TriggeredMode = ADC_TRIGGEREDMODE_SINGLE_TRIGGER;
+    hadc1.Init.Oversampling.OversamplingStopReset = ADC_REGOVERSAMPLING_CONTINUED_MODE;
+    if (HAL_ADC_Init(&hadc1) != HAL_OK) return -1;
+
+    static const uint32_t channels[BSP_ADC_CHANNELS] = {
+        ADC_CHANNEL_15, ADC_CHANNEL_VREFINT, ADC_CHANNEL_TEMPSENSOR
+    };
+    static const uint32_t ranks[BSP_ADC_CHANNELS] = {
+        ADC_REGULAR_RANK_1, ADC_REGULAR_RANK_2, ADC_REGULAR_RANK_3
+    };
+    ADC_ChannelConfTypeDef config = {0};
+    config.SamplingTime = ADC_SAMPLETIME_640CYCLES_5;   // Temperature sensor needs 5 us
+    config.SingleDiff = ADC_SINGLE_ENDED;
+    config.OffsetNumber = ADC_OFFSET_NONE;
+    for (uint32_t i = 0; i < BSP_ADC_CHANNELS; i++) {
+        config.Channel = channels[i];
+        config.Rank = ranks[i];
+        if (HAL_ADC_ConfigChannel(&hadc1, &config) != HAL_OK) return -1;
+    }
+    return (HAL_ADCEx_Calibration_Start(&hadc1, ADC_SINGLE_ENDED) == HAL_OK) ? 0 : -1;
+}
+
+// Averages one block and converts it with the factory calibration, which was
+// taken at VDDA = 3.0 V: VREFINT gives the actual VDDA, which then scales the
+// battery and temperature readings
+static void adc_process_block(const uint16_t* block) {
+    uint32_t sums[BSP_ADC_CHANNELS] = { 0, 0, 0 };
+    for (uint32_t scan = 0; scan < BSP_ADC_BLOCK_SCANS; scan++) {
+        for (uint32_t channel = 0; channel < BSP_ADC_CHANNELS; channel++) {
+            sums[channel] += block[scan * BSP_ADC_CHANNELS + channel];
+        }
+    }
+    uint32_t battery = sums[0] / BSP_ADC_BLOCK_SCANS;
+    uint32_t vrefint = sums[1] / BSP_ADC_BLOCK_SCANS;
+    uint32_t temperature = sums[2] / BSP_ADC_BLOCK_SCANS;
+    if (vrefint == 0) return;
+
+    uint32_t vdda_mv = VREFINT_CAL_VREF * (uint32_t)*VREFINT_CAL_ADDR * 16u / vrefint;
+    int32_t ts = (int32_t)(temperature * vdda_mv / VREFINT_CAL_VREF);
+    int32_t ts_cal1 = (int32_t)*TEMPSENSOR_CAL1_ADDR * 16;
+    int32_t ts_cal2 = (int32_t)*TEMPSENSOR_CAL2_ADDR * 16;
+
+    SensorBlock_t sample;
+    sample.battery_mv = (int32_t)(battery * vdda_mv / BSP_ADC_FULL_SCALE) * BSP_BATTERY_DIVIDER;
+    sample.temperature_cdeg = (ts - ts_cal1) * (TEMPSENSOR_CAL2_TEMP - TEMPSENSOR_CAL1_TEMP) * 100 /
+                              (ts_cal2 - ts_cal1) + TEMPSENSOR_CAL1_TEMP * 100;
+
+    uint32_t now_ms = xTaskGetTickCountFromISR() * portTICK_PERIOD_MS;
+    if (sensor_pipeline_process(&sensor_pipeline, &sample, now_ms) && sensor_notify_bits) {
+        bsp_task_notify_from_isr(sensor_task, sensor_notify_bits);
+    }
+}
+
+// HAL weak callback, from DMA1_Channel1_IRQHandler. The DMA is circular, so
+// the ADC is stopped before its next scan can overwrite the block.
+void HAL_ADC_ConvCpltCallback(ADC_HandleTypeDef* hadc) {
+    if (hadc != &hadc1 || !adc_burst_running) return;  // Cancelled by bsp_sensors_stop()
+
+    adc_burst_running = false;
+    HAL_ADC_Stop_DMA(&hadc1);
+    adc_process_block(adc_buffer);
+    bsp_power_allow_sleep();
+}
+
+// Timer task. The scheduler is held so that bsp_sensors_stop() cannot run
+// between starting the ADC and recording the burst.
+static void adc_burst_start(bsp_timer_handle_t timer, void* context) {
+    (void)timer; (void)context;
+
+    vTaskSuspendAll();
+    if (sensors_running && !adc_burst_running) {
+        bsp_power_suppress_sleep();
+        if (HAL_ADC_Start_DMA(&hadc1, (uint32_t*)adc_buffer,
+                              sizeof(adc_buffer) / sizeof(adc_buffer[0])) == HAL_OK) {
+            adc_burst_running = true;
+        } else {
+            bsp_power_allow_sleep();
+        }
+    }
+    xTaskResumeAll();
+}
+
+int bsp_sensors_start(bsp_task_handle_t task, uint32_t notify_bits, uint32_t snapshot_period_ms) {
+    if (notify_bits && !task) return -1;
+
+    taskENTER_CRITICAL();
+    sensor_task = task;
+    sensor_notify_bits = notify_bits;
+    taskEXIT_CRITICAL();
+    if (sensors_running) {
+        return 0;
+    }
+
+    if (!adc_burst_timer) {
+        adc_burst_timer = bsp_timer_create("ADC_Burst", CONFIG_SENSOR_BURST_PERIOD_MS, true,
+                                           adc_burst_start, NULL);
+    }
+    sensor_pipeline_init(&sensor_pipeline, snapshot_period_ms);
+    if (!adc_burst_timer || adc_configure() != 0 || !bsp_timer_start(adc_burst_timer)) {
+        return -1;
+    }
+    sensors_running = true;
+    adc_burst_start(NULL, NULL);    // First reading now rather than a period from now
+    return 0;
+}
+
+void bsp_sensors_stop(void) {
+    if (!sensors_running) return;
+
+    bsp_timer_stop(adc_burst_timer);
+    taskENTER_CRITICAL();
+    sensors_running = false;
+    bool burst = adc_burst_running;
+    adc_burst_running = false;
+    taskEXIT_CRITICAL();
+    if (burst) {
+        HAL_ADC_Stop_DMA(&hadc1);
+        bsp_power_allow_sleep();
+    }
+}
+
+int bsp_sensors_read(bsp_sensor_readings_t* readings) {
+    if (!readings || !sensors_running) return -1;
+
+    taskENTER_CRITICAL();
+    bool primed = sensor_pipeline.primed;
+    SensorPipelineOutput_t output = sensor_pipeline.output;
+    taskEXIT_CRITICAL();
+    if (!primed) return -1;     // First block not in yet
+
+    readings->battery_voltage = output.battery_mv / 1000.0f;
+    readings->battery_percentage = output.battery_percentage;
+    readings->temperature_celsius = output.temperature_cdeg / 100.0f;
+
+    // This board revision routes no door, latch or charge-status inputs;
+    // report the resting state
+    readings->door_closed = true;
+    readings->latch_engaged = true;
+    readings->charging_active = false;
+    return 0;
+}
+
+// Nothing to arm on this board revision: with no door or latch inputs
+// routed, their levels never change. A revision that adds them puts them on
+// EXTI lines and notifies this task from HAL_GPIO_EXTI_Callback.
+static bsp_task_handle_t sensor_edge_task;
+static uint32_t sensor_edge_notify_bits;
+
+void bsp_sensors_set_edge_notify(bsp_task_handle_t task, uint32_t notify_bits) {
+    taskENTER_CRITICAL();
+    sensor_edge_task = task;
+    sensor_edge_notify_bits = notify_bits;
+    taskEXIT_CRITICAL();
+}
+
+void bsp_sensors_get_stats(bsp_sensor_stats_t* stats) {
+    if (!stats) return;
+
+    taskENTER_CRITICAL();
+    stats->blocks = sensor_pipeline.stats.blocks;
+    stats->wakeups = sensor_pipeline.stats.wakeups;
+    stats->threshold_wakeups = sensor_pipeline.stats.threshold_wakeups;
+    taskEXIT_CRITICAL();
+}
+
+// =============================================================================
+// MEMORY WIRE (TIM2 CH1 PWM)
+// =============================================================================
+
+// The wire driver gate is on PA15, TIM2_CH1 (AF1); CubeMX leaves the pin
+// analog and TIM2 as a bare time base, so both are set up here on first use.
+// TIM2 counts at 1 MHz (APB1 is undivided, see SystemClock_Config), with
+// BSP_WIRE_DUTY_MAX counts per period: the compare value is the duty.
+#define WIRE_TIMER_HZ   (BSP_WIRE_PWM_HZ * BSP_WIRE_DUTY_MAX)
+
+static bool wire_configured;
+static bool wire_running;
+
+static int wire_configure(void) {
+    GPIO_InitTypeDef gpio = {0};
+    gpio.Pin = GPIO_PIN_15;
+    gpio.Mode = GPIO_MODE_AF_PP;
+    gpio.Pull = GPIO_PULLDOWN;          // Wire off while the pin is not driven
+    gpio.Speed = GPIO_SPEED_FREQ_LOW;
+    gpio.Alternate = GPIO_AF1_TIM2;
+    HAL_GPIO_Init(GPIOA, &gpio);
+
+    htim2.Init.Prescaler = HAL_RCC_GetPCLK1Freq() / WIRE_TIMER_HZ - 1;
+    htim2.Init.Period = BSP_WIRE_DUTY_MAX - 1;
+    if (HAL_TIM_PWM_Init(&htim2) != HAL_OK) {
+        return -1;
+    }
+
+    TIM_OC_InitTypeDef oc = {0};
+    oc.OCMode = TIM_OCMODE_PWM1;
+    oc.Pulse = 0;
+    oc.OCPolarity = TIM_OCPOLARITY_HIGH;
+    oc.OCFastMode = TIM_OCFAST_DISABLE;
+    if (HAL_TIM_PWM_ConfigChannel(&htim2, &oc, TIM_CHANNEL_1) != HAL_OK) {
+        return -1;
+    }
+    wire_configured = true;
+    return 0;
+}
+
+int bsp_wire_set_duty(uint16_t duty_permille) {
+    if (duty_permille > BSP_WIRE_DUTY_MAX) return -1;
+    if (!wire_configured && wire_configure() != 0) return -1;
+
+    // The compare register is preloaded, so a change takes effect at the
+    // next period and never cuts one short
+    __HAL_TIM_SET_COMPARE(&htim2, TIM_CHANNEL_1, duty_permille);
+    if (duty_permille && !wire_running) {
+        if (HAL_TIM_PWM_Start(&htim2, TIM_CHANNEL_1) != HAL_OK) return -1;
+        wire_running = true;
+    } else if (!duty_permille && wire_running) {
+        HAL_TIM_PWM_Stop(&htim2, TIM_CHANNEL_1);
+        wire_running = false;
+    }
+    return 0;
+}
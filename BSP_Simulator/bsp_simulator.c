@@ -10,6 +10,7 @@
 #include <pthread.h>
 #include <unistd.h>
 #include "../App/BSP/bsp_api.h"
+#include "../App/Config/app_config.h"
 
 // =============================================================================
 // SIMULATOR STATE
@@ -37,11 +38,8 @@ typedef struct {
     bool door_closed;
     bool latch_engaged;
     
-    // Lock state simulation
-    bsp_lock_state_t lock_state;
-    bool memory_wire_heating;
-    uint32_t memory_wire_start_time;
-    uint16_t memory_wire_duration;
+    // Memory wire drive (no thermal model in this simulator)
+    uint16_t wire_duty_permille;
     
     // Power management
     bsp_power_mode_t power_mode;
@@ -217,7 +215,6 @@ int bsp_display_init(void) {
     g_sim_state.temperature_celsius = 23.5f;
     g_sim_state.door_closed = true;
     g_sim_state.latch_engaged = true;
-    g_sim_state.lock_state = BSP_LOCK_STATE_LOCKED;
     g_sim_state.power_mode = BSP_POWER_MODE_RUN;
     
     g_sim_state.initialized = true;
@@ -305,27 +302,27 @@ bool bsp_display_get_pixel(int x, int y) {
     return (g_sim_state.framebuffer[byte_index] & (1 << bit_index)) != 0;
 }
 
+void bsp_display_draw_char(int x, int y, char c) {
+    // Convert to font index (ASCII 32 = space)
+    int font_index = (c >= 32 && c <= 126) ? (c - 32) : 0;
+    
+    for (int col = 0; col < 6; col++) {
+        uint8_t column = font_6x8[font_index][col];
+        for (int row = 0; row < 8; row++) {
+            if (column & (1 << row)) {
+                bsp_display_set_pixel(x + col, y + row, true);
+            }
+        }
+    }
+}
+
 void bsp_display_draw_text(int x, int y, const char* text) {
     if (!text) return;
     
     int current_x = x;
     
     for (int i = 0; text[i] != '\0'; i++) {
-        char c = text[i];
-        
-        // Convert to font index (ASCII 32 = space)
-        int font_index = (c >= 32 && c <= 126) ? (c - 32) : 0;
-        
-        // Draw character
-        for (int col = 0; col < 6; col++) {
-            uint8_t column = font_6x8[font_index][col];
-            for (int row = 0; row < 8; row++) {
-                if (column & (1 << row)) {
-                    bsp_display_set_pixel(current_x + col, y + row, true);
-                }
-            }
-        }
-        
+        bsp_display_draw_char(current_x, y, text[i]);
         current_x += 7; // 6 pixels + 1 space
     }
 }
@@ -398,6 +395,12 @@ void bsp_input_cleanup(void) {
     // Nothing to cleanup for input
 }
 
+// SDL events are only read when bsp_input_poll_event() is called, so there is
+// nothing to notify from
+void bsp_input_set_notify(bsp_task_handle_t task, uint32_t notify_bits) {
+    (void)task; (void)notify_bits;
+}
+
 static void add_button_event(bsp_button_id_t button, bool pressed) {
     if (g_sim_state.event_queue_count >= 32) {
         return; // Queue full
@@ -465,6 +468,10 @@ uint32_t bsp_get_tick_ms(void) {
     return SDL_GetTicks();
 }
 
+uint64_t bsp_get_tick_ms64(void) {
+    return SDL_GetTicks64();
+}
+
 uint64_t bsp_get_utc_time_seconds(void) {
     return (uint64_t)time(NULL);
 }
@@ -528,6 +535,15 @@ void bsp_task_delay(uint32_t ms) {
     usleep(ms * 1000); // Convert to microseconds
 }
 
+void bsp_task_delay_until(uint64_t* last_wake_ms, uint32_t period_ms) {
+    if (!last_wake_ms) return;
+    *last_wake_ms += period_ms;
+    uint64_t now = bsp_get_tick_ms64();
+    if (*last_wake_ms > now) {
+        bsp_task_delay((uint32_t)(*last_wake_ms - now));
+    }
+}
+
 void bsp_task_yield(void) {
     usleep(1000); // 1ms yield
 }
@@ -633,6 +649,30 @@ bool bsp_queue_receive(bsp_queue_handle_t queue, void* item, uint32_t timeout_ms
     return true;
 }
 
+// Tasks run as threads here, so mutexes are real ones
+static pthread_mutex_t sim_mutexes[CONFIG_RTOS_MAX_MUTEXES];
+static int sim_mutex_count = 0;
+static pthread_mutex_t sim_mutex_table_lock = PTHREAD_MUTEX_INITIALIZER;
+
+bsp_mutex_handle_t bsp_mutex_create(void) {
+    pthread_mutex_t* mutex = NULL;
+    pthread_mutex_lock(&sim_mutex_table_lock);
+    if (sim_mutex_count < CONFIG_RTOS_MAX_MUTEXES) {
+        mutex = &sim_mutexes[sim_mutex_count++];
+        pthread_mutex_init(mutex, NULL);
+    }
+    pthread_mutex_unlock(&sim_mutex_table_lock);
+    return (bsp_mutex_handle_t)mutex;
+}
+
+void bsp_mutex_lock(bsp_mutex_handle_t mutex) {
+    if (mutex) pthread_mutex_lock((pthread_mutex_t*)mutex);
+}
+
+void bsp_mutex_unlock(bsp_mutex_handle_t mutex) {
+    if (mutex) pthread_mutex_unlock((pthread_mutex_t*)mutex);
+}
+
 // =============================================================================
 // HARDWARE SERVICES SIMULATION
 // =============================================================================
@@ -662,16 +702,12 @@ int bsp_sensors_read(bsp_sensor_readings_t* readings) {
     return 0;
 }
 
-int bsp_lock_unlock(void) {
-    g_sim_state.lock_state = BSP_LOCK_STATE_UNLOCKING;
-    printf("Simulator: Lock unlocking...\n");
+int bsp_wire_set_duty(uint16_t duty_permille) {
+    if (duty_permille > BSP_WIRE_DUTY_MAX) return -1;
+    g_sim_state.wire_duty_permille = duty_permille;
     return 0;
 }
 
-bsp_lock_state_t bsp_lock_get_state(void) {
-    return g_sim_state.lock_state;
-}
-
 int bsp_power_set_mode(bsp_power_mode_t mode) {
     g_sim_state.power_mode = mode;
     printf("Simulator: Power mode set to %d\n", mode);
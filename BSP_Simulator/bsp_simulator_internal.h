@@ -0,0 +1,35 @@
+// BSP Simulator - Internal Interfaces
+// Shared between the simulator BSP files only; not part of the BSP API
+
+#ifndef BSP_SIMULATOR_INTERNAL_H
+#define BSP_SIMULATOR_INTERNAL_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Per-device state owned by bsp_simulator_power.c, bsp_simulator_timer.c and
+// bsp_simulator_storage.c.
+// bsp_sim_instance_*() in bsp_simulator_simple.c lays these out in one device
+// block after the core state; bind(NULL) restores the process default.
+size_t sim_power_instance_size(void);
+void sim_power_instance_bind(void* state);
+
+size_t sim_timer_instance_size(void);
+void sim_timer_instance_bind(void* state);
+
+size_t sim_storage_instance_size(void);
+void sim_storage_instance_bind(void* state);
+void sim_storage_instance_release(void* state);    // Unmaps any backing file
+
+// Activity counted by the device models for the energy model in
+// bsp_simulator_power.c
+typedef struct {
+    uint64_t display_bytes;         // Sent to the display controller
+    uint64_t adc_ms;                // Background sampling, bsp_sensors_start()
+    uint64_t wire_on_us;            // Memory wire on-time at full current (duty x time)
+} sim_activity_counters_t;
+
+void sim_get_activity_counters(sim_activity_counters_t* counters);
+uint32_t sim_timer_get_expiry_count(void);          // Callbacks and notifications delivered
+
+#endif // BSP_SIMULATOR_INTERNAL_H
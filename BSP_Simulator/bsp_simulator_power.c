@@ -0,0 +1,257 @@
+// BSP Simulator - Power Model
+// Models the target's tickless idle: insomnia level, SLEEP vs STOP2 selection
+// and per-mode residency, so sleep behaviour can be measured off-target, and
+// integrates a current-draw model over it to estimate the charge a scenario
+// costs
+
+#include <stdio.h>
+#include <string.h>
+#include <SDL.h>
+#include "../App/BSP/bsp_api.h"
+#include "../App/Utils/sim_instance.h"
+#include "bsp_simulator_internal.h"
+
+// =============================================================================
+// SIMULATOR POWER STATE
+// =============================================================================
+
+typedef struct {
+    uint32_t insomnia_level;
+    bsp_power_residency_t residency;
+    uint64_t residency_start_ms;    // Tick at which residency was last reset
+
+    // Energy model, and every counter it integrates as of the last reset
+    bsp_sim_energy_model_t energy_model;
+    bool energy_model_set;          // Else the default model
+    uint32_t energy_start_ms;
+    bsp_power_residency_t energy_residency;
+    sim_activity_counters_t energy_activity;
+    uint32_t energy_expiries;
+    uint64_t energy_flash_busy_us;
+} simulator_power_state_t;
+
+SIM_INSTANCE_STATE(simulator_power_state_t, g_sim_power);
+#define g_sim_power SIM_INSTANCE(g_sim_power)
+
+size_t sim_power_instance_size(void) {
+    return sizeof(simulator_power_state_t);
+}
+
+void sim_power_instance_bind(void* state) {
+    SIM_INSTANCE_BIND(g_sim_power, state);
+}
+
+// =============================================================================
+// SLEEP SUPPRESSION
+// =============================================================================
+
+void bsp_power_suppress_sleep(void) {
+    g_sim_power.insomnia_level++;
+}
+
+void bsp_power_allow_sleep(void) {
+    if (g_sim_power.insomnia_level > 0) {
+        g_sim_power.insomnia_level--;
+    } else {
+        printf("Simulator: WARNING - allow_sleep without matching suppress_sleep\n");
+    }
+}
+
+uint32_t bsp_power_get_insomnia_level(void) {
+    return g_sim_power.insomnia_level;
+}
+
+// =============================================================================
+// RESIDENCY ACCOUNTING
+// =============================================================================
+
+void bsp_power_get_residency(bsp_power_residency_t* residency) {
+    if (!residency) return;
+
+    *residency = g_sim_power.residency;
+
+    // RUN time is whatever was not spent idle since the last reset
+    uint64_t total_ms = bsp_get_tick_ms64() - g_sim_power.residency_start_ms;
+    uint64_t idle_ms = residency->sleep_ms + residency->stop2_ms;
+    residency->run_ms = (total_ms > idle_ms) ? (total_ms - idle_ms) : 0;
+}
+
+void bsp_power_reset_residency(void) {
+    memset(&g_sim_power.residency, 0, sizeof(g_sim_power.residency));
+    g_sim_power.residency_start_ms = bsp_get_tick_ms64();
+}
+
+// =============================================================================
+// TICKLESS IDLE MODEL
+// =============================================================================
+
+void bsp_sim_idle(uint32_t expected_idle_ms) {
+    if (expected_idle_ms == 0) return;
+
+    // Same decision as the target idle hook
+    bool deep = (g_sim_power.insomnia_level == 0) &&
+                (expected_idle_ms >= BSP_POWER_STOP2_MIN_IDLE_MS);
+
+    // Pending input wakes the MCU early, like an EXTI line on target. In
+    // fast-forward the virtual clock jumps straight to the deadline.
+    uint64_t start = bsp_get_tick_ms64();
+    if (bsp_sim_clock_is_fast_forward()) {
+        bsp_sim_clock_advance(expected_idle_ms);
+    } else {
+        SDL_WaitEventTimeout(NULL, (int)expected_idle_ms);
+    }
+    uint64_t slept = bsp_get_tick_ms64() - start;
+
+    if (deep) {
+        g_sim_power.residency.stop2_ms += slept;
+        g_sim_power.residency.stop2_entries++;
+    } else {
+        g_sim_power.residency.sleep_ms += slept;
+        g_sim_power.residency.sleep_entries++;
+    }
+}
+
+void bsp_debug_print_power_residency(void) {
+    bsp_power_residency_t r;
+    bsp_power_get_residency(&r);
+
+    uint64_t total = r.run_ms + r.sleep_ms + r.stop2_ms;
+    if (total == 0) total = 1;
+
+    printf("\n=== POWER RESIDENCY ===\n");
+    printf("RUN:   %8llu ms (%5.1f%%)\n",
+           (unsigned long long)r.run_ms, 100.0 * r.run_ms / total);
+    printf("SLEEP: %8llu ms (%5.1f%%) in %lu entries\n",
+           (unsigned long long)r.sleep_ms, 100.0 * r.sleep_ms / total,
+           (unsigned long)r.sleep_entries);
+    printf("STOP2: %8llu ms (%5.1f%%) in %lu entries\n",
+           (unsigned long long)r.stop2_ms, 100.0 * r.stop2_ms / total,
+           (unsigned long)r.stop2_entries);
+    printf("Insomnia level: %lu\n", (unsigned long)g_sim_power.insomnia_level);
+    printf("=== END POWER RESIDENCY ===\n\n");
+}
+
+// =============================================================================
+// ENERGY MODEL
+// =============================================================================
+
+// Typical STM32L452 figures at 3.3 V (datasheet), an ST7565-class display
+// controller on SPI and a 0.15 mm Flexinol memory wire
+static const bsp_sim_energy_model_t default_energy_model = {
+    .mcu_run_ua = 6700.0f,          // ~84 uA/MHz at 80 MHz
+    .mcu_sleep_ua = 1800.0f,
+    .mcu_stop2_ua = 2.8f,
+    .task_run_us = 200,
+    .display_spi_ua = 1000.0f,
+    .display_spi_khz = 8000,
+    .adc_ua = 300.0f,
+    .memory_wire_ua = 400000.0f,
+    .flash_ua = 7000.0f,
+};
+
+// Growth of a counter since the reset; a counter that was reset on its own
+// since then has only its new count to give
+static uint64_t counter_delta(uint64_t now, uint64_t base) {
+    return (now >= base) ? (now - base) : now;
+}
+
+static const bsp_sim_energy_model_t* energy_model(void) {
+    return g_sim_power.energy_model_set ? &g_sim_power.energy_model : &default_energy_model;
+}
+
+void bsp_sim_energy_get_default_model(bsp_sim_energy_model_t* model) {
+    if (model) *model = default_energy_model;
+}
+
+void bsp_sim_energy_set_model(const bsp_sim_energy_model_t* model) {
+    g_sim_power.energy_model_set = (model != NULL);
+    if (model) g_sim_power.energy_model = *model;
+}
+
+void bsp_sim_energy_reset(void) {
+    bsp_sim_storage_stats_t storage;
+    bsp_sim_storage_get_stats(&storage);
+
+    g_sim_power.energy_start_ms = bsp_get_tick_ms();
+    bsp_power_get_residency(&g_sim_power.energy_residency);
+    sim_get_activity_counters(&g_sim_power.energy_activity);
+    g_sim_power.energy_expiries = sim_timer_get_expiry_count();
+    g_sim_power.energy_flash_busy_us = storage.busy_us;
+}
+
+void bsp_sim_energy_get_report(bsp_sim_energy_report_t* report) {
+    if (!report) return;
+    memset(report, 0, sizeof(*report));
+
+    const bsp_sim_energy_model_t* model = energy_model();
+    bsp_power_residency_t residency;
+    sim_activity_counters_t activity;
+    bsp_sim_storage_stats_t storage;
+    bsp_power_get_residency(&residency);
+    sim_get_activity_counters(&activity);
+    bsp_sim_storage_get_stats(&storage);
+
+    const bsp_power_residency_t* base = &g_sim_power.energy_residency;
+    const sim_activity_counters_t* base_activity = &g_sim_power.energy_activity;
+    uint64_t activations = counter_delta(sim_timer_get_expiry_count(), g_sim_power.energy_expiries);
+    uint64_t display_bytes = counter_delta(activity.display_bytes, base_activity->display_bytes);
+    uint64_t wire_on_us = counter_delta(activity.wire_on_us, base_activity->wire_on_us);
+
+    // Charge in microamp-milliseconds first
+    double charge[BSP_SIM_ENERGY_COUNT];
+    charge[BSP_SIM_ENERGY_MCU_RUN] = model->mcu_run_ua *
+        ((double)counter_delta(residency.run_ms, base->run_ms) +
+         (double)activations * model->task_run_us / 1000.0);
+    charge[BSP_SIM_ENERGY_MCU_SLEEP] = model->mcu_sleep_ua *
+        (double)counter_delta(residency.sleep_ms, base->sleep_ms);
+    charge[BSP_SIM_ENERGY_MCU_STOP2] = model->mcu_stop2_ua *
+        (double)counter_delta(residency.stop2_ms, base->stop2_ms);
+    charge[BSP_SIM_ENERGY_DISPLAY_SPI] = model->display_spi_ua *
+        (model->display_spi_khz ? (double)display_bytes * 8.0 / model->display_spi_khz : 0.0);
+    charge[BSP_SIM_ENERGY_ADC] = model->adc_ua *
+        (double)counter_delta(activity.adc_ms, base_activity->adc_ms);
+    charge[BSP_SIM_ENERGY_MEMORY_WIRE] = model->memory_wire_ua * (double)wire_on_us / 1000.0;
+    charge[BSP_SIM_ENERGY_FLASH] = model->flash_ua *
+        (double)counter_delta(storage.busy_us, g_sim_power.energy_flash_busy_us) / 1000.0;
+
+    report->elapsed_ms = bsp_get_tick_ms() - g_sim_power.energy_start_ms;
+    double total = 0.0;
+    for (int i = 0; i < BSP_SIM_ENERGY_COUNT; i++) {
+        report->charge_mah[i] = charge[i] / 3.6e9;      // uA*ms -> mAh
+        total += charge[i];
+    }
+    report->total_mah = total / 3.6e9;
+    report->average_ua = report->elapsed_ms ? total / report->elapsed_ms : 0.0;
+}
+
+const char* bsp_sim_energy_subsystem_name(bsp_sim_energy_subsystem_t subsystem) {
+    static const char* const names[BSP_SIM_ENERGY_COUNT] = {
+        [BSP_SIM_ENERGY_MCU_RUN]        = "MCU run",
+        [BSP_SIM_ENERGY_MCU_SLEEP]      = "MCU sleep",
+        [BSP_SIM_ENERGY_MCU_STOP2]      = "MCU stop2",
+        [BSP_SIM_ENERGY_DISPLAY_SPI]    = "Display SPI",
+        [BSP_SIM_ENERGY_ADC]            = "ADC sampling",
+        [BSP_SIM_ENERGY_MEMORY_WIRE]    = "Memory wire",
+        [BSP_SIM_ENERGY_FLASH]          = "Flash",
+    };
+    return (subsystem < BSP_SIM_ENERGY_COUNT) ? names[subsystem] : "Unknown";
+}
+
+void bsp_debug_print_energy_report(const char* scenario) {
+    bsp_sim_energy_report_t r;
+    bsp_sim_energy_get_report(&r);
+
+    double total = (r.total_mah > 0.0) ? r.total_mah : 1.0;
+    double hours = r.elapsed_ms / 3.6e6;
+
+    printf("\n=== ENERGY: %s ===\n", scenario ? scenario : "scenario");
+    printf("Elapsed: %lu ms (%.2f h)\n", (unsigned long)r.elapsed_ms, hours);
+    for (int i = 0; i < BSP_SIM_ENERGY_COUNT; i++) {
+        printf("%-13s %11.5f mAh (%5.1f%%) avg %10.2f uA\n",
+               bsp_sim_energy_subsystem_name((bsp_sim_energy_subsystem_t)i),
+               r.charge_mah[i], 100.0 * r.charge_mah[i] / total,
+               r.elapsed_ms ? r.charge_mah[i] * 3.6e9 / r.elapsed_ms : 0.0);
+    }
+    printf("%-13s %11.5f mAh          avg %10.2f uA\n", "Total", r.total_mah, r.average_ua);
+    printf("=== END ENERGY ===\n\n");
+}
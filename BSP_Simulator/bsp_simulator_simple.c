@@ -9,11 +9,29 @@
 #include <time.h>
 #include <unistd.h>
 #include "../App/BSP/bsp_api.h"
+#include "../App/Config/app_config.h"
+#include "../App/Utils/sim_instance.h"
+#include "../App/Utils/sensor_pipeline.h"
+#include "bsp_simulator_internal.h"
 
 // =============================================================================
 // SIMULATOR STATE
 // =============================================================================
 
+typedef struct {
+    bool in_use;
+    uint8_t* buffer;
+    uint16_t capacity;              // Bytes reserved for this slot in the arena
+    uint8_t item_size;
+    uint8_t length;
+    uint8_t head, tail, count;
+} simple_queue_t;
+
+typedef struct {
+    bool in_use;
+    bool locked;
+} simple_mutex_t;
+
 typedef struct {
     // SDL components
     SDL_Window* window;
@@ -31,17 +49,55 @@ typedef struct {
     bool door_closed;
     bool latch_engaged;
     
-    // Lock state simulation
-    bsp_lock_state_t lock_state;
+    // ADC/DMA sampling model, see bsp_sensors_start()
+    SensorPipeline_t sensor_pipeline;
+    bsp_timer_handle_t sensor_timer;    // Starts a burst every period
+    bsp_timer_handle_t sensor_burst_timer;  // One-shot, the burst's DMA transfer
+    bool sensor_burst_running;
+    bsp_task_handle_t sensor_task;
+    uint32_t sensor_notify_bits;
+    uint32_t sensor_noise;              // Noise generator state
+    uint32_t sensor_burst_started_ms;
+    
+    // Memory wire and latch, see sim_wire_advance()
+    float wire_temperature_c;
+    uint16_t wire_duty_permille;
+    uint32_t wire_updated_ms;
+    float wire_heat_scale;              // Debug "wire_heat"
+    bool door_blocked;                  // Debug "door_blocked"
+    uint32_t latch_released_ms;
+    bsp_task_handle_t edge_task;        // See bsp_sensors_set_edge_notify()
+    uint32_t edge_notify_bits;
+    
+    // Activity for the energy model (ADC time covers finished bursts only)
+    sim_activity_counters_t activity;
     
     // Power management
     bsp_power_mode_t power_mode;
     
+    // Virtual clock
+    uint64_t clock_ms;              // Virtual time at clock_anchor_ms
+    uint32_t clock_anchor_ms;       // Host tick the virtual clock last synced to
+    uint64_t clock_utc_base;        // Host UTC when the clock started
+    bool clock_started;
+    bool clock_fast_forward;
+    
+    // Task notifications (every simulated task shares the main thread)
+    uint32_t notify_value;
+    
+    // Static queue tables
+    simple_queue_t queues[CONFIG_RTOS_MAX_QUEUES];
+    uint8_t queue_arena[CONFIG_RTOS_QUEUE_ARENA_SIZE];
+    size_t queue_arena_used;
+    simple_mutex_t mutexes[CONFIG_RTOS_MAX_MUTEXES];
+    
     // Initialization state
     bool initialized;
 } simulator_state_t;
 
-static simulator_state_t g_sim_state = {0};
+// One copy per simulated device, see bsp_sim_instance_bind()
+SIM_INSTANCE_STATE(simulator_state_t, g_sim_state);
+#define g_sim_state SIM_INSTANCE(g_sim_state)
 
 // Complete 6x8 font for text rendering - includes all printable ASCII characters
 static const uint8_t font_6x8[][6] = {
@@ -142,6 +198,20 @@ static const uint8_t font_6x8[][6] = {
     {0x10, 0x08, 0x08, 0x10, 0x08, 0x00}, // ~ (126)
 };
 
+// Simulated hardware state at power-up
+static void sim_hardware_defaults(void) {
+    g_sim_state.battery_percentage = 85.0f;
+    g_sim_state.battery_voltage = 3.7f;
+    g_sim_state.charging_active = false;
+    g_sim_state.temperature_celsius = 23.5f;
+    g_sim_state.door_closed = true;
+    g_sim_state.latch_engaged = true;
+    g_sim_state.sensor_noise = 1;
+    g_sim_state.wire_temperature_c = g_sim_state.temperature_celsius;
+    g_sim_state.wire_heat_scale = 1.0f;
+    g_sim_state.power_mode = BSP_POWER_MODE_RUN;
+}
+
 // =============================================================================
 // DISPLAY IMPLEMENTATION
 // =============================================================================
@@ -196,15 +266,7 @@ int bsp_display_init(void) {
     // Initialize framebuffer
     memset(g_sim_state.framebuffer, 0, sizeof(g_sim_state.framebuffer));
     
-    // Initialize simulated hardware state
-    g_sim_state.battery_percentage = 85.0f;
-    g_sim_state.battery_voltage = 3.7f;
-    g_sim_state.charging_active = false;
-    g_sim_state.temperature_celsius = 23.5f;
-    g_sim_state.door_closed = true;
-    g_sim_state.latch_engaged = true;
-    g_sim_state.lock_state = BSP_LOCK_STATE_LOCKED;
-    g_sim_state.power_mode = BSP_POWER_MODE_RUN;
+    sim_hardware_defaults();
     
     g_sim_state.initialized = true;
     printf("BSP Display initialized successfully\n");
@@ -238,6 +300,9 @@ void bsp_display_clear(void) {
 }
 
 void bsp_display_refresh(void) {
+    // The whole framebuffer goes to the controller each frame, rendered or not
+    g_sim_state.activity.display_bytes += sizeof(g_sim_state.framebuffer);
+    
     if (!g_sim_state.renderer || !g_sim_state.display_texture) {
         return;
     }
@@ -291,27 +356,27 @@ bool bsp_display_get_pixel(int x, int y) {
     return (g_sim_state.framebuffer[byte_index] & (1 << bit_index)) != 0;
 }
 
+void bsp_display_draw_char(int x, int y, char c) {
+    // Convert to font index (ASCII 32 = space)
+    int font_index = (c >= 32 && c <= 126) ? (c - 32) : 0;
+    
+    for (int col = 0; col < 6; col++) {
+        uint8_t column = font_6x8[font_index][col];
+        for (int row = 0; row < 8; row++) {
+            if (column & (1 << row)) {
+                bsp_display_set_pixel(x + col, y + row, true);
+            }
+        }
+    }
+}
+
 void bsp_display_draw_text(int x, int y, const char* text) {
     if (!text) return;
     
     int current_x = x;
     
     for (int i = 0; text[i] != '\0'; i++) {
-        char c = text[i];
-        
-        // Convert to font index (ASCII 32 = space)
-        int font_index = (c >= 32 && c <= 126) ? (c - 32) : 0;
-        
-        // Draw character
-        for (int col = 0; col < 6; col++) {
-            uint8_t column = font_6x8[font_index][col];
-            for (int row = 0; row < 8; row++) {
-                if (column & (1 << row)) {
-                    bsp_display_set_pixel(current_x + col, y + row, true);
-                }
-            }
-        }
-        
+        bsp_display_draw_char(current_x, y, text[i]);
         current_x += 7; // 6 pixels + 1 space
     }
 }
@@ -379,6 +444,13 @@ void bsp_input_cleanup(void) {
     // Cleanup handled by display_cleanup
 }
 
+// SDL events are only read when the main loop polls (main_simulator.cpp),
+// and sim_device_press_button() hands presses straight to app logic, so no
+// task ever waits for input here
+void bsp_input_set_notify(bsp_task_handle_t task, uint32_t notify_bits) {
+    (void)task; (void)notify_bits;
+}
+
 bool bsp_input_poll_event(bsp_button_event_t* event) {
     if (!event) return false;
     
@@ -421,16 +493,53 @@ bool bsp_input_poll_event(bsp_button_event_t* event) {
 // TIMING IMPLEMENTATION
 // =============================================================================
 
+static void sim_clock_start(void) {
+    if (g_sim_state.clock_started) return;
+    g_sim_state.clock_ms = 0;
+    g_sim_state.clock_anchor_ms = SDL_GetTicks();
+    g_sim_state.clock_utc_base = (uint64_t)time(NULL);
+    g_sim_state.clock_started = true;
+}
+
+uint64_t bsp_get_tick_ms64(void) {
+    sim_clock_start();
+    if (g_sim_state.clock_fast_forward) {
+        return g_sim_state.clock_ms;
+    }
+    return g_sim_state.clock_ms + (uint32_t)(SDL_GetTicks() - g_sim_state.clock_anchor_ms);
+}
+
 uint32_t bsp_get_tick_ms(void) {
-    return SDL_GetTicks();
+    return (uint32_t)bsp_get_tick_ms64();
 }
 
 uint64_t bsp_get_utc_time_seconds(void) {
-    return (uint64_t)time(NULL);
+    sim_clock_start();
+    return g_sim_state.clock_utc_base + bsp_get_tick_ms64() / 1000;
 }
 
 void bsp_delay_ms(uint32_t ms) {
-    SDL_Delay(ms);
+    if (g_sim_state.clock_fast_forward) {
+        bsp_sim_clock_advance(ms);
+    } else {
+        SDL_Delay(ms);
+    }
+}
+
+void bsp_sim_clock_set_fast_forward(bool enabled) {
+    // Fold elapsed host time in so the virtual clock never jumps
+    g_sim_state.clock_ms = bsp_get_tick_ms64();
+    g_sim_state.clock_anchor_ms = SDL_GetTicks();
+    g_sim_state.clock_fast_forward = enabled;
+}
+
+bool bsp_sim_clock_is_fast_forward(void) {
+    return g_sim_state.clock_fast_forward;
+}
+
+void bsp_sim_clock_advance(uint32_t ms) {
+    sim_clock_start();
+    g_sim_state.clock_ms += ms;
 }
 
 // =============================================================================
@@ -457,33 +566,118 @@ void bsp_task_delay(uint32_t ms) {
     bsp_delay_ms(ms);
 }
 
+void bsp_task_delay_until(uint64_t* last_wake_ms, uint32_t period_ms) {
+    if (!last_wake_ms) return;
+    
+    *last_wake_ms += period_ms;
+    uint64_t now = bsp_get_tick_ms64();
+    if (*last_wake_ms > now) {
+        bsp_delay_ms((uint32_t)(*last_wake_ms - now));
+    }
+}
+
 void bsp_task_yield(void) {
     // No-op in single-threaded mode
 }
 
+bsp_task_handle_t bsp_task_get_current(void) {
+    return (bsp_task_handle_t)0x1; // Same dummy handle as bsp_task_create
+}
+
+bool bsp_task_notify(bsp_task_handle_t task, uint32_t bits) {
+    if (!task) return false;
+    g_sim_state.notify_value |= bits;
+    return true;
+}
+
+bool bsp_task_notify_from_isr(bsp_task_handle_t task, uint32_t bits) {
+    // No interrupt context in the simulator
+    return bsp_task_notify(task, bits);
+}
+
+uint32_t bsp_task_notify_wait_bits(uint32_t wait_mask, uint32_t timeout_ms) {
+    if ((g_sim_state.notify_value & wait_mask) == 0 && timeout_ms != 0) {
+        // Blocking means letting the timer service run until something notifies
+        uint32_t start = bsp_get_tick_ms();
+        
+        while ((g_sim_state.notify_value & wait_mask) == 0) {
+            uint32_t waited = bsp_get_tick_ms() - start;
+            if (timeout_ms != BSP_WAIT_FOREVER && waited >= timeout_ms) break;
+            
+            uint32_t idle_ms = bsp_sim_timer_next_expiry_ms();
+            if (timeout_ms != BSP_WAIT_FOREVER && idle_ms > timeout_ms - waited) {
+                idle_ms = timeout_ms - waited;
+            }
+            if (idle_ms == BSP_WAIT_FOREVER) break; // Nothing could ever notify us
+            
+            bsp_sim_idle(idle_ms);
+            bsp_sim_timer_process();
+        }
+    }
+    
+    uint32_t bits = g_sim_state.notify_value & wait_mask;
+    g_sim_state.notify_value &= ~bits;
+    return bits;
+}
+
+uint32_t bsp_task_notify_wait(uint32_t timeout_ms) {
+    return bsp_task_notify_wait_bits(0xFFFFFFFFu, timeout_ms);
+}
+
+uint32_t bsp_task_notify_wait_until(uint32_t wait_mask, uint64_t* last_wake_ms, uint32_t period_ms) {
+    if (!last_wake_ms) return bsp_task_notify_wait_bits(wait_mask, period_ms);
+    
+    uint64_t deadline = *last_wake_ms + period_ms;
+    uint64_t now = bsp_get_tick_ms64();
+    uint32_t bits = bsp_task_notify_wait_bits(wait_mask,
+                                              deadline > now ? (uint32_t)(deadline - now) : 0);
+    if (bsp_get_tick_ms64() >= deadline) {
+        *last_wake_ms = deadline;
+    }
+    return bits;
+}
+
 void bsp_scheduler_start(void) {
     // In single-threaded mode, this is handled by main loop
     printf("Single-threaded scheduler (no-op)\n");
 }
 
-// Simplified queue implementation (single-threaded)
-typedef struct {
-    uint8_t* buffer;
-    uint8_t item_size;
-    uint8_t length;
-    uint8_t head, tail, count;
-} simple_queue_t;
-
+// Simplified queue implementation (single-threaded). Queues and their item
+// storage come from static tables sized like the target's (see
+// simulator_state_t), so running out here means running out on hardware too.
 bsp_queue_handle_t bsp_queue_create(uint8_t length, uint8_t item_size) {
-    simple_queue_t* queue = malloc(sizeof(simple_queue_t));
-    if (!queue) return NULL;
+    size_t bytes = (size_t)length * item_size;
+    if (bytes == 0) return NULL;
     
-    queue->buffer = malloc(length * item_size);
-    if (!queue->buffer) {
-        free(queue);
+    // Reuse a deleted queue's storage if it is big enough, else carve new storage
+    simple_queue_t* queue = NULL;
+    for (int i = 0; i < CONFIG_RTOS_MAX_QUEUES; i++) {
+        simple_queue_t* q = &g_sim_state.queues[i];
+        if (!q->in_use && q->buffer && q->capacity >= bytes) {
+            queue = q;
+            break;
+        }
+    }
+    if (!queue) {
+        for (int i = 0; i < CONFIG_RTOS_MAX_QUEUES; i++) {
+            simple_queue_t* q = &g_sim_state.queues[i];
+            if (!q->in_use && !q->buffer &&
+                g_sim_state.queue_arena_used + bytes <= sizeof(g_sim_state.queue_arena)) {
+                queue = q;
+                queue->buffer = &g_sim_state.queue_arena[g_sim_state.queue_arena_used];
+                queue->capacity = (uint16_t)bytes;
+                g_sim_state.queue_arena_used += bytes;
+                break;
+            }
+        }
+    }
+    if (!queue) {
+        printf("Simulator: ERROR - no static queue storage for %u x %u bytes\n",
+               (unsigned)length, (unsigned)item_size);
         return NULL;
     }
     
+    queue->in_use = true;
     queue->item_size = item_size;
     queue->length = length;
     queue->head = 0;
@@ -496,8 +690,7 @@ bsp_queue_handle_t bsp_queue_create(uint8_t length, uint8_t item_size) {
 void bsp_queue_delete(bsp_queue_handle_t queue) {
     simple_queue_t* q = (simple_queue_t*)queue;
     if (q) {
-        free(q->buffer);
-        free(q);
+        q->in_use = false;  // Storage stays with the slot for reuse
     }
 }
 
@@ -535,26 +728,118 @@ bool bsp_queue_receive(bsp_queue_handle_t queue, void* item, uint32_t timeout_ms
     return true;
 }
 
+// Every simulated task shares one thread, so a mutex never has to wait.
+// Locking one that is already held would block forever on the target, so it
+// is reported instead.
+bsp_mutex_handle_t bsp_mutex_create(void) {
+    for (int i = 0; i < CONFIG_RTOS_MAX_MUTEXES; i++) {
+        simple_mutex_t* m = &g_sim_state.mutexes[i];
+        if (!m->in_use) {
+            m->in_use = true;
+            m->locked = false;
+            return (bsp_mutex_handle_t)m;
+        }
+    }
+    printf("Simulator: ERROR - no static mutex left\n");
+    return NULL;
+}
+
+void bsp_mutex_lock(bsp_mutex_handle_t mutex) {
+    simple_mutex_t* m = (simple_mutex_t*)mutex;
+    if (!m) return;
+    if (m->locked) {
+        printf("Simulator: ERROR - mutex %p locked twice, the target would deadlock\n", mutex);
+    }
+    m->locked = true;
+}
+
+void bsp_mutex_unlock(bsp_mutex_handle_t mutex) {
+    simple_mutex_t* m = (simple_mutex_t*)mutex;
+    if (m) m->locked = false;
+}
+
 // =============================================================================
 // HARDWARE SERVICES SIMULATION
 // =============================================================================
 
-int bsp_storage_read(const bsp_storage_operation_t* op) {
-    (void)op;
-    return 0; // Success
+// Memory wire model, advanced in 1 ms steps up to the current tick: the
+// wire heats at SIM_WIRE_HEAT_C_PER_S times the duty (and "wire_heat") and
+// cools toward the sensor temperature with time constant SIM_WIRE_TAU_MS.
+// The latch lets go when the wire passes SIM_WIRE_RELEASE_C and the ejector
+// opens the door SIM_EJECTOR_MS later unless it is blocked.
+#define SIM_WIRE_HEAT_C_PER_S       150.0f
+#define SIM_WIRE_TAU_MS             2000.0f
+#define SIM_WIRE_RELEASE_C          65.0f
+#define SIM_EJECTOR_MS              150
+
+// The door and latch switches are on EXTI lines on target: any change
+// notifies at once
+static void sim_sensor_edge(void) {
+    if (g_sim_state.edge_task && g_sim_state.edge_notify_bits) {
+        bsp_task_notify(g_sim_state.edge_task, g_sim_state.edge_notify_bits);
+    }
+}
+
+static void sim_wire_advance(void) {
+    uint32_t now = bsp_get_tick_ms();
+    float ambient = g_sim_state.temperature_celsius;
+    float heat = SIM_WIRE_HEAT_C_PER_S * g_sim_state.wire_heat_scale *
+                 g_sim_state.wire_duty_permille / (1000.0f * 1000.0f);
+    
+    while (g_sim_state.wire_updated_ms != now) {
+        float above = g_sim_state.wire_temperature_c - ambient;
+        if (g_sim_state.wire_duty_permille == 0 && above < 0.01f && above > -0.01f) {
+            g_sim_state.wire_temperature_c = ambient;   // Settled, skip ahead
+            g_sim_state.wire_updated_ms = now;
+            break;
+        }
+        float t = g_sim_state.wire_temperature_c;
+        g_sim_state.wire_temperature_c = t + heat - (t - ambient) / SIM_WIRE_TAU_MS;
+        g_sim_state.wire_updated_ms++;
+        g_sim_state.activity.wire_on_us += g_sim_state.wire_duty_permille;
+        
+        if (g_sim_state.latch_engaged && g_sim_state.wire_temperature_c >= SIM_WIRE_RELEASE_C) {
+            g_sim_state.latch_engaged = false;
+            g_sim_state.latch_released_ms = g_sim_state.wire_updated_ms;
+            sim_sensor_edge();
+        }
+    }
+    
+    if (!g_sim_state.latch_engaged && g_sim_state.door_closed && !g_sim_state.door_blocked &&
+        now - g_sim_state.latch_released_ms >= SIM_EJECTOR_MS) {
+        g_sim_state.door_closed = false;
+        printf("Simulator: Latch released, door opened\n");
+        sim_sensor_edge();
+    }
+}
+
+int bsp_wire_set_duty(uint16_t duty_permille) {
+    if (duty_permille > BSP_WIRE_DUTY_MAX) return -1;
+    
+    sim_wire_advance();
+    g_sim_state.wire_duty_permille = duty_permille;
+    return 0;
 }
 
-int bsp_storage_write(const bsp_storage_operation_t* op) {
-    (void)op;
-    return 0; // Success
+float bsp_sim_wire_get_temperature(void) {
+    sim_wire_advance();
+    return g_sim_state.wire_temperature_c;
 }
 
 int bsp_sensors_read(bsp_sensor_readings_t* readings) {
     if (!readings) return -1;
     
-    readings->battery_voltage = g_sim_state.battery_voltage;
-    readings->battery_percentage = (uint8_t)g_sim_state.battery_percentage;
-    readings->temperature_celsius = g_sim_state.temperature_celsius;
+    sim_wire_advance();
+    if (g_sim_state.sensor_timer && g_sim_state.sensor_pipeline.primed) {
+        const SensorPipelineOutput_t* output = &g_sim_state.sensor_pipeline.output;
+        readings->battery_voltage = output->battery_mv / 1000.0f;
+        readings->battery_percentage = output->battery_percentage;
+        readings->temperature_celsius = output->temperature_cdeg / 100.0f;
+    } else {
+        readings->battery_voltage = g_sim_state.battery_voltage;
+        readings->battery_percentage = (uint8_t)g_sim_state.battery_percentage;
+        readings->temperature_celsius = g_sim_state.temperature_celsius;
+    }
     readings->door_closed = g_sim_state.door_closed;
     readings->latch_engaged = g_sim_state.latch_engaged;
     readings->charging_active = g_sim_state.charging_active;
@@ -562,14 +847,107 @@ int bsp_sensors_read(bsp_sensor_readings_t* readings) {
     return 0;
 }
 
-int bsp_lock_unlock(void) {
-    g_sim_state.lock_state = BSP_LOCK_STATE_UNLOCKING;
-    printf("Simulator: Lock unlocking...\n");
+// ADC model: every CONFIG_SENSOR_BURST_PERIOD_MS a burst holds insomnia for
+// SIM_SENSOR_BURST_MS, as the target's ADC does, then delivers a block of
+// oversampled scans. Each scan is the true value plus uniform noise; the
+// block goes through the same averaging and pipeline as on target.
+#define SIM_SENSOR_BURST_MS         100     // Target: 4 scans of ~25 ms
+#define SIM_SENSOR_BLOCK_SCANS      4
+#define SIM_BATTERY_NOISE_MV        8       // Peak, per oversampled scan
+#define SIM_TEMPERATURE_NOISE_CDEG  50
+
+static int32_t sim_sensor_noise(int32_t amplitude) {
+    g_sim_state.sensor_noise = g_sim_state.sensor_noise * 1664525u + 1013904223u;
+    return (int32_t)((g_sim_state.sensor_noise >> 16) % (uint32_t)(2 * amplitude + 1)) - amplitude;
+}
+
+static void sim_sensor_block(bsp_timer_handle_t timer, void* context) {
+    (void)timer; (void)context;
+    
+    g_sim_state.sensor_burst_running = false;
+    g_sim_state.activity.adc_ms += bsp_get_tick_ms() - g_sim_state.sensor_burst_started_ms;
+    bsp_power_allow_sleep();
+    
+    float percentage = g_sim_state.battery_percentage;
+    percentage = (percentage < 0.0f) ? 0.0f : (percentage > 100.0f) ? 100.0f : percentage;
+    int32_t battery_mv = sensor_pipeline_battery_mv((uint8_t)percentage);
+    int32_t temperature_cdeg = (int32_t)(g_sim_state.temperature_celsius * 100.0f);
+    
+    SensorBlock_t block = { 0, 0 };
+    for (int i = 0; i < SIM_SENSOR_BLOCK_SCANS; i++) {
+        block.battery_mv += battery_mv + sim_sensor_noise(SIM_BATTERY_NOISE_MV);
+        block.temperature_cdeg += temperature_cdeg + sim_sensor_noise(SIM_TEMPERATURE_NOISE_CDEG);
+    }
+    block.battery_mv /= SIM_SENSOR_BLOCK_SCANS;
+    block.temperature_cdeg /= SIM_SENSOR_BLOCK_SCANS;
+    
+    if (sensor_pipeline_process(&g_sim_state.sensor_pipeline, &block, bsp_get_tick_ms()) &&
+        g_sim_state.sensor_notify_bits) {
+        bsp_task_notify(g_sim_state.sensor_task, g_sim_state.sensor_notify_bits);
+    }
+}
+
+static void sim_sensor_burst(bsp_timer_handle_t timer, void* context) {
+    (void)timer; (void)context;
+    
+    if (g_sim_state.sensor_burst_running) return;
+    g_sim_state.sensor_burst_running = true;
+    g_sim_state.sensor_burst_started_ms = bsp_get_tick_ms();
+    bsp_power_suppress_sleep();
+    bsp_timer_start(g_sim_state.sensor_burst_timer);
+}
+
+int bsp_sensors_start(bsp_task_handle_t task, uint32_t notify_bits, uint32_t snapshot_period_ms) {
+    if (notify_bits && !task) return -1;
+    
+    g_sim_state.sensor_task = task;
+    g_sim_state.sensor_notify_bits = notify_bits;
+    if (g_sim_state.sensor_timer) {
+        return 0;   // Already sampling
+    }
+    
+    bsp_timer_handle_t timer = bsp_timer_create("SimADC", CONFIG_SENSOR_BURST_PERIOD_MS, true,
+                                                sim_sensor_burst, NULL);
+    bsp_timer_handle_t burst = bsp_timer_create("SimADCBurst", SIM_SENSOR_BURST_MS, false,
+                                                sim_sensor_block, NULL);
+    if (!timer || !burst || !bsp_timer_start(timer)) {
+        bsp_timer_delete(timer);
+        bsp_timer_delete(burst);
+        return -1;
+    }
+    sensor_pipeline_init(&g_sim_state.sensor_pipeline, snapshot_period_ms);
+    g_sim_state.sensor_timer = timer;
+    g_sim_state.sensor_burst_timer = burst;
+    sim_sensor_burst(NULL, NULL);   // First reading now, as on target
     return 0;
 }
 
-bsp_lock_state_t bsp_lock_get_state(void) {
-    return g_sim_state.lock_state;
+void bsp_sensors_stop(void) {
+    if (!g_sim_state.sensor_timer) return;
+    
+    bsp_timer_delete(g_sim_state.sensor_timer);
+    bsp_timer_delete(g_sim_state.sensor_burst_timer);
+    g_sim_state.sensor_timer = NULL;
+    g_sim_state.sensor_burst_timer = NULL;
+    if (g_sim_state.sensor_burst_running) {
+        g_sim_state.sensor_burst_running = false;
+        g_sim_state.activity.adc_ms += bsp_get_tick_ms() - g_sim_state.sensor_burst_started_ms;
+        bsp_power_allow_sleep();
+    }
+}
+
+void bsp_sensors_get_stats(bsp_sensor_stats_t* stats) {
+    if (!stats) return;
+    
+    const SensorPipelineStats_t* pipeline = &g_sim_state.sensor_pipeline.stats;
+    stats->blocks = pipeline->blocks;
+    stats->wakeups = pipeline->wakeups;
+    stats->threshold_wakeups = pipeline->threshold_wakeups;
+}
+
+void bsp_sensors_set_edge_notify(bsp_task_handle_t task, uint32_t notify_bits) {
+    g_sim_state.edge_task = task;
+    g_sim_state.edge_notify_bits = notify_bits;
 }
 
 int bsp_power_set_mode(bsp_power_mode_t mode) {
@@ -578,16 +956,22 @@ int bsp_power_set_mode(bsp_power_mode_t mode) {
     return 0;
 }
 
-// =============================================================================
-// SLEEP SUPPRESSION (Single-threaded stubs)
-// =============================================================================
-
-void bsp_power_suppress_sleep(void) {
-    // No-op in single-threaded mode
-}
-
-void bsp_power_allow_sleep(void) {
-    // No-op in single-threaded mode
+// Bit-serial model of the CRC unit's shift register, as documented for the
+// STM32L4, rather than a copy of the table-driven code in Utils/utils.c
+uint32_t bsp_crc_update(bsp_crc_type_t type, uint32_t crc, const uint8_t* data, size_t length) {
+    uint32_t width = (type == BSP_CRC_16_CCITT) ? 16u : 32u;
+    uint32_t poly = (type == BSP_CRC_16_CCITT) ? 0x1021u : 0x04C11DB7u;
+    uint32_t top = 1u << (width - 1);
+    uint32_t mask = (width == 32u) ? 0xFFFFFFFFu : ((1u << width) - 1);
+    
+    crc &= mask;
+    for (size_t i = 0; data && i < length; i++) {
+        for (int bit = 7; bit >= 0; bit--) {
+            bool feedback = ((crc & top) != 0) != (((data[i] >> bit) & 1u) != 0);
+            crc = ((crc << 1) ^ (feedback ? poly : 0u)) & mask;
+        }
+    }
+    return crc;
 }
 
 // =============================================================================
@@ -612,6 +996,22 @@ void bsp_debug_set_sensor_value(const char* sensor, float value) {
         g_sim_state.battery_percentage = value;
     } else if (strcmp(sensor, "temperature") == 0) {
         g_sim_state.temperature_celsius = value;
+    } else if (strcmp(sensor, "door") == 0) {
+        sim_wire_advance();
+        bool door_closed = g_sim_state.door_closed;
+        bool latch_engaged = g_sim_state.latch_engaged;
+        g_sim_state.door_closed = value != 0.0f;
+        if (g_sim_state.door_closed) {
+            g_sim_state.latch_engaged = true;   // Closing the door re-latches it
+        }
+        if (g_sim_state.door_closed != door_closed || g_sim_state.latch_engaged != latch_engaged) {
+            sim_sensor_edge();
+        }
+    } else if (strcmp(sensor, "wire_heat") == 0) {
+        sim_wire_advance();
+        g_sim_state.wire_heat_scale = value;
+    } else if (strcmp(sensor, "door_blocked") == 0) {
+        g_sim_state.door_blocked = value != 0.0f;
     }
     printf("Simulator: Set %s to %.2f\n", sensor, value);
 }
@@ -626,4 +1026,76 @@ void bsp_debug_trigger_button(bsp_button_id_t button) {
         printf("Simulator: Triggered button %d\n", button);
     }
 }
+
+// =============================================================================
+// MULTI-INSTANCE SUPPORT
+// =============================================================================
+
+// A device block is the core state followed by the power, timer and flash
+// storage state, each starting on a max_align boundary
+#define SIM_INSTANCE_ALIGN(size) (((size) + 15u) & ~(size_t)15u)
+
+size_t bsp_sim_instance_size(void) {
+    return SIM_INSTANCE_ALIGN(sizeof(simulator_state_t)) +
+           SIM_INSTANCE_ALIGN(sim_power_instance_size()) +
+           SIM_INSTANCE_ALIGN(sim_timer_instance_size()) +
+           SIM_INSTANCE_ALIGN(sim_storage_instance_size());
+}
+
+static uint8_t* sim_instance_storage_block(void* state) {
+    return (uint8_t*)state +
+           SIM_INSTANCE_ALIGN(sizeof(simulator_state_t)) +
+           SIM_INSTANCE_ALIGN(sim_power_instance_size()) +
+           SIM_INSTANCE_ALIGN(sim_timer_instance_size());
+}
+
+void bsp_sim_instance_bind(void* state) {
+    if (!state) {
+        SIM_INSTANCE_BIND(g_sim_state, NULL);
+        sim_power_instance_bind(NULL);
+        sim_timer_instance_bind(NULL);
+        sim_storage_instance_bind(NULL);
+        return;
+    }
+    
+    uint8_t* block = (uint8_t*)state;
+    uint8_t* power = block + SIM_INSTANCE_ALIGN(sizeof(simulator_state_t));
+    uint8_t* timer = power + SIM_INSTANCE_ALIGN(sim_power_instance_size());
+    
+    SIM_INSTANCE_BIND(g_sim_state, block);
+    sim_power_instance_bind(power);
+    sim_timer_instance_bind(timer);
+    sim_storage_instance_bind(sim_instance_storage_block(state));
+}
+
+void bsp_sim_instance_init(void* state) {
+    if (!state) return;
+    
+    memset(state, 0, bsp_sim_instance_size());
+    
+    // Defaults are written through the binding, so borrow it briefly
+    simulator_state_t* previous = g_sim_state_instance;
+    SIM_INSTANCE_BIND(g_sim_state, state);
+    sim_hardware_defaults();
+    SIM_INSTANCE_BIND(g_sim_state, previous);
+}
+
+void bsp_sim_instance_release(void* state) {
+    if (!state) return;
+    sim_storage_instance_release(sim_instance_storage_block(state));
+}
+
+const uint8_t* bsp_sim_get_framebuffer(void) {
+    return g_sim_state.framebuffer;
+}
+
+void sim_get_activity_counters(sim_activity_counters_t* counters) {
+    if (!counters) return;
+    
+    sim_wire_advance();
+    *counters = g_sim_state.activity;
+    if (g_sim_state.sensor_burst_running) {
+        counters->adc_ms += bsp_get_tick_ms() - g_sim_state.sensor_burst_started_ms;
+    }
+}
 #endif
\ No newline at end of file
@@ -0,0 +1,314 @@
+// BSP Simulator - Flash Storage Model
+// Emulates the STM32L452 flash pages behind bsp_storage_*(): doubleword
+// programming with erase-before-write, page erase with per-page wear counters
+// and typical erase/program latency. The image can be memory-mapped from a
+// file so contents and wear survive simulator restarts.
+
+#ifndef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 200112L
+#endif
+
+#include <stdio.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "../App/BSP/bsp_api.h"
+#include "../App/Config/app_config.h"
+#include "../App/Utils/sim_instance.h"
+#include "bsp_simulator_internal.h"
+
+#if (CONFIG_STORAGE_TOTAL_SIZE % BSP_STORAGE_PAGE_SIZE) != 0
+#error "CONFIG_STORAGE_TOTAL_SIZE must be a whole number of flash pages"
+#endif
+
+// =============================================================================
+// FLASH GEOMETRY AND TIMING
+// =============================================================================
+
+#define SIM_FLASH_PAGE_COUNT        (CONFIG_STORAGE_TOTAL_SIZE / BSP_STORAGE_PAGE_SIZE)
+#define SIM_FLASH_DOUBLEWORDS       (CONFIG_STORAGE_TOTAL_SIZE / BSP_STORAGE_PROGRAM_UNIT)
+#define SIM_FLASH_ERASED            0xFF
+
+// Typical values from the STM32L452 datasheet (flash memory characteristics)
+#define SIM_FLASH_PAGE_ERASE_US     22000   // tERASE, one 2KB page
+#define SIM_FLASH_PROGRAM_US        82      // tPROG, one 64-bit doubleword
+
+#define SIM_FLASH_MAGIC             "CKOSFLSH"
+#define SIM_FLASH_VERSION           1
+
+// Stored after the flash image in the backing file. A doubleword that has
+// been programmed cannot be programmed again until its page is erased (the
+// L4 ECC forbids it even when only clearing bits), so that is tracked here.
+typedef struct {
+    char magic[8];
+    uint32_t version;
+    uint32_t page_size;
+    uint32_t page_count;
+    uint32_t erase_counts[SIM_FLASH_PAGE_COUNT];
+    uint8_t programmed[SIM_FLASH_DOUBLEWORDS / 8];
+} sim_flash_meta_t;
+
+typedef struct {
+    uint8_t* image;                 // Points at ram_image or into the mapping
+    sim_flash_meta_t* meta;
+    bool ready;
+
+    // Backing file mapping (image then meta)
+    void* map;
+    size_t map_size;
+
+    // Blank device when no file is open
+    uint8_t ram_image[CONFIG_STORAGE_TOTAL_SIZE];
+    sim_flash_meta_t ram_meta;
+
+    bsp_sim_storage_stats_t stats;
+    uint32_t busy_carry_us;         // Busy time not yet charged to the clock
+} simulator_storage_state_t;
+
+SIM_INSTANCE_STATE(simulator_storage_state_t, g_sim_storage);
+#define g_sim_storage SIM_INSTANCE(g_sim_storage)
+
+size_t sim_storage_instance_size(void) {
+    return sizeof(simulator_storage_state_t);
+}
+
+void sim_storage_instance_bind(void* state) {
+    SIM_INSTANCE_BIND(g_sim_storage, state);
+}
+
+static void storage_unmap(simulator_storage_state_t* storage) {
+    if (storage->map) {
+        msync(storage->map, storage->map_size, MS_SYNC);
+        munmap(storage->map, storage->map_size);
+        storage->map = NULL;
+        storage->map_size = 0;
+    }
+    storage->image = NULL;
+    storage->meta = NULL;
+    storage->ready = false;
+}
+
+void sim_storage_instance_release(void* state) {
+    if (state) storage_unmap((simulator_storage_state_t*)state);
+}
+
+// =============================================================================
+// IMAGE MANAGEMENT
+// =============================================================================
+
+static void storage_format(uint8_t* image, sim_flash_meta_t* meta) {
+    memset(image, SIM_FLASH_ERASED, CONFIG_STORAGE_TOTAL_SIZE);
+    memset(meta, 0, sizeof(*meta));
+    memcpy(meta->magic, SIM_FLASH_MAGIC, sizeof(meta->magic));
+    meta->version = SIM_FLASH_VERSION;
+    meta->page_size = BSP_STORAGE_PAGE_SIZE;
+    meta->page_count = SIM_FLASH_PAGE_COUNT;
+}
+
+static bool storage_meta_valid(const sim_flash_meta_t* meta) {
+    return memcmp(meta->magic, SIM_FLASH_MAGIC, sizeof(meta->magic)) == 0 &&
+           meta->version == SIM_FLASH_VERSION &&
+           meta->page_size == BSP_STORAGE_PAGE_SIZE &&
+           meta->page_count == SIM_FLASH_PAGE_COUNT;
+}
+
+// Blank RAM device unless a file has been opened
+static void storage_ensure_ready(void) {
+    if (!g_sim_storage.ready) {
+        g_sim_storage.image = g_sim_storage.ram_image;
+        g_sim_storage.meta = &g_sim_storage.ram_meta;
+        storage_format(g_sim_storage.image, g_sim_storage.meta);
+        g_sim_storage.ready = true;
+    }
+}
+
+int bsp_sim_storage_open(const char* path) {
+    if (!path) return -1;
+
+    int fd = open(path, O_RDWR | O_CREAT, 0644);
+    if (fd < 0) {
+        printf("Simulator: ERROR - cannot open flash image %s\n", path);
+        return -1;
+    }
+
+    struct stat st;
+    size_t map_size = CONFIG_STORAGE_TOTAL_SIZE + sizeof(sim_flash_meta_t);
+    bool fresh = (fstat(fd, &st) != 0) || ((size_t)st.st_size != map_size);
+    if (fresh && ftruncate(fd, (off_t)map_size) != 0) {
+        printf("Simulator: ERROR - cannot size flash image %s\n", path);
+        close(fd);
+        return -1;
+    }
+
+    void* map = mmap(NULL, map_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED) {
+        printf("Simulator: ERROR - cannot map flash image %s\n", path);
+        return -1;
+    }
+
+    storage_unmap(&g_sim_storage);
+    g_sim_storage.map = map;
+    g_sim_storage.map_size = map_size;
+    g_sim_storage.image = (uint8_t*)map;
+    g_sim_storage.meta = (sim_flash_meta_t*)((uint8_t*)map + CONFIG_STORAGE_TOTAL_SIZE);
+    g_sim_storage.ready = true;
+
+    if (fresh || !storage_meta_valid(g_sim_storage.meta)) {
+        if (!fresh) {
+            printf("Simulator: Flash image %s has a different layout, erasing\n", path);
+        }
+        storage_format(g_sim_storage.image, g_sim_storage.meta);
+    }
+    return 0;
+}
+
+void bsp_sim_storage_close(void) {
+    storage_unmap(&g_sim_storage);
+}
+
+// =============================================================================
+// TIMING MODEL
+// =============================================================================
+
+// The CPU stalls while flash is busy, so in fast-forward the virtual clock
+// moves on by the modelled time. Real-time runs only account for it.
+static void storage_charge_busy(uint32_t busy_us) {
+    g_sim_storage.stats.busy_us += busy_us;
+    if (!bsp_sim_clock_is_fast_forward()) return;
+
+    g_sim_storage.busy_carry_us += busy_us;
+    if (g_sim_storage.busy_carry_us >= 1000) {
+        bsp_sim_clock_advance(g_sim_storage.busy_carry_us / 1000);
+        g_sim_storage.busy_carry_us %= 1000;
+    }
+}
+
+// =============================================================================
+// BSP STORAGE API
+// =============================================================================
+
+static bool storage_range_valid(uint32_t address, uint32_t length) {
+    return address <= CONFIG_STORAGE_TOTAL_SIZE &&
+           length <= CONFIG_STORAGE_TOTAL_SIZE - address;
+}
+
+static bool dw_programmed(uint32_t dw) {
+    return (g_sim_storage.meta->programmed[dw / 8] >> (dw % 8)) & 1u;
+}
+
+int bsp_storage_read(const bsp_storage_operation_t* op) {
+    if (!op || (!op->data && op->length > 0)) return -1;
+    if (!storage_range_valid(op->address, op->length)) return -1;
+    storage_ensure_ready();
+
+    memcpy(op->data, &g_sim_storage.image[op->address], op->length);
+    g_sim_storage.stats.reads++;
+    g_sim_storage.stats.bytes_read += op->length;
+    return 0;
+}
+
+int bsp_storage_write(const bsp_storage_operation_t* op) {
+    if (!op || (!op->data && op->length > 0)) return -1;
+    if (!storage_range_valid(op->address, op->length)) return -1;
+    storage_ensure_ready();
+    if (op->length == 0) return 0;
+
+    uint32_t first = op->address / BSP_STORAGE_PROGRAM_UNIT;
+    uint32_t last = (op->address + op->length - 1) / BSP_STORAGE_PROGRAM_UNIT;
+
+    // Nothing is written unless every doubleword is still erased (PROGERR)
+    for (uint32_t dw = first; dw <= last; dw++) {
+        if (dw_programmed(dw)) {
+            g_sim_storage.stats.program_errors++;
+            printf("Simulator: Flash program error at 0x%04lx (doubleword not erased)\n",
+                   (unsigned long)(dw * BSP_STORAGE_PROGRAM_UNIT));
+            return -1;
+        }
+    }
+
+    // Bytes of a partly covered doubleword stay 0xFF but are spent until erase
+    memcpy(&g_sim_storage.image[op->address], op->data, op->length);
+    for (uint32_t dw = first; dw <= last; dw++) {
+        g_sim_storage.meta->programmed[dw / 8] |= (uint8_t)(1u << (dw % 8));
+    }
+
+    uint32_t doublewords = last - first + 1;
+    g_sim_storage.stats.writes++;
+    g_sim_storage.stats.doublewords_programmed += doublewords;
+    storage_charge_busy(doublewords * SIM_FLASH_PROGRAM_US);
+    return 0;
+}
+
+int bsp_storage_erase(uint32_t address, uint32_t length) {
+    if ((address % BSP_STORAGE_PAGE_SIZE) != 0 || (length % BSP_STORAGE_PAGE_SIZE) != 0) {
+        return -1;
+    }
+    if (!storage_range_valid(address, length)) return -1;
+    storage_ensure_ready();
+
+    for (uint32_t page = address / BSP_STORAGE_PAGE_SIZE;
+         page < (address + length) / BSP_STORAGE_PAGE_SIZE; page++) {
+        uint32_t base = page * BSP_STORAGE_PAGE_SIZE;
+        memset(&g_sim_storage.image[base], SIM_FLASH_ERASED, BSP_STORAGE_PAGE_SIZE);
+        memset(&g_sim_storage.meta->programmed[base / BSP_STORAGE_PROGRAM_UNIT / 8], 0,
+               BSP_STORAGE_PAGE_SIZE / BSP_STORAGE_PROGRAM_UNIT / 8);
+
+        g_sim_storage.meta->erase_counts[page]++;
+        g_sim_storage.stats.page_erases++;
+        storage_charge_busy(SIM_FLASH_PAGE_ERASE_US);
+    }
+    return 0;
+}
+
+// =============================================================================
+// STATISTICS
+// =============================================================================
+
+uint32_t bsp_sim_storage_get_page_erase_count(uint32_t page) {
+    if (page >= SIM_FLASH_PAGE_COUNT) return 0;
+    storage_ensure_ready();
+    return g_sim_storage.meta->erase_counts[page];
+}
+
+void bsp_sim_storage_get_stats(bsp_sim_storage_stats_t* stats) {
+    if (!stats) return;
+
+    storage_ensure_ready();
+    *stats = g_sim_storage.stats;
+    stats->max_page_erase_count = 0;
+    for (uint32_t page = 0; page < SIM_FLASH_PAGE_COUNT; page++) {
+        if (g_sim_storage.meta->erase_counts[page] > stats->max_page_erase_count) {
+            stats->max_page_erase_count = g_sim_storage.meta->erase_counts[page];
+        }
+    }
+}
+
+void bsp_sim_storage_reset_stats(void) {
+    memset(&g_sim_storage.stats, 0, sizeof(g_sim_storage.stats));
+    g_sim_storage.busy_carry_us = 0;
+}
+
+void bsp_debug_print_storage_stats(void) {
+    bsp_sim_storage_stats_t s;
+    bsp_sim_storage_get_stats(&s);
+
+    printf("\n=== FLASH STORAGE ===\n");
+    printf("Reads:    %lu (%lu bytes)\n",
+           (unsigned long)s.reads, (unsigned long)s.bytes_read);
+    printf("Writes:   %lu (%lu doublewords, %lu rejected)\n",
+           (unsigned long)s.writes, (unsigned long)s.doublewords_programmed,
+           (unsigned long)s.program_errors);
+    printf("Erases:   %lu pages\n", (unsigned long)s.page_erases);
+    printf("Busy:     %.1f ms\n", s.busy_us / 1000.0);
+    for (uint32_t page = 0; page < SIM_FLASH_PAGE_COUNT; page++) {
+        uint32_t base = page * BSP_STORAGE_PAGE_SIZE;
+        printf("Page %lu (0x%04lx %s): %lu erase cycles\n",
+               (unsigned long)page, (unsigned long)base,
+               base < CONFIG_STORAGE_LOG_START_ADDR ? "config" : "log",
+               (unsigned long)g_sim_storage.meta->erase_counts[page]);
+    }
+    printf("=== END FLASH STORAGE ===\n\n");
+}
@@ -0,0 +1,286 @@
+// BSP Simulator - Software Timer Service
+// Timers on the virtual clock, kept in a binary min-heap ordered by expiry so
+// arming, stopping and finding the next deadline are O(log n) / O(1)
+
+#include <stdio.h>
+#include <string.h>
+#include "../App/BSP/bsp_api.h"
+#include "../App/Utils/sim_instance.h"
+#include "bsp_simulator_internal.h"
+
+// =============================================================================
+// SIMULATOR TIMER STATE
+// =============================================================================
+
+#define SIM_MAX_TIMERS  16
+
+typedef struct {
+    bool in_use;
+    const char* name;
+    uint32_t period_ms;
+    bool periodic;
+
+    // Delivery: callback, or notify bits for a task
+    bsp_timer_callback_t callback;
+    void* context;
+    bsp_task_handle_t notify_task;
+    uint32_t notify_bits;
+
+    uint32_t expiry_ms;
+    int heap_index;                 // -1 while stopped
+} sim_timer_t;
+
+typedef struct {
+    sim_timer_t timers[SIM_MAX_TIMERS];
+    sim_timer_t* heap[SIM_MAX_TIMERS];
+    int heap_size;
+    uint32_t expiries;              // Deliveries, for the energy model
+    bsp_timer_handle_t rtc_alarm;   // One-shot notify timer, NULL if unset
+} sim_timer_service_t;
+
+SIM_INSTANCE_STATE(sim_timer_service_t, g_timer_service);
+#define g_timer_service SIM_INSTANCE(g_timer_service)
+
+#define g_timers            (g_timer_service.timers)
+#define g_timer_heap        (g_timer_service.heap)
+#define g_timer_heap_size   (g_timer_service.heap_size)
+
+size_t sim_timer_instance_size(void) {
+    return sizeof(sim_timer_service_t);
+}
+
+void sim_timer_instance_bind(void* state) {
+    SIM_INSTANCE_BIND(g_timer_service, state);
+}
+
+// Tick comparison that survives the 32-bit wrap (~49 days)
+static bool expires_before(const sim_timer_t* a, const sim_timer_t* b) {
+    return (int32_t)(a->expiry_ms - b->expiry_ms) < 0;
+}
+
+// =============================================================================
+// MIN-HEAP
+// =============================================================================
+
+static void heap_place(int index, sim_timer_t* timer) {
+    g_timer_heap[index] = timer;
+    timer->heap_index = index;
+}
+
+static void heap_sift_up(int index) {
+    sim_timer_t* timer = g_timer_heap[index];
+    while (index > 0) {
+        int parent = (index - 1) / 2;
+        if (!expires_before(timer, g_timer_heap[parent])) break;
+        heap_place(index, g_timer_heap[parent]);
+        index = parent;
+    }
+    heap_place(index, timer);
+}
+
+static void heap_sift_down(int index) {
+    sim_timer_t* timer = g_timer_heap[index];
+    while (true) {
+        int child = 2 * index + 1;
+        if (child >= g_timer_heap_size) break;
+        if (child + 1 < g_timer_heap_size &&
+            expires_before(g_timer_heap[child + 1], g_timer_heap[child])) {
+            child++;
+        }
+        if (!expires_before(g_timer_heap[child], timer)) break;
+        heap_place(index, g_timer_heap[child]);
+        index = child;
+    }
+    heap_place(index, timer);
+}
+
+static void heap_insert(sim_timer_t* timer) {
+    heap_place(g_timer_heap_size++, timer);
+    heap_sift_up(timer->heap_index);
+}
+
+static void heap_remove(sim_timer_t* timer) {
+    int index = timer->heap_index;
+    if (index < 0) return;
+
+    timer->heap_index = -1;
+    sim_timer_t* last = g_timer_heap[--g_timer_heap_size];
+    if (last == timer) return;
+
+    // Move the last entry into the hole and restore order in either direction
+    heap_place(index, last);
+    heap_sift_up(index);
+    heap_sift_down(last->heap_index);
+}
+
+// =============================================================================
+// TIMER API
+// =============================================================================
+
+static sim_timer_t* timer_alloc(const char* name, uint32_t period_ms, bool periodic) {
+    if (period_ms == 0) return NULL;
+
+    for (int i = 0; i < SIM_MAX_TIMERS; i++) {
+        if (!g_timers[i].in_use) {
+            sim_timer_t* timer = &g_timers[i];
+            memset(timer, 0, sizeof(*timer));
+            timer->in_use = true;
+            timer->name = name;
+            timer->period_ms = period_ms;
+            timer->periodic = periodic;
+            timer->heap_index = -1;
+            return timer;
+        }
+    }
+
+    printf("Simulator: ERROR - no free timer for '%s'\n", name ? name : "?");
+    return NULL;
+}
+
+bsp_timer_handle_t bsp_timer_create(const char* name,
+                                    uint32_t period_ms,
+                                    bool periodic,
+                                    bsp_timer_callback_t callback,
+                                    void* context) {
+    if (!callback) return NULL;
+
+    sim_timer_t* timer = timer_alloc(name, period_ms, periodic);
+    if (!timer) return NULL;
+
+    timer->callback = callback;
+    timer->context = context;
+    return timer;
+}
+
+bsp_timer_handle_t bsp_timer_create_notify(const char* name,
+                                           uint32_t period_ms,
+                                           bool periodic,
+                                           bsp_task_handle_t task,
+                                           uint32_t notify_bits) {
+    if (!task || notify_bits == 0) return NULL;
+
+    sim_timer_t* timer = timer_alloc(name, period_ms, periodic);
+    if (!timer) return NULL;
+
+    timer->notify_task = task;
+    timer->notify_bits = notify_bits;
+    return timer;
+}
+
+void bsp_timer_delete(bsp_timer_handle_t timer) {
+    sim_timer_t* t = (sim_timer_t*)timer;
+    if (!t || !t->in_use) return;
+
+    heap_remove(t);
+    t->in_use = false;
+}
+
+bool bsp_timer_start(bsp_timer_handle_t timer) {
+    sim_timer_t* t = (sim_timer_t*)timer;
+    if (!t || !t->in_use) return false;
+
+    heap_remove(t);
+    t->expiry_ms = bsp_get_tick_ms() + t->period_ms;
+    heap_insert(t);
+    return true;
+}
+
+bool bsp_timer_stop(bsp_timer_handle_t timer) {
+    sim_timer_t* t = (sim_timer_t*)timer;
+    if (!t || !t->in_use) return false;
+
+    heap_remove(t);
+    return true;
+}
+
+bool bsp_timer_set_period(bsp_timer_handle_t timer, uint32_t period_ms) {
+    sim_timer_t* t = (sim_timer_t*)timer;
+    if (!t || !t->in_use || period_ms == 0) return false;
+
+    t->period_ms = period_ms;
+    return bsp_timer_start(timer);
+}
+
+bool bsp_timer_is_active(bsp_timer_handle_t timer) {
+    sim_timer_t* t = (sim_timer_t*)timer;
+    return t && t->in_use && t->heap_index >= 0;
+}
+
+// =============================================================================
+// TIMER SERVICE (called from the simulator main loop)
+// =============================================================================
+
+void bsp_sim_timer_process(void) {
+    uint32_t now = bsp_get_tick_ms();
+
+    while (g_timer_heap_size > 0) {
+        sim_timer_t* t = g_timer_heap[0];
+        if ((int32_t)(now - t->expiry_ms) < 0) break;
+
+        // Re-arm before delivery so the callback may stop or delete the timer.
+        // Periodic timers keep their phase; if the host stalled for more than
+        // a period each missed expiry is still delivered, as FreeRTOS does when
+        // it reloads an auto-reload timer from its previous expiry time.
+        if (t->periodic) {
+            t->expiry_ms += t->period_ms;
+            heap_sift_down(0);
+        } else {
+            heap_remove(t);
+        }
+
+        g_timer_service.expiries++;
+        if (t->callback) {
+            t->callback((bsp_timer_handle_t)t, t->context);
+        } else {
+            bsp_task_notify(t->notify_task, t->notify_bits);
+        }
+    }
+}
+
+// =============================================================================
+// RTC ALARM
+// =============================================================================
+
+// The alarm is a one-shot notify timer on the virtual clock. Timer ticks
+// are 32-bit, so an alarm more than ~24 days out fires early at that limit.
+#define SIM_RTC_ALARM_MAX_MS    0x7FFFFFFFu
+
+int bsp_rtc_set_alarm(uint64_t utc_seconds, bsp_task_handle_t task, uint32_t notify_bits) {
+    if (!task || notify_bits == 0) return -1;
+    bsp_rtc_cancel_alarm();
+
+    // The UTC clock ticks over on whole seconds of the virtual clock
+    uint64_t now_utc = bsp_get_utc_time_seconds();
+    if (utc_seconds <= now_utc) {
+        bsp_task_notify(task, notify_bits);
+        return 0;
+    }
+    uint64_t delay_ms = (utc_seconds - now_utc) * 1000u - bsp_get_tick_ms64() % 1000u;
+    if (delay_ms > SIM_RTC_ALARM_MAX_MS) delay_ms = SIM_RTC_ALARM_MAX_MS;
+
+    g_timer_service.rtc_alarm = bsp_timer_create_notify("RTC_Alarm", (uint32_t)delay_ms, false,
+                                                        task, notify_bits);
+    if (!g_timer_service.rtc_alarm || !bsp_timer_start(g_timer_service.rtc_alarm)) {
+        bsp_rtc_cancel_alarm();
+        return -1;
+    }
+    return 0;
+}
+
+void bsp_rtc_cancel_alarm(void) {
+    if (g_timer_service.rtc_alarm) {
+        bsp_timer_delete(g_timer_service.rtc_alarm);
+        g_timer_service.rtc_alarm = NULL;
+    }
+}
+
+uint32_t sim_timer_get_expiry_count(void) {
+    return g_timer_service.expiries;
+}
+
+uint32_t bsp_sim_timer_next_expiry_ms(void) {
+    if (g_timer_heap_size == 0) return BSP_WAIT_FOREVER;
+
+    int32_t remaining = (int32_t)(g_timer_heap[0]->expiry_ms - bsp_get_tick_ms());
+    return (remaining > 0) ? (uint32_t)remaining : 0;
+}
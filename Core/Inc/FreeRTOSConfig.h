@@ -166,6 +166,15 @@ standard names. */
 
 /* USER CODE BEGIN Defines */
 /* Section where parameter definitions can be added (for instance, to override default ones in FreeRTOS.h) */
+
+/* Tickless idle: the BSP suppresses SysTick and wakes from STOP2 on the RTC
+wake-up timer (see BSP_STM32/bsp_stm32.c and Power_Management_System_Design.txt) */
+#define configUSE_TICKLESS_IDLE                  2
+#define configEXPECTED_IDLE_TIME_BEFORE_SLEEP    2
+#if defined(__ICCARM__) || defined(__CC_ARM) || defined(__GNUC__)
+  void bsp_power_suppress_ticks_and_sleep(uint32_t expected_idle_ticks);
+#endif
+#define portSUPPRESS_TICKS_AND_SLEEP( xExpectedIdleTime ) bsp_power_suppress_ticks_and_sleep( xExpectedIdleTime )
 /* USER CODE END Defines */
 
 #endif /* FREERTOS_CONFIG_H */
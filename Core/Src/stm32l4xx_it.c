@@ -48,7 +48,9 @@
 
 /* Private function prototypes -----------------------------------------------*/
 /* USER CODE BEGIN PFP */
-
+void bsp_power_rtc_wakeup_irq_handler(void);
+void bsp_crc_dma_irq_handler(void);
+void bsp_rtc_alarm_irq_handler(void);
 /* USER CODE END PFP */
 
 /* Private user code ---------------------------------------------------------*/
@@ -271,4 +273,31 @@ void EXTI15_10_IRQHandler(void)
 
 /* USER CODE BEGIN 1 */
 
+/**
+  * @brief This function handles RTC wake-up interrupt through EXTI line 20
+  *        (tickless idle wake source, armed by the BSP before STOP2).
+  */
+void RTC_WKUP_IRQHandler(void)
+{
+  bsp_power_rtc_wakeup_irq_handler();
+}
+
+/**
+  * @brief This function handles DMA1 channel2 global interrupt
+  *        (memory-to-memory transfers feeding the CRC unit, see the BSP).
+  */
+void DMA1_Channel2_IRQHandler(void)
+{
+  bsp_crc_dma_irq_handler();
+}
+
+/**
+  * @brief This function handles RTC alarm A and B interrupt through EXTI line 18
+  *        (lock schedule wake source, armed by the BSP).
+  */
+void RTC_Alarm_IRQHandler(void)
+{
+  bsp_rtc_alarm_irq_handler();
+}
+
 /* USER CODE END 1 */
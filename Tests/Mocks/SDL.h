@@ -0,0 +1,121 @@
+// CKOS Headless SDL Mock
+// Just enough of the SDL2 API for BSP_Simulator sources to build and run in
+// unit tests and benchmarks without a display. Time is the host monotonic
+// clock; no window is created and no input ever arrives.
+
+#ifndef CKOS_MOCK_SDL_H
+#define CKOS_MOCK_SDL_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <time.h>
+
+typedef uint8_t Uint8;
+typedef uint32_t Uint32;
+typedef uint64_t Uint64;
+
+typedef struct SDL_Window { int unused; } SDL_Window;
+typedef struct SDL_Renderer { int unused; } SDL_Renderer;
+typedef struct SDL_Texture { int unused; } SDL_Texture;
+
+typedef struct { int sym; } SDL_Keysym;
+typedef struct { Uint32 type; SDL_Keysym keysym; } SDL_KeyboardEvent;
+typedef union { Uint32 type; SDL_KeyboardEvent key; } SDL_Event;
+
+enum {
+    SDL_QUIT = 0x100,
+    SDL_KEYDOWN = 0x300,
+    SDL_KEYUP
+};
+
+enum {
+    SDLK_ESCAPE = 27,
+    SDLK_a = 'a',
+    SDLK_b = 'b',
+    SDLK_RIGHT = 0x4000004F,
+    SDLK_LEFT,
+    SDLK_DOWN,
+    SDLK_UP
+};
+
+#define SDL_INIT_VIDEO              0x00000020u
+#define SDL_INIT_EVENTS             0x00004000u
+#define SDL_WINDOWPOS_CENTERED      0x2FFF0000
+#define SDL_WINDOW_SHOWN            0x00000004u
+#define SDL_RENDERER_ACCELERATED    0x00000002u
+#define SDL_RENDERER_PRESENTVSYNC   0x00000004u
+#define SDL_PIXELFORMAT_RGBA8888    0x16462004u
+#define SDL_PIXELFORMAT_ARGB8888    0x16362004u
+#define SDL_TEXTUREACCESS_STREAMING 1
+
+static inline int SDL_Init(Uint32 flags) { (void)flags; return 0; }
+static inline void SDL_Quit(void) {}
+static inline const char* SDL_GetError(void) { return "headless mock"; }
+
+static inline SDL_Window* SDL_CreateWindow(const char* title, int x, int y, int w, int h, Uint32 flags) {
+    static SDL_Window window;
+    (void)title; (void)x; (void)y; (void)w; (void)h; (void)flags;
+    return &window;
+}
+
+static inline SDL_Renderer* SDL_CreateRenderer(SDL_Window* window, int index, Uint32 flags) {
+    static SDL_Renderer renderer;
+    (void)window; (void)index; (void)flags;
+    return &renderer;
+}
+
+static inline SDL_Texture* SDL_CreateTexture(SDL_Renderer* renderer, Uint32 format, int access, int w, int h) {
+    static SDL_Texture texture;
+    (void)renderer; (void)format; (void)access; (void)w; (void)h;
+    return &texture;
+}
+
+static inline void SDL_DestroyTexture(SDL_Texture* texture) { (void)texture; }
+static inline void SDL_DestroyRenderer(SDL_Renderer* renderer) { (void)renderer; }
+static inline void SDL_DestroyWindow(SDL_Window* window) { (void)window; }
+
+static inline int SDL_UpdateTexture(SDL_Texture* texture, const void* rect, const void* pixels, int pitch) {
+    (void)texture; (void)rect; (void)pixels; (void)pitch;
+    return 0;
+}
+
+static inline int SDL_SetRenderDrawColor(SDL_Renderer* renderer, Uint8 r, Uint8 g, Uint8 b, Uint8 a) {
+    (void)renderer; (void)r; (void)g; (void)b; (void)a;
+    return 0;
+}
+
+static inline int SDL_RenderClear(SDL_Renderer* renderer) { (void)renderer; return 0; }
+
+static inline int SDL_RenderCopy(SDL_Renderer* renderer, SDL_Texture* texture, const void* src, const void* dst) {
+    (void)renderer; (void)texture; (void)src; (void)dst;
+    return 0;
+}
+
+static inline void SDL_RenderPresent(SDL_Renderer* renderer) { (void)renderer; }
+
+static inline int SDL_PollEvent(SDL_Event* event) { (void)event; return 0; }
+
+static inline Uint32 SDL_GetTicks(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (Uint32)(ts.tv_sec * 1000u + ts.tv_nsec / 1000000u);
+}
+
+static inline Uint64 SDL_GetTicks64(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (Uint64)ts.tv_sec * 1000u + (Uint64)ts.tv_nsec / 1000000u;
+}
+
+static inline void SDL_Delay(Uint32 ms) {
+    struct timespec ts = { (time_t)(ms / 1000u), (long)(ms % 1000u) * 1000000L };
+    nanosleep(&ts, NULL);
+}
+
+static inline int SDL_WaitEventTimeout(SDL_Event* event, int timeout_ms) {
+    (void)event;
+    if (timeout_ms > 0) SDL_Delay((Uint32)timeout_ms);
+    return 0;
+}
+
+#endif // CKOS_MOCK_SDL_H
@@ -0,0 +1,186 @@
+// CKOS CRC Benchmark
+// Checks the slice-by-8 software CRCs in Utils/utils.c against the simulator's
+// bit-serial model of the STM32 CRC unit, then measures how fast storage
+// records are validated: byte-at-a-time table lookup versus slice-by-8, and a
+// full kv_store mount
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "BSP/bsp_api.h"
+#include "Config/app_config.h"
+#include "Utils/utils.h"
+#include "Utils/utils_crc_tables.h"
+#include "Utils/kv_store.h"
+
+#define BENCH_BYTES        (64u * 1024u * 1024u)   // Per size and method
+#define BENCH_MOUNTS       2000
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+// Keeps the CRCs from being optimised away
+static volatile uint32_t g_sink;
+
+// The table-per-byte loop utils_crc16() used before slice-by-8
+static uint16_t crc16_bytewise(const uint8_t* data, size_t length) {
+    uint16_t crc = UTILS_CRC16_INIT;
+    for (size_t i = 0; i < length; i++) {
+        crc = (uint16_t)((crc << 8) ^ crc16_slice_table[0][((crc >> 8) ^ data[i]) & 0xFF]);
+    }
+    return crc;
+}
+
+// =============================================================================
+// CORRECTNESS
+// =============================================================================
+
+static bool check_known_values(void) {
+    const uint8_t check[] = "123456789";
+    bool ok = utils_crc16(check, 9) == 0x29B1 &&        // CRC-16/CCITT-FALSE
+              utils_crc32(check, 9) == 0x0376E6E7u;     // CRC-32/MPEG-2
+    printf("  [%s] standard check values\n", ok ? "PASS" : "FAIL");
+    return ok;
+}
+
+static bool check_against_unit_model(void) {
+    uint8_t data[600];
+    srand(1234);
+    for (size_t i = 0; i < sizeof(data); i++) {
+        data[i] = (uint8_t)rand();
+    }
+
+    bool ok = true;
+    for (size_t length = 0; length <= sizeof(data) && ok; length++) {
+        uint32_t model16 = bsp_crc_update(BSP_CRC_16_CCITT, UTILS_CRC16_INIT, data, length);
+        uint32_t model32 = bsp_crc_update(BSP_CRC_32, UTILS_CRC32_INIT, data, length);
+        ok = utils_crc16(data, length) == model16 && utils_crc32(data, length) == model32 &&
+             crc16_bytewise(data, length) == model16;
+
+        // Streaming in two pieces gives the same result
+        size_t split = length / 3;
+        uint16_t part16 = utils_crc16_update(UTILS_CRC16_INIT, data, split);
+        uint32_t part32 = utils_crc32_update(UTILS_CRC32_INIT, data, split);
+        ok = ok && utils_crc16_update(part16, data + split, length - split) == model16;
+        ok = ok && utils_crc32_update(part32, data + split, length - split) == model32;
+    }
+    printf("  [%s] slice-by-8 matches the CRC unit model, 0-%u bytes, streamed\n",
+           ok ? "PASS" : "FAIL", (unsigned)sizeof(data));
+    return ok;
+}
+
+// =============================================================================
+// THROUGHPUT
+// =============================================================================
+
+static double mb_per_s(double bytes, double ns) {
+    return bytes / ns * 1e9 / (1024.0 * 1024.0);
+}
+
+// size: a small kv_store record, an event log block, the largest kv_store
+// record, a flash page
+static bool run_size(size_t size) {
+    uint8_t* data = malloc(size);
+    if (!data) return false;
+    memset(data, 0x5A, size);
+    size_t rounds = BENCH_BYTES / size;
+
+    double start = now_ns();
+    for (size_t i = 0; i < rounds; i++) {
+        data[0] = (uint8_t)i;
+        g_sink += crc16_bytewise(data, size);
+    }
+    double bytewise_ns = now_ns() - start;
+
+    start = now_ns();
+    for (size_t i = 0; i < rounds; i++) {
+        data[0] = (uint8_t)i;
+        g_sink += utils_crc16(data, size);
+    }
+    double slice_ns = now_ns() - start;
+
+    start = now_ns();
+    for (size_t i = 0; i < rounds; i++) {
+        data[0] = (uint8_t)i;
+        g_sink += utils_crc32(data, size);
+    }
+    double slice32_ns = now_ns() - start;
+    free(data);
+
+    double bytes = (double)rounds * size;
+    printf("  %5u-byte records  bytewise %7.1f MB/s   slice-by-8 %7.1f MB/s (%.1fx)"
+           "   crc32 %7.1f MB/s   %6.1f ns/record\n",
+           (unsigned)size, mb_per_s(bytes, bytewise_ns), mb_per_s(bytes, slice_ns),
+           bytewise_ns / slice_ns, mb_per_s(bytes, slice32_ns), slice_ns / rounds);
+
+    // Tiny records are all loop overhead; from an event log block up the
+    // wider step has to pay off
+    bool ok = size < 64 || slice_ns < bytewise_ns;
+    if (!ok) printf("  [FAIL] slice-by-8 not faster at %u bytes\n", (unsigned)size);
+    return ok;
+}
+
+// Mount validates the CRC of every record in the region
+static bool run_mount(void) {
+    void* device = calloc(1, bsp_sim_instance_size());
+    static KvStore_t store;
+    if (!device) return false;
+    bsp_sim_instance_init(device);
+    bsp_sim_instance_bind(device);
+
+    bool ok = kv_store_mount(&store, CONFIG_STORAGE_CONFIG_START_ADDR,
+                             CONFIG_STORAGE_CONFIG_SIZE) == 0;
+    uint8_t value[24];
+    uint32_t records = 0;
+    for (uint32_t i = 0; ok && i < 60; i++) {
+        memset(value, (int)i, sizeof(value));
+        ok = kv_store_write(&store, (uint16_t)(i % 8), value, sizeof(value)) == 0;
+    }
+    KvStoreStats_t stats;
+    kv_store_get_stats(&store, &stats);
+    records = stats.records_written;
+
+    double start = now_ns();
+    for (int i = 0; ok && i < BENCH_MOUNTS; i++) {
+        ok = kv_store_mount(&store, CONFIG_STORAGE_CONFIG_START_ADDR,
+                            CONFIG_STORAGE_CONFIG_SIZE) == 0;
+    }
+    double mount_ns = (now_ns() - start) / BENCH_MOUNTS;
+
+    printf("  kv_store mount      %.1f us for a %u-byte region (%u records written)\n",
+           mount_ns / 1000.0, (unsigned)CONFIG_STORAGE_CONFIG_SIZE, (unsigned)records);
+
+    bsp_sim_instance_release(device);
+    bsp_sim_instance_bind(NULL);
+    free(device);
+    printf("  [%s] mount after %u record writes\n", ok ? "PASS" : "FAIL", (unsigned)records);
+    return ok;
+}
+
+int main(void) {
+    printf("CKOS CRC Benchmark\n");
+    printf("==================\n\n");
+
+    int passed = 0;
+    int total = 0;
+
+    total++; if (check_known_values()) passed++;
+    total++; if (check_against_unit_model()) passed++;
+    printf("\n");
+
+    static const size_t sizes[] = { 12, 64, 260, BSP_STORAGE_PAGE_SIZE };
+    for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+        total++; if (run_size(sizes[i])) passed++;
+    }
+    total++; if (run_mount()) passed++;
+
+    printf("\nBenchmark Results: %d/%d passed\n", passed, total);
+    printf("Note: host figures are the software path. On target the CRC unit\n");
+    printf("takes a word per AHB write; records of 256 bytes or more are fed\n");
+    printf("by DMA while the calling task blocks.\n");
+    return (passed == total) ? 0 : 1;
+}
@@ -0,0 +1,224 @@
+// CKOS Agent Dialog Selection Benchmark
+// Picks dialog from synthetic corpora of growing size, generated into the
+// build directory by Tools/Scripts/gen_dialog_tables.py --synthetic: section
+// 4.2's linear filter and weighted pick versus the indexed selection in
+// AppLogic/agent_dialog.c. The indexed cost should stay nearly flat.
+// Then, per agent of the real corpus, how far the Huffman-coded text
+// shrinks and how fast it streams out a character at a time.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "AppLogic/agent_dialog.h"
+#include "bench_dialog_tables.h"
+
+#define BENCH_SELECTIONS    200000      // Per corpus and method
+#define BENCH_MOODS         256         // Random mood and context mix
+#define MAX_MATCHES         4096
+#define BENCH_TEXT_ROUNDS   200         // Passes over each agent's text
+#define REAL_AGENTS         3
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+// Keeps the picks from being optimised away
+static volatile uintptr_t g_sink;
+
+typedef struct {
+    uint8_t mood[AGENT_MOOD_DIMENSION_COUNT];
+    DialogContext context;
+} Query_t;
+
+static Query_t g_queries[BENCH_MOODS];
+
+static uint32_t xorshift32(uint32_t* state) {
+    uint32_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state = x;
+    return x;
+}
+
+// Section 4.2 as written: filter the whole array, then weigh the matches
+static const DialogEntry_t* linear_select(const DialogIndex_t* index, DialogContext context,
+                                          const uint8_t mood[AGENT_MOOD_DIMENSION_COUNT],
+                                          uint32_t* rng_state) {
+    static const DialogEntry_t* matches[MAX_MATCHES];
+    uint32_t match_count = 0;
+    for (uint16_t i = 0; i < index->entry_count; i++) {
+        if (agent_dialog_matches(&index->entries[i], context, mood)) {
+            matches[match_count++] = &index->entries[i];
+        }
+    }
+    if (match_count == 0) return NULL;
+
+    uint32_t total_weight = 0;
+    for (uint32_t i = 0; i < match_count; i++) {
+        total_weight += matches[i]->priority;
+    }
+    uint32_t rand_val = xorshift32(rng_state) % total_weight;
+    uint32_t cumulative = 0;
+    for (uint32_t i = 0; i < match_count; i++) {
+        cumulative += matches[i]->priority;
+        if (rand_val < cumulative) return matches[i];
+    }
+    return NULL;
+}
+
+// =============================================================================
+// CORRECTNESS
+// =============================================================================
+
+static bool check_candidates(const DialogIndex_t* index) {
+    static uint16_t indexed[MAX_MATCHES];
+    bool ok = true;
+    uint32_t matched = 0;
+    for (int q = 0; q < BENCH_MOODS && ok; q++) {
+        uint16_t n = agent_dialog_candidates(index, g_queries[q].context, g_queries[q].mood,
+                                             indexed, MAX_MATCHES);
+        uint16_t expected = 0;
+        for (uint16_t i = 0; i < index->entry_count && ok; i++) {
+            if (agent_dialog_matches(&index->entries[i], g_queries[q].context, g_queries[q].mood)) {
+                ok = expected < n && indexed[expected] == i;
+                expected++;
+            }
+        }
+        ok = ok && expected == n;
+        matched += n;
+    }
+    printf("  [%s] %4u entries: index matches the linear filter (%.1f candidates per query)\n",
+           ok ? "PASS" : "FAIL", (unsigned)index->entry_count, (double)matched / BENCH_MOODS);
+    return ok;
+}
+
+// =============================================================================
+// SELECTION COST
+// =============================================================================
+
+typedef const DialogEntry_t* (*SelectFn)(const DialogIndex_t*, DialogContext,
+                                         const uint8_t[AGENT_MOOD_DIMENSION_COUNT], uint32_t*);
+
+static double time_selection(const DialogIndex_t* index, SelectFn select) {
+    uint32_t rng = 0x12345678u;
+    double start = now_ns();
+    for (uint32_t i = 0; i < BENCH_SELECTIONS; i++) {
+        const Query_t* query = &g_queries[i % BENCH_MOODS];
+        g_sink += (uintptr_t)select(index, query->context, query->mood, &rng);
+    }
+    return (now_ns() - start) / BENCH_SELECTIONS;
+}
+
+// =============================================================================
+// TEXT DECODE
+// =============================================================================
+
+// Streams every entry's text as the layout reads it, checks it against the
+// copy and reports bits per character and decode speed
+static bool bench_agent_text(uint8_t agent, const char* name) {
+    const DialogIndex_t* index = agent_dialog_index(agent);
+    uint32_t chars = 0;
+    uint32_t bits = 0;
+    bool ok = true;
+    for (uint16_t i = 0; i < index->entry_count; i++) {
+        char copied[256];
+        uint16_t length = agent_dialog_text_copy(index->entries[i].text, copied, sizeof(copied));
+        DisplayTextSource source;
+        agent_dialog_text_source(index->entries[i].text, &source);
+        uint16_t n = 0;
+        int c;
+        while ((c = source.next(&source)) >= 0) {
+            ok = ok && n < length && c == copied[n];
+            n++;
+        }
+        ok = ok && n == length;
+        chars += length;
+        bits += source.position - index->entries[i].text;
+    }
+
+    double start = now_ns();
+    for (int round = 0; round < BENCH_TEXT_ROUNDS; round++) {
+        for (uint16_t i = 0; i < index->entry_count; i++) {
+            DisplayTextSource source;
+            agent_dialog_text_source(index->entries[i].text, &source);
+            int c;
+            while ((c = source.next(&source)) >= 0) g_sink += (uintptr_t)c;
+        }
+    }
+    double ns_per_char = (now_ns() - start) / ((double)chars * BENCH_TEXT_ROUNDS);
+
+    // Characters only: the terminator costs a byte plain and one code packed
+    double ratio = bits / (8.0 * chars);
+    ok = ok && ratio < 0.7;
+    printf("  [%s] %-8s %4u chars  %5.2f bits/char (%.1f%%)  %5.1f ns/char  %6.1f MB/s\n",
+           ok ? "PASS" : "FAIL", name, (unsigned)chars, 8.0 * ratio, 100.0 * ratio,
+           ns_per_char, 1e3 / ns_per_char);
+    return ok;
+}
+
+int main(void) {
+    printf("CKOS Agent Dialog Selection Benchmark\n");
+    printf("=====================================\n\n");
+
+    int passed = 0;
+    int total = 0;
+
+    // Moods spread over the whole range, any context
+    uint32_t rng = 2024;
+    for (int q = 0; q < BENCH_MOODS; q++) {
+        for (int d = 0; d < AGENT_MOOD_DIMENSION_COUNT; d++) {
+            g_queries[q].mood[d] = (uint8_t)(xorshift32(&rng) % 101);
+        }
+        g_queries[q].context = (DialogContext)(xorshift32(&rng) % DIALOG_CONTEXT_COUNT);
+    }
+
+    for (int c = 0; c < BENCH_DIALOG_TABLES_COUNT; c++) {
+        total++; if (check_candidates(bench_dialog_tables[c])) passed++;
+    }
+    printf("\n");
+
+    double linear_ns[BENCH_DIALOG_TABLES_COUNT];
+    double indexed_ns[BENCH_DIALOG_TABLES_COUNT];
+    for (int c = 0; c < BENCH_DIALOG_TABLES_COUNT; c++) {
+        const DialogIndex_t* index = bench_dialog_tables[c];
+        linear_ns[c] = time_selection(index, linear_select);
+        indexed_ns[c] = time_selection(index, agent_dialog_select);
+        printf("  %4u entries  linear %8.1f ns/selection   indexed %6.1f ns/selection (%.1fx)\n",
+               (unsigned)index->entry_count, linear_ns[c], indexed_ns[c], linear_ns[c] / indexed_ns[c]);
+    }
+
+    // The linear filter grows with the corpus; the index should grow by a
+    // small fraction of that, and win from a few hundred entries up
+    int last = BENCH_DIALOG_TABLES_COUNT - 1;
+    double linear_growth = linear_ns[last] / linear_ns[0];
+    double indexed_growth = indexed_ns[last] / indexed_ns[0];
+    bool flat = indexed_growth * 8.0 < linear_growth;
+    printf("\n  %u to %u entries: linear %.1fx, indexed %.1fx\n",
+           (unsigned)bench_dialog_tables[0]->entry_count, (unsigned)bench_dialog_tables[last]->entry_count,
+           linear_growth, indexed_growth);
+    total++; if (flat) passed++;
+    printf("  [%s] indexed cost stays flat as the corpus grows\n", flat ? "PASS" : "FAIL");
+
+    bool faster = true;
+    for (int c = 0; c < BENCH_DIALOG_TABLES_COUNT; c++) {
+        if (bench_dialog_tables[c]->entry_count >= 256) faster = faster && indexed_ns[c] < linear_ns[c];
+    }
+    total++; if (faster) passed++;
+    printf("  [%s] indexed faster from 256 entries\n", faster ? "PASS" : "FAIL");
+
+    printf("\nText, streamed from the real tables:\n");
+    static const char* const agents[REAL_AGENTS] = { "rookie", "veteran", "warden" };
+    for (uint8_t a = 0; a < REAL_AGENTS; a++) {
+        total++; if (bench_agent_text(a, agents[a])) passed++;
+    }
+
+    printf("\nBenchmark Results: %d/%d passed\n", passed, total);
+    printf("Note: the index trades flash for time; the generator prints its size\n");
+    printf("per corpus at the top of each table. The layout reads each word twice,\n");
+    printf("once to measure it and once to draw it.\n");
+    return (passed == total) ? 0 : 1;
+}
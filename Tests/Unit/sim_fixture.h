@@ -0,0 +1,42 @@
+// CKOS Simulator Test Fixtures
+// Shared setup for the unit tests that run on the simulator BSP: every test
+// starts from a blank device, bound to the calling thread, on a fast-forward
+// virtual clock. Header-only so each test links just the layers it uses.
+
+#ifndef SIM_FIXTURE_H
+#define SIM_FIXTURE_H
+
+#include <stdbool.h>
+#include <string.h>
+#include "BSP/bsp_api.h"
+#include "Hardware/hardware_api.h"
+#include "Simulator/sim_fleet.h"
+
+// BSP instance only: erased flash, default sensors, clock back at zero
+static inline void sim_fixture_blank_bsp(void* bsp_state) {
+    bsp_sim_instance_release(bsp_state);
+    bsp_sim_instance_init(bsp_state);
+    bsp_sim_instance_bind(bsp_state);
+    bsp_sim_clock_set_fast_forward(true);
+}
+
+// BSP instance with a zeroed hardware service on top; the test still calls
+// hardware_init()
+static inline void sim_fixture_blank_hardware(void* bsp_state, void* hardware_state) {
+    memset(hardware_state, 0, hardware_instance_size());
+    sim_fixture_blank_bsp(bsp_state);
+    hardware_instance_bind(hardware_state);
+}
+
+// A whole simulated device (BSP, hardware and application state) in place of
+// *device, which may be NULL
+static inline bool sim_fixture_blank_device(sim_device_t** device) {
+    sim_device_destroy(*device);
+    *device = sim_device_create(0);
+    if (!*device) return false;
+    sim_device_bind(*device);
+    bsp_sim_clock_set_fast_forward(true);
+    return true;
+}
+
+#endif // SIM_FIXTURE_H
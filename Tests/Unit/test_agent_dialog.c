@@ -0,0 +1,278 @@
+// CKOS Agent Dialog Tests
+// Tests for the indexed dialog selection in AppLogic/agent_dialog.c against
+// section 4.2's linear filter, and for its compressed text, over the
+// generated corpus tables
+
+#include <stdio.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include "AppLogic/agent_dialog.h"
+
+#define AGENTS          3
+#define MAX_EDGES       48
+
+static void print_test_result(const char* test_name, bool passed) {
+    printf("[%s] %s\n", passed ? "PASS" : "FAIL", test_name);
+}
+
+static void add_edge(uint8_t* edges, int* count, int level) {
+    if (level < 0 || level > 100) return;
+    for (int i = 0; i < *count; i++) {
+        if (edges[i] == level) return;
+    }
+    if (*count < MAX_EDGES) edges[(*count)++] = (uint8_t)level;
+}
+
+// Every level where some entry starts or stops matching, and either side
+static int mood_edges(const DialogIndex_t* index, int dimension, uint8_t* edges) {
+    int count = 0;
+    add_edge(edges, &count, 0);
+    add_edge(edges, &count, 100);
+    for (uint16_t i = 0; i < index->entry_count; i++) {
+        const DialogEntry_t* entry = &index->entries[i];
+        if (entry->min_mood[dimension] != DIALOG_MOOD_ANY) {
+            add_edge(edges, &count, entry->min_mood[dimension] - 1);
+            add_edge(edges, &count, entry->min_mood[dimension]);
+        }
+        if (entry->max_mood[dimension] != DIALOG_MOOD_ANY) {
+            add_edge(edges, &count, entry->max_mood[dimension]);
+            add_edge(edges, &count, entry->max_mood[dimension] + 1);
+        }
+    }
+    return count;
+}
+
+// Section 4.2's loop over the whole array
+static uint16_t linear_candidates(const DialogIndex_t* index, DialogContext context,
+                                  const uint8_t mood[AGENT_MOOD_DIMENSION_COUNT], uint16_t* entries) {
+    uint16_t count = 0;
+    for (uint16_t i = 0; i < index->entry_count; i++) {
+        if (agent_dialog_matches(&index->entries[i], context, mood)) entries[count++] = i;
+    }
+    return count;
+}
+
+// =============================================================================
+// CANDIDATE TESTS
+// =============================================================================
+
+bool test_index_matches_linear_filter(void) {
+    bool result = true;
+    uint32_t checked = 0;
+
+    for (uint8_t agent = 0; agent < AGENTS && result; agent++) {
+        const DialogIndex_t* index = agent_dialog_index(agent);
+        result = index != NULL && index->entry_count > 0;
+        if (!result) break;
+
+        uint8_t edges[AGENT_MOOD_DIMENSION_COUNT][MAX_EDGES];
+        int count[AGENT_MOOD_DIMENSION_COUNT];
+        for (int d = 0; d < AGENT_MOOD_DIMENSION_COUNT; d++) {
+            count[d] = mood_edges(index, d, edges[d]);
+        }
+
+        // Both sides of every range edge, in every combination
+        uint16_t indexed[512];
+        uint16_t linear[512];
+        for (int a = 0; a < count[0] && result; a++)
+        for (int s = 0; s < count[1] && result; s++)
+        for (int p = 0; p < count[2] && result; p++)
+        for (int t = 0; t < count[3] && result; t++) {
+            uint8_t mood[AGENT_MOOD_DIMENSION_COUNT] = { edges[0][a], edges[1][s], edges[2][p], edges[3][t] };
+            for (int c = 0; c < DIALOG_CONTEXT_COUNT && result; c++) {
+                uint16_t n = agent_dialog_candidates(index, (DialogContext)c, mood, indexed, 512);
+                uint16_t expected = linear_candidates(index, (DialogContext)c, mood, linear);
+                // The index lists a context's entries in array order too
+                result = n == expected && memcmp(indexed, linear, n * sizeof(uint16_t)) == 0;
+                checked++;
+            }
+        }
+    }
+
+    printf("  %lu agent, context and mood combinations\n", (unsigned long)checked);
+    print_test_result("Index finds exactly the linear filter's candidates", result);
+    return result;
+}
+
+bool test_no_candidates(void) {
+    const DialogIndex_t* index = agent_dialog_index(0);
+    uint32_t rng = 1;
+
+    // Negotiation needs trust above 60
+    const uint8_t wary[AGENT_MOOD_DIMENSION_COUNT] = { 50, 50, 50, 60 };
+    bool result = agent_dialog_candidates(index, DIALOG_CTX_NEGOTIATION, wary, NULL, 0) == 0;
+    result = result && agent_dialog_select(index, DIALOG_CTX_NEGOTIATION, wary, &rng) == NULL;
+
+    // Levels above 100 read as 100
+    const uint8_t over[AGENT_MOOD_DIMENSION_COUNT] = { 50, 50, 50, 200 };
+    const uint8_t full[AGENT_MOOD_DIMENSION_COUNT] = { 50, 50, 50, 100 };
+    result = result && agent_dialog_candidates(index, DIALOG_CTX_NEGOTIATION, over, NULL, 0) ==
+                       agent_dialog_candidates(index, DIALOG_CTX_NEGOTIATION, full, NULL, 0);
+    result = result && agent_dialog_candidates(index, DIALOG_CTX_NEGOTIATION, full, NULL, 0) > 0;
+
+    result = result && agent_dialog_select(index, DIALOG_CONTEXT_COUNT, full, &rng) == NULL;
+    result = result && agent_dialog_select(index, DIALOG_CTX_GREETING, full, NULL) == NULL;
+    result = result && agent_dialog_index(AGENTS) == NULL;
+    print_test_result("Nothing is picked without candidates", result);
+    return result;
+}
+
+// =============================================================================
+// SELECTION TESTS
+// =============================================================================
+
+// Picks rounds times and checks every candidate comes up in proportion to
+// its priority, within 10%, and nothing else does
+static bool picks_by_priority(uint8_t agent, DialogContext context,
+                              const uint8_t mood[AGENT_MOOD_DIMENSION_COUNT], uint32_t rounds) {
+    const DialogIndex_t* index = agent_dialog_index(agent);
+    static uint32_t picks[1024];
+    memset(picks, 0, sizeof(picks));
+
+    uint32_t rng = 0;   // Reseeds itself
+    for (uint32_t i = 0; i < rounds; i++) {
+        const DialogEntry_t* entry = agent_dialog_select(index, context, mood, &rng);
+        if (!entry || !agent_dialog_matches(entry, context, mood)) return false;
+        picks[entry - index->entries]++;
+    }
+
+    uint16_t candidates[512];
+    uint16_t n = agent_dialog_candidates(index, context, mood, candidates, 512);
+    uint32_t weight = 0;
+    uint32_t counted = 0;
+    for (uint16_t i = 0; i < n; i++) {
+        weight += index->entries[candidates[i]].priority;
+        counted += picks[candidates[i]];
+    }
+    bool ok = n > 1 && counted == rounds;
+    for (uint16_t i = 0; i < n && ok; i++) {
+        double expected = (double)rounds * index->entries[candidates[i]].priority / weight;
+        double got = picks[candidates[i]];
+        ok = got > expected * 0.9 && got < expected * 1.1;
+    }
+    return ok;
+}
+
+bool test_selection_weighted_by_priority(void) {
+    // Trusted: most of the context matches, the draws nearly always land
+    const uint8_t trusted[AGENT_MOOD_DIMENSION_COUNT] = { 70, 30, 70, 90 };
+    bool result = picks_by_priority(0, DIALOG_CTX_BEG_EARLY_UNLOCK, trusted, 60000);
+
+    // Impatient and distrusted: few matches, so the exact fallback runs often
+    const uint8_t impatient[AGENT_MOOD_DIMENSION_COUNT] = { 20, 80, 10, 10 };
+    result = result && picks_by_priority(2, DIALOG_CTX_GREETING, impatient, 60000);
+    result = result && picks_by_priority(1, DIALOG_CTX_BEG_LESS_TIME, impatient, 60000);
+    print_test_result("Selection is weighted by priority", result);
+    return result;
+}
+
+// =============================================================================
+// TEXT TESTS
+// =============================================================================
+
+static const DialogEntry_t* find_entry(uint8_t agent, const char* text) {
+    const DialogIndex_t* index = agent_dialog_index(agent);
+    char decoded[128];
+    for (uint16_t i = 0; i < index->entry_count; i++) {
+        agent_dialog_text_copy(index->entries[i].text, decoded, sizeof(decoded));
+        if (strcmp(decoded, text) == 0) return &index->entries[i];
+    }
+    return NULL;
+}
+
+bool test_text_decodes(void) {
+    // First line of the corpus, and an option
+    char text[128];
+    const DialogIndex_t* rookie = agent_dialog_index(0);
+    uint16_t length = agent_dialog_text_copy(rookie->entries[0].text, text, sizeof(text));
+    bool result = strcmp(text, "Hey there! Ready for another great locked session?") == 0 && length == 50;
+    agent_dialog_text_copy(agent_dialog_option_text(DIALOG_OPTION_ASK_GAME), text, sizeof(text));
+    result = result && strcmp(text, "Ask to play a game") == 0;
+
+    // Cut short to fit, still terminated, full length returned
+    char small[5];
+    result = result && agent_dialog_text_copy(rookie->entries[0].text, small, sizeof(small)) == 50;
+    result = result && strcmp(small, "Hey ") == 0;
+
+    // Lines every agent has are stored once
+    const DialogEntry_t* shared = find_entry(0, "You've earned my complete trust. What do you need?");
+    result = result && shared && find_entry(2, "You've earned my complete trust. What do you need?") &&
+             find_entry(2, "You've earned my complete trust. What do you need?")->text == shared->text;
+
+    // Every entry decodes to printable text
+    for (uint8_t agent = 0; agent < AGENTS && result; agent++) {
+        const DialogIndex_t* index = agent_dialog_index(agent);
+        for (uint16_t i = 0; i < index->entry_count && result; i++) {
+            length = agent_dialog_text_copy(index->entries[i].text, text, sizeof(text));
+            result = length > 0 && length < sizeof(text);
+            for (uint16_t c = 0; c < length && result; c++) {
+                result = text[c] >= 32 && text[c] <= 126;
+            }
+        }
+    }
+    print_test_result("Text decodes from the shared code", result);
+    return result;
+}
+
+bool test_text_source_streams(void) {
+    const DialogIndex_t* warden = agent_dialog_index(2);
+    char copied[128];
+    agent_dialog_text_copy(warden->entries[0].text, copied, sizeof(copied));
+
+    // A character per read, as the copy has it
+    DisplayTextSource source;
+    agent_dialog_text_source(warden->entries[0].text, &source);
+    bool result = true;
+    size_t i = 0;
+    int c;
+    while ((c = source.next(&source)) >= 0 && result) {
+        result = i < strlen(copied) && c == copied[i++];
+    }
+    result = result && i == strlen(copied);
+
+    // The end sticks, and the position alone rewinds
+    result = result && source.next(&source) == -1 && source.next(&source) == -1;
+    agent_dialog_text_source(warden->entries[0].text, &source);
+    source.next(&source);
+    uint32_t second = source.position;
+    int expected = source.next(&source);
+    source.next(&source);
+    source.position = second;
+    result = result && source.next(&source) == expected && expected == copied[1];
+    print_test_result("Text source streams and rewinds", result);
+    return result;
+}
+
+int main(void) {
+    printf("CKOS Agent Dialog Tests\n");
+    printf("=======================\n\n");
+
+    int passed = 0;
+    int total = 0;
+
+    printf("Candidate Tests:\n");
+    total++; if (test_index_matches_linear_filter()) passed++;
+    total++; if (test_no_candidates()) passed++;
+    printf("\n");
+
+    printf("Selection Tests:\n");
+    total++; if (test_selection_weighted_by_priority()) passed++;
+    printf("\n");
+
+    printf("Text Tests:\n");
+    total++; if (test_text_decodes()) passed++;
+    total++; if (test_text_source_streams()) passed++;
+    printf("\n");
+
+    printf("Test Results: %d/%d passed (%.1f%%)\n",
+           passed, total, (float)passed / total * 100.0f);
+
+    if (passed == total) {
+        printf("All tests PASSED! ✓\n");
+        return 0;
+    } else {
+        printf("Some tests FAILED! ✗\n");
+        return 1;
+    }
+}
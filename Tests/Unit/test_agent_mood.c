@@ -0,0 +1,186 @@
+// CKOS Agent Mood Tests
+// Tests for the fixed-point mood engine in AppLogic/agent_mood.c: tier
+// baselines, event deltas, closed-form drift and the lock time influence
+
+#include <stdio.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include "AppLogic/agent_mood.h"
+
+#define ROOKIE      0
+#define VETERAN     1
+#define WARDEN      2
+#define T0          1700000000ull
+#define POINTS(p)   ((uint16_t)((p) * AGENT_MOOD_ONE))
+
+static void print_test_result(const char* test_name, bool passed) {
+    printf("[%s] %s\n", passed ? "PASS" : "FAIL", test_name);
+}
+
+static bool levels_are(const AgentMood_t* mood, uint64_t now, uint16_t affection,
+                       uint16_t strictness, uint16_t satisfaction, uint16_t trust) {
+    uint16_t level[AGENT_MOOD_DIMENSION_COUNT];
+    agent_mood_levels(mood, now, level);
+    return level[AGENT_MOOD_AFFECTION] == affection && level[AGENT_MOOD_STRICTNESS] == strictness &&
+           level[AGENT_MOOD_SATISFACTION] == satisfaction && level[AGENT_MOOD_TRUST] == trust;
+}
+
+// =============================================================================
+// EVENT TESTS
+// =============================================================================
+
+bool test_starts_at_tier_baseline(void) {
+    AgentMood_t mood;
+    agent_mood_init(&mood, ROOKIE, T0);
+    bool result = levels_are(&mood, T0, POINTS(90), POINTS(30), POINTS(70), POINTS(50));
+
+    // Nothing to drift toward, however long it sleeps
+    result = result && levels_are(&mood, T0 + 30ull * 86400, POINTS(90), POINTS(30), POINTS(70), POINTS(50));
+
+    agent_mood_init(&mood, WARDEN, T0);
+    result = result && levels_are(&mood, T0, POINTS(30), POINTS(90), POINTS(40), POINTS(30));
+    print_test_result("Moods start at the tier baseline", result);
+    return result;
+}
+
+bool test_events_scale_and_clamp(void) {
+    AgentMood_t mood;
+    agent_mood_init(&mood, ROOKIE, T0);
+
+    // Rookie: affection, patience and trust at full volatility
+    agent_mood_apply_event(&mood, AGENT_MOOD_EVENT_PROMISE_KEPT, T0);
+    bool result = agent_mood_level(&mood, AGENT_MOOD_AFFECTION, T0) == POINTS(95);
+    result = result && agent_mood_level(&mood, AGENT_MOOD_SATISFACTION, T0) == POINTS(75);
+    result = result && agent_mood_level(&mood, AGENT_MOOD_TRUST, T0) == POINTS(60);
+    // Strictness at 80%: 3 points is 2.4
+    result = result && agent_mood_level(&mood, AGENT_MOOD_STRICTNESS, T0) ==
+                       POINTS(30) - 3 * AGENT_MOOD_ONE * 4 / 5;
+
+    // Trust is lost at twice the rate it is gained
+    agent_mood_apply_event(&mood, AGENT_MOOD_EVENT_PROMISE_BROKEN, T0);
+    result = result && agent_mood_level(&mood, AGENT_MOOD_TRUST, T0) == POINTS(20);
+
+    // Clamped at both ends
+    for (int i = 0; i < 10; i++) {
+        agent_mood_apply_event(&mood, AGENT_MOOD_EVENT_BREAK_VIOLATION, T0);
+    }
+    result = result && levels_are(&mood, T0, 0, AGENT_MOOD_LEVEL_MAX, 0, 0);
+    print_test_result("Events scale by volatility and clamp", result);
+    return result;
+}
+
+// =============================================================================
+// DRIFT TESTS
+// =============================================================================
+
+bool test_drift_is_closed_form(void) {
+    AgentMood_t mood;
+    agent_mood_init(&mood, ROOKIE, T0);
+    const int8_t upset[AGENT_MOOD_DIMENSION_COUNT] = { -20, 0, -30, -10 };
+    agent_mood_apply(&mood, upset, T0);
+
+    // Patience recovers 3.75 points per 5 minutes, affection 1.25; trust
+    // stays. Every second of eight hours, against the straight line.
+    bool result = true;
+    for (uint64_t t = 0; t <= 8 * 3600 && result; t++) {
+        uint32_t patience = POINTS(40) + (uint32_t)(t * 960 / 300);
+        uint32_t affection = POINTS(70) + (uint32_t)(t * 320 / 300);
+        if (patience > POINTS(70)) patience = POINTS(70);
+        if (affection > POINTS(90)) affection = POINTS(90);
+        result = levels_are(&mood, T0 + t, (uint16_t)affection, POINTS(30),
+                            (uint16_t)patience, POINTS(30));
+    }
+
+    // Reached exactly at the baseline, and never past it
+    result = result && agent_mood_level(&mood, AGENT_MOOD_SATISFACTION, T0 + 40 * 60) == POINTS(70);
+    result = result && agent_mood_level(&mood, AGENT_MOOD_SATISFACTION, T0 + 40 * 60 - 1) < POINTS(70);
+    result = result && levels_are(&mood, T0 + 365ull * 86400, POINTS(90), POINTS(30),
+                                  POINTS(70), POINTS(30));
+    // A clock behind the anchor reads the anchored levels
+    result = result && agent_mood_level(&mood, AGENT_MOOD_SATISFACTION, T0 - 100) == POINTS(40);
+    print_test_result("Drift is closed form in the elapsed time", result);
+    return result;
+}
+
+bool test_events_settle_drift(void) {
+    AgentMood_t mood;
+    agent_mood_init(&mood, ROOKIE, T0);
+    const int8_t impatient[AGENT_MOOD_DIMENSION_COUNT] = { 0, 0, -30, 0 };
+    agent_mood_apply(&mood, impatient, T0);
+
+    // 150 s in: 1.875 points back, then thanked for 2 more
+    agent_mood_apply_event(&mood, AGENT_MOOD_EVENT_THANKS, T0 + 150);
+    uint16_t settled = (uint16_t)(POINTS(40) + 150 * 960 / 300 + POINTS(2));
+    bool result = mood.anchor_utc == T0 + 150;
+    result = result && agent_mood_level(&mood, AGENT_MOOD_SATISFACTION, T0 + 150) == settled;
+    result = result && agent_mood_level(&mood, AGENT_MOOD_SATISFACTION, T0 + 450) == settled + 960;
+
+    // Restored levels drift on from their own anchor
+    AgentMood_t restored;
+    agent_mood_restore(&restored, ROOKIE, mood.level, mood.anchor_utc);
+    result = result && agent_mood_level(&restored, AGENT_MOOD_SATISFACTION, T0 + 450) == settled + 960;
+    print_test_result("Events settle the drift before applying", result);
+    return result;
+}
+
+// =============================================================================
+// LOCK TIME TESTS
+// =============================================================================
+
+bool test_lock_hours_shift_baseline(void) {
+    AgentMood_t mood;
+    agent_mood_init(&mood, ROOKIE, T0);
+
+    agent_mood_set_lock_hours(&mood, 10, T0);
+    bool result = agent_mood_baseline(&mood, AGENT_MOOD_STRICTNESS) == POINTS(30);
+
+    // 25 hours: 2 points less strict, 1 less patient; affection unchanged
+    agent_mood_set_lock_hours(&mood, 25, T0);
+    result = result && agent_mood_baseline(&mood, AGENT_MOOD_STRICTNESS) == POINTS(28);
+    result = result && agent_mood_baseline(&mood, AGENT_MOOD_SATISFACTION) == POINTS(69);
+    result = result && agent_mood_baseline(&mood, AGENT_MOOD_AFFECTION) == POINTS(90);
+
+    // The levels drift over to it: 2 points at 2.5 per 5 minutes
+    result = result && agent_mood_level(&mood, AGENT_MOOD_STRICTNESS, T0 + 120) == POINTS(29);
+    result = result && agent_mood_level(&mood, AGENT_MOOD_STRICTNESS, T0 + 240) == POINTS(28);
+
+    // Never below zero
+    agent_mood_set_lock_hours(&mood, 100000, T0 + 240);
+    result = result && agent_mood_baseline(&mood, AGENT_MOOD_STRICTNESS) == 0;
+    print_test_result("Lock hours shift the baseline", result);
+    return result;
+}
+
+int main(void) {
+    printf("CKOS Agent Mood Tests\n");
+    printf("=====================\n\n");
+
+    int passed = 0;
+    int total = 0;
+
+    printf("Event Tests:\n");
+    total++; if (test_starts_at_tier_baseline()) passed++;
+    total++; if (test_events_scale_and_clamp()) passed++;
+    printf("\n");
+
+    printf("Drift Tests:\n");
+    total++; if (test_drift_is_closed_form()) passed++;
+    total++; if (test_events_settle_drift()) passed++;
+    printf("\n");
+
+    printf("Lock Time Tests:\n");
+    total++; if (test_lock_hours_shift_baseline()) passed++;
+    printf("\n");
+
+    printf("Test Results: %d/%d passed (%.1f%%)\n",
+           passed, total, (float)passed / total * 100.0f);
+
+    if (passed == total) {
+        printf("All tests PASSED! ✓\n");
+        return 0;
+    } else {
+        printf("Some tests FAILED! ✗\n");
+        return 1;
+    }
+}
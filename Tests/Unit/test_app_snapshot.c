@@ -0,0 +1,248 @@
+// CKOS Application State Snapshot Tests
+// Tests for the versioned AppLogicState/lock session snapshot in
+// AppLogic/app_logic.c: restore at boot, migration and rejection of bad
+// records, on a simulated device with the flash model
+
+#include <stdio.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include "Simulator/sim_fleet.h"
+#include "AppLogic/app_logic.h"
+#include "Display/display_api.h"
+#include "Hardware/hardware_api.h"
+#include "Utils/utils.h"
+#include "sim_fixture.h"
+
+static sim_device_t* g_device;
+static uint32_t g_lock_start;       // Locks start at boot, so none has run out
+
+static void print_test_result(const char* test_name, bool passed) {
+    printf("[%s] %s\n", passed ? "PASS" : "FAIL", test_name);
+}
+
+// Power-up: whatever only the config cache held is lost
+static void boot(void) {
+    hardware_init();
+    display_task_init();
+    app_logic_init();
+    display_task_update();
+}
+
+// Each test starts from a blank device, booted once
+static bool fresh_device(void) {
+    if (!sim_fixture_blank_device(&g_device)) return false;
+    g_lock_start = (uint32_t)bsp_get_utc_time_seconds();
+    boot();
+    return true;
+}
+
+static void press(bsp_button_id_t button) {
+    bsp_sim_clock_advance(200);     // Past the debounce window
+    sim_device_press_button(g_device, button);
+}
+
+static uint32_t storage_reads(void) {
+    bsp_sim_storage_stats_t stats;
+    bsp_sim_storage_get_stats(&stats);
+    return stats.reads;
+}
+
+static void seal(AppSnapshotHeader_t* header, uint8_t version, size_t size) {
+    header->magic = APP_SNAPSHOT_MAGIC;
+    header->version = version;
+    header->length = (uint8_t)(size - sizeof(*header));
+    header->crc = utils_crc32((const uint8_t*)header + sizeof(*header), header->length);
+}
+
+static AppSnapshot_t locked_snapshot(void) {
+    AppSnapshot_t snapshot;
+    memset(&snapshot, 0, sizeof(snapshot));
+    snapshot.flags = APP_SNAPSHOT_FLAG_TIMEZONE_CONFIGURED | APP_SNAPSHOT_FLAG_TIME_CONFIGURED;
+    snapshot.timezone_offset_hours = -5;
+    snapshot.state = STATE_LOCK_ACTIVE;
+    snapshot.selected_agent = AGENT_VETERAN;
+    snapshot.moods[AGENT_MOOD_AFFECTION] = 25 * AGENT_MOOD_ONE;
+    snapshot.utc_mood_anchor = g_lock_start;
+    snapshot.lock_type = LOCK_TYPE_AGENT;
+    snapshot.lock_state = LOCK_STATE_LOCKED;
+    snapshot.utc_lock_start_time = g_lock_start;
+    snapshot.utc_unlock_target_time = g_lock_start + 7200u;
+    snapshot.accumulated_seconds = 1800u;
+    seal(&snapshot.header, APP_SNAPSHOT_VERSION, sizeof(snapshot));
+    return snapshot;
+}
+
+static bool write_record(const void* record, uint32_t length) {
+    return hardware_config_write(HARDWARE_CONFIG_KEY_APP_SNAPSHOT, record, length) == 0 &&
+           hardware_config_flush() == 0;
+}
+
+// =============================================================================
+// RESTORE TESTS
+// =============================================================================
+
+bool test_first_power_up(void) {
+    bool result = fresh_device();
+    result = result && app_logic_get_state() == STATE_WELCOME;
+    result = result && display_get_current_screen() == SCREEN_ID_WELCOME;
+    result = result && app_logic_get_lock_session()->operational_state == LOCK_STATE_UNLOCKED;
+    print_test_result("Blank device boots to Welcome", result);
+    return result;
+}
+
+bool test_settings_survive_restart(void) {
+    bool result = fresh_device();
+    press(BSP_BUTTON_A);            // Welcome -> Timezone
+    press(BSP_BUTTON_RIGHT);
+    press(BSP_BUTTON_RIGHT);
+    press(BSP_BUTTON_A);            // -> Time setup
+    press(BSP_BUTTON_A);            // -> Menu
+    result = result && app_logic_get_state() == STATE_MENU;
+    result = result && hardware_config_flush() == 0;
+
+    boot();
+    result = result && app_logic_get_state() == STATE_MENU;
+    result = result && display_get_current_screen() == SCREEN_ID_MAIN_MENU;
+
+    // Setup is not offered again
+    press(BSP_BUTTON_B);            // Menu -> Welcome
+    press(BSP_BUTTON_A);
+    result = result && app_logic_get_state() == STATE_MENU;
+    print_test_result("Setup and timezone survive a restart", result);
+    return result;
+}
+
+bool test_lock_restored_in_one_read(void) {
+    bool result = fresh_device();
+    AppSnapshot_t snapshot = locked_snapshot();
+    result = result && write_record(&snapshot, sizeof(snapshot));
+
+    // Mounting scans the store; the restore itself is one read
+    hardware_init();
+    uint32_t reads = storage_reads();
+    app_logic_init();
+    result = result && storage_reads() - reads == 1;
+    display_task_update();
+
+    const LockSession_t* session = app_logic_get_lock_session();
+    result = result && app_logic_get_state() == STATE_LOCK_ACTIVE;
+    result = result && display_get_current_screen() == SCREEN_ID_LOCK_STATUS;
+    result = result && AGENT_MOOD_POINTS(app_logic_get_agent_mood(AGENT_MOOD_AFFECTION)) == 25;
+    result = result && session->operational_state == LOCK_STATE_LOCKED &&
+             session->utc_lock_start_time == g_lock_start &&
+             session->utc_unlock_target_time == g_lock_start + 7200u &&
+             session->current_session_accumulated_time_seconds == 1800u;
+    print_test_result("Lock in progress restored in one read, status screen first", result);
+    return result;
+}
+
+// =============================================================================
+// VERSION AND INTEGRITY TESTS
+// =============================================================================
+
+bool test_v1_moods_converted(void) {
+    bool result = fresh_device();
+    AppSnapshotV1_t old;
+    memset(&old, 0, sizeof(old));
+    old.flags = APP_SNAPSHOT_FLAG_TIMEZONE_CONFIGURED | APP_SNAPSHOT_FLAG_TIME_CONFIGURED;
+    old.state = STATE_LOCK_ACTIVE;
+    old.selected_agent = AGENT_VETERAN;
+    old.moods[AGENT_MOOD_AFFECTION] = 0.5f;
+    old.moods[AGENT_MOOD_STRICTNESS] = 1.5f;        // Clamped
+    old.moods[AGENT_MOOD_SATISFACTION] = -0.25f;
+    old.moods[AGENT_MOOD_TRUST] = 0.4f;
+    old.lock_type = LOCK_TYPE_AGENT;
+    old.lock_state = LOCK_STATE_LOCKED;
+    old.utc_lock_start_time = g_lock_start;
+    old.utc_unlock_target_time = g_lock_start + 7200u;
+    seal(&old.header, 1, sizeof(old));
+    result = result && write_record(&old, sizeof(old));
+
+    boot();
+    result = result && app_logic_get_state() == STATE_LOCK_ACTIVE;
+    result = result && app_logic_get_lock_session()->utc_unlock_target_time == g_lock_start + 7200u;
+
+    // Q8.8 points, holding as of the boot that converted them
+    AppSnapshot_t saved;
+    result = result && app_logic_save_snapshot() == 0;
+    result = result && hardware_config_read(HARDWARE_CONFIG_KEY_APP_SNAPSHOT, &saved,
+                                            sizeof(saved)) == (int)sizeof(saved);
+    result = result && saved.header.version == APP_SNAPSHOT_VERSION &&
+             saved.moods[AGENT_MOOD_AFFECTION] == 50 * AGENT_MOOD_ONE &&
+             saved.moods[AGENT_MOOD_STRICTNESS] == AGENT_MOOD_LEVEL_MAX &&
+             saved.moods[AGENT_MOOD_SATISFACTION] == 0 &&
+             saved.moods[AGENT_MOOD_TRUST] == 40 * AGENT_MOOD_ONE;
+    result = result && saved.utc_mood_anchor >= g_lock_start &&
+             saved.utc_mood_anchor <= bsp_get_utc_time_seconds();
+
+    // And drift toward the Veteran's baseline from there
+    bsp_sim_clock_advance(3600u * 1000u);
+    app_logic_update();
+    result = result && app_logic_get_agent_mood(AGENT_MOOD_STRICTNESS) < AGENT_MOOD_LEVEL_MAX;
+    result = result && app_logic_get_agent_mood(AGENT_MOOD_TRUST) == 40 * AGENT_MOOD_ONE;
+    print_test_result("Version 1 moods converted to fixed point", result);
+    return result;
+}
+
+bool test_bad_snapshots_ignored(void) {
+    bool result = fresh_device();
+    AppSnapshot_t snapshot = locked_snapshot();
+
+    // Flipped bit
+    snapshot.accumulated_seconds ^= 1;
+    result = result && write_record(&snapshot, sizeof(snapshot));
+    boot();
+    result = result && app_logic_get_state() == STATE_WELCOME;
+
+    // From newer firmware
+    snapshot = locked_snapshot();
+    seal(&snapshot.header, APP_SNAPSHOT_VERSION + 1, sizeof(snapshot));
+    result = result && write_record(&snapshot, sizeof(snapshot));
+    boot();
+    result = result && app_logic_get_state() == STATE_WELCOME;
+
+    // Good CRC, impossible contents
+    snapshot = locked_snapshot();
+    snapshot.lock_state = LOCK_STATE_COUNT;
+    seal(&snapshot.header, APP_SNAPSHOT_VERSION, sizeof(snapshot));
+    result = result && write_record(&snapshot, sizeof(snapshot));
+    boot();
+    result = result && app_logic_get_state() == STATE_WELCOME &&
+             app_logic_get_lock_session()->operational_state == LOCK_STATE_UNLOCKED;
+    print_test_result("Corrupt, newer and out-of-range snapshots ignored", result);
+    return result;
+}
+
+int main(void) {
+    printf("CKOS Application State Snapshot Tests\n");
+    printf("=====================================\n\n");
+
+    int passed = 0;
+    int total = 0;
+
+    printf("Restore Tests:\n");
+    total++; if (test_first_power_up()) passed++;
+    total++; if (test_settings_survive_restart()) passed++;
+    total++; if (test_lock_restored_in_one_read()) passed++;
+    printf("\n");
+
+    printf("Version and Integrity Tests:\n");
+    total++; if (test_v1_moods_converted()) passed++;
+    total++; if (test_bad_snapshots_ignored()) passed++;
+    printf("\n");
+
+    sim_device_destroy(g_device);
+    sim_device_bind(NULL);
+
+    printf("Test Results: %d/%d passed (%.1f%%)\n",
+           passed, total, (float)passed / total * 100.0f);
+
+    if (passed == total) {
+        printf("All tests PASSED! ✓\n");
+        return 0;
+    } else {
+        printf("Some tests FAILED! ✗\n");
+        return 1;
+    }
+}
@@ -0,0 +1,231 @@
+// CKOS Application State Machine Tests
+// Tests for the transition table in AppLogic/app_logic.c: the setup flow,
+// menu navigation, the unlock event, coverage counting and the generated
+// diagram, on a simulated device
+
+#include <stdio.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include "Simulator/sim_fleet.h"
+#include "AppLogic/app_logic.h"
+#include "Display/display_api.h"
+#include "Hardware/hardware_api.h"
+#include "sim_fixture.h"
+
+static sim_device_t* g_device;
+
+static void print_test_result(const char* test_name, bool passed) {
+    printf("[%s] %s\n", passed ? "PASS" : "FAIL", test_name);
+}
+
+// Each test starts from a blank device on its first boot
+static bool fresh_device(void) {
+    if (!sim_fixture_blank_device(&g_device)) return false;
+    hardware_init();
+    display_task_init();
+    app_logic_init();
+    display_task_update();
+    return true;
+}
+
+static void press(bsp_button_id_t button) {
+    bsp_sim_clock_advance(200);     // Past the debounce window
+    sim_device_press_button(g_device, button);
+    display_task_update();
+}
+
+static void press_times(bsp_button_id_t button, int times) {
+    for (int i = 0; i < times; i++) press(button);
+}
+
+// Every state change saves the snapshot, so it shows the settings
+static AppSnapshot_t saved_snapshot(void) {
+    AppSnapshot_t saved;
+    memset(&saved, 0, sizeof(saved));
+    hardware_config_read(HARDWARE_CONFIG_KEY_APP_SNAPSHOT, &saved, sizeof(saved));
+    return saved;
+}
+
+static void finish_setup(void) {
+    press(BSP_BUTTON_A);            // Welcome
+    press(BSP_BUTTON_A);            // Timezone
+    press(BSP_BUTTON_A);            // Time
+}
+
+// =============================================================================
+// TRANSITION TESTS
+// =============================================================================
+
+bool test_first_boot_setup_flow(void) {
+    bool result = fresh_device();
+    result = result && app_logic_get_state() == STATE_WELCOME;
+
+    press(BSP_BUTTON_B);
+    result = result && app_logic_get_state() == STATE_TIMEZONE_SETUP;
+    result = result && display_get_current_screen() == SCREEN_ID_TIMEZONE_SETUP;
+
+    // Moves that stay put, clamped at the end of the range
+    press_times(BSP_BUTTON_RIGHT, 14);
+    press(BSP_BUTTON_UP);
+    result = result && app_logic_get_state() == STATE_TIMEZONE_SETUP;
+
+    press(BSP_BUTTON_A);
+    AppSnapshot_t saved = saved_snapshot();
+    result = result && app_logic_get_state() == STATE_TIME_SETUP;
+    result = result && saved.timezone_offset_hours == 12;
+    result = result && (saved.flags & APP_SNAPSHOT_FLAG_DST_ACTIVE);
+    result = result && (saved.flags & APP_SNAPSHOT_FLAG_TIMEZONE_CONFIGURED);
+
+    // Skipping the time still ends first boot, on the way out
+    press(BSP_BUTTON_B);
+    saved = saved_snapshot();
+    result = result && app_logic_get_state() == STATE_MENU;
+    result = result && !(saved.flags & APP_SNAPSHOT_FLAG_FIRST_BOOT);
+    result = result && !(saved.flags & APP_SNAPSHOT_FLAG_TIME_CONFIGURED);
+
+    // Welcome after setup goes straight back to the menu
+    press(BSP_BUTTON_B);
+    result = result && app_logic_get_state() == STATE_WELCOME;
+    press(BSP_BUTTON_LEFT);
+    result = result && app_logic_get_state() == STATE_MENU;
+    print_test_result("First boot setup flow follows the table", result);
+    return result;
+}
+
+bool test_menu_opens_settings_screen(void) {
+    bool result = fresh_device();
+    finish_setup();
+
+    // Down to Settings, and the Settings screen stays up
+    press_times(BSP_BUTTON_DOWN, 6);
+    press(BSP_BUTTON_A);
+    result = result && app_logic_get_state() == STATE_SETTINGS;
+    result = result && display_get_current_screen() == SCREEN_ID_SETTINGS;
+
+    press(BSP_BUTTON_DOWN);
+    result = result && app_logic_get_state() == STATE_SETTINGS;
+    press(BSP_BUTTON_B);
+    result = result && app_logic_get_state() == STATE_MENU;
+    result = result && display_get_current_screen() == SCREEN_ID_MAIN_MENU;
+
+    // Back on the first entry, which runs its action and stays in the menu
+    press(BSP_BUTTON_A);
+    result = result && app_logic_get_state() == STATE_MENU;
+    result = result && display_get_current_screen() == SCREEN_ID_MAIN_MENU;
+    print_test_result("Menu opens the Settings screen", result);
+    return result;
+}
+
+bool test_unhandled_events_are_ignored(void) {
+    bool result = fresh_device();
+    finish_setup();
+
+    // No transition for these: nothing changes, nothing is counted
+    uint32_t taken_before = 0;
+    app_logic_get_state_coverage(&taken_before, NULL);
+    result = result && !app_logic_dispatch_event(APP_EVENT_LEFT);
+    result = result && !app_logic_dispatch_event(APP_EVENT_UNLOCKED);
+    result = result && !app_logic_dispatch_event(APP_EVENT_COUNT);
+    uint32_t taken_after = 0;
+    app_logic_get_state_coverage(&taken_after, NULL);
+    result = result && taken_after == taken_before;
+    result = result && app_logic_get_state() == STATE_MENU;
+
+    result = result && strcmp(app_logic_get_event_name(APP_EVENT_UNLOCKED), "UNLOCKED") == 0;
+    result = result && strcmp(app_logic_get_event_name(APP_EVENT_COUNT), "UNKNOWN") == 0;
+    result = result && strcmp(app_logic_get_state_name(STATE_SETTINGS), "SETTINGS") == 0;
+    result = result && strcmp(app_logic_get_state_name(STATE_COUNT), "UNKNOWN") == 0;
+    print_test_result("Events without a transition are ignored", result);
+    return result;
+}
+
+// =============================================================================
+// INSTRUMENTATION TESTS
+// =============================================================================
+
+bool test_coverage_counts_branches(void) {
+    bool result = fresh_device();
+
+    uint32_t taken = 0;
+    uint32_t total = 0;
+    app_logic_get_state_coverage(&taken, &total);
+    result = result && taken == 0 && total > 0;
+
+    // Both branches of the Welcome guard count separately
+    finish_setup();
+    app_logic_get_state_coverage(&taken, NULL);
+    result = result && taken == 3;
+    press(BSP_BUTTON_B);
+    press(BSP_BUTTON_A);
+    app_logic_get_state_coverage(&taken, NULL);
+    result = result && taken == 5;
+
+    // Taking one again adds nothing
+    press(BSP_BUTTON_B);
+    press(BSP_BUTTON_A);
+    app_logic_get_state_coverage(&taken, NULL);
+    result = result && taken == 5;
+
+    printf("  %lu of %lu transitions taken\n", (unsigned long)taken, (unsigned long)total);
+    print_test_result("Coverage counts each guarded branch", result);
+    return result;
+}
+
+bool test_diagram_lists_transitions(void) {
+    bool result = fresh_device();
+
+    char text[4096] = "";
+    FILE* out = tmpfile();
+    result = result && out != NULL;
+    if (out) {
+        app_logic_write_state_diagram(out);
+        rewind(out);
+        size_t length = fread(text, 1, sizeof(text) - 1, out);
+        text[length] = '\0';
+        fclose(out);
+    }
+
+    result = result && strncmp(text, "digraph app_logic {", 19) == 0;
+    result = result && strstr(text, "  IDLE;\n") != NULL;
+    // Events sharing a transition make one edge, one per guard outcome
+    result = result && strstr(text, "WELCOME -> TIMEZONE_SETUP [label=\"UP,DOWN,LEFT,RIGHT,A,B [is_first_boot]\"]") != NULL;
+    result = result && strstr(text, "WELCOME -> MENU [label=\"UP,DOWN,LEFT,RIGHT,A,B [!is_first_boot]\"]") != NULL;
+    result = result && strstr(text, "TIMEZONE_SETUP -> TIMEZONE_SETUP [label=\"UP,DOWN / toggle_dst\", style=dashed]") != NULL;
+    result = result && strstr(text, "TIME_SETUP -> MENU [label=\"A / confirm_time\"]") != NULL;
+    result = result && strstr(text, "LOCK_ACTIVE -> MENU [label=\"UNLOCKED\"]") != NULL;
+    print_test_result("Diagram lists every transition", result);
+    return result;
+}
+
+int main(void) {
+    printf("CKOS App State Machine Tests\n");
+    printf("============================\n\n");
+
+    int passed = 0;
+    int total = 0;
+
+    printf("Transition Tests:\n");
+    total++; if (test_first_boot_setup_flow()) passed++;
+    total++; if (test_menu_opens_settings_screen()) passed++;
+    total++; if (test_unhandled_events_are_ignored()) passed++;
+    printf("\n");
+
+    printf("Instrumentation Tests:\n");
+    total++; if (test_coverage_counts_branches()) passed++;
+    total++; if (test_diagram_lists_transitions()) passed++;
+    printf("\n");
+
+    sim_device_destroy(g_device);
+
+    printf("Test Results: %d/%d passed (%.1f%%)\n",
+           passed, total, (float)passed / total * 100.0f);
+
+    if (passed == total) {
+        printf("All tests PASSED! ✓\n");
+        return 0;
+    } else {
+        printf("Some tests FAILED! ✗\n");
+        return 1;
+    }
+}
@@ -48,6 +48,10 @@ bool hardware_is_latch_engaged(void) {
     return true; // Default engaged for testing
 }
 
+bool hardware_is_charging(void) {
+    return false;
+}
+
 float hardware_get_battery_percentage(void) {
     return 85.0f; // Mock battery level
 }
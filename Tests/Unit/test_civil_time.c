@@ -0,0 +1,208 @@
+// CKOS Civil Time Tests
+// Tests for the integer date conversion, the DST rule table, the cached
+// clock and the formatter in Utils/civil_time.c
+
+#define _DEFAULT_SOURCE                 // timegm() and gmtime_r() as the reference
+#include <stdio.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <time.h>
+#include "Utils/civil_time.h"
+
+#define DAY         CIVIL_SECONDS_PER_DAY
+#define HOUR        3600
+#define EST         (-5 * HOUR)
+#define CET         (1 * HOUR)
+
+static void print_test_result(const char* test_name, bool passed) {
+    printf("[%s] %s\n", passed ? "PASS" : "FAIL", test_name);
+}
+
+static uint64_t utc_of(int year, int month, int day, int hour, int minute) {
+    struct tm tm;
+    memset(&tm, 0, sizeof(tm));
+    tm.tm_year = year - 1900;
+    tm.tm_mon = month - 1;
+    tm.tm_mday = day;
+    tm.tm_hour = hour;
+    tm.tm_min = minute;
+    return (uint64_t)timegm(&tm);
+}
+
+static bool same_as_gmtime(uint64_t utc, const CivilTime_t* civil) {
+    time_t t = (time_t)utc;
+    struct tm tm;
+    gmtime_r(&t, &tm);
+    return civil->year == tm.tm_year + 1900 && civil->month == tm.tm_mon + 1 &&
+           civil->day == tm.tm_mday && civil->hour == tm.tm_hour &&
+           civil->minute == tm.tm_min && civil->second == tm.tm_sec &&
+           civil->weekday == tm.tm_wday;
+}
+
+// =============================================================================
+// CONVERSION TESTS
+// =============================================================================
+
+bool test_dates_match_gmtime(void) {
+    bool result = true;
+
+    // Every day from 1970 to 2200 at a varying time of day, leap years,
+    // century years and 2000 included
+    for (uint32_t days = 0; days < 84000 && result; days++) {
+        uint64_t utc = (uint64_t)days * DAY + (days * 7919U) % DAY;
+        CivilTime_t civil;
+        civil_time_from_utc(utc, 0, &civil);
+        result = same_as_gmtime(utc, &civil);
+        result = result && civil_time_days_from_date(civil.year, civil.month, civil.day) == days;
+    }
+
+    CivilTime_t leap;
+    civil_time_from_utc(utc_of(2024, 2, 29, 23, 59) + 59, 0, &leap);
+    result = result && leap.month == 2 && leap.day == 29 && leap.second == 59;
+    print_test_result("Dates match gmtime() from 1970 to 2200", result);
+    return result;
+}
+
+bool test_offsets_cross_midnight(void) {
+    // 2024-01-01 02:30 UTC is still New Year's Eve five hours west
+    CivilTime_t civil;
+    civil_time_from_utc(utc_of(2024, 1, 1, 2, 30), EST, &civil);
+    bool result = civil.year == 2023 && civil.month == 12 && civil.day == 31 &&
+                  civil.hour == 21 && civil.minute == 30 && civil.weekday == 0;
+
+    civil_time_from_utc(utc_of(2023, 12, 31, 23, 30), 12 * HOUR, &civil);
+    result = result && civil.year == 2024 && civil.month == 1 && civil.day == 1 && civil.hour == 11;
+    print_test_result("Offsets cross midnight and New Year", result);
+    return result;
+}
+
+// =============================================================================
+// DST TESTS
+// =============================================================================
+
+bool test_dst_transitions(void) {
+    // EU: 01:00 UTC on the last Sundays of March and October
+    bool result = civil_time_dst_transition(CIVIL_DST_EU, 2024, true, CET) ==
+                  (int64_t)utc_of(2024, 3, 31, 1, 0);
+    result = result && civil_time_dst_transition(CIVIL_DST_EU, 2024, false, CET) ==
+                       (int64_t)utc_of(2024, 10, 27, 1, 0);
+    result = result && civil_time_dst_transition(CIVIL_DST_EU, 2026, true, CET) ==
+                       (int64_t)utc_of(2026, 3, 29, 1, 0);
+
+    // US: 02:00 local on the second Sunday of March and first of November
+    result = result && civil_time_dst_transition(CIVIL_DST_US, 2024, true, EST) ==
+                       (int64_t)utc_of(2024, 3, 10, 7, 0);
+    result = result && civil_time_dst_transition(CIVIL_DST_US, 2024, false, EST) ==
+                       (int64_t)utc_of(2024, 11, 3, 6, 0);
+
+    // In force between them, with the span to the next change
+    int64_t from = 0;
+    int64_t until = 0;
+    result = result && civil_time_dst_active(CIVIL_DST_EU, utc_of(2024, 7, 1, 12, 0), CET,
+                                             &from, &until);
+    result = result && from == (int64_t)utc_of(2024, 3, 31, 1, 0) &&
+                       until == (int64_t)utc_of(2024, 10, 27, 1, 0);
+    result = result && !civil_time_dst_active(CIVIL_DST_EU, utc_of(2024, 12, 31, 12, 0), CET,
+                                              &from, &until);
+    result = result && until == (int64_t)utc_of(2025, 3, 30, 1, 0);
+    result = result && civil_time_dst_active(CIVIL_DST_FIXED, utc_of(2024, 1, 1, 0, 0), 0,
+                                             NULL, NULL);
+    print_test_result("DST rules give the published transitions", result);
+    return result;
+}
+
+// =============================================================================
+// CACHED CLOCK TESTS
+// =============================================================================
+
+bool test_clock_matches_full_conversion(void) {
+    CivilClock_t clock;
+    civil_clock_init(&clock, CET, CIVIL_DST_EU, true);
+    bool result = true;
+
+    // Second by second through both EU changes of 2024, and a few jumps
+    uint64_t starts[] = { utc_of(2024, 3, 30, 22, 0), utc_of(2024, 10, 26, 22, 0) };
+    for (int s = 0; s < 2; s++) {
+        for (uint64_t utc = starts[s]; utc < starts[s] + 6 * HOUR && result; utc++) {
+            CivilTime_t expected;
+            bool dst = civil_time_dst_active(CIVIL_DST_EU, utc, CET, NULL, NULL);
+            civil_time_from_utc(utc, CET + (dst ? CIVIL_DST_SAVE_SECONDS : 0), &expected);
+            result = memcmp(civil_clock_update(&clock, utc), &expected, sizeof(expected)) == 0;
+            result = result && civil_clock_is_dst(&clock) == dst;
+        }
+    }
+
+    const CivilTime_t* summer = civil_clock_update(&clock, utc_of(2024, 7, 1, 10, 0) + 5);
+    result = result && summer->hour == 12 && summer->second == 5;
+    const CivilTime_t* earlier = civil_clock_update(&clock, utc_of(2024, 7, 1, 9, 0));
+    result = result && earlier->hour == 11 && earlier->second == 0;
+
+    // Changing the zone drops the cache; DST off ignores the rule
+    civil_clock_set_zone(&clock, CET, CIVIL_DST_EU, false);
+    result = result && civil_clock_update(&clock, utc_of(2024, 7, 1, 10, 0))->hour == 11;
+    civil_clock_set_zone(&clock, CET, CIVIL_DST_FIXED, true);
+    result = result && civil_clock_update(&clock, utc_of(2024, 1, 1, 10, 0))->hour == 12;
+    print_test_result("Cached clock matches full conversion across DST", result);
+    return result;
+}
+
+// =============================================================================
+// FORMATTING TESTS
+// =============================================================================
+
+bool test_format_into_buffer(void) {
+    CivilTime_t civil;
+    civil_time_from_utc(utc_of(2024, 2, 9, 7, 5) + 3, 0, &civil);
+
+    char time_text[16];     // Same size as the status bar's
+    bool result = civil_time_format_hms(&civil, time_text, sizeof(time_text)) == 8;
+    result = result && strcmp(time_text, "07:05:03") == 0;
+    char date[CIVIL_TIME_DATE_SIZE];
+    result = result && civil_time_format_date(&civil, date, sizeof(date)) == 10;
+    result = result && strcmp(date, "2024-02-09") == 0;
+
+    // Too small: nothing but an empty string
+    char small[8] = "xxxxxxx";
+    result = result && civil_time_format_hms(&civil, small, sizeof(small)) == 0 && small[0] == '\0';
+    result = result && civil_time_format_hms(NULL, time_text, sizeof(time_text)) == 0;
+    result = result && civil_time_format_date(&civil, NULL, 0) == 0;
+    print_test_result("Formatter writes into the caller's buffer", result);
+    return result;
+}
+
+int main(void) {
+    printf("CKOS Civil Time Tests\n");
+    printf("=====================\n\n");
+
+    int passed = 0;
+    int total = 0;
+
+    printf("Conversion Tests:\n");
+    total++; if (test_dates_match_gmtime()) passed++;
+    total++; if (test_offsets_cross_midnight()) passed++;
+    printf("\n");
+
+    printf("DST Tests:\n");
+    total++; if (test_dst_transitions()) passed++;
+    printf("\n");
+
+    printf("Cached Clock Tests:\n");
+    total++; if (test_clock_matches_full_conversion()) passed++;
+    printf("\n");
+
+    printf("Formatting Tests:\n");
+    total++; if (test_format_into_buffer()) passed++;
+    printf("\n");
+
+    printf("Test Results: %d/%d passed (%.1f%%)\n",
+           passed, total, (float)passed / total * 100.0f);
+
+    if (passed == total) {
+        printf("All tests PASSED! ✓\n");
+        return 0;
+    } else {
+        printf("Some tests FAILED! ✗\n");
+        return 1;
+    }
+}
@@ -14,6 +14,13 @@ static int mock_text_calls = 0;
 static int mock_box_calls = 0;
 static int mock_line_calls = 0;
 
+// Glyphs drawn one at a time, in order
+#define MOCK_GLYPHS 64
+static char mock_glyphs[MOCK_GLYPHS];
+static int mock_glyph_x[MOCK_GLYPHS];
+static int mock_glyph_y[MOCK_GLYPHS];
+static int mock_glyph_count = 0;
+
 // Mock BSP implementations
 void bsp_display_clear(void) {
     memset(mock_display_buffer, 0, sizeof(mock_display_buffer));
@@ -34,6 +41,16 @@ bool bsp_display_get_pixel(int x, int y) {
     return false; // Mock implementation
 }
 
+void bsp_display_draw_char(int x, int y, char c) {
+    if (mock_glyph_count < MOCK_GLYPHS) {
+        mock_glyphs[mock_glyph_count] = c;
+        mock_glyph_x[mock_glyph_count] = x;
+        mock_glyph_y[mock_glyph_count] = y;
+    }
+    mock_glyph_count++;
+    mock_text_calls++;
+}
+
 void bsp_display_draw_text(int x, int y, const char* text) {
     (void)x; (void)y; (void)text;
     mock_text_calls++;
@@ -61,12 +78,28 @@ void bsp_display_draw_filled_box(int x, int y, int w, int h) {
 
 // Include the display API after mocks
 #include "../../App/Display/display_api.h"
+#include "../../App/Config/app_config.h"
+
+// Mock clock and task notification for the refresh governor
+static uint32_t mock_tick_ms = 0;
+static int mock_notify_calls = 0;
+
+uint32_t bsp_get_tick_ms(void) {
+    return mock_tick_ms;
+}
+
+bool bsp_task_notify(bsp_task_handle_t task, uint32_t bits) {
+    (void)task; (void)bits;
+    mock_notify_calls++;
+    return true;
+}
 
 // Test helpers
 void reset_mock_counters(void) {
     mock_text_calls = 0;
     mock_box_calls = 0;
     mock_line_calls = 0;
+    mock_glyph_count = 0;
 }
 
 void print_test_result(const char* test_name, bool passed) {
@@ -188,6 +221,27 @@ bool test_agent_dialog_box_component(void) {
     return result;
 }
 
+bool test_wrapped_text_layout(void) {
+    reset_mock_counters();
+    DisplayTextSource source;
+    
+    // Nine columns: a word that does not fit starts the next line
+    display_text_source_init(&source, "Hello big  world");
+    bool result = ui_draw_wrapped_text(10, 20, 63, 14, &source);
+    result = result && (mock_glyph_count == 13);
+    result = result && (mock_glyphs[5] == 'b') && (mock_glyph_x[5] == 10 + 6 * 7) && (mock_glyph_y[5] == 20);
+    result = result && (mock_glyphs[8] == 'w') && (mock_glyph_x[8] == 10) && (mock_glyph_y[8] == 27);
+    
+    // A word longer than a line is broken, and text past the box is cut
+    reset_mock_counters();
+    display_text_source_init(&source, "Extraordinary");
+    result = result && !ui_draw_wrapped_text(0, 0, 42, 14, &source);
+    result = result && (mock_glyph_count == 12);
+    result = result && (mock_glyphs[6] == 'r') && (mock_glyph_x[6] == 0) && (mock_glyph_y[6] == 7);
+    print_test_result("Wrapped Text Layout", result);
+    return result;
+}
+
 bool test_confirmation_dialog_component(void) {
     reset_mock_counters();
     
@@ -341,6 +395,185 @@ bool test_display_task_update(void) {
     return result;
 }
 
+bool test_display_screen_payload_copied(void) {
+    // Callers pass a stack local; the display must not read it after return
+    display_task_init();
+    DisplayCommand cmd = {0};
+    LockStatusScreenData data = {0};
+    data.time_remaining_seconds = 1234;
+    cmd.id = DISPLAY_CMD_ACTIVATE_SCREEN;
+    cmd.data.activate_screen.screen_id = SCREEN_ID_LOCK_STATUS;
+    cmd.data.activate_screen.data_ptr = &data;
+    
+    bool result = display_task_send_command(&cmd);
+    data.time_remaining_seconds = 0;
+    
+    MemoryPoolStats_t stats;
+    display_get_payload_pool_stats(&stats);
+    result = result && stats.allocated_blocks == 1;
+    
+    display_task_update();
+    display_get_payload_pool_stats(&stats);
+    result = result && stats.allocated_blocks == 0 && stats.invalid_frees == 0;
+    
+    print_test_result("Display Screen Payload Copied", result);
+    return result;
+}
+
+// =============================================================================
+// REFRESH GOVERNOR TESTS
+// =============================================================================
+
+static uint32_t frames_drawn(void) {
+    DisplayRefreshStats stats;
+    display_get_refresh_stats(&stats);
+    return stats.frames;
+}
+
+static void activate_screen(ScreenID screen_id, void* data) {
+    DisplayCommand cmd = {0};
+    cmd.id = DISPLAY_CMD_ACTIVATE_SCREEN;
+    cmd.data.activate_screen.screen_id = screen_id;
+    cmd.data.activate_screen.data_ptr = data;
+    display_task_send_command(&cmd);
+}
+
+bool test_refresh_follows_screen_policy(void) {
+    mock_tick_ms = 0;
+    display_task_init();
+    
+    // Static: one frame, then nothing to wake for but the blanking timeout
+    display_task_update();
+    display_task_update();
+    bool result = frames_drawn() == 1;
+    result = result && display_task_next_update_ms() == CONFIG_DISPLAY_SLEEP_TIMEOUT_MS;
+    
+    // On change: only commands that touch the screen draw
+    MenuScreenData menu = {0};
+    activate_screen(SCREEN_ID_MAIN_MENU, &menu);
+    result = result && display_task_next_update_ms() == 0;
+    display_task_update();
+    DisplayCommand status = {0};
+    status.id = DISPLAY_CMD_UPDATE_LOCK_STATUS;
+    display_task_send_command(&status);
+    display_task_update();
+    result = result && frames_drawn() == 2;
+    
+    // The lock countdown shows minutes and draws only when app logic
+    // sends it a new remaining time
+    LockStatusScreenData lock = {0};
+    activate_screen(SCREEN_ID_LOCK_STATUS, &lock);
+    display_task_update();
+    mock_tick_ms = 5000;
+    display_task_update();
+    result = result && frames_drawn() == 3 &&
+             display_task_next_update_ms() == CONFIG_DISPLAY_SLEEP_TIMEOUT_MS - 5000;
+    status.data.lock_status.time_remaining = 3600;
+    display_task_send_command(&status);
+    display_task_update();
+    result = result && frames_drawn() == 4;
+    
+    // Periodic: the verification clock draws once a second
+    VerificationScreenData verification = {0};
+    activate_screen(SCREEN_ID_VERIFICATION, &verification);
+    display_task_update();
+    mock_tick_ms = 5500;
+    display_task_update();
+    result = result && frames_drawn() == 5 && display_task_next_update_ms() == 500;
+    mock_tick_ms = 6000;
+    display_task_update();
+    result = result && frames_drawn() == 6;
+    
+    print_test_result("Refresh Follows Screen Policy", result);
+    return result;
+}
+
+bool test_periodic_frames_keep_phase(void) {
+    const uint32_t period = CONFIG_DISPLAY_STATUS_PERIOD_MS;
+    mock_tick_ms = 0;
+    display_task_init();
+    VerificationScreenData verification = {0};
+    activate_screen(SCREEN_ID_VERIFICATION, &verification);
+    display_task_update();
+    
+    // Every wake 7 ms late: the next frame is still due on the period
+    uint32_t before = frames_drawn();
+    bool result = true;
+    for (uint32_t i = 1; i <= 10; i++) {
+        mock_tick_ms = i * period + 7;
+        display_task_update();
+        result = result && display_task_next_update_ms() == period - 7;
+    }
+    result = result && frames_drawn() - before == 10;
+    
+    // A stall of several periods draws once and restarts the phase
+    mock_tick_ms += 3 * period;
+    display_task_update();
+    result = result && frames_drawn() - before == 11;
+    result = result && display_task_next_update_ms() == period;
+    
+    print_test_result("Periodic Frames Keep Phase", result);
+    return result;
+}
+
+bool test_spin_wheel_animates_then_settles(void) {
+    mock_tick_ms = 0;
+    display_task_init();
+    SpinWheelScreenData wheel = {0};
+    wheel.num_segments = 6;
+    activate_screen(SCREEN_ID_GAME_SPIN_WHEEL, &wheel);
+    display_task_update();
+    
+    DisplayCommand spin = {0};
+    spin.id = DISPLAY_CMD_GAME_SPIN_THE_WHEEL_START_ANIM;
+    spin.data.spin_wheel_anim.target_segment = 4;
+    spin.data.spin_wheel_anim.duration_ms = 1000;
+    display_task_send_command(&spin);
+    
+    // Polled every 5 ms, the animation still draws at its own rate
+    uint32_t before = frames_drawn();
+    for (mock_tick_ms = 0; mock_tick_ms <= 2000; mock_tick_ms += 5) {
+        display_task_update();
+    }
+    uint32_t frames = frames_drawn() - before;
+    uint32_t expected = 1000 / (1000 / CONFIG_DISPLAY_ANIMATION_FREQ_HZ);
+    printf("  %lu frames for a 1 s spin\n", (unsigned long)frames);
+    
+    bool result = frames >= expected && frames <= expected + 2;
+    result = result && display_task_next_update_ms() != 0;
+    print_test_result("Spin Wheel Animates Then Settles", result);
+    return result;
+}
+
+bool test_display_blanks_after_inactivity(void) {
+    mock_tick_ms = 0;
+    display_task_init();
+    display_task_set_notify((bsp_task_handle_t)1, 1u);
+    display_task_update();
+    
+    // The timeout blanks the panel and stops the frames
+    mock_tick_ms = CONFIG_DISPLAY_SLEEP_TIMEOUT_MS;
+    display_task_update();
+    mock_tick_ms += 10000;
+    display_task_update();
+    DisplayRefreshStats stats;
+    display_get_refresh_stats(&stats);
+    bool result = display_is_blanked() && stats.blanks == 1 && stats.frames == 1;
+    result = result && display_task_next_update_ms() == BSP_WAIT_FOREVER;
+    
+    // Input wakes the display task and redraws
+    int notified = mock_notify_calls;
+    display_task_note_activity();
+    result = result && mock_notify_calls == notified + 1;
+    result = result && display_task_next_update_ms() == 0;
+    display_task_update();
+    result = result && !display_is_blanked() && frames_drawn() == 2;
+    
+    display_task_set_notify(NULL, 0);
+    print_test_result("Display Blanks After Inactivity", result);
+    return result;
+}
+
 // =============================================================================
 // NULL SAFETY TESTS
 // =============================================================================
@@ -415,6 +648,7 @@ int main(void) {
     total++; if (test_time_duration_selector_component()) passed++;
     total++; if (test_agent_mood_display_component()) passed++;
     total++; if (test_agent_dialog_box_component()) passed++;
+    total++; if (test_wrapped_text_layout()) passed++;
     total++; if (test_confirmation_dialog_component()) passed++;
     printf("\n");
     
@@ -432,6 +666,15 @@ int main(void) {
     total++; if (test_display_task_initialization()) passed++;
     total++; if (test_display_command_sending()) passed++;
     total++; if (test_display_task_update()) passed++;
+    total++; if (test_display_screen_payload_copied()) passed++;
+    printf("\n");
+    
+    // Refresh Governor Tests
+    printf("Refresh Governor Tests:\n");
+    total++; if (test_refresh_follows_screen_policy()) passed++;
+    total++; if (test_periodic_frames_keep_phase()) passed++;
+    total++; if (test_spin_wheel_animates_then_settles()) passed++;
+    total++; if (test_display_blanks_after_inactivity()) passed++;
     printf("\n");
     
     // Edge Case Tests
@@ -0,0 +1,298 @@
+// CKOS Event Log Unit Tests
+// Tests for the binary lock history log in Utils/event_log.c and the
+// hardware_log_* API over it, running on the simulator flash model
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include "BSP/bsp_api.h"
+#include "Config/app_config.h"
+#include "Utils/event_log.h"
+#include "Hardware/hardware_api.h"
+#include "sim_fixture.h"
+
+#define TEST_REGION_START   CONFIG_STORAGE_LOG_START_ADDR
+#define TEST_REGION_SIZE    CONFIG_STORAGE_LOG_SIZE
+#define TEST_BASE_TIME      1700000000u
+
+static void* g_device;
+static EventLog_t g_log;
+
+static void print_test_result(const char* test_name, bool passed) {
+    printf("[%s] %s\n", passed ? "PASS" : "FAIL", test_name);
+}
+
+// Each test starts from a blank flash device and a freshly mounted log
+static bool fresh_log(void) {
+    sim_fixture_blank_bsp(g_device);
+    return event_log_mount(&g_log, TEST_REGION_START, TEST_REGION_SIZE) == 0;
+}
+
+static uint32_t doublewords_programmed(void) {
+    bsp_sim_storage_stats_t stats;
+    bsp_sim_storage_get_stats(&stats);
+    return stats.doublewords_programmed;
+}
+
+// Entry i: event 1 + i % 8, a minute apart, argument i
+static bool append_entries(uint32_t first, uint32_t count) {
+    bool result = true;
+    for (uint32_t i = first; i < first + count; i++) {
+        result = result && event_log_append(&g_log, (uint8_t)(1 + i % 8),
+                                            TEST_BASE_TIME + i * 60u, i) == 0;
+    }
+    return result;
+}
+
+static bool entry_matches(uint32_t back, uint32_t i) {
+    EventLogEntry_t entry;
+    return event_log_read(&g_log, back, &entry) == 0 &&
+           entry.sequence == i && entry.event == 1 + i % 8 &&
+           entry.timestamp == TEST_BASE_TIME + i * 60u && entry.arg == i;
+}
+
+// =============================================================================
+// APPEND/READ TESTS
+// =============================================================================
+
+bool test_append_read_newest_first(void) {
+    bool result = fresh_log();
+    uint32_t before = doublewords_programmed();
+    result = result && event_log_append(&g_log, 3, TEST_BASE_TIME, 0xFFFFFFFFu) == 0;
+    result = result && event_log_append(&g_log, 4, TEST_BASE_TIME - 3600u, 7) == 0;
+    result = result && event_log_append(&g_log, 5, TEST_BASE_TIME + 86400u, 0) == 0;
+
+    // Held in RAM until flushed, readable either way
+    result = result && doublewords_programmed() == before;
+    result = result && event_log_pending(&g_log) == 3 && event_log_count(&g_log) == 3;
+    for (int pass = 0; pass < 2; pass++) {
+        EventLogEntry_t entry;
+        result = result && event_log_read(&g_log, 0, &entry) == 0 &&
+                 entry.event == 5 && entry.timestamp == TEST_BASE_TIME + 86400u;
+        result = result && event_log_read(&g_log, 1, &entry) == 0 &&
+                 entry.event == 4 && entry.timestamp == TEST_BASE_TIME - 3600u && entry.arg == 7;
+        result = result && event_log_read(&g_log, 2, &entry) == 0 &&
+                 entry.sequence == 0 && entry.arg == 0xFFFFFFFFu;
+        result = result && event_log_read(&g_log, 3, &entry) == -1;
+        result = result && event_log_flush(&g_log) == 0;
+    }
+    result = result && event_log_pending(&g_log) == 0;
+    print_test_result("Entries read newest first, before and after flush", result);
+    return result;
+}
+
+bool test_entries_packed(void) {
+    bool result = fresh_log();
+    result = result && append_entries(0, 160);
+    result = result && event_log_flush(&g_log) == 0;
+
+    // Event, one-byte delta and a one- or two-byte argument: 13+ per block
+    // (a 256-byte text record each would fill the region 16 times over)
+    EventLogStats_t stats;
+    event_log_get_stats(&g_log, &stats);
+    result = result && stats.entries_appended == 160;
+    result = result && stats.blocks_written <= 13;
+    result = result && doublewords_programmed() <= stats.blocks_written * EVENT_LOG_BLOCK_SIZE / 8;
+    print_test_result("Entries packed into a few bytes each", result);
+    return result;
+}
+
+// =============================================================================
+// INDEX AND RECOVERY TESTS
+// =============================================================================
+
+bool test_mount_rebuilds_index(void) {
+    bool result = fresh_log();
+    result = result && append_entries(0, 100);
+    result = result && event_log_flush(&g_log) == 0;
+
+    result = result && event_log_mount(&g_log, TEST_REGION_START, TEST_REGION_SIZE) == 0;
+    result = result && event_log_count(&g_log) == 100;
+    result = result && entry_matches(0, 99) && entry_matches(99, 0) && entry_matches(50, 49);
+
+    // Numbering carries on after the remount
+    result = result && append_entries(100, 1);
+    result = result && entry_matches(0, 100);
+    print_test_result("Mount rebuilds the index from block headers", result);
+    return result;
+}
+
+bool test_read_costs_one_block(void) {
+    bool result = fresh_log();
+    result = result && append_entries(0, 200);
+    result = result && event_log_flush(&g_log) == 0;
+    EventLogStats_t stats;
+    event_log_get_stats(&g_log, &stats);
+    uint32_t blocks = stats.blocks_written;
+    result = result && event_log_mount(&g_log, TEST_REGION_START, TEST_REGION_SIZE) == 0;
+
+    // Any single entry: one block read
+    result = result && entry_matches(150, 49);
+    event_log_get_stats(&g_log, &stats);
+    result = result && stats.block_reads == 1;
+
+    // Scrolling back through everything reads each block once
+    for (uint32_t back = 0; back < 200; back++) {
+        result = result && entry_matches(back, 199 - back);
+    }
+    event_log_get_stats(&g_log, &stats);
+    result = result && stats.block_reads == 1 + blocks;
+    print_test_result("Reading an entry costs at most one block read", result);
+    return result;
+}
+
+bool test_wraparound_erases_one_page(void) {
+    bool result = fresh_log();
+    uint32_t total = 0;
+    EventLogStats_t stats;
+
+    // Fill both pages, then write into the first again
+    while (result && g_log.next_block < EVENT_LOG_MAX_SLOTS + 3) {
+        result = result && append_entries(total, 1);
+        total++;
+    }
+    event_log_get_stats(&g_log, &stats);
+    result = result && stats.pages_erased == 3;
+
+    // Only the oldest page's entries are gone; the rest read back unchanged
+    uint32_t count = event_log_count(&g_log);
+    result = result && count < total && count > total / 2;
+    result = result && entry_matches(0, total - 1) && entry_matches(count - 1, total - count);
+    EventLogEntry_t entry;
+    result = result && event_log_read(&g_log, count, &entry) == -1;
+
+    uint32_t log_page = TEST_REGION_START / BSP_STORAGE_PAGE_SIZE;
+    result = result && bsp_sim_storage_get_page_erase_count(log_page) == 2;
+    result = result && bsp_sim_storage_get_page_erase_count(log_page + 1) == 1;
+    print_test_result("Wrap-around erases only the oldest page", result);
+    return result;
+}
+
+bool test_torn_block_skipped(void) {
+    bool result = fresh_log();
+    result = result && append_entries(0, 5);
+    result = result && event_log_flush(&g_log) == 0;
+
+    // A reset while programming block 1 left just its header
+    uint8_t torn[16];
+    memset(torn, 0, sizeof(torn));
+    torn[0] = 1;
+    bsp_storage_operation_t op = { TEST_REGION_START + EVENT_LOG_BLOCK_SIZE, torn, sizeof(torn) };
+    result = result && bsp_storage_write(&op) == 0;
+
+    result = result && event_log_mount(&g_log, TEST_REGION_START, TEST_REGION_SIZE) == 0;
+    EventLogStats_t stats;
+    event_log_get_stats(&g_log, &stats);
+    result = result && stats.corrupt_blocks == 1 && event_log_count(&g_log) == 5;
+
+    // The spent slot is stepped over on the next write
+    result = result && append_entries(5, 5);
+    result = result && event_log_flush(&g_log) == 0;
+    result = result && event_log_mount(&g_log, TEST_REGION_START, TEST_REGION_SIZE) == 0;
+    result = result && event_log_count(&g_log) == 10;
+    result = result && entry_matches(0, 9) && entry_matches(9, 0);
+    print_test_result("Torn block skipped at mount and on write", result);
+    return result;
+}
+
+// =============================================================================
+// HARDWARE LOG TESTS
+// =============================================================================
+
+// Blank flash device with the hardware service initialized
+static bool fresh_hardware(void) {
+    bool result = fresh_log();
+    bsp_sim_clock_set_fast_forward(true);
+    return result && hardware_init() == 0;
+}
+
+bool test_hardware_logs_sensor_events(void) {
+    bool result = fresh_hardware();
+    EventLogEntry_t entry;
+    result = result && hardware_log_count() == 1;
+    result = result && hardware_log_read(0, &entry) == 0 && entry.event == HARDWARE_LOG_EVENT_BOOT;
+
+    hardware_sensor_poll_events();  // Baseline sample
+    bsp_debug_set_sensor_value("door", 0);
+    hardware_sensor_poll_events();
+    result = result && hardware_log_read(0, &entry) == 0 &&
+             entry.event == HARDWARE_LOG_EVENT_DOOR_OPENED;
+    result = result && hardware_log_append(HARDWARE_LOG_EVENT_NONE, 0) == -1;
+    result = result && strcmp(hardware_log_event_name(entry.event), "Door opened") == 0;
+    print_test_result("Boot and door events logged", result);
+    return result;
+}
+
+bool test_hardware_log_flush_triggers(void) {
+    bool result = fresh_hardware();
+    EventLog_t* log = &g_log;
+
+    // Deadline
+    bsp_sim_clock_advance(CONFIG_CONFIG_CACHE_FLUSH_MS - 1);
+    hardware_storage_idle();
+    result = result && event_log_mount(log, TEST_REGION_START, TEST_REGION_SIZE) == 0 &&
+             event_log_count(log) == 0;
+    bsp_sim_clock_advance(1);
+    hardware_storage_idle();
+    result = result && event_log_mount(log, TEST_REGION_START, TEST_REGION_SIZE) == 0 &&
+             event_log_count(log) == 1;
+
+    // Sleep entry
+    result = result && hardware_log_append(HARDWARE_LOG_EVENT_LOCK_STARTED, 90) == 0;
+    hardware_power_set_mode(HARDWARE_POWER_SLEEP);
+    result = result && event_log_mount(log, TEST_REGION_START, TEST_REGION_SIZE) == 0 &&
+             event_log_count(log) == 2;
+
+    // History survives a restart
+    result = result && hardware_init() == 0 && hardware_log_count() == 3;
+    EventLogEntry_t entry;
+    result = result && hardware_log_read(1, &entry) == 0 &&
+             entry.event == HARDWARE_LOG_EVENT_LOCK_STARTED && entry.arg == 90;
+    print_test_result("History flushed on deadline and sleep, kept across restart", result);
+    return result;
+}
+
+int main(void) {
+    printf("CKOS Event Log Tests\n");
+    printf("====================\n\n");
+
+    int passed = 0;
+    int total = 0;
+
+    g_device = calloc(1, bsp_sim_instance_size());
+    if (!g_device) return 1;
+
+    printf("Append/Read Tests:\n");
+    total++; if (test_append_read_newest_first()) passed++;
+    total++; if (test_entries_packed()) passed++;
+    printf("\n");
+
+    printf("Index and Recovery Tests:\n");
+    total++; if (test_mount_rebuilds_index()) passed++;
+    total++; if (test_read_costs_one_block()) passed++;
+    total++; if (test_wraparound_erases_one_page()) passed++;
+    total++; if (test_torn_block_skipped()) passed++;
+    printf("\n");
+
+    printf("Hardware Log Tests:\n");
+    total++; if (test_hardware_logs_sensor_events()) passed++;
+    total++; if (test_hardware_log_flush_triggers()) passed++;
+    printf("\n");
+
+    bsp_sim_instance_release(g_device);
+    bsp_sim_instance_bind(NULL);
+    free(g_device);
+
+    printf("Test Results: %d/%d passed (%.1f%%)\n",
+           passed, total, (float)passed / total * 100.0f);
+
+    if (passed == total) {
+        printf("All tests PASSED! ✓\n");
+        return 0;
+    } else {
+        printf("Some tests FAILED! ✗\n");
+        return 1;
+    }
+}
@@ -0,0 +1,409 @@
+// CKOS Record Store Unit Tests
+// Tests for the log-structured record store in Utils/kv_store.c and the
+// write-back config cache in front of it, running on the simulator flash model
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include "BSP/bsp_api.h"
+#include "Config/app_config.h"
+#include "Utils/kv_store.h"
+#include "Hardware/hardware_api.h"
+#include "sim_fixture.h"
+
+#define TEST_REGION_START   CONFIG_STORAGE_CONFIG_START_ADDR
+#define TEST_REGION_SIZE    CONFIG_STORAGE_CONFIG_SIZE
+
+typedef struct {
+    uint32_t utc_lock_start_time;
+    uint32_t utc_unlock_target_time;
+    uint32_t accumulated_seconds;
+    uint8_t state;
+} test_session_t;
+
+static void* g_device;
+static KvStore_t g_store;
+
+static void print_test_result(const char* test_name, bool passed) {
+    printf("[%s] %s\n", passed ? "PASS" : "FAIL", test_name);
+}
+
+// Each test starts from a blank flash device and a freshly mounted store
+static bool fresh_store(void) {
+    sim_fixture_blank_bsp(g_device);
+    return kv_store_mount(&g_store, TEST_REGION_START, TEST_REGION_SIZE) == 0;
+}
+
+static uint32_t doublewords_programmed(void) {
+    bsp_sim_storage_stats_t stats;
+    bsp_sim_storage_get_stats(&stats);
+    return stats.doublewords_programmed;
+}
+
+// =============================================================================
+// READ/WRITE TESTS
+// =============================================================================
+
+bool test_write_read_roundtrip(void) {
+    bool result = fresh_store();
+    test_session_t session = { 1000, 4600, 42, 3 };
+    test_session_t readback;
+    memset(&readback, 0, sizeof(readback));
+
+    result = result && kv_store_read(&g_store, 1, &readback, sizeof(readback)) == -1;
+    result = result && kv_store_write(&g_store, 1, &session, sizeof(session)) == 0;
+    result = result && kv_store_read(&g_store, 1, &readback, sizeof(readback)) == (int)sizeof(session);
+    result = result && memcmp(&session, &readback, sizeof(session)) == 0;
+
+    // Reserved key and oversized values are rejected
+    uint8_t big[KV_STORE_MAX_VALUE_SIZE + 1];
+    memset(big, 0, sizeof(big));
+    result = result && kv_store_write(&g_store, KV_STORE_KEY_INVALID, &session, sizeof(session)) == -1;
+    result = result && kv_store_write(&g_store, 2, big, sizeof(big)) == -1;
+    print_test_result("Write/read roundtrip, bad key and size rejected", result);
+    return result;
+}
+
+bool test_newer_record_supersedes(void) {
+    bool result = fresh_store();
+    uint32_t value = 0;
+    for (uint32_t i = 1; i <= 10; i++) {
+        result = result && kv_store_write(&g_store, 7, &i, sizeof(i)) == 0;
+    }
+    result = result && kv_store_read(&g_store, 7, &value, sizeof(value)) == 4 && value == 10;
+
+    // Same value again is absorbed without programming flash
+    uint32_t before = doublewords_programmed();
+    result = result && kv_store_write(&g_store, 7, &value, sizeof(value)) == 0;
+    result = result && doublewords_programmed() == before;
+
+    KvStoreStats_t stats;
+    kv_store_get_stats(&g_store, &stats);
+    result = result && stats.records_written == 10 && stats.writes_unchanged == 1;
+    print_test_result("Newer record supersedes, unchanged write absorbed", result);
+    return result;
+}
+
+// =============================================================================
+// MOUNT AND RECOVERY TESTS
+// =============================================================================
+
+bool test_mount_rebuilds_index(void) {
+    bool result = fresh_store();
+    uint32_t a = 0xAAAA0001u, b = 0xBBBB0002u, a2 = 0xAAAA0003u;
+    result = result && kv_store_write(&g_store, 1, &a, sizeof(a)) == 0;
+    result = result && kv_store_write(&g_store, 2, &b, sizeof(b)) == 0;
+    result = result && kv_store_write(&g_store, 1, &a2, sizeof(a2)) == 0;
+
+    KvStore_t remounted;
+    uint32_t value = 0;
+    result = result && kv_store_mount(&remounted, TEST_REGION_START, TEST_REGION_SIZE) == 0;
+    result = result && kv_store_read(&remounted, 1, &value, sizeof(value)) == 4 && value == a2;
+    result = result && kv_store_read(&remounted, 2, &value, sizeof(value)) == 4 && value == b;
+    result = result && remounted.index_count == 2;
+    result = result && remounted.head_offset == g_store.head_offset;
+    print_test_result("Mount rebuilds index with latest values", result);
+    return result;
+}
+
+bool test_torn_record_skipped(void) {
+    bool result = fresh_store();
+    uint32_t good = 0x600D600Du;
+    result = result && kv_store_write(&g_store, 3, &good, sizeof(good)) == 0;
+
+    // A header whose value never made it (CRC cannot match the erased value)
+    uint16_t torn[4] = { 3, 4, (uint16_t)~4u, 0x1234 };
+    bsp_storage_operation_t op = {
+        TEST_REGION_START + g_store.head_offset, (uint8_t*)torn, sizeof(torn)
+    };
+    result = result && bsp_storage_write(&op) == 0;
+
+    KvStore_t remounted;
+    uint32_t value = 0;
+    result = result && kv_store_mount(&remounted, TEST_REGION_START, TEST_REGION_SIZE) == 0;
+    result = result && kv_store_read(&remounted, 3, &value, sizeof(value)) == 4 && value == good;
+
+    KvStoreStats_t stats;
+    kv_store_get_stats(&remounted, &stats);
+    result = result && stats.corrupt_records == 1;
+
+    // Appending continues after the torn record
+    uint32_t next = 0x0E0E0E0Eu;
+    result = result && kv_store_write(&remounted, 3, &next, sizeof(next)) == 0;
+    result = result && kv_store_read(&remounted, 3, &value, sizeof(value)) == 4 && value == next;
+    print_test_result("Torn record skipped at mount", result);
+    return result;
+}
+
+bool test_damaged_page_header_erased(void) {
+    bool result = fresh_store();
+    uint32_t value = 0x12345678u;
+    result = result && kv_store_write(&g_store, 4, &value, sizeof(value)) == 0;
+
+    // Garbage in the spare page's header, as after an interrupted erase
+    uint32_t garbage[2] = { 0x00FF00FFu, 0 };
+    bsp_storage_operation_t op = {
+        TEST_REGION_START + BSP_STORAGE_PAGE_SIZE, (uint8_t*)garbage, sizeof(garbage)
+    };
+    result = result && bsp_storage_write(&op) == 0;
+
+    uint32_t spare_page = (TEST_REGION_START / BSP_STORAGE_PAGE_SIZE) + 1;
+    uint32_t erases_before = bsp_sim_storage_get_page_erase_count(spare_page);
+    KvStore_t remounted;
+    uint32_t readback = 0;
+    result = result && kv_store_mount(&remounted, TEST_REGION_START, TEST_REGION_SIZE) == 0;
+    result = result && bsp_sim_storage_get_page_erase_count(spare_page) == erases_before + 1;
+    result = result && kv_store_read(&remounted, 4, &readback, sizeof(readback)) == 4;
+    result = result && readback == value;
+    print_test_result("Damaged page header erased at mount", result);
+    return result;
+}
+
+// =============================================================================
+// WEAR LEVELLING AND COMPACTION TESTS
+// =============================================================================
+
+bool test_pages_rotate_evenly(void) {
+    bool result = fresh_store();
+    test_session_t session = { 0, 0, 0, 1 };
+    uint32_t counters[6] = { 0 };
+
+    for (uint32_t i = 0; i < 2000 && result; i++) {
+        session.accumulated_seconds = i;
+        counters[i % 6] = i;
+        result = kv_store_write(&g_store, 1, &session, sizeof(session)) == 0 &&
+                 kv_store_write(&g_store, 2, counters, sizeof(counters)) == 0;
+    }
+
+    test_session_t readback;
+    uint32_t counters_back[6];
+    result = result && kv_store_read(&g_store, 1, &readback, sizeof(readback)) == (int)sizeof(readback);
+    result = result && readback.accumulated_seconds == 1999;
+    result = result && kv_store_read(&g_store, 2, counters_back, sizeof(counters_back)) ==
+                       (int)sizeof(counters_back);
+    result = result && memcmp(counters, counters_back, sizeof(counters)) == 0;
+
+    uint32_t first = TEST_REGION_START / BSP_STORAGE_PAGE_SIZE;
+    uint32_t e0 = bsp_sim_storage_get_page_erase_count(first);
+    uint32_t e1 = bsp_sim_storage_get_page_erase_count(first + 1);
+    result = result && e0 > 10 && (e0 > e1 ? e0 - e1 : e1 - e0) <= 1;
+    printf("  4000 records: page erases %lu / %lu\n", (unsigned long)e0, (unsigned long)e1);
+    print_test_result("Pages rotate with even erase counts", result);
+    return result;
+}
+
+bool test_idle_compaction_takes_erase_off_write_path(void) {
+    bool result = fresh_store();
+    uint32_t value = 0;
+
+    // Fill until the head could not take a maximum-size record
+    while (result && g_store.head_offset + 8 + KV_STORE_MAX_VALUE_SIZE <= BSP_STORAGE_PAGE_SIZE) {
+        value++;
+        result = kv_store_write(&g_store, 5, &value, sizeof(value)) == 0;
+    }
+    result = result && kv_store_compact(&g_store) == 1;
+    result = result && kv_store_compact(&g_store) == 0;
+
+    bsp_sim_storage_stats_t before, after;
+    bsp_sim_storage_get_stats(&before);
+    uint8_t big[KV_STORE_MAX_VALUE_SIZE];
+    memset(big, 0x5A, sizeof(big));
+    result = result && kv_store_write(&g_store, 6, big, sizeof(big)) == 0;
+    bsp_sim_storage_get_stats(&after);
+    result = result && after.page_erases == before.page_erases;
+
+    uint32_t readback = 0;
+    result = result && kv_store_read(&g_store, 5, &readback, sizeof(readback)) == 4;
+    result = result && readback == value;
+    print_test_result("Idle compaction takes the erase off the write path", result);
+    return result;
+}
+
+bool test_store_full_rejected(void) {
+    bool result = fresh_store();
+    uint8_t big[KV_STORE_MAX_VALUE_SIZE];
+    memset(big, 0x33, sizeof(big));
+
+    // Six 264-byte records leave room to rewrite any of them in a 2040-byte
+    // page; a seventh would not
+    uint16_t key = 0;
+    for (key = 0; key < 6 && result; key++) {
+        result = kv_store_write(&g_store, key, big, sizeof(big)) == 0;
+    }
+    result = result && kv_store_write(&g_store, key, big, sizeof(big)) == -1;
+
+    // Existing keys can still be rewritten through page rotation
+    big[0] = 0x44;
+    for (int i = 0; i < 20 && result; i++) {
+        result = kv_store_write(&g_store, (uint16_t)(i % 6), big, sizeof(big)) == 0;
+        big[1]++;
+    }
+    print_test_result("Store full rejected, live records still rewritable", result);
+    return result;
+}
+
+// =============================================================================
+// WRITE-BACK CACHE TESTS
+// =============================================================================
+
+// Blank flash device with the hardware service (and its cache) initialized
+static bool fresh_hardware(void) {
+    bool result = fresh_store();
+    bsp_sim_clock_set_fast_forward(true);
+    return result && hardware_init() == 0;
+}
+
+static uint32_t stored_value(uint16_t key) {
+    KvStore_t store;
+    uint32_t value = 0;
+    kv_store_mount(&store, TEST_REGION_START, TEST_REGION_SIZE);
+    kv_store_read(&store, key, &value, sizeof(value));
+    return value;
+}
+
+bool test_cache_absorbs_writes_until_flush(void) {
+    bool result = fresh_hardware();
+    uint32_t before = doublewords_programmed();
+    for (uint32_t i = 1; i <= 50; i++) {
+        result = result && hardware_config_write(0x10, &i, sizeof(i)) == 0;
+    }
+
+    uint32_t value = 0;
+    result = result && hardware_config_read(0x10, &value, sizeof(value)) == 4 && value == 50;
+    result = result && doublewords_programmed() == before;
+    result = result && hardware_config_flush() == 0;
+    result = result && stored_value(0x10) == 50;
+
+    hardware_config_cache_stats_t stats;
+    hardware_config_get_cache_stats(&stats);
+    // Every write but the one flushed was superseded before reaching flash
+    result = result && stats.writes == 50 && stats.writes_absorbed == 49;
+    result = result && stats.flash_programs == 1 && stats.dirty_records == 0;
+    print_test_result("Cache absorbs repeated writes, flush programs once", result);
+    return result;
+}
+
+bool test_cache_flush_deadline(void) {
+    bool result = fresh_hardware();
+    uint32_t value = 7;
+    result = result && hardware_config_write(0x11, &value, sizeof(value)) == 0;
+
+    bsp_sim_clock_advance(CONFIG_CONFIG_CACHE_FLUSH_MS - 1);
+    hardware_storage_idle();
+    result = result && stored_value(0x11) != 7;
+
+    bsp_sim_clock_advance(1);
+    hardware_storage_idle();
+    result = result && stored_value(0x11) == 7;
+    print_test_result("Cache flushed once the deadline passes", result);
+    return result;
+}
+
+bool test_cache_flush_on_sleep_and_critical_battery(void) {
+    bool result = fresh_hardware();
+    uint32_t value = 21;
+    result = result && hardware_config_write(0x12, &value, sizeof(value)) == 0;
+    hardware_power_set_mode(HARDWARE_POWER_SLEEP);
+    result = result && stored_value(0x12) == 21;
+
+    value = 22;
+    result = result && hardware_config_write(0x12, &value, sizeof(value)) == 0;
+    hardware_sensor_poll_events();  // Baseline sample
+    bsp_debug_set_sensor_value("battery", CONFIG_BATTERY_CRITICAL_THRESHOLD);
+    result = result && (hardware_sensor_poll_events() & HST_EVT_BATTERY_CRITICAL) != 0;
+    result = result && stored_value(0x12) == 22;
+    print_test_result("Cache flushed on sleep entry and critical battery", result);
+    return result;
+}
+
+bool test_cache_large_record_written_through(void) {
+    bool result = fresh_hardware();
+    uint8_t big[128];
+    memset(big, 0x77, sizeof(big));
+    result = result && hardware_config_write(0x13, big, sizeof(big)) == 0;
+
+    KvStore_t store;
+    uint8_t readback[128];
+    result = result && kv_store_mount(&store, TEST_REGION_START, TEST_REGION_SIZE) == 0;
+    result = result && kv_store_read(&store, 0x13, readback, sizeof(readback)) == 128;
+    result = result && memcmp(big, readback, sizeof(big)) == 0;
+
+    hardware_config_cache_stats_t stats;
+    hardware_config_get_cache_stats(&stats);
+    result = result && stats.writes_absorbed == 0 && stats.flash_programs == 1;
+    print_test_result("Records larger than a cache line written through", result);
+    return result;
+}
+
+bool test_cache_write_through_supersedes_dirty(void) {
+    bool result = fresh_hardware();
+    uint32_t small = 5;
+    uint8_t big[128];
+    memset(big, 0x55, sizeof(big));
+    result = result && hardware_config_write(0x14, &small, sizeof(small)) == 0;
+    result = result && hardware_config_write(0x14, big, sizeof(big)) == 0;
+
+    // The cached value never reaches flash and leaves nothing to flush
+    hardware_config_cache_stats_t stats;
+    hardware_config_get_cache_stats(&stats);
+    result = result && stats.writes_absorbed == 1 && stats.flash_programs == 1 &&
+             stats.dirty_records == 0;
+    result = result && hardware_config_flush() == 0;
+    hardware_config_get_cache_stats(&stats);
+    result = result && stats.flash_programs == 1;
+    print_test_result("Write-through supersedes a dirty cached value", result);
+    return result;
+}
+
+int main(void) {
+    printf("CKOS Record Store Tests\n");
+    printf("=======================\n\n");
+
+    int passed = 0;
+    int total = 0;
+
+    g_device = calloc(1, bsp_sim_instance_size());
+    if (!g_device) return 1;
+
+    printf("Read/Write Tests:\n");
+    total++; if (test_write_read_roundtrip()) passed++;
+    total++; if (test_newer_record_supersedes()) passed++;
+    printf("\n");
+
+    printf("Mount and Recovery Tests:\n");
+    total++; if (test_mount_rebuilds_index()) passed++;
+    total++; if (test_torn_record_skipped()) passed++;
+    total++; if (test_damaged_page_header_erased()) passed++;
+    printf("\n");
+
+    printf("Wear Levelling and Compaction Tests:\n");
+    total++; if (test_pages_rotate_evenly()) passed++;
+    total++; if (test_idle_compaction_takes_erase_off_write_path()) passed++;
+    total++; if (test_store_full_rejected()) passed++;
+    printf("\n");
+
+    printf("Write-Back Cache Tests:\n");
+    total++; if (test_cache_absorbs_writes_until_flush()) passed++;
+    total++; if (test_cache_flush_deadline()) passed++;
+    total++; if (test_cache_flush_on_sleep_and_critical_battery()) passed++;
+    total++; if (test_cache_large_record_written_through()) passed++;
+    total++; if (test_cache_write_through_supersedes_dirty()) passed++;
+    printf("\n");
+
+    bsp_sim_instance_release(g_device);
+    bsp_sim_instance_bind(NULL);
+    free(g_device);
+
+    printf("Test Results: %d/%d passed (%.1f%%)\n",
+           passed, total, (float)passed / total * 100.0f);
+
+    if (passed == total) {
+        printf("All tests PASSED! ✓\n");
+        return 0;
+    } else {
+        printf("Some tests FAILED! ✗\n");
+        return 1;
+    }
+}
@@ -0,0 +1,410 @@
+// CKOS Lock Time Checkpoint Tests
+// Tests for the delta checkpoints of the lock time counters in
+// AppLogic/lock_time.c and the RTC alarm schedule in AppLogic/lock_schedule.c,
+// on a simulated device with the flash model
+
+#include <stdio.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include "Simulator/sim_fleet.h"
+#include "AppLogic/app_logic.h"
+#include "AppLogic/lock_time.h"
+#include "AppLogic/lock_schedule.h"
+#include "Hardware/hardware_api.h"
+#include "Utils/utils.h"
+#include "sim_fixture.h"
+
+#define TEST_BATTERY_OK     80.0f
+#define TEST_NOW_UTC        1700000000ull
+#define TEST_LOCK_SECONDS   600u
+
+static sim_device_t* g_device;
+static LockTime_t g_lock_time;
+
+static void print_test_result(const char* test_name, bool passed) {
+    printf("[%s] %s\n", passed ? "PASS" : "FAIL", test_name);
+}
+
+// Each test starts from a blank device with the hardware service running
+static bool fresh_device(void) {
+    if (!sim_fixture_blank_device(&g_device)) return false;
+    return hardware_init() == 0 && lock_time_restore(&g_lock_time, bsp_get_tick_ms()) == 0;
+}
+
+static bsp_sim_storage_stats_t storage_stats(void) {
+    bsp_sim_storage_stats_t stats;
+    bsp_sim_storage_get_stats(&stats);
+    return stats;
+}
+
+// A minute locked on counter, then a checkpoint
+static bool locked_minute(LockCounterType counter) {
+    lock_time_accrue(&g_lock_time, counter, 60, 0);
+    return lock_time_checkpoint(&g_lock_time, bsp_get_tick_ms()) == 0;
+}
+
+// Power cycle: RAM state is lost, the counters come back from flash
+static bool restart(LockTime_t* restored) {
+    return hardware_init() == 0 && lock_time_restore(restored, bsp_get_tick_ms()) == 0;
+}
+
+static bool counters_equal(const LockTimeCounters_t* a, const LockTimeCounters_t* b) {
+    return memcmp(a, b, sizeof(*a)) == 0;
+}
+
+// Snapshot of a custom lock in progress when the device last ran
+static bool write_locked_snapshot(uint32_t lock_start_utc, uint32_t unlock_target_utc) {
+    AppSnapshot_t snapshot;
+    memset(&snapshot, 0, sizeof(snapshot));
+    snapshot.state = STATE_LOCK_ACTIVE;
+    snapshot.lock_type = LOCK_TYPE_CUSTOM;
+    snapshot.lock_state = LOCK_STATE_LOCKED;
+    snapshot.utc_lock_start_time = lock_start_utc;
+    snapshot.utc_unlock_target_time = unlock_target_utc;
+    snapshot.header.magic = APP_SNAPSHOT_MAGIC;
+    snapshot.header.version = APP_SNAPSHOT_VERSION;
+    snapshot.header.length = (uint8_t)(sizeof(snapshot) - sizeof(snapshot.header));
+    snapshot.header.crc = utils_crc32((const uint8_t*)&snapshot + sizeof(snapshot.header),
+                                      snapshot.header.length);
+    return hardware_config_write(HARDWARE_CONFIG_KEY_APP_SNAPSHOT, &snapshot,
+                                 sizeof(snapshot)) == 0 &&
+           hardware_config_flush() == 0;
+}
+
+// =============================================================================
+// CHECKPOINT TESTS
+// =============================================================================
+
+bool test_deltas_fold_into_base(void) {
+    bool result = fresh_device();
+
+    // The first checkpoint has no base to refer to
+    result = result && locked_minute(LOCK_COUNTER_CUSTOM);
+    LockTimeStats_t stats;
+    lock_time_get_stats(&g_lock_time, &stats);
+    result = result && stats.bases_written == 1 && stats.deltas_written == 0;
+
+    for (int i = 0; i < CONFIG_LOCK_TIME_DELTAS_PER_BASE; i++) {
+        result = result && locked_minute(LOCK_COUNTER_CUSTOM);
+    }
+    lock_time_get_stats(&g_lock_time, &stats);
+    result = result && stats.bases_written == 1 &&
+             stats.deltas_written == CONFIG_LOCK_TIME_DELTAS_PER_BASE;
+
+    result = result && locked_minute(LOCK_COUNTER_CUSTOM);
+    lock_time_get_stats(&g_lock_time, &stats);
+    result = result && stats.bases_written == 2;
+
+    // Nothing accrued: nothing written
+    uint32_t programmed = storage_stats().doublewords_programmed;
+    result = result && lock_time_checkpoint(&g_lock_time, bsp_get_tick_ms()) == 0;
+    result = result && storage_stats().doublewords_programmed == programmed;
+    print_test_result("Deltas folded into a new base after the limit", result);
+    return result;
+}
+
+bool test_fold_on_second_counter_and_new_session(void) {
+    bool result = fresh_device();
+    result = result && locked_minute(LOCK_COUNTER_AGENT_BEGINNER);
+    result = result && locked_minute(LOCK_COUNTER_AGENT_BEGINNER);
+
+    LockTimeStats_t stats;
+    result = result && locked_minute(LOCK_COUNTER_KEYHOLDER_BASIC);
+    lock_time_get_stats(&g_lock_time, &stats);
+    result = result && stats.bases_written == 2;
+
+    lock_time_end_session(&g_lock_time);
+    result = result && lock_time_checkpoint(&g_lock_time, bsp_get_tick_ms()) == 0;
+    lock_time_get_stats(&g_lock_time, &stats);
+    result = result && stats.bases_written == 3;
+
+    LockTime_t restored;
+    result = result && restart(&restored);
+    result = result && restored.counters.session_seconds == 0 &&
+             restored.counters.total_locked_seconds[LOCK_COUNTER_AGENT_BEGINNER] == 120 &&
+             restored.counters.total_locked_seconds[LOCK_COUNTER_KEYHOLDER_BASIC] == 60;
+    print_test_result("Second counter or a new session forces a base", result);
+    return result;
+}
+
+bool test_fewer_flash_programs(void) {
+    bool result = fresh_device();
+    const int checkpoints = 45;
+
+    uint32_t before = storage_stats().doublewords_programmed;
+    for (int i = 0; i < checkpoints; i++) {
+        lock_time_accrue(&g_lock_time, LOCK_COUNTER_AGENT_ADVANCED, 300, (i % 5 == 0) ? 30 : 0);
+        result = result && lock_time_checkpoint(&g_lock_time, bsp_get_tick_ms()) == 0;
+    }
+    uint32_t delta_cost = storage_stats().doublewords_programmed - before;
+
+    // The same checkpoints as whole records
+    LockTimeBase_t full;
+    memset(&full, 0, sizeof(full));
+    before = storage_stats().doublewords_programmed;
+    for (int i = 0; i < checkpoints; i++) {
+        full.counters.session_seconds += 300;
+        result = result && hardware_config_write(0x0010, &full, sizeof(full)) == 0 &&
+                 hardware_config_flush() == 0;
+    }
+    uint32_t full_cost = storage_stats().doublewords_programmed - before;
+
+    printf("  %d checkpoints: %lu doublewords as deltas, %lu as whole records\n",
+           checkpoints, (unsigned long)delta_cost, (unsigned long)full_cost);
+    result = result && delta_cost * 2 < full_cost;
+    print_test_result("Delta checkpoints program under half the flash", result);
+    return result;
+}
+
+// =============================================================================
+// RESTORE TESTS
+// =============================================================================
+
+bool test_restore_base_and_one_delta(void) {
+    bool result = fresh_device();
+    for (int i = 0; i < 5; i++) {
+        lock_time_accrue(&g_lock_time, LOCK_COUNTER_AGENT_PERMANENT, 45, 0);
+        lock_time_accrue(&g_lock_time, LOCK_COUNTER_AGENT_PERMANENT, 0, 7);
+        result = result && lock_time_checkpoint(&g_lock_time, bsp_get_tick_ms()) == 0;
+    }
+
+    hardware_init();
+    LockTime_t restored;
+    uint32_t reads = storage_stats().reads;
+    result = result && lock_time_restore(&restored, bsp_get_tick_ms()) == 0;
+    result = result && storage_stats().reads - reads == 2;
+    result = result && counters_equal(&restored.counters, &g_lock_time.counters);
+    result = result && restored.counters.total_locked_seconds[LOCK_COUNTER_AGENT_PERMANENT] == 225 &&
+             restored.counters.break_seconds == 35;
+
+    // Carrying on from the restored state keeps the sequence going
+    LockTimeStats_t stats;
+    lock_time_get_stats(&restored, &stats);
+    result = result && stats.deltas_replayed == 1 && restored.deltas_since_base == 4;
+    print_test_result("Restore reads the base and the newest delta only", result);
+    return result;
+}
+
+bool test_stale_delta_ignored(void) {
+    bool result = fresh_device();
+    for (int i = 0; i < CONFIG_LOCK_TIME_DELTAS_PER_BASE + 2; i++) {
+        result = result && locked_minute(LOCK_COUNTER_CUSTOM);
+    }
+
+    // The new base holds the last full delta's time; that delta is now stale
+    LockTime_t restored;
+    result = result && restart(&restored);
+    result = result && counters_equal(&restored.counters, &g_lock_time.counters);
+    result = result && restored.counters.total_locked_seconds[LOCK_COUNTER_CUSTOM] ==
+             60u * (CONFIG_LOCK_TIME_DELTAS_PER_BASE + 2);
+    LockTimeStats_t stats;
+    lock_time_get_stats(&restored, &stats);
+    result = result && stats.deltas_replayed == 0;
+    print_test_result("Delta from an older base not replayed", result);
+    return result;
+}
+
+// =============================================================================
+// INTERVAL TESTS
+// =============================================================================
+
+bool test_interval_follows_battery(void) {
+    bool result = fresh_device();
+    result = result && lock_time_checkpoint_interval_ms(TEST_BATTERY_OK, true) ==
+             CONFIG_LOCK_TIME_CHECKPOINT_CHARGING_MS;
+    result = result && lock_time_checkpoint_interval_ms(TEST_BATTERY_OK, false) ==
+             CONFIG_LOCK_TIME_CHECKPOINT_MS;
+    result = result && lock_time_checkpoint_interval_ms(CONFIG_BATTERY_LOW_THRESHOLD - 1, false) ==
+             CONFIG_LOCK_TIME_CHECKPOINT_LOW_MS;
+
+    // Not due yet, then due
+    LockTimeStats_t stats;
+    lock_time_accrue(&g_lock_time, LOCK_COUNTER_CUSTOM, 10, 0);
+    bsp_sim_clock_advance(CONFIG_LOCK_TIME_CHECKPOINT_MS - 1);
+    result = result && lock_time_service(&g_lock_time, bsp_get_tick_ms(), TEST_BATTERY_OK, false) == 0;
+    lock_time_get_stats(&g_lock_time, &stats);
+    result = result && stats.bases_written == 0;
+    bsp_sim_clock_advance(1);
+    result = result && lock_time_service(&g_lock_time, bsp_get_tick_ms(), TEST_BATTERY_OK, false) == 0;
+    lock_time_get_stats(&g_lock_time, &stats);
+    result = result && stats.bases_written == 1;
+
+    // Going critical checkpoints at once, and only once
+    lock_time_accrue(&g_lock_time, LOCK_COUNTER_CUSTOM, 10, 0);
+    bsp_sim_clock_advance(1000);
+    result = result && lock_time_service(&g_lock_time, bsp_get_tick_ms(),
+                                         CONFIG_BATTERY_CRITICAL_THRESHOLD, false) == 0;
+    lock_time_accrue(&g_lock_time, LOCK_COUNTER_CUSTOM, 10, 0);
+    bsp_sim_clock_advance(1000);
+    result = result && lock_time_service(&g_lock_time, bsp_get_tick_ms(),
+                                         CONFIG_BATTERY_CRITICAL_THRESHOLD, false) == 0;
+    lock_time_get_stats(&g_lock_time, &stats);
+    result = result && stats.deltas_written == 1;
+    print_test_result("Checkpoint interval follows the battery", result);
+    return result;
+}
+
+// =============================================================================
+// APPLICATION TESTS
+// =============================================================================
+
+bool test_locked_device_accrues(void) {
+    bool result = sim_fixture_blank_device(&g_device) && hardware_init() == 0;
+
+    // A device that was locked when it last ran
+    result = result && write_locked_snapshot(0, 0);
+
+    result = result && sim_device_start(g_device) == 0;
+    sim_device_run_for(g_device, 2 * CONFIG_LOCK_TIME_CHECKPOINT_MS + 5000);
+    const LockTimeCounters_t* counters = app_logic_get_lock_time_counters();
+    uint32_t locked = (uint32_t)counters->total_locked_seconds[LOCK_COUNTER_CUSTOM];
+    result = result && locked >= 2 * CONFIG_LOCK_TIME_CHECKPOINT_MS / 1000 &&
+             app_logic_get_lock_session()->current_session_accumulated_time_seconds == locked;
+
+    // Two checkpoints reached flash before the power cut
+    LockTime_t restored;
+    result = result && restart(&restored);
+    result = result && restored.counters.session_seconds >= 2 * CONFIG_LOCK_TIME_CHECKPOINT_MS / 1000 - 1 &&
+             restored.counters.session_seconds <= locked;
+    print_test_result("Locked device accrues and checkpoints session time", result);
+    return result;
+}
+
+// =============================================================================
+// SCHEDULE TESTS
+// =============================================================================
+
+bool test_schedule_picks_earliest(void) {
+    LockSchedule_t schedule = {0};
+    LockWakeReason reason;
+
+    bool result = lock_schedule_next(&schedule, TEST_NOW_UTC, &reason) == 0 &&
+                  reason == LOCK_WAKE_NONE;
+
+    // A four-week lock wakes for its checkpoint, then for the unlock
+    schedule.unlock_utc = TEST_NOW_UTC + 28ull * 24 * 3600;
+    schedule.checkpoint_utc = TEST_NOW_UTC + 300;
+    result = result && lock_schedule_next(&schedule, TEST_NOW_UTC, &reason) == TEST_NOW_UTC + 300 &&
+             reason == LOCK_WAKE_CHECKPOINT;
+    schedule.checkpoint_utc = 0;
+    result = result && lock_schedule_next(&schedule, TEST_NOW_UTC, &reason) == schedule.unlock_utc &&
+             reason == LOCK_WAKE_UNLOCK;
+
+    // 90 s left shows one minute until 59 s are left
+    schedule.unlock_utc = TEST_NOW_UTC + 90;
+    schedule.countdown_visible = true;
+    result = result && lock_schedule_next(&schedule, TEST_NOW_UTC, &reason) == TEST_NOW_UTC + 31 &&
+             reason == LOCK_WAKE_DISPLAY_MINUTE;
+
+    // Counting up from a lock with no end: the next whole minute locked
+    schedule.unlock_utc = 0;
+    schedule.countup_start_utc = TEST_NOW_UTC - 130;
+    result = result && lock_schedule_next(&schedule, TEST_NOW_UTC, &reason) == TEST_NOW_UTC + 50 &&
+             reason == LOCK_WAKE_DISPLAY_MINUTE;
+
+    // A break that ran out while asleep is due now
+    schedule.countdown_visible = false;
+    schedule.break_end_utc = TEST_NOW_UTC - 5;
+    result = result && lock_schedule_next(&schedule, TEST_NOW_UTC, &reason) == TEST_NOW_UTC &&
+             reason == LOCK_WAKE_BREAK_END;
+
+    result = result && lock_schedule_remaining(TEST_NOW_UTC + 10, TEST_NOW_UTC) == 10 &&
+             lock_schedule_remaining(TEST_NOW_UTC - 10, TEST_NOW_UTC) == 0 &&
+             lock_schedule_reached(TEST_NOW_UTC, TEST_NOW_UTC) &&
+             !lock_schedule_reached(0, TEST_NOW_UTC);
+    print_test_result("Schedule picks the earliest instant", result);
+    return result;
+}
+
+bool test_locked_device_wakes_on_alarm(void) {
+    bool result = sim_fixture_blank_device(&g_device) && hardware_init() == 0;
+
+    uint32_t now = (uint32_t)bsp_get_utc_time_seconds();
+    result = result && write_locked_snapshot(now, now + TEST_LOCK_SECONDS);
+    result = result && sim_device_start(g_device) == 0;
+
+    // Once the display has blanked only the checkpoints and the unlock remain
+    sim_device_run_for(g_device, TEST_LOCK_SECONDS * 1000 / 2 - 10000);
+    LockWakeReason reason;
+    uint64_t next = app_logic_get_next_lock_wake(&reason);
+    result = result && next > bsp_get_utc_time_seconds() && next <= now + TEST_LOCK_SECONDS &&
+             (reason == LOCK_WAKE_CHECKPOINT || reason == LOCK_WAKE_UNLOCK);
+
+    // The alarm ends the lock on time and the memory wire opens the door;
+    // nothing is left to wake for
+    sim_device_run_for(g_device, TEST_LOCK_SECONDS * 1000 / 2 + 12000);
+    const LockSession_t* session = app_logic_get_lock_session();
+    result = result && session->operational_state == LOCK_STATE_UNLOCKED &&
+             !hardware_is_door_closed() &&
+             session->current_session_accumulated_time_seconds == TEST_LOCK_SECONDS &&
+             app_logic_get_next_lock_wake(&reason) == 0 && reason == LOCK_WAKE_NONE;
+    print_test_result("Locked device wakes on the RTC alarm and unlocks on time", result);
+    return result;
+}
+
+bool test_unlock_persists_total(void) {
+    bool result = sim_fixture_blank_device(&g_device) && hardware_init() == 0;
+
+    uint32_t now = (uint32_t)bsp_get_utc_time_seconds();
+    result = result && write_locked_snapshot(now, now + TEST_LOCK_SECONDS);
+    result = result && sim_device_start(g_device) == 0;
+    sim_device_run_for(g_device, TEST_LOCK_SECONDS * 1000 + 2000);
+    result = result && app_logic_get_lock_session()->operational_state == LOCK_STATE_UNLOCKED;
+
+    // Reset straight after the unlock: the whole lock is in flash and no
+    // session is left open
+    LockTime_t restored;
+    result = result && restart(&restored);
+    result = result && restored.counters.total_locked_seconds[LOCK_COUNTER_CUSTOM] == TEST_LOCK_SECONDS &&
+             restored.counters.session_seconds == 0 && restored.counters.break_seconds == 0;
+    print_test_result("Unlock checkpoints the final total", result);
+    return result;
+}
+
+int main(void) {
+    printf("CKOS Lock Time Checkpoint Tests\n");
+    printf("===============================\n\n");
+
+    int passed = 0;
+    int total = 0;
+
+    printf("Checkpoint Tests:\n");
+    total++; if (test_deltas_fold_into_base()) passed++;
+    total++; if (test_fold_on_second_counter_and_new_session()) passed++;
+    total++; if (test_fewer_flash_programs()) passed++;
+    printf("\n");
+
+    printf("Restore Tests:\n");
+    total++; if (test_restore_base_and_one_delta()) passed++;
+    total++; if (test_stale_delta_ignored()) passed++;
+    printf("\n");
+
+    printf("Interval Tests:\n");
+    total++; if (test_interval_follows_battery()) passed++;
+    printf("\n");
+
+    printf("Application Tests:\n");
+    total++; if (test_locked_device_accrues()) passed++;
+    printf("\n");
+
+    printf("Schedule Tests:\n");
+    total++; if (test_schedule_picks_earliest()) passed++;
+    total++; if (test_locked_device_wakes_on_alarm()) passed++;
+    total++; if (test_unlock_persists_total()) passed++;
+    printf("\n");
+
+    sim_device_destroy(g_device);
+    sim_device_bind(NULL);
+
+    printf("Test Results: %d/%d passed (%.1f%%)\n",
+           passed, total, (float)passed / total * 100.0f);
+
+    if (passed == total) {
+        printf("All tests PASSED! ✓\n");
+        return 0;
+    } else {
+        printf("Some tests FAILED! ✗\n");
+        return 1;
+    }
+}
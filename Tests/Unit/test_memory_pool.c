@@ -0,0 +1,203 @@
+// CKOS Memory Pool Unit Tests
+// Tests for the fixed-block bitmap allocator in Utils/memory_pool.c
+
+#include <stdio.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include "Utils/memory_pool.h"
+
+#define TEST_BLOCK_SIZE   20    // Rounds up to 24
+#define TEST_NUM_BLOCKS   5
+
+MEMORY_POOL_ARENA(test_arena, TEST_BLOCK_SIZE, TEST_NUM_BLOCKS);
+MEMORY_POOL_ARENA(big_arena, 8, 40);
+
+static void print_test_result(const char* test_name, bool passed) {
+    printf("[%s] %s\n", passed ? "PASS" : "FAIL", test_name);
+}
+
+static MemoryPool_t make_test_pool(void) {
+    MemoryPool_t pool;
+    memory_pool_init(&pool, "test", test_arena, sizeof(test_arena), TEST_BLOCK_SIZE);
+    return pool;
+}
+
+// =============================================================================
+// INITIALIZATION TESTS
+// =============================================================================
+
+bool test_pool_init(void) {
+    MemoryPool_t pool;
+    bool result = memory_pool_init(&pool, "test", test_arena, sizeof(test_arena),
+                                   TEST_BLOCK_SIZE) == 0;
+    result = result && pool.num_blocks == TEST_NUM_BLOCKS;
+    result = result && pool.block_size_bytes == 24;
+    result = result && pool.free_blocks_bitmap == 0x1F;
+    
+    // Misaligned arena and an arena too small for one block are rejected
+    result = result && memory_pool_init(&pool, "bad", test_arena + 1,
+                                        sizeof(test_arena) - 1, TEST_BLOCK_SIZE) == -1;
+    result = result && memory_pool_init(&pool, "bad", test_arena, 16, TEST_BLOCK_SIZE) == -1;
+    
+    print_test_result("Pool Initialization", result);
+    return result;
+}
+
+bool test_pool_clamps_to_max_blocks(void) {
+    MemoryPool_t pool;
+    bool result = memory_pool_init(&pool, "big", big_arena, sizeof(big_arena), 8) == 0;
+    result = result && pool.num_blocks == MEMORY_POOL_MAX_BLOCKS;
+    result = result && pool.free_blocks_bitmap == 0xFFFFFFFFu;
+    
+    int allocated = 0;
+    while (memory_pool_alloc(&pool)) allocated++;
+    result = result && allocated == MEMORY_POOL_MAX_BLOCKS;
+    
+    print_test_result("Pool Clamps To 32 Blocks", result);
+    return result;
+}
+
+// =============================================================================
+// ALLOCATION TESTS
+// =============================================================================
+
+bool test_alloc_until_exhausted(void) {
+    MemoryPool_t pool = make_test_pool();
+    void* blocks[TEST_NUM_BLOCKS];
+    bool result = true;
+    
+    for (int i = 0; i < TEST_NUM_BLOCKS; i++) {
+        blocks[i] = memory_pool_alloc(&pool);
+        // Lowest free block first, every block aligned
+        result = result && blocks[i] == test_arena + i * 24;
+        result = result && ((uintptr_t)blocks[i] % MEMORY_POOL_ALIGNMENT) == 0;
+    }
+    result = result && memory_pool_alloc(&pool) == NULL;
+    
+    MemoryPoolStats_t stats;
+    memory_pool_get_stats(&pool, &stats);
+    result = result && stats.allocated_blocks == TEST_NUM_BLOCKS;
+    result = result && stats.free_blocks == 0;
+    result = result && stats.alloc_failures == 1;
+    
+    print_test_result("Allocate Until Exhausted", result);
+    return result;
+}
+
+bool test_free_reuses_block(void) {
+    MemoryPool_t pool = make_test_pool();
+    void* a = memory_pool_alloc(&pool);
+    void* b = memory_pool_alloc(&pool);
+    void* c = memory_pool_alloc(&pool);
+    
+    bool result = memory_pool_free(&pool, b) == 0;
+    result = result && memory_pool_alloc(&pool) == b;
+    result = result && memory_pool_free(&pool, a) == 0;
+    result = result && memory_pool_free(&pool, c) == 0;
+    result = result && pool.allocated_count == 1;
+    
+    print_test_result("Free Reuses Lowest Block", result);
+    return result;
+}
+
+// =============================================================================
+// ERROR DETECTION TESTS
+// =============================================================================
+
+bool test_double_free_detected(void) {
+    MemoryPool_t pool = make_test_pool();
+    void* a = memory_pool_alloc(&pool);
+    void* b = memory_pool_alloc(&pool);
+    
+    bool result = memory_pool_free(&pool, a) == 0;
+    result = result && memory_pool_free(&pool, a) == -1;
+    
+    // The rejected free must not disturb the accounting
+    MemoryPoolStats_t stats;
+    memory_pool_get_stats(&pool, &stats);
+    result = result && stats.allocated_blocks == 1;
+    result = result && stats.invalid_frees == 1;
+    result = result && memory_pool_owns(&pool, b);
+    
+    print_test_result("Double Free Detected", result);
+    return result;
+}
+
+bool test_foreign_pointer_rejected(void) {
+    MemoryPool_t pool = make_test_pool();
+    uint8_t* a = memory_pool_alloc(&pool);
+    static uint8_t outside[24];
+    
+    bool result = memory_pool_free(&pool, outside) == -1;
+    result = result && memory_pool_free(&pool, a + 4) == -1;   // Not on a block boundary
+    result = result && !memory_pool_owns(&pool, outside);
+    result = result && memory_pool_free(&pool, a) == 0;
+    result = result && pool.invalid_frees == 2;
+    
+    print_test_result("Foreign Pointer Rejected", result);
+    return result;
+}
+
+// =============================================================================
+// STATISTICS TESTS
+// =============================================================================
+
+bool test_high_water_mark(void) {
+    MemoryPool_t pool = make_test_pool();
+    void* a = memory_pool_alloc(&pool);
+    void* b = memory_pool_alloc(&pool);
+    void* c = memory_pool_alloc(&pool);
+    memory_pool_free(&pool, b);
+    memory_pool_free(&pool, c);
+    
+    MemoryPoolStats_t stats;
+    memory_pool_get_stats(&pool, &stats);
+    bool result = stats.high_water_blocks == 3 && stats.allocated_blocks == 1;
+    
+    memory_pool_reset_high_water(&pool);
+    memory_pool_get_stats(&pool, &stats);
+    result = result && stats.high_water_blocks == 1;
+    memory_pool_free(&pool, a);
+    
+    print_test_result("High Water Mark", result);
+    return result;
+}
+
+int main(void) {
+    printf("CKOS Memory Pool Unit Tests\n");
+    printf("===========================\n\n");
+    
+    int passed = 0;
+    int total = 0;
+    
+    printf("Initialization Tests:\n");
+    total++; if (test_pool_init()) passed++;
+    total++; if (test_pool_clamps_to_max_blocks()) passed++;
+    printf("\n");
+    
+    printf("Allocation Tests:\n");
+    total++; if (test_alloc_until_exhausted()) passed++;
+    total++; if (test_free_reuses_block()) passed++;
+    printf("\n");
+    
+    printf("Error Detection Tests:\n");
+    total++; if (test_double_free_detected()) passed++;
+    total++; if (test_foreign_pointer_rejected()) passed++;
+    printf("\n");
+    
+    printf("Statistics Tests:\n");
+    total++; if (test_high_water_mark()) passed++;
+    printf("\n");
+    
+    printf("Test Results: %d/%d passed (%.1f%%)\n",
+           passed, total, (float)passed / total * 100.0f);
+    
+    if (passed == total) {
+        printf("All tests PASSED! ✓\n");
+        return 0;
+    } else {
+        printf("Some tests FAILED! ✗\n");
+        return 1;
+    }
+}
@@ -0,0 +1,317 @@
+// CKOS Power Governor Tests
+// Tests for sleep suppression accounting and the idle-timeout power states,
+// on their own and through the hardware layer on the simulator BSP
+
+#include <stdio.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include "BSP/bsp_api.h"
+#include "Hardware/hardware_api.h"
+#include "Utils/power_governor.h"
+#include "sim_fixture.h"
+
+#define HOLD_THREADS        4
+#define HOLDS_PER_THREAD    100000
+
+#define T_SLEEP             CONFIG_IDLE_TO_SLEEP_TIMEOUT_MS
+#define T_DEEP              (CONFIG_IDLE_TO_SLEEP_TIMEOUT_MS + CONFIG_SLEEP_TO_DEEP_SLEEP_MS)
+
+static void* g_bsp_state;
+static void* g_hardware_state;
+
+static void print_test_result(const char* test_name, bool passed) {
+    printf("[%s] %s\n", passed ? "PASS" : "FAIL", test_name);
+}
+
+static bool fresh_device(void) {
+    sim_fixture_blank_hardware(g_bsp_state, g_hardware_state);
+    return hardware_init() == 0;
+}
+
+// =============================================================================
+// INSOMNIA TESTS
+// =============================================================================
+
+bool test_holds_nest_per_reason(void) {
+    PowerGovernor_t governor;
+    power_governor_init(&governor, 0);
+
+    // Reasons match by content, not by pointer
+    char radio[] = "radio";
+    power_governor_hold(&governor, "radio", 0);
+    power_governor_hold(&governor, radio, 100);
+    power_governor_hold(&governor, "unlock", 200);
+    bool result = power_governor_insomnia(&governor) == 3;
+
+    power_governor_release(&governor, "radio", 300);
+    power_governor_release(&governor, "unlock", 700);
+    result = result && power_governor_insomnia(&governor) == 1;
+    power_governor_release(&governor, radio, 1000);
+    result = result && power_governor_insomnia(&governor) == 0;
+
+    // Releasing what was never held cannot drive the count negative
+    power_governor_release(&governor, "radio", 1100);
+    power_governor_release(&governor, "display", 1100);
+    result = result && power_governor_insomnia(&governor) == 0;
+
+    PowerReasonCost_t costs[POWER_GOVERNOR_MAX_REASONS];
+    result = result && power_governor_costliest(&governor, 2000, costs, POWER_GOVERNOR_MAX_REASONS) == 2;
+    result = result && strcmp(costs[0].name, "radio") == 0 && costs[0].held_ms == 1000 &&
+             costs[0].count == 2 && !costs[0].held;
+    result = result && strcmp(costs[1].name, "unlock") == 0 && costs[1].held_ms == 500 &&
+             costs[1].count == 1;
+    print_test_result("Holds nest per reason and never underflow", result);
+    return result;
+}
+
+bool test_costliest_report(void) {
+    PowerGovernor_t governor;
+    power_governor_init(&governor, 0);
+
+    static const char* const names[] = { "a", "b", "c", "d" };
+    static const uint32_t held_ms[] = { 300, 1200, 50, 700 };
+    for (uint32_t i = 0; i < 4; i++) {
+        power_governor_hold(&governor, names[i], 0);
+        power_governor_release(&governor, names[i], held_ms[i]);
+    }
+    // An outstanding hold counts up to now
+    power_governor_hold(&governor, "a", 1000);
+
+    PowerReasonCost_t costs[3];
+    uint32_t count = power_governor_costliest(&governor, 2000, costs, 3);
+    bool result = count == 3;
+    result = result && strcmp(costs[0].name, "a") == 0 && costs[0].held_ms == 1300 && costs[0].held;
+    result = result && strcmp(costs[1].name, "b") == 0 && costs[1].held_ms == 1200;
+    result = result && strcmp(costs[2].name, "d") == 0 && costs[2].held_ms == 700;
+    power_governor_release(&governor, "a", 2000);
+
+    // Once every slot is claimed, new reasons still count as insomnia
+    char extra[POWER_GOVERNOR_MAX_REASONS][8];
+    for (uint32_t i = 0; i < POWER_GOVERNOR_MAX_REASONS; i++) {
+        snprintf(extra[i], sizeof(extra[i]), "x%lu", (unsigned long)i);
+        power_governor_hold(&governor, extra[i], 3000);
+    }
+    result = result && power_governor_insomnia(&governor) == POWER_GOVERNOR_MAX_REASONS &&
+             governor.unregistered == 4;
+    for (uint32_t i = 0; i < POWER_GOVERNOR_MAX_REASONS; i++) {
+        power_governor_release(&governor, extra[i], 4000);
+    }
+    result = result && power_governor_insomnia(&governor) == 0 && governor.unregistered == 0;
+    print_test_result("Report ranks reasons by time held", result);
+    return result;
+}
+
+typedef struct {
+    PowerGovernor_t* governor;
+    const char* reason;
+} hold_context_t;
+
+static void* hold_thread(void* arg) {
+    hold_context_t* context = (hold_context_t*)arg;
+    for (uint32_t i = 0; i < HOLDS_PER_THREAD; i++) {
+        power_governor_hold(context->governor, context->reason, i);
+        power_governor_release(context->governor, context->reason, i);
+    }
+    return NULL;
+}
+
+bool test_concurrent_holds(void) {
+    static PowerGovernor_t governor;
+    power_governor_init(&governor, 0);
+
+    // Two threads per reason, all racing to claim the reason slots
+    static const char* const reasons[HOLD_THREADS] = { "left", "right", "left", "right" };
+    hold_context_t contexts[HOLD_THREADS];
+    pthread_t threads[HOLD_THREADS];
+    bool result = true;
+    for (int i = 0; i < HOLD_THREADS; i++) {
+        contexts[i].governor = &governor;
+        contexts[i].reason = reasons[i];
+        result = result && pthread_create(&threads[i], NULL, hold_thread, &contexts[i]) == 0;
+    }
+    for (int i = 0; i < HOLD_THREADS; i++) {
+        pthread_join(threads[i], NULL);
+    }
+
+    PowerReasonCost_t costs[POWER_GOVERNOR_MAX_REASONS];
+    uint32_t count = power_governor_costliest(&governor, 0, costs, POWER_GOVERNOR_MAX_REASONS);
+    result = result && count == 2 && power_governor_insomnia(&governor) == 0;
+    result = result && governor.reasons[0].holds == 0 && governor.reasons[1].holds == 0;
+    result = result && costs[0].count == 2 * HOLDS_PER_THREAD && costs[1].count == 2 * HOLDS_PER_THREAD;
+    print_test_result("Concurrent holds keep exact counts", result);
+    return result;
+}
+
+// =============================================================================
+// IDLE TIMEOUT TESTS
+// =============================================================================
+
+bool test_idle_timeouts(void) {
+    PowerGovernor_t governor;
+    power_governor_init(&governor, 1000);
+
+    bool result = power_governor_next_deadline_ms(&governor, 1000) == T_SLEEP;
+    result = result && power_governor_update(&governor, 1000 + T_SLEEP - 1) == POWER_GOVERNOR_ACTIVE;
+    result = result && power_governor_update(&governor, 1000 + T_SLEEP) == POWER_GOVERNOR_SLEEP;
+    result = result && power_governor_next_deadline_ms(&governor, 1000 + T_SLEEP) ==
+                       CONFIG_SLEEP_TO_DEEP_SLEEP_MS;
+    result = result && power_governor_update(&governor, 1000 + T_DEEP) == POWER_GOVERNOR_DEEP_SLEEP;
+    result = result && power_governor_next_deadline_ms(&governor, 1000 + T_DEEP) == POWER_GOVERNOR_NO_DEADLINE;
+
+    // A wake source goes straight back to ACTIVE and restarts the timers
+    uint32_t wake = 1000 + T_DEEP + 5000;
+    power_governor_activity(&governor, wake);
+    result = result && power_governor_next_deadline_ms(&governor, wake) == 0;
+    result = result && power_governor_update(&governor, wake) == POWER_GOVERNOR_ACTIVE;
+    result = result && power_governor_next_deadline_ms(&governor, wake) == T_SLEEP;
+
+    result = result && governor.entries[POWER_GOVERNOR_ACTIVE] == 2 &&
+             governor.entries[POWER_GOVERNOR_SLEEP] == 1 &&
+             governor.entries[POWER_GOVERNOR_DEEP_SLEEP] == 1;
+    result = result && power_governor_residency_ms(&governor, POWER_GOVERNOR_SLEEP, wake) ==
+                       CONFIG_SLEEP_TO_DEEP_SLEEP_MS;
+    result = result && power_governor_residency_ms(&governor, POWER_GOVERNOR_DEEP_SLEEP, wake) == 5000;
+    print_test_result("Idle timeouts step down and activity wakes", result);
+    return result;
+}
+
+bool test_insomnia_blocks_deep_sleep(void) {
+    PowerGovernor_t governor;
+    power_governor_init(&governor, 0);
+
+    // A hold does not stop the display-off SLEEP, only the step to DEEP_SLEEP
+    power_governor_hold(&governor, "unlock", 0);
+    bool result = power_governor_update(&governor, T_SLEEP) == POWER_GOVERNOR_SLEEP;
+    result = result && power_governor_next_deadline_ms(&governor, T_SLEEP) == POWER_GOVERNOR_NO_DEADLINE;
+    result = result && power_governor_update(&governor, T_DEEP + 1000) == POWER_GOVERNOR_SLEEP;
+
+    power_governor_release(&governor, "unlock", T_DEEP + 2000);
+    result = result && power_governor_next_deadline_ms(&governor, T_DEEP + 2000) == 0;
+    result = result && power_governor_update(&governor, T_DEEP + 2000) == POWER_GOVERNOR_DEEP_SLEEP;
+
+    // A hold taken in deep sleep brings it back up to SLEEP
+    power_governor_hold(&governor, "unlock", T_DEEP + 3000);
+    result = result && power_governor_update(&governor, T_DEEP + 3000) == POWER_GOVERNOR_SLEEP;
+    power_governor_release(&governor, "unlock", T_DEEP + 4000);
+    print_test_result("Insomnia holds off deep sleep only", result);
+    return result;
+}
+
+bool test_long_uptime(void) {
+    PowerGovernor_t governor;
+    power_governor_init(&governor, 0);
+    power_governor_update(&governor, T_DEEP);
+
+    // Two months idle: a 32-bit tick would have wrapped and looked active
+    uint64_t later = (1ULL << 32) + T_SLEEP / 2;
+    bool result = power_governor_update(&governor, later) == POWER_GOVERNOR_DEEP_SLEEP;
+    result = result && power_governor_next_deadline_ms(&governor, later) == POWER_GOVERNOR_NO_DEADLINE;
+
+    // Activity and holds on the far side of the wrap keep full-width times
+    uint64_t wake = (1ULL << 32) + 5000;
+    power_governor_hold(&governor, "unlock", (1ULL << 32) - 1000);
+    power_governor_activity(&governor, wake);
+    result = result && power_governor_update(&governor, wake + 1000) == POWER_GOVERNOR_ACTIVE;
+    result = result && power_governor_next_deadline_ms(&governor, wake + 1000) == T_SLEEP - 1000;
+    power_governor_release(&governor, "unlock", wake);
+    result = result && governor.reasons[0].held_ms == 6000;
+    result = result && power_governor_residency_ms(&governor, POWER_GOVERNOR_DEEP_SLEEP, wake) ==
+                       wake + 1000 - T_DEEP;
+    print_test_result("Long uptimes neither wrap nor lose residency", result);
+    return result;
+}
+
+// =============================================================================
+// HARDWARE LAYER TESTS
+// =============================================================================
+
+bool test_hardware_governor(void) {
+    bool result = fresh_device();
+    result = result && hardware_power_get_mode() == HARDWARE_POWER_ACTIVE;
+    hardware_sensor_poll_events();      // Baseline sample
+
+    // A dirty config record rides along until sleep entry flushes it
+    uint32_t value = 42;
+    hardware_config_write(HARDWARE_CONFIG_KEY_LOCK_TIME_DELTA, &value, sizeof(value));
+    hardware_config_cache_stats_t cache;
+    hardware_config_get_cache_stats(&cache);
+    result = result && cache.dirty_records == 1;
+
+    result = result && hardware_power_governor_next_ms() == T_SLEEP;
+    bsp_sim_clock_advance(T_SLEEP - 1);
+    result = result && hardware_power_governor_update() == 0;
+    bsp_sim_clock_advance(1);
+    result = result && hardware_power_governor_update() ==
+                       (HST_EVT_SRC_POWER | HST_EVT_POWER_MODE_CHANGED);
+    result = result && hardware_power_get_mode() == HARDWARE_POWER_SLEEP;
+    hardware_config_get_cache_stats(&cache);
+    result = result && cache.dirty_records == 0;
+
+    bsp_sim_clock_advance(hardware_power_governor_next_ms());
+    result = result && hardware_power_governor_update() != 0;
+    result = result && hardware_power_get_mode() == HARDWARE_POWER_DEEP_SLEEP;
+    result = result && hardware_power_governor_next_ms() == BSP_WAIT_FOREVER;
+
+    // A door edge is a wake source
+    bsp_debug_set_sensor_value("door", 0);
+    result = result && hardware_sensor_poll_events() != 0;
+    result = result && hardware_power_governor_update() != 0;
+    result = result && hardware_power_get_mode() == HARDWARE_POWER_ACTIVE;
+
+    // Storage flushes show up in the report
+    PowerReasonCost_t costs[POWER_GOVERNOR_MAX_REASONS];
+    uint32_t count = hardware_power_get_costliest(costs, POWER_GOVERNOR_MAX_REASONS);
+    result = result && count >= 1 && strcmp(costs[0].name, "storage flush") == 0;
+    result = result && hardware_power_get_insomnia() == 0 && bsp_power_get_insomnia_level() == 0;
+    hardware_power_print_report();
+    print_test_result("Hardware layer flushes on sleep and wakes on events", result);
+    return result;
+}
+
+int main(void) {
+    printf("CKOS Power Governor Tests\n");
+    printf("=========================\n\n");
+
+    int passed = 0;
+    int total = 0;
+
+    g_bsp_state = calloc(1, bsp_sim_instance_size());
+    g_hardware_state = calloc(1, hardware_instance_size());
+    if (!g_bsp_state || !g_hardware_state) return 1;
+
+    printf("Insomnia Tests:\n");
+    total++; if (test_holds_nest_per_reason()) passed++;
+    total++; if (test_costliest_report()) passed++;
+    total++; if (test_concurrent_holds()) passed++;
+    printf("\n");
+
+    printf("Idle Timeout Tests:\n");
+    total++; if (test_idle_timeouts()) passed++;
+    total++; if (test_insomnia_blocks_deep_sleep()) passed++;
+    total++; if (test_long_uptime()) passed++;
+    printf("\n");
+
+    printf("Hardware Layer Tests:\n");
+    total++; if (test_hardware_governor()) passed++;
+    printf("\n");
+
+    bsp_sim_instance_release(g_bsp_state);
+    bsp_sim_instance_bind(NULL);
+    hardware_instance_bind(NULL);
+    free(g_bsp_state);
+    free(g_hardware_state);
+
+    printf("Test Results: %d/%d passed (%.1f%%)\n",
+           passed, total, (float)passed / total * 100.0f);
+
+    if (passed == total) {
+        printf("All tests PASSED! ✓\n");
+        return 0;
+    } else {
+        printf("Some tests FAILED! ✗\n");
+        return 1;
+    }
+}
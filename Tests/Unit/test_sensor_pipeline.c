@@ -0,0 +1,281 @@
+// CKOS Sensor Pipeline Tests
+// Tests for the fixed-point filtering and threshold wake-ups behind
+// bsp_sensors_start(), on their own and through the simulator ADC model
+
+#include <stdio.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include "BSP/bsp_api.h"
+#include "Utils/sensor_pipeline.h"
+#include "sim_fixture.h"
+
+#define TEST_NOTIFY_BITS    (1u << 30)
+#define TEST_EDGE_BITS      (1u << 29)
+#define BURST_MS            100     // Simulator ADC burst length
+
+static void* g_bsp_state;
+
+static void print_test_result(const char* test_name, bool passed) {
+    printf("[%s] %s\n", passed ? "PASS" : "FAIL", test_name);
+}
+
+static bool fresh_device(void) {
+    sim_fixture_blank_bsp(g_bsp_state);
+    return bsp_get_tick_ms() == 0;
+}
+
+// Lets the simulator ADC finish the running burst and start the next, one
+// block per CONFIG_SENSOR_BURST_PERIOD_MS
+static void run_blocks(uint32_t blocks) {
+    for (uint32_t i = 0; i < blocks; i++) {
+        bsp_sim_clock_advance(BURST_MS);
+        bsp_sim_timer_process();
+        bsp_sim_clock_advance(CONFIG_SENSOR_BURST_PERIOD_MS - BURST_MS);
+        bsp_sim_timer_process();
+    }
+}
+
+static SensorBlock_t block_at(int32_t battery_mv, int32_t temperature_cdeg) {
+    SensorBlock_t block = { battery_mv, temperature_cdeg };
+    return block;
+}
+
+// =============================================================================
+// PIPELINE TESTS
+// =============================================================================
+
+bool test_battery_curve_round_trip(void) {
+    bool result = true;
+    for (uint32_t percentage = 0; percentage <= 100; percentage++) {
+        int32_t mv = sensor_pipeline_battery_mv((uint8_t)percentage);
+        result = result && sensor_pipeline_battery_percentage(mv) == percentage;
+    }
+    result = result && sensor_pipeline_battery_percentage(3000) == 0;
+    result = result && sensor_pipeline_battery_percentage(4350) == 100;
+    result = result && sensor_pipeline_battery_mv(0) == 3300 && sensor_pipeline_battery_mv(100) == 4200;
+    print_test_result("Battery curve is exact both ways at whole percents", result);
+    return result;
+}
+
+bool test_filter_converges_and_smooths(void) {
+    SensorPipeline_t pipeline;
+    sensor_pipeline_init(&pipeline, 60000);
+
+    // Seeded by the first block, then a step settles on the new value
+    SensorBlock_t block = block_at(3870, 2500);
+    bool result = sensor_pipeline_process(&pipeline, &block, 0) == SENSOR_PIPELINE_SNAPSHOT_DUE;
+    result = result && pipeline.output.battery_mv == 3870 && pipeline.output.temperature_cdeg == 2500;
+
+    block = block_at(3920, 3000);
+    sensor_pipeline_process(&pipeline, &block, 200);
+    result = result && pipeline.output.battery_mv > 3870 && pipeline.output.battery_mv < 3920;
+    for (uint32_t i = 2; i < 100; i++) {
+        sensor_pipeline_process(&pipeline, &block, i * 200);
+    }
+    result = result && pipeline.output.battery_mv == 3920 && pipeline.output.temperature_cdeg == 3000;
+    result = result && pipeline.output.battery_percentage == 70;
+
+    // Alternating noise of +-40 mV comes out well inside +-40 mV
+    int32_t worst = 0;
+    for (uint32_t i = 100; i < 200; i++) {
+        block = block_at((i & 1) ? 3960 : 3880, 3000);
+        sensor_pipeline_process(&pipeline, &block, i * 200);
+        int32_t error = abs((int32_t)pipeline.output.battery_mv - 3920);
+        worst = (error > worst) ? error : worst;
+    }
+    printf("  Worst error under +-40 mV alternating noise: %ld mV\n", (long)worst);
+    result = result && worst <= 10;
+    print_test_result("Filter seeds, converges and smooths noise", result);
+    return result;
+}
+
+bool test_alarms_have_hysteresis(void) {
+    uint8_t alarms = sensor_pipeline_alarms(0, CONFIG_BATTERY_LOW_THRESHOLD + 1, 2500);
+    bool result = alarms == 0;
+    alarms = sensor_pipeline_alarms(alarms, CONFIG_BATTERY_LOW_THRESHOLD, 2500);
+    result = result && alarms == SENSOR_ALARM_BATTERY_LOW;
+
+    // Back above the threshold but inside the hysteresis: still raised
+    alarms = sensor_pipeline_alarms(alarms, CONFIG_BATTERY_LOW_THRESHOLD + 1, 2500);
+    result = result && alarms == SENSOR_ALARM_BATTERY_LOW;
+    alarms = sensor_pipeline_alarms(alarms,
+                                    CONFIG_BATTERY_LOW_THRESHOLD + CONFIG_BATTERY_HYSTERESIS_PERCENT + 1,
+                                    2500);
+    result = result && alarms == 0;
+
+    int32_t over = CONFIG_TEMPERATURE_OVER_THRESHOLD_C * 100;
+    alarms = sensor_pipeline_alarms(0, 80, over);
+    result = result && alarms == SENSOR_ALARM_OVER_TEMPERATURE;
+    alarms = sensor_pipeline_alarms(alarms, 80, over - 100);
+    result = result && alarms == SENSOR_ALARM_OVER_TEMPERATURE;
+    alarms = sensor_pipeline_alarms(alarms, 80, over - CONFIG_TEMPERATURE_HYSTERESIS_C * 100 - 1);
+    result = result && alarms == 0;
+
+    result = result && sensor_pipeline_alarms(0, CONFIG_BATTERY_CRITICAL_THRESHOLD, 2500) ==
+                       (SENSOR_ALARM_BATTERY_LOW | SENSOR_ALARM_BATTERY_CRITICAL);
+    print_test_result("Alarms raise at the threshold and clear past the hysteresis", result);
+    return result;
+}
+
+bool test_wakes_only_on_threshold_or_snapshot(void) {
+    SensorPipeline_t pipeline;
+    sensor_pipeline_init(&pipeline, 5000);
+
+    SensorBlock_t block = block_at(3870, 2500);
+    bool result = sensor_pipeline_process(&pipeline, &block, 0) == SENSOR_PIPELINE_SNAPSHOT_DUE;
+
+    // Steady values: quiet until the snapshot period has passed
+    uint32_t now = 0;
+    for (now = 200; now < 5000; now += 200) {
+        result = result && sensor_pipeline_process(&pipeline, &block, now) == 0;
+    }
+    result = result && sensor_pipeline_process(&pipeline, &block, now) == SENSOR_PIPELINE_SNAPSHOT_DUE;
+
+    // Overheating wakes as soon as the filtered value crosses, exactly once
+    block = block_at(3870, CONFIG_TEMPERATURE_OVER_THRESHOLD_C * 100 + 500);
+    uint32_t raised_at = 0;
+    for (uint32_t i = 1; i <= 20; i++) {
+        uint32_t wake = sensor_pipeline_process(&pipeline, &block, now + i * 200);
+        if (wake & SENSOR_ALARM_OVER_TEMPERATURE) {
+            result = result && raised_at == 0;
+            raised_at = i;
+        } else {
+            result = result && wake == 0;
+        }
+    }
+    result = result && raised_at > 0 && (pipeline.output.alarms & SENSOR_ALARM_OVER_TEMPERATURE);
+    result = result && pipeline.stats.blocks == 46 && pipeline.stats.wakeups == 3;
+    result = result && pipeline.stats.threshold_wakeups == 1 && pipeline.stats.alarms_raised == 1;
+    print_test_result("Wakes only on a threshold crossing or a due snapshot", result);
+    return result;
+}
+
+// =============================================================================
+// SIMULATOR ADC TESTS
+// =============================================================================
+
+bool test_simulator_sampling(void) {
+    bool result = fresh_device();
+    bsp_debug_set_sensor_value("battery", 50);
+    bsp_debug_set_sensor_value("temperature", 25);
+
+    bsp_task_handle_t self = bsp_task_get_current();
+    uint32_t insomnia = bsp_power_get_insomnia_level();
+    result = result && bsp_sensors_start(self, TEST_NOTIFY_BITS, 10000) == 0;
+    result = result && bsp_power_get_insomnia_level() == insomnia + 1;
+
+    // Sleep is only held off while a burst runs
+    bsp_sim_clock_advance(BURST_MS);
+    bsp_sim_timer_process();
+    result = result && bsp_power_get_insomnia_level() == insomnia;
+    bsp_sim_clock_advance(CONFIG_SENSOR_BURST_PERIOD_MS - BURST_MS);
+    bsp_sim_timer_process();
+    result = result && bsp_power_get_insomnia_level() == insomnia + 1;
+
+    // The first block wakes the task; a minute of steady readings only
+    // wakes it for the snapshots
+    result = result && bsp_task_notify_wait_bits(TEST_NOTIFY_BITS, 0) == TEST_NOTIFY_BITS;
+    uint32_t wakeups = 0;
+    for (uint32_t i = 0; i < 60; i++) {
+        run_blocks(1);
+        if (bsp_task_notify_wait_bits(TEST_NOTIFY_BITS, 0)) wakeups++;
+    }
+    bsp_sensor_readings_t readings;
+    result = result && bsp_sensors_read(&readings) == 0;
+    result = result && readings.battery_percentage == 50;
+    result = result && readings.temperature_celsius > 24.9f && readings.temperature_celsius < 25.1f;
+
+    bsp_sensor_stats_t stats;
+    bsp_sensors_get_stats(&stats);
+    printf("  %lu blocks, %lu wakeups\n", (unsigned long)stats.blocks, (unsigned long)stats.wakeups);
+    result = result && stats.blocks == 61 && wakeups == 6 && stats.wakeups == 7;
+    result = result && stats.threshold_wakeups == 0;
+
+    // Draining below the low threshold wakes without waiting for a snapshot
+    bsp_debug_set_sensor_value("battery", CONFIG_BATTERY_LOW_THRESHOLD - 5);
+    uint32_t blocks = 0;
+    while (blocks < 40 && !bsp_task_notify_wait_bits(TEST_NOTIFY_BITS, 0)) {
+        run_blocks(1);
+        blocks++;
+    }
+    bsp_sensors_get_stats(&stats);
+    result = result && blocks < 40 && stats.threshold_wakeups == 1;
+
+    bsp_sensors_stop();
+    result = result && bsp_power_get_insomnia_level() == insomnia;
+    result = result && bsp_sensors_read(&readings) == 0;
+    result = result && readings.battery_percentage == CONFIG_BATTERY_LOW_THRESHOLD - 5;
+    print_test_result("Simulator ADC filters in the background and wakes on thresholds", result);
+    return result;
+}
+
+bool test_door_and_latch_edges(void) {
+    bool result = fresh_device();
+    bsp_task_handle_t self = bsp_task_get_current();
+    bsp_sensors_set_edge_notify(self, TEST_EDGE_BITS);
+
+    // Edges notify without background sampling; a level that does not
+    // change does not
+    bsp_debug_set_sensor_value("door", 0);
+    result = result && bsp_task_notify_wait_bits(TEST_EDGE_BITS, 0) == TEST_EDGE_BITS;
+    bsp_debug_set_sensor_value("door", 0);
+    result = result && bsp_task_notify_wait_bits(TEST_EDGE_BITS, 0) == 0;
+    bsp_debug_set_sensor_value("door", 1);
+    result = result && bsp_task_notify_wait_bits(TEST_EDGE_BITS, 0) == TEST_EDGE_BITS;
+
+    // The memory wire letting go of the latch, then the ejector opening the
+    // door, are edges too
+    bsp_wire_set_duty(BSP_WIRE_DUTY_MAX);
+    bsp_sim_clock_advance(5000);
+    bsp_wire_set_duty(0);
+    result = result && bsp_task_notify_wait_bits(TEST_EDGE_BITS, 0) == TEST_EDGE_BITS;
+    bsp_sensor_readings_t readings;
+    result = result && bsp_sensors_read(&readings) == 0 && !readings.latch_engaged &&
+             !readings.door_closed;
+
+    bsp_sensors_set_edge_notify(NULL, 0);
+    bsp_debug_set_sensor_value("door", 1);
+    result = result && bsp_task_notify_wait_bits(TEST_EDGE_BITS, 0) == 0;
+    print_test_result("Door and latch changes notify as edges", result);
+    return result;
+}
+
+int main(void) {
+    printf("CKOS Sensor Pipeline Tests\n");
+    printf("==========================\n\n");
+
+    int passed = 0;
+    int total = 0;
+
+    g_bsp_state = calloc(1, bsp_sim_instance_size());
+    if (!g_bsp_state) return 1;
+
+    printf("Pipeline Tests:\n");
+    total++; if (test_battery_curve_round_trip()) passed++;
+    total++; if (test_filter_converges_and_smooths()) passed++;
+    total++; if (test_alarms_have_hysteresis()) passed++;
+    total++; if (test_wakes_only_on_threshold_or_snapshot()) passed++;
+    printf("\n");
+
+    printf("Simulator ADC Tests:\n");
+    total++; if (test_simulator_sampling()) passed++;
+    total++; if (test_door_and_latch_edges()) passed++;
+    printf("\n");
+
+    bsp_sim_instance_release(g_bsp_state);
+    bsp_sim_instance_bind(NULL);
+    free(g_bsp_state);
+
+    printf("Test Results: %d/%d passed (%.1f%%)\n",
+           passed, total, (float)passed / total * 100.0f);
+
+    if (passed == total) {
+        printf("All tests PASSED! ✓\n");
+        return 0;
+    } else {
+        printf("Some tests FAILED! ✗\n");
+        return 1;
+    }
+}
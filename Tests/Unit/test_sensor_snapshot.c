@@ -0,0 +1,182 @@
+// CKOS Sensor Snapshot Tests
+// Tests for the sensor snapshot the HardwareService task publishes for the
+// other tasks (hardware_get_sensor_data() and the single-value getters)
+
+#include <stdio.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include "BSP/bsp_api.h"
+#include "Hardware/hardware_api.h"
+#include "sim_fixture.h"
+
+#define READER_THREADS      3
+#define WRITER_SAMPLES      100000
+#define SAMPLE_VALUE(i)     (30u + (i) % 30u)
+
+static void* g_bsp_state;
+static void* g_hardware_state;
+
+typedef struct {
+    void* hardware_state;           // Readers share only the published snapshot
+    volatile bool* done;
+    uint32_t reads;
+    uint32_t torn;
+    uint32_t backwards;
+} reader_context_t;
+
+static void print_test_result(const char* test_name, bool passed) {
+    printf("[%s] %s\n", passed ? "PASS" : "FAIL", test_name);
+}
+
+// Blank device: BSP and hardware service state only
+static bool fresh_device(void) {
+    sim_fixture_blank_hardware(g_bsp_state, g_hardware_state);
+    return hardware_init() == 0;
+}
+
+// The simulator logs every sensor change; keep the writer loop quiet
+static int silence_stdout(void) {
+    fflush(stdout);
+    int saved = dup(STDOUT_FILENO);
+    int null_fd = open("/dev/null", O_WRONLY);
+    if (null_fd >= 0) {
+        dup2(null_fd, STDOUT_FILENO);
+        close(null_fd);
+    }
+    return saved;
+}
+
+static void restore_stdout(int saved) {
+    fflush(stdout);
+    if (saved >= 0) {
+        dup2(saved, STDOUT_FILENO);
+        close(saved);
+    }
+}
+
+// =============================================================================
+// SNAPSHOT TESTS
+// =============================================================================
+
+bool test_getters_read_published_sample(void) {
+    bool result = fresh_device();
+    hardware_sensor_data_t data;
+    result = result && hardware_get_sensor_data(&data) == 0 && data.door_closed;
+
+    // A sensor change is invisible until the HardwareService task samples
+    bsp_debug_set_sensor_value("door", 0);
+    bsp_debug_set_sensor_value("battery", 42);
+    result = result && hardware_is_door_closed() && hardware_get_battery_percentage() != 42.0f;
+
+    bsp_sim_clock_advance(250);
+    hardware_sensor_poll_events();
+    result = result && !hardware_is_door_closed() && hardware_get_battery_percentage() == 42.0f;
+    result = result && hardware_get_sensor_data(&data) == 0 && data.timestamp_ms == bsp_get_tick_ms();
+    result = result && !hardware_is_charging();
+    print_test_result("Getters serve the published sample, never the sensors", result);
+    return result;
+}
+
+// Sample i is taken at tick i and has battery percentage and temperature
+// SAMPLE_VALUE(i), kept above the low battery and below the over-temperature
+// thresholds so that no event flushes to flash and moves the clock; a reader must never see a mix of two samples
+static void* reader_thread(void* arg) {
+    reader_context_t* context = (reader_context_t*)arg;
+    hardware_instance_bind(context->hardware_state);
+
+    uint32_t last_timestamp = 0;
+    while (!*context->done) {
+        hardware_sensor_data_t data;
+        hardware_get_sensor_data(&data);
+        context->reads++;
+        if (data.battery_percentage != SAMPLE_VALUE(data.timestamp_ms) ||
+            (float)data.battery_percentage != data.temperature_celsius) {
+            context->torn++;
+        }
+        if (data.timestamp_ms < last_timestamp) {
+            context->backwards++;
+        }
+        last_timestamp = data.timestamp_ms;
+    }
+    return NULL;
+}
+
+bool test_concurrent_readers_consistent(void) {
+    bool result = fresh_device() && bsp_get_tick_ms() == 0;
+    bsp_debug_set_sensor_value("battery", SAMPLE_VALUE(0));
+    bsp_debug_set_sensor_value("temperature", SAMPLE_VALUE(0));
+    hardware_sensor_poll_events();
+
+    volatile bool done = false;
+    reader_context_t contexts[READER_THREADS];
+    pthread_t threads[READER_THREADS];
+    for (int i = 0; i < READER_THREADS; i++) {
+        memset(&contexts[i], 0, sizeof(contexts[i]));
+        contexts[i].hardware_state = g_hardware_state;
+        contexts[i].done = &done;
+        result = result && pthread_create(&threads[i], NULL, reader_thread, &contexts[i]) == 0;
+    }
+
+    int saved_stdout = silence_stdout();
+    for (uint32_t i = 1; result && i <= WRITER_SAMPLES; i++) {
+        float value = (float)SAMPLE_VALUE(i);
+        bsp_debug_set_sensor_value("battery", value);
+        bsp_debug_set_sensor_value("temperature", value);
+        bsp_sim_clock_advance(1);
+        hardware_sensor_poll_events();
+    }
+    done = true;
+    restore_stdout(saved_stdout);
+
+    uint32_t reads = 0, torn = 0, backwards = 0;
+    for (int i = 0; i < READER_THREADS; i++) {
+        pthread_join(threads[i], NULL);
+        reads += contexts[i].reads;
+        torn += contexts[i].torn;
+        backwards += contexts[i].backwards;
+    }
+    printf("  %u samples published, %lu reads on %d threads\n",
+           WRITER_SAMPLES, (unsigned long)reads, READER_THREADS);
+    result = result && reads > 0 && torn == 0 && backwards == 0;
+    print_test_result("Concurrent readers never see a torn sample", result);
+    return result;
+}
+
+int main(void) {
+    printf("CKOS Sensor Snapshot Tests\n");
+    printf("==========================\n\n");
+
+    int passed = 0;
+    int total = 0;
+
+    g_bsp_state = calloc(1, bsp_sim_instance_size());
+    g_hardware_state = calloc(1, hardware_instance_size());
+    if (!g_bsp_state || !g_hardware_state) return 1;
+
+    printf("Snapshot Tests:\n");
+    total++; if (test_getters_read_published_sample()) passed++;
+    total++; if (test_concurrent_readers_consistent()) passed++;
+    printf("\n");
+
+    bsp_sim_instance_release(g_bsp_state);
+    bsp_sim_instance_bind(NULL);
+    hardware_instance_bind(NULL);
+    free(g_bsp_state);
+    free(g_hardware_state);
+
+    printf("Test Results: %d/%d passed (%.1f%%)\n",
+           passed, total, (float)passed / total * 100.0f);
+
+    if (passed == total) {
+        printf("All tests PASSED! ✓\n");
+        return 0;
+    } else {
+        printf("Some tests FAILED! ✗\n");
+        return 1;
+    }
+}
@@ -0,0 +1,127 @@
+// CKOS Multi-Instance Simulator Tests
+// Runs a fleet of virtual devices on a thread pool and checks that every
+// device keeps its own clock, storage, framebuffer and application state
+
+#include <stdio.h>
+#include <string.h>
+#include <stdbool.h>
+#include "Simulator/sim_fleet.h"
+#include "Hardware/hardware_api.h"
+#include "Display/display_api.h"
+
+#define FLEET_SIZE          32
+#define FLEET_THREADS       4
+#define FLEET_DURATION_MS   5000
+#define FLEET_SLICE_MS      500
+
+#define FRAMEBUFFER_BYTES   (BSP_DISPLAY_WIDTH * BSP_DISPLAY_HEIGHT / 8)
+
+typedef struct {
+    uint32_t storage_mismatches;
+    uint32_t clock_mismatches;
+} fleet_results_t;
+
+static void print_test_result(const char* test_name, bool passed) {
+    printf("[%s] %s\n", passed ? "PASS" : "FAIL", test_name);
+}
+
+// Even devices get a button press (Welcome -> Timezone Setup), odd ones idle.
+// Every device stamps its id into storage and checks it after each slice.
+static void fleet_hook(sim_device_t* device, uint32_t elapsed_ms, void* context) {
+    fleet_results_t* results = (fleet_results_t*)context;
+    uint32_t id = sim_device_get_id(device);
+    
+    if (elapsed_ms == 0) {
+        hardware_config_write(0, &id, sizeof(id));
+        if ((id % 2) == 0) {
+            sim_device_press_button(device, BSP_BUTTON_A);
+        }
+        return;
+    }
+    
+    uint32_t stored = 0xFFFFFFFFu;
+    hardware_config_read(0, &stored, sizeof(stored));
+    if (stored != id) {
+        __atomic_add_fetch(&results->storage_mismatches, 1, __ATOMIC_RELAXED);
+    }
+    // Fast-forward clocks start at zero and only move with the device
+    if (bsp_get_tick_ms() != elapsed_ms) {
+        __atomic_add_fetch(&results->clock_mismatches, 1, __ATOMIC_RELAXED);
+    }
+}
+
+int main(void) {
+    printf("CKOS Multi-Instance Simulator Tests\n");
+    printf("===================================\n\n");
+    
+    int passed = 0;
+    int total = 0;
+    
+    sim_device_t* devices[FLEET_SIZE];
+    bool created = true;
+    for (uint32_t i = 0; i < FLEET_SIZE; i++) {
+        devices[i] = sim_device_create(i);
+        created = created && devices[i] != NULL;
+    }
+    
+    fleet_results_t results = {0};
+    sim_fleet_config_t config = {
+        .num_threads = FLEET_THREADS,
+        .duration_ms = FLEET_DURATION_MS,
+        .slice_ms = FLEET_SLICE_MS,
+        .hook = fleet_hook,
+        .hook_context = &results
+    };
+    bool ran = created && sim_fleet_run(devices, FLEET_SIZE, &config) == 0;
+    
+    printf("\nFleet Tests:\n");
+    total++; if (ran) passed++;
+    print_test_result("Fleet Of 32 Devices Runs On 4 Threads", ran);
+    
+    bool storage_ok = ran && results.storage_mismatches == 0;
+    total++; if (storage_ok) passed++;
+    print_test_result("Per-Device Storage", storage_ok);
+    
+    bool clock_ok = ran && results.clock_mismatches == 0;
+    total++; if (clock_ok) passed++;
+    print_test_result("Per-Device Virtual Clock", clock_ok);
+    
+    // Same inputs give the same screen; different inputs a different one
+    bool screens_ok = ran;
+    for (uint32_t i = 2; screens_ok && i < FLEET_SIZE; i++) {
+        const uint8_t* reference = sim_device_get_framebuffer(devices[i % 2]);
+        uint8_t copy[FRAMEBUFFER_BYTES];
+        memcpy(copy, reference, sizeof(copy));
+        screens_ok = memcmp(copy, sim_device_get_framebuffer(devices[i]), sizeof(copy)) == 0;
+    }
+    if (screens_ok) {
+        uint8_t even[FRAMEBUFFER_BYTES];
+        memcpy(even, sim_device_get_framebuffer(devices[0]), sizeof(even));
+        screens_ok = memcmp(even, sim_device_get_framebuffer(devices[1]), sizeof(even)) != 0;
+    }
+    total++; if (screens_ok) passed++;
+    print_test_result("Per-Device Framebuffer And App State", screens_ok);
+    
+    // The process default device was never touched by the fleet
+    sim_device_bind(NULL);
+    MemoryPoolStats_t stats;
+    display_get_payload_pool_stats(&stats);
+    bool default_ok = stats.total_blocks == 0;
+    total++; if (default_ok) passed++;
+    print_test_result("Process Default State Untouched", default_ok);
+    
+    for (uint32_t i = 0; i < FLEET_SIZE; i++) {
+        sim_device_destroy(devices[i]);
+    }
+    
+    printf("\nTest Results: %d/%d passed (%.1f%%)\n",
+           passed, total, (float)passed / total * 100.0f);
+    
+    if (passed == total) {
+        printf("All tests PASSED! ✓\n");
+        return 0;
+    } else {
+        printf("Some tests FAILED! ✗\n");
+        return 1;
+    }
+}
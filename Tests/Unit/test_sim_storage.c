@@ -0,0 +1,178 @@
+// CKOS Simulator Flash Storage Tests
+// Tests for the flash model in BSP_Simulator/bsp_simulator_storage.c
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <unistd.h>
+#include "BSP/bsp_api.h"
+#include "Config/app_config.h"
+#include "sim_fixture.h"
+
+#define TEST_FLASH_FILE  "test_sim_storage.bin"
+
+static void print_test_result(const char* test_name, bool passed) {
+    printf("[%s] %s\n", passed ? "PASS" : "FAIL", test_name);
+}
+
+static int write_bytes(uint32_t address, const void* data, uint32_t length) {
+    bsp_storage_operation_t op = { address, (uint8_t*)data, length };
+    return bsp_storage_write(&op);
+}
+
+static int read_bytes(uint32_t address, void* data, uint32_t length) {
+    bsp_storage_operation_t op = { address, (uint8_t*)data, length };
+    return bsp_storage_read(&op);
+}
+
+static void* g_device;
+
+static void fresh_device(void) {
+    sim_fixture_blank_bsp(g_device);
+}
+
+// =============================================================================
+// PROGRAM/ERASE TESTS
+// =============================================================================
+
+bool test_blank_reads_erased(void) {
+    fresh_device();
+    uint8_t buf[16];
+    memset(buf, 0, sizeof(buf));
+    bool result = read_bytes(CONFIG_STORAGE_LOG_START_ADDR, buf, sizeof(buf)) == 0;
+    for (size_t i = 0; i < sizeof(buf); i++) {
+        result = result && buf[i] == 0xFF;
+    }
+    result = result && read_bytes(CONFIG_STORAGE_TOTAL_SIZE - 4, buf, 8) == -1;
+    print_test_result("Blank flash reads erased, out of range rejected", result);
+    return result;
+}
+
+bool test_erase_before_write(void) {
+    fresh_device();
+    uint32_t value = 0x12345678u;
+    uint32_t other = 0x0u;
+    bool result = write_bytes(0x10, &value, sizeof(value)) == 0;
+
+    // Same doubleword again, even the untouched half, needs an erase first
+    result = result && write_bytes(0x10, &other, sizeof(other)) == -1;
+    result = result && write_bytes(0x14, &other, sizeof(other)) == -1;
+    result = result && write_bytes(0x18, &other, sizeof(other)) == 0;
+
+    uint32_t readback = 0;
+    read_bytes(0x10, &readback, sizeof(readback));
+    result = result && readback == value;
+
+    bsp_sim_storage_stats_t stats;
+    bsp_sim_storage_get_stats(&stats);
+    result = result && stats.program_errors == 2 && stats.doublewords_programmed == 2;
+    print_test_result("Programmed doubleword rejected until erased", result);
+    return result;
+}
+
+bool test_page_erase_counts(void) {
+    fresh_device();
+    uint32_t value = 0xA5A5A5A5u;
+    bool result = write_bytes(CONFIG_STORAGE_LOG_START_ADDR, &value, sizeof(value)) == 0;
+    result = result && bsp_storage_erase(CONFIG_STORAGE_LOG_START_ADDR,
+                                         BSP_STORAGE_PAGE_SIZE) == 0;
+    result = result && write_bytes(CONFIG_STORAGE_LOG_START_ADDR, &value, sizeof(value)) == 0;
+    result = result && bsp_storage_erase(CONFIG_STORAGE_LOG_START_ADDR,
+                                         CONFIG_STORAGE_LOG_SIZE) == 0;
+
+    uint32_t log_page = CONFIG_STORAGE_LOG_START_ADDR / BSP_STORAGE_PAGE_SIZE;
+    result = result && bsp_sim_storage_get_page_erase_count(log_page) == 2;
+    result = result && bsp_sim_storage_get_page_erase_count(log_page + 1) == 1;
+    result = result && bsp_sim_storage_get_page_erase_count(0) == 0;
+
+    // Erase is page granular
+    result = result && bsp_storage_erase(CONFIG_STORAGE_LOG_START_ADDR + 8,
+                                         BSP_STORAGE_PAGE_SIZE) == -1;
+    result = result && bsp_storage_erase(0, 100) == -1;
+    print_test_result("Page erase counted per page, unaligned erase rejected", result);
+    return result;
+}
+
+// =============================================================================
+// TIMING AND PERSISTENCE TESTS
+// =============================================================================
+
+bool test_latency_advances_virtual_clock(void) {
+    fresh_device();
+    uint32_t start = bsp_get_tick_ms();
+
+    bool result = bsp_storage_erase(0, 2 * BSP_STORAGE_PAGE_SIZE) == 0;
+    uint8_t block[256];
+    memset(block, 0x42, sizeof(block));
+    result = result && write_bytes(0, block, sizeof(block)) == 0;
+
+    // 2 x 22 ms erase + 32 x 82 us program
+    bsp_sim_storage_stats_t stats;
+    bsp_sim_storage_get_stats(&stats);
+    result = result && stats.busy_us == 2 * 22000 + 32 * 82;
+    result = result && (bsp_get_tick_ms() - start) == 46;
+    print_test_result("Erase and program latency advance the virtual clock", result);
+    return result;
+}
+
+bool test_file_persists_contents_and_wear(void) {
+    unlink(TEST_FLASH_FILE);
+    fresh_device();
+    uint32_t value = 0xC0FFEE00u;
+    bool result = bsp_sim_storage_open(TEST_FLASH_FILE) == 0;
+    result = result && bsp_storage_erase(0, BSP_STORAGE_PAGE_SIZE) == 0;
+    result = result && write_bytes(0x20, &value, sizeof(value)) == 0;
+    bsp_sim_storage_close();
+
+    // A new device mapping the same file sees the data, wear and spent doubleword
+    fresh_device();
+    uint32_t readback = 0;
+    result = result && bsp_sim_storage_open(TEST_FLASH_FILE) == 0;
+    result = result && read_bytes(0x20, &readback, sizeof(readback)) == 0;
+    result = result && readback == value;
+    result = result && bsp_sim_storage_get_page_erase_count(0) == 1;
+    result = result && write_bytes(0x20, &value, sizeof(value)) == -1;
+    bsp_sim_storage_close();
+    unlink(TEST_FLASH_FILE);
+    print_test_result("Backing file keeps contents and erase counts", result);
+    return result;
+}
+
+int main(void) {
+    printf("CKOS Simulator Flash Storage Tests\n");
+    printf("==================================\n\n");
+
+    int passed = 0;
+    int total = 0;
+
+    g_device = calloc(1, bsp_sim_instance_size());
+    if (!g_device) return 1;
+
+    printf("Program/Erase Tests:\n");
+    total++; if (test_blank_reads_erased()) passed++;
+    total++; if (test_erase_before_write()) passed++;
+    total++; if (test_page_erase_counts()) passed++;
+    printf("\n");
+
+    printf("Timing and Persistence Tests:\n");
+    total++; if (test_latency_advances_virtual_clock()) passed++;
+    total++; if (test_file_persists_contents_and_wear()) passed++;
+    printf("\n");
+
+    bsp_sim_instance_release(g_device);
+    bsp_sim_instance_bind(NULL);
+    free(g_device);
+
+    printf("Test Results: %d/%d passed (%.1f%%)\n",
+           passed, total, (float)passed / total * 100.0f);
+
+    if (passed == total) {
+        printf("All tests PASSED! ✓\n");
+        return 0;
+    } else {
+        printf("Some tests FAILED! ✗\n");
+        return 1;
+    }
+}
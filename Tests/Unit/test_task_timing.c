@@ -0,0 +1,187 @@
+// CKOS Task Timing Tests
+// Tests for the 64-bit tick and the absolute-deadline task delays on the
+// simulator BSP's virtual clock
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include "BSP/bsp_api.h"
+#include "sim_fixture.h"
+
+#define PERIOD_MS       16          // ApplicationLogic_Task's period
+#define NOTIFY_BIT      (1u << 0)
+
+static void print_test_result(const char* test_name, bool passed) {
+    printf("[%s] %s\n", passed ? "PASS" : "FAIL", test_name);
+}
+
+static void* g_device;
+
+static void fresh_device(void) {
+    sim_fixture_blank_bsp(g_device);
+}
+
+// Moves the virtual clock to just before the 32-bit tick wraps
+static void run_to_wrap(uint32_t before_ms) {
+    uint64_t target = 0x100000000ull - before_ms;
+    while (bsp_get_tick_ms64() < target) {
+        uint64_t left = target - bsp_get_tick_ms64();
+        bsp_sim_clock_advance(left > 0x40000000u ? 0x40000000u : (uint32_t)left);
+    }
+}
+
+// =============================================================================
+// MONOTONIC TICK TESTS
+// =============================================================================
+
+bool test_tick_continues_past_32_bits(void) {
+    fresh_device();
+    uint64_t utc_start = bsp_get_utc_time_seconds();
+    run_to_wrap(10);
+
+    // The 32-bit tick is the low word and wraps; the 64-bit one carries on
+    bsp_sim_clock_advance(25);
+    uint64_t now = bsp_get_tick_ms64();
+    bool result = now == 0x100000000ull + 15;
+    result = result && bsp_get_tick_ms() == 15;
+
+    // UTC counts from the 64-bit tick, so it does not jump back 49.7 days
+    result = result && bsp_get_utc_time_seconds() - utc_start == now / 1000;
+    print_test_result("64-bit tick continues past the 32-bit wrap", result);
+    return result;
+}
+
+bool test_timers_fire_across_wrap(void) {
+    fresh_device();
+    bsp_task_handle_t self = bsp_task_get_current();
+    run_to_wrap(20);
+
+    // A deadline on the far side of the wrap is reached once, on time
+    bsp_timer_handle_t timer = bsp_timer_create_notify("Wrap", 40, false, self, NOTIFY_BIT);
+    bool result = timer && bsp_timer_start(timer);
+    uint64_t start = bsp_get_tick_ms64();
+    result = result && bsp_task_notify_wait_bits(NOTIFY_BIT, 100) == NOTIFY_BIT;
+    result = result && bsp_get_tick_ms64() - start == 40;
+    bsp_timer_delete(timer);
+    print_test_result("Timers fire across the 32-bit wrap", result);
+    return result;
+}
+
+// =============================================================================
+// PERIODIC DELAY TESTS
+// =============================================================================
+
+bool test_delay_until_holds_rate(void) {
+    fresh_device();
+    uint64_t start = bsp_get_tick_ms64();
+    uint64_t last_wake = start;
+
+    // The loop body takes a varying part of the period
+    for (uint32_t i = 0; i < 100; i++) {
+        bsp_delay_ms(i % 11);
+        bsp_task_delay_until(&last_wake, PERIOD_MS);
+    }
+    bool result = last_wake == start + 100 * PERIOD_MS;
+    result = result && bsp_get_tick_ms64() == last_wake;
+
+    // The same loop on relative delays runs late by the sum of its bodies
+    uint64_t relative_start = bsp_get_tick_ms64();
+    for (uint32_t i = 0; i < 100; i++) {
+        bsp_delay_ms(i % 11);
+        bsp_task_delay(PERIOD_MS);
+    }
+    uint64_t drift = bsp_get_tick_ms64() - relative_start - 100 * PERIOD_MS;
+    printf("  relative delays drifted %llu ms over 100 periods\n", (unsigned long long)drift);
+    result = result && drift > 0;
+    print_test_result("Delay until holds the rate under a busy loop", result);
+    return result;
+}
+
+bool test_delay_until_catches_up(void) {
+    fresh_device();
+    uint64_t start = bsp_get_tick_ms64();
+    uint64_t last_wake = start;
+
+    // Three periods late: the missed wakes return at once, then it blocks
+    bsp_delay_ms(3 * PERIOD_MS + 5);
+    uint64_t stalled = bsp_get_tick_ms64();
+    bool result = true;
+    for (uint32_t i = 1; i <= 3; i++) {
+        bsp_task_delay_until(&last_wake, PERIOD_MS);
+        result = result && bsp_get_tick_ms64() == stalled;
+        result = result && last_wake == start + i * PERIOD_MS;
+    }
+    bsp_task_delay_until(&last_wake, PERIOD_MS);
+    result = result && bsp_get_tick_ms64() == start + 4 * PERIOD_MS;
+    print_test_result("Delay until catches up after a stall", result);
+    return result;
+}
+
+bool test_notify_wait_until_keeps_period(void) {
+    fresh_device();
+    bsp_task_handle_t self = bsp_task_get_current();
+    uint64_t start = bsp_get_tick_ms64();
+    uint64_t last_wake = start;
+
+    // A pending notification returns at once and leaves the period alone
+    bsp_task_notify(self, NOTIFY_BIT);
+    bool result = bsp_task_notify_wait_until(NOTIFY_BIT, &last_wake, PERIOD_MS) == NOTIFY_BIT;
+    result = result && last_wake == start && bsp_get_tick_ms64() == start;
+
+    // Events every 5 ms wake the loop in between, the period still holds
+    bsp_timer_handle_t events = bsp_timer_create_notify("Events", 5, true, self, NOTIFY_BIT);
+    result = result && events && bsp_timer_start(events);
+    uint32_t periods = 0;
+    uint32_t wakes = 0;
+    while (bsp_get_tick_ms64() - start < 1000) {
+        uint64_t before = last_wake;
+        bsp_task_notify_wait_until(NOTIFY_BIT, &last_wake, PERIOD_MS);
+        wakes++;
+        if (last_wake != before) periods++;
+    }
+    bsp_timer_delete(events);
+    result = result && wakes > periods;
+    result = result && last_wake == start + periods * PERIOD_MS;
+    result = result && periods == 1000 / PERIOD_MS;
+    print_test_result("Notify wait until keeps the period through early wakes", result);
+    return result;
+}
+
+int main(void) {
+    printf("CKOS Task Timing Tests\n");
+    printf("======================\n\n");
+
+    int passed = 0;
+    int total = 0;
+
+    g_device = calloc(1, bsp_sim_instance_size());
+    if (!g_device) return 1;
+
+    printf("Monotonic Tick Tests:\n");
+    total++; if (test_tick_continues_past_32_bits()) passed++;
+    total++; if (test_timers_fire_across_wrap()) passed++;
+    printf("\n");
+
+    printf("Periodic Delay Tests:\n");
+    total++; if (test_delay_until_holds_rate()) passed++;
+    total++; if (test_delay_until_catches_up()) passed++;
+    total++; if (test_notify_wait_until_keeps_period()) passed++;
+    printf("\n");
+
+    bsp_sim_instance_release(g_device);
+    bsp_sim_instance_bind(NULL);
+    free(g_device);
+
+    printf("Test Results: %d/%d passed (%.1f%%)\n",
+           passed, total, (float)passed / total * 100.0f);
+
+    if (passed == total) {
+        printf("All tests PASSED! ✓\n");
+        return 0;
+    } else {
+        printf("Some tests FAILED! ✗\n");
+        return 1;
+    }
+}
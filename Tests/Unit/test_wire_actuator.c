@@ -0,0 +1,324 @@
+// CKOS Memory Wire Actuator Tests
+// Tests for the unlock sequence state machine on its own, and through the
+// hardware layer against the simulator's wire and latch model
+
+#include <stdio.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include "BSP/bsp_api.h"
+#include "Hardware/hardware_api.h"
+#include "Utils/wire_actuator.h"
+#include "sim_fixture.h"
+
+#define STEP_MS             CONFIG_MEMORY_WIRE_CONTROL_MS
+#define SEQUENCE_LIMIT_MS   60000u
+
+static void* g_bsp_state;
+static void* g_hardware_state;
+
+static void print_test_result(const char* test_name, bool passed) {
+    printf("[%s] %s\n", passed ? "PASS" : "FAIL", test_name);
+}
+
+static bool fresh_device(void) {
+    sim_fixture_blank_hardware(g_bsp_state, g_hardware_state);
+    return hardware_init() == 0;
+}
+
+// Steps the actuator every time it asks until it returns a result or the
+// limit passes; the clock is kept in *now_ms
+static WireActuatorResult_t run_actuator(WireActuator_t* actuator, const WireActuatorInputs_t* inputs,
+                                         uint32_t* now_ms, uint32_t limit_ms) {
+    uint32_t end = *now_ms + limit_ms;
+    while ((int32_t)(*now_ms - end) < 0) {
+        uint32_t next = wire_actuator_next_ms(actuator, *now_ms);
+        if (next == WIRE_ACTUATOR_NO_DEADLINE) break;
+        *now_ms += next ? next : 1;
+        WireActuatorResult_t result = wire_actuator_step(actuator, inputs, *now_ms);
+        if (result != WIRE_RESULT_NONE) return result;
+    }
+    return WIRE_RESULT_NONE;
+}
+
+// =============================================================================
+// STATE MACHINE TESTS
+// =============================================================================
+
+bool test_heats_to_setpoint_and_holds(void) {
+    WireActuator_t actuator;
+    wire_actuator_init(&actuator);
+    WireActuatorInputs_t inputs = { 2300, true, true };
+    uint32_t now = 1000;
+
+    bool result = wire_actuator_request(&actuator, 0, 0, &inputs, now) == 0;
+    result = result && actuator.state == WIRE_ACTUATOR_HEATING &&
+             wire_actuator_duty(&actuator) == WIRE_ACTUATOR_DUTY_MAX &&
+             wire_actuator_next_ms(&actuator, now) == STEP_MS;
+
+    // Full power to the setpoint, then held there without overshoot
+    int32_t setpoint = CONFIG_MEMORY_WIRE_TARGET_TEMP * 100;
+    int32_t peak = 0;
+    uint32_t reached_ms = 0;
+    while (actuator.state == WIRE_ACTUATOR_HEATING) {
+        now += wire_actuator_next_ms(&actuator, now);
+        wire_actuator_step(&actuator, &inputs, now);
+        if (actuator.estimate_cdeg > peak) peak = actuator.estimate_cdeg;
+        if (!reached_ms && actuator.estimate_cdeg >= setpoint - 100) reached_ms = now - 1000;
+    }
+    result = result && reached_ms > 0 && reached_ms < 1000;
+    result = result && peak < setpoint + 200;
+    result = result && actuator.estimate_cdeg > setpoint - 200;
+    result = result && now - 1000 == CONFIG_MEMORY_WIRE_HEAT_DURATION;
+    result = result && actuator.state == WIRE_ACTUATOR_MONITORING_LATCH &&
+             wire_actuator_duty(&actuator) == 0;
+    printf("  setpoint reached in %lu ms, peak %.2f C\n", (unsigned long)reached_ms, peak / 100.0);
+
+    // A second request while one runs is refused
+    result = result && wire_actuator_request(&actuator, 0, 0, &inputs, now) == -1;
+    print_test_result("Heats to the setpoint and holds it", result);
+    return result;
+}
+
+bool test_latch_release_then_door(void) {
+    WireActuator_t actuator;
+    wire_actuator_init(&actuator);
+    WireActuatorInputs_t inputs = { 2300, true, true };
+    uint32_t now = 0;
+
+    bool result = wire_actuator_request(&actuator, 0, 0, &inputs, now) == 0;
+    now += 300;
+    wire_actuator_step(&actuator, &inputs, now);
+    result = result && wire_actuator_is_heating(&actuator);
+
+    // The latch moving cuts the wire at once
+    inputs.latch_engaged = false;
+    now += STEP_MS;
+    result = result && wire_actuator_step(&actuator, &inputs, now) == WIRE_RESULT_NONE;
+    result = result && actuator.state == WIRE_ACTUATOR_MONITORING_EJECTOR &&
+             wire_actuator_duty(&actuator) == 0;
+
+    inputs.door_closed = false;
+    now += STEP_MS;
+    result = result && wire_actuator_step(&actuator, &inputs, now) == WIRE_RESULT_UNLOCKED;
+    result = result && actuator.stats.unlocks == 1 && actuator.stats.last_attempts == 1 &&
+             actuator.stats.last_latency_ms == 300 + 2 * STEP_MS;
+    // Full duty for the first 300 ms at least; nothing after the latch moved
+    result = result && actuator.stats.last_on_us >= 300000 &&
+             actuator.stats.last_on_us <= (300 + STEP_MS) * 1000;
+
+    // Cooldown before another sequence
+    result = result && actuator.state == WIRE_ACTUATOR_COOLDOWN &&
+             wire_actuator_next_ms(&actuator, now) == CONFIG_MEMORY_WIRE_COOLDOWN_MS;
+    result = result && wire_actuator_request(&actuator, 0, 0, &inputs, now) == -1;
+    now += CONFIG_MEMORY_WIRE_COOLDOWN_MS;
+    wire_actuator_step(&actuator, &inputs, now);
+    result = result && actuator.state == WIRE_ACTUATOR_IDLE &&
+             wire_actuator_next_ms(&actuator, now) == WIRE_ACTUATOR_NO_DEADLINE;
+    print_test_result("Latch release stops heating, door open unlocks", result);
+    return result;
+}
+
+bool test_retries_step_the_setpoint(void) {
+    WireActuator_t actuator;
+    wire_actuator_init(&actuator);
+    WireActuatorInputs_t inputs = { 2300, true, true };
+    uint32_t now = 0;
+
+    // The latch never moves: every attempt runs, each one hotter
+    bool result = wire_actuator_request(&actuator, 0, 0, &inputs, now) == 0;
+    int32_t setpoints[CONFIG_MEMORY_WIRE_MAX_ATTEMPTS] = {0};
+    WireActuatorResult_t outcome = WIRE_RESULT_NONE;
+    while (outcome == WIRE_RESULT_NONE && now < SEQUENCE_LIMIT_MS) {
+        if (actuator.attempt >= 1 && actuator.attempt <= CONFIG_MEMORY_WIRE_MAX_ATTEMPTS) {
+            setpoints[actuator.attempt - 1] = actuator.setpoint_cdeg;
+        }
+        outcome = run_actuator(&actuator, &inputs, &now, STEP_MS);
+    }
+    result = result && outcome == WIRE_RESULT_LATCH_FAILED;
+    result = result && actuator.stats.attempts == CONFIG_MEMORY_WIRE_MAX_ATTEMPTS &&
+             actuator.stats.latch_failures == 1;
+    for (int i = 0; i < CONFIG_MEMORY_WIRE_MAX_ATTEMPTS; i++) {
+        int32_t expected = (CONFIG_MEMORY_WIRE_TARGET_TEMP + i * CONFIG_MEMORY_WIRE_RETRY_STEP_TEMP) * 100;
+        if (expected > CONFIG_MEMORY_WIRE_MAX_TEMP * 100) expected = CONFIG_MEMORY_WIRE_MAX_TEMP * 100;
+        result = result && setpoints[i] == expected;
+    }
+    uint32_t expected_ms = CONFIG_MEMORY_WIRE_MAX_ATTEMPTS *
+                           (CONFIG_MEMORY_WIRE_HEAT_DURATION + CONFIG_MEMORY_WIRE_LATCH_SETTLE_MS) +
+                           (CONFIG_MEMORY_WIRE_MAX_ATTEMPTS - 1) * CONFIG_MEMORY_WIRE_RETRY_DELAY_MS;
+    result = result && actuator.stats.last_latency_ms == expected_ms;
+    print_test_result("Retries step the setpoint up to the ceiling", result);
+    return result;
+}
+
+bool test_blocked_and_aborted(void) {
+    WireActuator_t actuator;
+    wire_actuator_init(&actuator);
+    WireActuatorInputs_t inputs = { 2300, true, true };
+    uint32_t now = 0;
+
+    // Latch free but the door stays shut
+    wire_actuator_request(&actuator, 0, 0, &inputs, now);
+    inputs.latch_engaged = false;
+    bool result = run_actuator(&actuator, &inputs, &now, SEQUENCE_LIMIT_MS) == WIRE_RESULT_BLOCKED;
+    result = result && actuator.stats.blocked == 1 && wire_actuator_duty(&actuator) == 0;
+    result = result && actuator.stats.last_latency_ms == STEP_MS + CONFIG_MEMORY_WIRE_EJECTOR_MS;
+
+    // Over temperature ends the sequence with the wire off
+    now += CONFIG_MEMORY_WIRE_COOLDOWN_MS;
+    wire_actuator_step(&actuator, &inputs, now);
+    inputs.latch_engaged = true;
+    result = result && wire_actuator_request(&actuator, 0, 0, &inputs, now) == 0;
+    inputs.ambient_cdeg = CONFIG_TEMPERATURE_OVER_THRESHOLD_C * 100;
+    now += STEP_MS;
+    result = result && wire_actuator_step(&actuator, &inputs, now) == WIRE_RESULT_ABORTED;
+    result = result && actuator.stats.aborts == 1 && wire_actuator_duty(&actuator) == 0;
+    print_test_result("Blocked door and over temperature end the sequence", result);
+    return result;
+}
+
+// =============================================================================
+// SIMULATOR TESTS
+// =============================================================================
+
+typedef struct {
+    uint32_t events;
+    float peak_c;
+} sequence_run_t;
+
+// Runs the HardwareService side of the sequence the way the task does:
+// update, then block for hardware_lock_next_ms()
+static sequence_run_t run_hardware_sequence(void) {
+    sequence_run_t run = { 0, bsp_sim_wire_get_temperature() };
+    uint32_t elapsed = 0;
+    while (!run.events && elapsed < SEQUENCE_LIMIT_MS) {
+        run.events = hardware_lock_update();
+        float wire_c = bsp_sim_wire_get_temperature();
+        if (wire_c > run.peak_c) run.peak_c = wire_c;
+
+        uint32_t next = hardware_lock_next_ms();
+        if (run.events || next == BSP_WAIT_FOREVER) break;
+        bsp_sim_clock_advance(next ? next : 1);
+        elapsed += next ? next : 1;
+    }
+    return run;
+}
+
+bool test_unlock_across_ambient(void) {
+    static const float ambients[] = { 0.0f, 23.0f, 40.0f };
+    bsp_sim_energy_model_t model;
+    bsp_sim_energy_get_default_model(&model);
+    bool result = true;
+
+    printf("  ambient   latency   on-time   charge    peak\n");
+    for (size_t i = 0; i < sizeof(ambients) / sizeof(ambients[0]); i++) {
+        bool started = fresh_device();
+        result = result && started;
+        bsp_debug_set_sensor_value("temperature", ambients[i]);
+        bsp_sim_energy_reset();
+
+        result = result && hardware_lock_release() == 0;
+        result = result && hardware_power_get_insomnia() == 0;  // Taken by the task
+        sequence_run_t run = run_hardware_sequence();
+
+        WireActuatorStats_t stats;
+        hardware_lock_get_stats(&stats);
+        bsp_sim_energy_report_t report;
+        bsp_sim_energy_get_report(&report);
+        double wire_mah = report.charge_mah[BSP_SIM_ENERGY_MEMORY_WIRE];
+        double expected_mah = model.memory_wire_ua * (double)stats.last_on_us / 1000.0 / 3.6e9;
+        printf("  %5.1f C  %5lu ms  %5lu ms  %.4f mAh  %.1f C\n", ambients[i],
+               (unsigned long)stats.last_latency_ms, (unsigned long)(stats.last_on_us / 1000),
+               wire_mah, run.peak_c);
+
+        result = result && run.events == (HST_EVT_SRC_HLM | HST_EVT_UNLOCK_SUCCESS);
+        result = result && stats.last_attempts == 1 && stats.last_latency_ms < 1000;
+        result = result && wire_mah > expected_mah * 0.999 && wire_mah < expected_mah * 1.001;
+        result = result && run.peak_c < CONFIG_MEMORY_WIRE_TARGET_TEMP;
+        hardware_sensor_poll_events();      // Publishes the free latch
+        result = result && hardware_lock_get_state() == HARDWARE_LOCK_UNLOCKED;
+        result = result && hardware_power_get_insomnia() == 0;
+    }
+    print_test_result("Unlocks in one attempt at every ambient", result);
+    return result;
+}
+
+bool test_weak_wire_retries(void) {
+    bool result = fresh_device();
+    bsp_debug_set_sensor_value("wire_heat", 0.6f);
+
+    result = result && hardware_lock_release() == 0;
+    sequence_run_t run = run_hardware_sequence();
+    WireActuatorStats_t stats;
+    hardware_lock_get_stats(&stats);
+    printf("  unlocked after %lu attempts, %lu ms, peak %.1f C\n",
+           (unsigned long)stats.last_attempts, (unsigned long)stats.last_latency_ms, run.peak_c);
+
+    result = result && run.events == (HST_EVT_SRC_HLM | HST_EVT_UNLOCK_SUCCESS);
+    result = result && stats.last_attempts > 1;
+    result = result && run.peak_c < CONFIG_MEMORY_WIRE_MAX_TEMP;
+    print_test_result("A weak wire unlocks on a hotter retry", result);
+    return result;
+}
+
+bool test_blocked_door_reported(void) {
+    bool result = fresh_device();
+    bsp_debug_set_sensor_value("door_blocked", 1);
+
+    result = result && hardware_lock_release() == 0;
+    sequence_run_t run = run_hardware_sequence();
+    result = result && run.events == (HST_EVT_SRC_HLM | HST_EVT_UNLOCK_BLOCKED);
+    result = result && hardware_is_door_closed() && hardware_power_get_insomnia() == 0;
+
+    // No new sequence until the wire has cooled down
+    result = result && hardware_lock_release() == -1;
+    bsp_sim_clock_advance(hardware_lock_next_ms());
+    hardware_lock_update();
+    result = result && hardware_lock_next_ms() == BSP_WAIT_FOREVER;
+    result = result && hardware_lock_release() == 0;
+    print_test_result("Blocked door is reported and the wire cools down", result);
+    return result;
+}
+
+int main(void) {
+    printf("CKOS Wire Actuator Tests\n");
+    printf("========================\n\n");
+
+    int passed = 0;
+    int total = 0;
+
+    g_bsp_state = calloc(1, bsp_sim_instance_size());
+    g_hardware_state = calloc(1, hardware_instance_size());
+    if (!g_bsp_state || !g_hardware_state) return 1;
+
+    printf("State Machine Tests:\n");
+    total++; if (test_heats_to_setpoint_and_holds()) passed++;
+    total++; if (test_latch_release_then_door()) passed++;
+    total++; if (test_retries_step_the_setpoint()) passed++;
+    total++; if (test_blocked_and_aborted()) passed++;
+    printf("\n");
+
+    printf("Simulator Tests:\n");
+    total++; if (test_unlock_across_ambient()) passed++;
+    total++; if (test_weak_wire_retries()) passed++;
+    total++; if (test_blocked_door_reported()) passed++;
+    printf("\n");
+
+    bsp_sim_instance_release(g_bsp_state);
+    bsp_sim_instance_bind(NULL);
+    hardware_instance_bind(NULL);
+    free(g_bsp_state);
+    free(g_hardware_state);
+
+    printf("Test Results: %d/%d passed (%.1f%%)\n",
+           passed, total, (float)passed / total * 100.0f);
+
+    if (passed == total) {
+        printf("All tests PASSED! ✓\n");
+        return 0;
+    } else {
+        printf("Some tests FAILED! ✗\n");
+        return 1;
+    }
+}
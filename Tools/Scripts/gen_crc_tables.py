@@ -0,0 +1,68 @@
+#!/usr/bin/env python3
+"""Generate the slice-by-8 lookup tables for the software CRCs in App/Utils/utils.c.
+
+Both CRCs are MSB first (not reflected), matching the STM32 CRC unit:
+  CRC-16/CCITT-FALSE  polynomial 0x1021
+  CRC-32/MPEG-2       polynomial 0x04C11DB7
+
+Table k holds the CRC contribution of a byte followed by k zero bytes.
+
+Usage: python3 Tools/Scripts/gen_crc_tables.py > App/Utils/utils_crc_tables.h
+"""
+
+SLICES = 8
+
+
+def byte_table(poly, width):
+    top = 1 << (width - 1)
+    mask = (1 << width) - 1
+    table = []
+    for n in range(256):
+        crc = n << (width - 8)
+        for _ in range(8):
+            crc = ((crc << 1) ^ poly) if crc & top else (crc << 1)
+        table.append(crc & mask)
+    return table
+
+
+def slice_tables(poly, width):
+    mask = (1 << width) - 1
+    tables = [byte_table(poly, width)]
+    for _ in range(1, SLICES):
+        prev = tables[-1]
+        tables.append([((v << 8) ^ tables[0][v >> (width - 8)]) & mask for v in prev])
+    return tables
+
+
+def emit(name, ctype, digits, tables):
+    lines = [f"static const {ctype} {name}[{SLICES}][256] = {{"]
+    for table in tables:
+        lines.append("    {")
+        for row in range(0, 256, 8):
+            values = ", ".join(f"0x{v:0{digits}X}" for v in table[row:row + 8])
+            lines.append(f"        {values},")
+        lines.append("    },")
+    lines.append("};")
+    return "\n".join(lines)
+
+
+def main():
+    print("// CKOS CRC Lookup Tables")
+    print("// Generated by Tools/Scripts/gen_crc_tables.py - do not edit")
+    print()
+    print("#ifndef UTILS_CRC_TABLES_H")
+    print("#define UTILS_CRC_TABLES_H")
+    print()
+    print("#include <stdint.h>")
+    print()
+    print("// CRC-16/CCITT-FALSE, polynomial 0x1021")
+    print(emit("crc16_slice_table", "uint16_t", 4, slice_tables(0x1021, 16)))
+    print()
+    print("// CRC-32/MPEG-2, polynomial 0x04C11DB7")
+    print(emit("crc32_slice_table", "uint32_t", 8, slice_tables(0x04C11DB7, 32)))
+    print()
+    print("#endif // UTILS_CRC_TABLES_H")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,402 @@
+#!/usr/bin/env python3
+"""Generate the agent dialog tables, selection index and compressed text for App/AppLogic/agent_dialog.c.
+
+Reads the corpus in Assets_Src/Dialogs/dialogs.txt (format described at the
+top of that file) and the context and option lists from
+App/AppLogic/agent_dialog.h, and emits per agent:
+
+  <agent>_entries    DialogEntry_t per corpus line, mood bounds 255 = don't care
+  <agent>_ids        entry numbers of each context, context after context
+  <agent>_prefix     running priority sums over those, restarting per context
+  <agent>_bucket_of  mood bucket of each whole point 0-100, per dimension
+  <agent>_bits       per context, per dimension bucket, a bitset of the
+                     context's entries whose range covers that bucket
+
+A dimension's buckets are the stretches of 0-100 between the points where
+some entry's range starts or ends, so every level in a bucket is matched by
+the same entries and the bitsets are exact.
+
+All text, entries and options, is stored once per distinct string in one
+canonical Huffman code over the whole corpus, a terminating symbol 0 after
+each string, bits most significant first. An entry's text is the bit
+offset its code starts at. The code is limited to DIALOG_TEXT_CODE_BITS
+and checked by decoding every string back. Each agent's table is headed
+by its text size as C strings and compressed.
+
+--synthetic SIZES emits random corpora of the given sizes instead, one
+"agent" each, for Tests/Unit/bench_dialog.c.
+
+Usage: python3 Tools/Scripts/gen_dialog_tables.py > App/AppLogic/agent_dialog_tables.h
+       python3 Tools/Scripts/gen_dialog_tables.py --synthetic 64,256,1024,4096 --name bench_dialog_tables
+"""
+
+import argparse
+import heapq
+import os
+import random
+import re
+import sys
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "..")
+CORPUS = os.path.join(ROOT, "Assets_Src", "Dialogs", "dialogs.txt")
+HEADER = os.path.join(ROOT, "App", "AppLogic", "agent_dialog.h")
+
+AGENTS = ["rookie", "veteran", "warden"]    # AgentPersonality order
+DIMENSIONS = 4                              # affection, strictness, patience, trust
+LEVELS = 101
+ANY = 255
+CODE_BITS = 15                              # DIALOG_TEXT_CODE_BITS
+END = 0                                     # Ends each string
+
+
+def fail(where, message):
+    sys.exit(f"{where}: {message}")
+
+
+def read_list(path, macro):
+    with open(path) as f:
+        text = f.read()
+    block = re.search(r"#define " + macro + r"\(X\)((?:.*\\\n)*.*)", text)
+    if not block:
+        fail(path, f"no {macro}")
+    return re.findall(r"X\((\w+)\)", block.group(1))
+
+
+def read_contexts(path):
+    contexts = read_list(path, "DIALOG_CONTEXT_LIST")
+    if not 0 < len(contexts) <= 16:
+        fail(path, "context_flags holds 1-16 contexts")
+    return contexts
+
+
+def check_text(where, text):
+    # Printable ASCII is what the display font has; no backslashes, as the
+    # text is repeated in comments
+    if not text or any(not 32 <= ord(c) <= 126 or c == "\\" for c in text):
+        fail(where, "text must be printable ASCII without backslashes")
+
+
+def parse_range(where, field):
+    if field == "*":
+        return ANY, ANY
+    match = re.fullmatch(r"(\d+)-(\d+)", field)
+    if not match:
+        fail(where, f"bad mood range '{field}'")
+    lo, hi = int(match.group(1)), int(match.group(2))
+    if not lo <= hi <= 100:
+        fail(where, f"mood range '{field}' outside 0-100")
+    return lo, hi
+
+
+def read_corpus(path, contexts, option_names):
+    entries = {agent: [] for agent in AGENTS}
+    options = {}
+    with open(path) as f:
+        for number, line in enumerate(f, 1):
+            line = line.strip()
+            if not line or line.startswith("#"):
+                continue
+            where = f"{path}:{number}"
+            if line.split("|", 1)[0].strip() == "option":
+                fields = [field.strip() for field in line.split("|", 2)]
+                if len(fields) != 3 or fields[1] not in option_names:
+                    fail(where, "expected option | DIALOG_OPTION_LIST name | text")
+                if fields[1] in options:
+                    fail(where, f"option '{fields[1]}' given twice")
+                check_text(where, fields[2])
+                options[fields[1]] = fields[2]
+                continue
+            fields = [field.strip() for field in line.split("|", 7)]
+            if len(fields) != 8:
+                fail(where, "expected 8 fields")
+            agent, names, moods, priority, text = fields[0], fields[1], fields[2:6], fields[6], fields[7]
+            if agent != "any" and agent not in AGENTS:
+                fail(where, f"unknown agent '{agent}'")
+            flags = 0
+            for name in names.split(","):
+                if name.strip() not in contexts:
+                    fail(where, f"unknown context '{name.strip()}'")
+                flags |= 1 << contexts.index(name.strip())
+            ranges = [parse_range(where, field) for field in moods]
+            if not priority.isdigit() or not 1 <= int(priority) <= 255:
+                fail(where, "priority must be 1-255")
+            check_text(where, text)
+            for target in (AGENTS if agent == "any" else [agent]):
+                entries[target].append({
+                    "lo": [lo for lo, _ in ranges],
+                    "hi": [hi for _, hi in ranges],
+                    "flags": flags,
+                    "priority": int(priority),
+                    "text": text,
+                })
+    missing = [name for name in option_names if name not in options]
+    if missing:
+        fail(path, f"no text for options {', '.join(missing)}")
+    return entries, [options[name] for name in option_names]
+
+
+def synthetic_corpus(size, contexts):
+    rng = random.Random(size)
+    entries = []
+    for i in range(size):
+        flags = 0
+        for _ in range(1 + (rng.random() < 0.3)):
+            flags |= 1 << rng.randrange(len(contexts))
+        lo, hi = [], []
+        for _ in range(DIMENSIONS):
+            if rng.random() < 0.5:
+                lo.append(ANY)
+                hi.append(ANY)
+            else:
+                low = 5 * rng.randint(0, 16)
+                lo.append(low)
+                hi.append(min(100, low + 5 * rng.randint(4, 12)))
+        entries.append({"lo": lo, "hi": hi, "flags": flags,
+                        "priority": rng.randint(1, 20), "text": f"Synthetic line {i + 1}"})
+    return entries
+
+
+def admits(entry, d, level):
+    return ((entry["lo"][d] == ANY or level >= entry["lo"][d]) and
+            (entry["hi"][d] == ANY or level <= entry["hi"][d]))
+
+
+def build_index(entries, context_count):
+    # Buckets start at 0 and wherever a range starts or ends
+    bucket_of, starts = [], []
+    for d in range(DIMENSIONS):
+        cuts = {0}
+        for entry in entries:
+            if entry["lo"][d] != ANY:
+                cuts.add(entry["lo"][d])
+            if entry["hi"][d] != ANY and entry["hi"][d] < 100:
+                cuts.add(entry["hi"][d] + 1)
+        cuts = sorted(cuts)
+        starts.append(cuts)
+        bucket_of.append([sum(1 for cut in cuts if cut <= level) - 1 for level in range(LEVELS)])
+    bucket_base = [sum(len(starts[e]) for e in range(d)) for d in range(DIMENSIONS)]
+    buckets = sum(len(cuts) for cuts in starts)
+
+    ids, prefix, bits, contexts = [], [], [], []
+    for c in range(context_count):
+        members = [i for i, entry in enumerate(entries) if entry["flags"] & (1 << c)]
+        words = (len(members) + 31) // 32
+        contexts.append((len(ids), len(members), words, len(bits)))
+        total = 0
+        for i in members:
+            total += entries[i]["priority"]
+            ids.append(i)
+            prefix.append(total)
+        for d in range(DIMENSIONS):
+            for level in starts[d]:
+                row = [0] * words
+                for j, i in enumerate(members):
+                    if admits(entries[i], d, level):
+                        row[j // 32] |= 1 << (j % 32)
+                bits.extend(row)
+    assert len(bits) == sum(count * buckets for _, _, count, _ in contexts)
+    return {"ids": ids, "prefix": prefix, "bits": bits, "contexts": contexts,
+            "bucket_of": bucket_of, "bucket_base": bucket_base}
+
+
+def code_lengths(weights):
+    # Huffman, ties broken by symbol so the output is reproducible
+    heap = [(weight, symbol, [symbol]) for symbol, weight in sorted(weights.items())]
+    heapq.heapify(heap)
+    lengths = dict.fromkeys(weights, 0)
+    while len(heap) > 1:
+        w1, s1, group1 = heapq.heappop(heap)
+        w2, s2, group2 = heapq.heappop(heap)
+        for symbol in group1 + group2:
+            lengths[symbol] += 1
+        heapq.heappush(heap, (w1 + w2, min(s1, s2), group1 + group2))
+    return lengths
+
+
+def build_text(strings):
+    weights = {END: len(strings)}
+    for text in strings:
+        for c in text:
+            weights[ord(c)] = weights.get(ord(c), 0) + 1
+    lengths = code_lengths(weights)
+    if max(lengths.values()) > CODE_BITS:
+        fail("text", f"a Huffman code is longer than {CODE_BITS} bits")
+
+    # Canonical: shorter codes first, by symbol within a length
+    symbols = sorted(lengths, key=lambda symbol: (lengths[symbol], symbol))
+    codes, code, length = {}, 0, lengths[symbols[0]]
+    for symbol in symbols:
+        code <<= lengths[symbol] - length
+        length = lengths[symbol]
+        codes[symbol] = (code, length)
+        code += 1
+
+    bits, offsets = [], {}
+    for text in strings:
+        offsets[text] = len(bits)
+        for symbol in [ord(c) for c in text] + [END]:
+            value, length = codes[symbol]
+            bits.extend((value >> (length - 1 - i)) & 1 for i in range(length))
+    data = [int("".join(map(str, bits[i:i + 8])).ljust(8, "0"), 2) for i in range(0, len(bits), 8)]
+    count = [0] * (CODE_BITS + 1)
+    for symbol in symbols:
+        count[lengths[symbol]] += 1
+    store = {"count": count, "symbols": symbols, "data": data, "offsets": offsets, "codes": codes}
+
+    for text in strings:
+        if decode(store, offsets[text]) != text:
+            fail("text", f"'{text}' does not decode back")
+    return store
+
+
+def decode(store, position):
+    # As agent_dialog.c does it
+    out = []
+    while True:
+        code = first = index = 0
+        for length in range(1, CODE_BITS + 1):
+            code |= (store["data"][position >> 3] >> (7 - (position & 7))) & 1
+            position += 1
+            count = store["count"][length]
+            if code - count < first:
+                symbol = store["symbols"][index + code - first]
+                break
+            index += count
+            first = (first + count) << 1
+            code <<= 1
+        if symbol == END:
+            return "".join(out)
+        out.append(chr(symbol))
+
+
+def text_bits(store, text):
+    return sum(store["codes"][symbol][1] for symbol in [ord(c) for c in text] + [END])
+
+
+def emit_text(prefix, store, options):
+    plain = sum(len(text) + 1 for text in store["offsets"])
+    tables = 2 * (CODE_BITS + 1) + len(store["symbols"])
+    out = [f"// Text: {len(store['offsets'])} distinct strings, {plain} bytes as C strings, "
+           f"{len(store['data'])} compressed + {tables} of code ({100.0 * (len(store['data']) + tables) / plain:.1f}%),",
+           f"// canonical Huffman over {len(store['symbols'])} symbols"]
+    out.append(f"static const uint16_t {prefix}_code_count[DIALOG_TEXT_CODE_BITS + 1] = {{")
+    out.append("    " + ", ".join(str(v) for v in store["count"]) + ",")
+    out.append("};")
+    out.append("")
+    out.append(emit_values(f"{prefix}_code_symbol", "uint8_t", store["symbols"], 16, str))
+    out.append("")
+    out.append(emit_values(f"{prefix}_text", "uint8_t", store["data"], 16, lambda v: f"0x{v:02X}"))
+    if options is not None:
+        out.append("")
+        out.append(f"static const DialogText {prefix}_options[DIALOG_OPTION_COUNT] = {{")
+        for text in options:
+            out.append(f"    {store['offsets'][text]},    // {text}")
+        out.append("};")
+    return "\n".join(out)
+
+
+def emit_values(name, ctype, values, per_line, fmt):
+    values = values or [0]    # C has no empty arrays
+    lines = [f"static const {ctype} {name}[{len(values)}] = {{"]
+    for row in range(0, len(values), per_line):
+        lines.append("    " + ", ".join(fmt(v) for v in values[row:row + per_line]) + ",")
+    lines.append("};")
+    return "\n".join(lines)
+
+
+def emit_agent(agent, entries, context_names, store):
+    index = build_index(entries, len(context_names))
+    out = []
+    index_bytes = (2 * len(index["ids"]) + 4 * len(index["prefix"]) + 4 * len(index["bits"]) +
+                   DIMENSIONS * LEVELS + 10 * len(context_names))
+    plain = sum(len(entry["text"]) + 1 for entry in entries)
+    packed = (sum(text_bits(store, entry["text"]) for entry in entries) + 7) // 8
+    out.append(f"// {agent}: {len(entries)} entries, {index_bytes} bytes of index, text {plain} bytes "
+               f"as C strings, {packed} compressed ({100.0 * packed / max(plain, 1):.1f}%)")
+    out.append(f"static const DialogEntry_t {agent}_entries[{max(len(entries), 1)}] = {{")
+    for number, entry in enumerate(entries, 1):
+        lo = ", ".join(f"{v:3d}" for v in entry["lo"])
+        hi = ", ".join(f"{v:3d}" for v in entry["hi"])
+        out.append(f"    {{ {number}, {{ {lo} }}, {{ {hi} }}, 0x{entry['flags']:04X}, "
+                   f"{entry['priority']}, {store['offsets'][entry['text']]} }},    // {entry['text']}")
+    if not entries:
+        out.append("    { 0 },")
+    out.append("};")
+    out.append("")
+    out.append(emit_values(f"{agent}_ids", "uint16_t", index["ids"], 16, str))
+    out.append("")
+    out.append(emit_values(f"{agent}_prefix", "uint32_t", index["prefix"], 12, str))
+    out.append("")
+    out.append(emit_values(f"{agent}_bits", "uint32_t", index["bits"], 6, lambda v: f"0x{v:08X}"))
+    out.append("")
+    out.append(f"static const uint8_t {agent}_bucket_of[AGENT_MOOD_DIMENSION_COUNT][DIALOG_MOOD_LEVELS] = {{")
+    for row in index["bucket_of"]:
+        out.append("    {")
+        for start in range(0, LEVELS, 20):
+            out.append("        " + ", ".join(str(v) for v in row[start:start + 20]) + ",")
+        out.append("    },")
+    out.append("};")
+    out.append("")
+    out.append(f"static const DialogContextIndex_t {agent}_contexts[DIALOG_CONTEXT_COUNT] = {{")
+    for name, (first, count, words, offset) in zip(context_names, index["contexts"]):
+        out.append(f"    {{ {first}, {count}, {words}, {offset} }},    // {name}")
+    out.append("};")
+    out.append("")
+    base = ", ".join(str(v) for v in index["bucket_base"])
+    out.append(f"static const DialogIndex_t {agent}_dialogs = {{")
+    out.append(f"    {agent}_entries, {len(entries)}, {agent}_ids, {agent}_prefix, {agent}_contexts,")
+    out.append(f"    {agent}_bucket_of, {{ {base} }}, {agent}_bits,")
+    out.append("};")
+    return "\n".join(out)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--synthetic", help="comma separated corpus sizes")
+    parser.add_argument("--name", default="agent_dialog_tables", help="name of the table list")
+    args = parser.parse_args()
+
+    contexts = read_contexts(HEADER)
+    if args.synthetic:
+        corpora = [(f"synthetic_{size}", synthetic_corpus(int(size), contexts))
+                   for size in args.synthetic.split(",")]
+        options = None
+        source = f"synthetic corpora of {args.synthetic} entries"
+    else:
+        entries, options = read_corpus(CORPUS, contexts, read_list(HEADER, "DIALOG_OPTION_LIST"))
+        corpora = [(agent, entries[agent]) for agent in AGENTS]
+        source = "Assets_Src/Dialogs/dialogs.txt"
+
+    strings = []
+    for text in [entry["text"] for _, entries in corpora for entry in entries] + (options or []):
+        if text not in strings:
+            strings.append(text)
+    store = build_text(strings)
+    prefix = args.name[:-len("_tables")] if args.name.endswith("_tables") else args.name
+
+    guard = args.name.upper() + "_H"
+    print("// CKOS Agent Dialog Tables")
+    print("// Generated by Tools/Scripts/gen_dialog_tables.py - do not edit")
+    print(f"// Source: {source}")
+    print("// Included by agent_dialog.c after agent_dialog.h")
+    print()
+    print(f"#ifndef {guard}")
+    print(f"#define {guard}")
+    print()
+    for agent, entries in corpora:
+        print(emit_agent(agent, entries, contexts, store))
+        print()
+    print(emit_text(prefix, store, options))
+    print()
+    print(f"#define {args.name.upper()}_COUNT {len(corpora)}")
+    print()
+    print(f"static const DialogIndex_t* const {args.name}[{len(corpora)}] = {{")
+    for agent, _ in corpora:
+        print(f"    &{agent}_dialogs,")
+    print("};")
+    print()
+    print(f"#endif // {guard}")
+
+
+if __name__ == "__main__":
+    main()